@@ -5,11 +5,16 @@
 #include <cstdlib>
 #include<memory>
 #include<mutex>
+#include<thread>
+#include<future>
+#include<deque>
+#include<condition_variable>
 #include<string>
 #include<limits>
 #include<functional>
 #include<optional>
 #include<unordered_set>
+#include<map>
 #include<algorithm>
 #include<filesystem>
 #include<fstream>
@@ -17,6 +22,33 @@
 #include<array>
 #include<cstddef>
 #include <chrono>
+#include<charconv>
+#include<numeric>
+#include<cctype>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && 2 <= _M_IX86_FP)
+#include <immintrin.h>
+#define SIMD_SSE_ENABLE
+#endif
+
+#if defined(__AVX__)
+#define SIMD_AVX_ENABLE
+#endif
+
+#if defined(__AVX2__)
+#define SIMD_AVX2_ENABLE
+#endif
 
 #include "vulkan/vulkan.h"
 
@@ -29,6 +61,8 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/gtc/quaternion.hpp>
 #include <glm/gtx/hash.hpp>
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -67,12 +101,72 @@ constexpr int HEIGHT{ 600 };
 
 constexpr int MAX_FRAMES_IN_FLIGHT = 2;
 
+//NOTE : Coarsest LOD Whose Geometric Error Projects Below This Many Pixels Is Drawn
+constexpr float Lod_Pixel_Threshold{ 1.0f };
+
+//NOTE : Shared Geometry Buffers Start At Least This Large, So Meshes Loaded Later Fit Without Growing Them
+constexpr uint32_t Geometry_Pool_Min_Vertices{ 1 << 18 };
+constexpr uint32_t Geometry_Pool_Min_Indices{ 1 << 20 };
+
+//NOTE : Cull And Build Draws In A Compute Pass When The Device And Compiled Shaders Allow It
+constexpr bool Gpu_Culling_Enable{ true };
+
+//NOTE : CPU Path Only, The Nearest Visible Objects Are Rasterized In Software And Occlude The Rest Before Any Draw Is Recorded
+constexpr bool Software_Occlusion_Enable{ true };
+constexpr uint32_t Software_Occluder_Count{ 8 };
+
+//NOTE : Two Phase Depth Pyramid Occlusion On Top Of GPU Culling, Needs A Multisampled Depth Attachment That Can Be Sampled
+constexpr bool Occlusion_Culling_Enable{ true };
+
+//NOTE : Frustum Only GPU Culling Goes Down To Meshlets Of LOD 0, Each Visible Front Facing Cluster Becomes Its Own Indirect Draw
+constexpr bool Cluster_Culling_Enable{ true };
+
+//NOTE : With VK_EXT_mesh_shader Clusters Surviving The Cull Are Drawn By A Mesh Shader Instead, No Index Buffer Involved
+constexpr bool Mesh_Shader_Enable{ true };
+
+//NOTE : Render Straight Into Image Views When VK_KHR_dynamic_rendering Is There, A Resize Then Rebuilds No Render Pass Or Framebuffer
+constexpr bool Dynamic_Rendering_Enable{ true };
+
+//NOTE : Compile The Scene Pipeline As VK_EXT_graphics_pipeline_library Parts And Fast Link Them, The Optimized Link Follows In The Background
+constexpr bool Pipeline_Library_Enable{ true };
+
+//NOTE : Set Material State Through VK_EXT_extended_dynamic_state 1, 2 And 3 As Far As The Device Goes, The Rest Stays Baked
+constexpr bool Extended_Dynamic_State_Enable{ true };
+
+//NOTE : Remember What Each Command Buffer Has Bound And Drop Binds, Pushes And Dynamic State That Would Not Change It
+constexpr bool Draw_State_Cache_Enable{ true };
+
+//NOTE : Material Textures Are One Sampler Array Indexed In The Fragment Shader, Never More Slots Than This Whatever The Device Allows
+constexpr uint32_t Max_Material_Textures{ 1024 };
+
 const constexpr char* validationLayers{ "VK_LAYER_KHRONOS_validation" };
 
 const constexpr char* Device_EXT_SwapChain{ VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+const constexpr char* Device_EXT_Synchronization2{ VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME };
+const constexpr char* Device_EXT_Dynamic_Rendering{ VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME };
+const constexpr char* Device_EXT_Pipeline_Library{ VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME };
+const constexpr char* Device_EXT_Graphics_Pipeline_Library{ VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME };
+const constexpr char* Device_EXT_Extended_Dynamic_State{ VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME };
+const constexpr char* Device_EXT_Extended_Dynamic_State2{ VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME };
+const constexpr char* Device_EXT_Extended_Dynamic_State3{ VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME };
+const constexpr char* Device_EXT_Mesh_Shader{ VK_EXT_MESH_SHADER_EXTENSION_NAME };
 
 const constexpr char* Vertex_Shader_File_Path{ "shaders/vshader.spv" };
+const constexpr char* Compact_Vertex_Shader_File_Path{ "shaders/vshader_compact.spv" };
+const constexpr char* Compact_Normal_Vertex_Shader_File_Path{ "shaders/vshader_compact_normal.spv" };
+const constexpr char* Instanced_Vertex_Shader_File_Path{ "shaders/vshader_compact_instanced.spv" };
+const constexpr char* Pull_Vertex_Shader_File_Path{ "shaders/vshader_pull.spv" };
+const constexpr char* Pull_Instanced_Vertex_Shader_File_Path{ "shaders/vshader_pull_instanced.spv" };
+const constexpr char* Meshlet_Mesh_Shader_File_Path{ "shaders/meshlet.spv" };
 const constexpr char* Fragment_Shader_File_Path{ "shaders/fshader.spv" };
+const constexpr char* Nonuniform_Fragment_Shader_File_Path{ "shaders/fshader_nonuniform.spv" };
+const constexpr char* Cull_Compute_Shader_File_Path{ "shaders/cull.spv" };
+const constexpr char* Cull_Occlusion_Compute_Shader_File_Path{ "shaders/cull_occlusion.spv" };
+const constexpr char* Cull_Cluster_Compute_Shader_File_Path{ "shaders/cull_cluster.spv" };
+const constexpr char* Cull_Cluster_Mesh_Compute_Shader_File_Path{ "shaders/cull_cluster_mesh.spv" };
+const constexpr char* Depth_Pyramid_Copy_Shader_File_Path{ "shaders/depth_pyramid_copy.spv" };
+const constexpr char* Depth_Pyramid_Reduce_Shader_File_Path{ "shaders/depth_pyramid_reduce.spv" };
+const constexpr char* Pipeline_Cache_File_Path{ "shaders/pipeline.cache" };
 
 const constexpr char* Texture_Image_Path{ "textures/texture.jpg" };
 
@@ -84,59 +178,273 @@ struct Vertex final {
 	glm::vec3 Pos;
 	glm::vec3 Color;
 	glm::vec2 TexCoord;
+	glm::vec3 Normal;
+
+	bool operator==(const Vertex& Other) const {
+		return Pos == Other.Pos && Color == Other.Color && TexCoord == Other.TexCoord && Normal == Other.Normal;
+	}
+};
+
+namespace std {
+	template<>
+	struct hash<Vertex> {
+		size_t operator()(Vertex const& Vertex) const {
+			return ((((hash<glm::vec3>()(Vertex.Pos) ^ (hash<glm::vec3>()(Vertex.Color) << 1)) >> 1) ^ (hash<glm::vec2>()(Vertex.TexCoord) << 1)) >> 1) ^ (hash<glm::vec3>()(Vertex.Normal) << 1);
+		}
+	};
+}
+
+struct Mesh_Bounds final {
+	glm::vec3 Min{ numeric_limits<float>::max() };
+	glm::vec3 Max{ numeric_limits<float>::lowest() };
+
+	void Expand(const glm::vec3& Point) {
+		this->Min = glm::min(this->Min, Point);
+		this->Max = glm::max(this->Max, Point);
+	}
+
+	const glm::vec3 Get_Center(void) const {
+		return (this->Min + this->Max) * 0.5f;
+	}
+
+	const float Get_Radius(void) const {
+		return glm::length(this->Max - this->Min) * 0.5f;
+	}
+
+	const glm::vec3 Get_Extent(void) const {
+		//NOTE : Flat Axis Must Not Divide By Zero When Quantizing
+		return glm::max(this->Max - this->Min, glm::vec3{ numeric_limits<float>::epsilon() });
+	}
+};
+
+enum Vertex_Attribute : uint32_t {
+	Vertex_Attribute_Position = 1 << 0,
+	Vertex_Attribute_Color = 1 << 1,
+	Vertex_Attribute_TexCoord = 1 << 2,
+	Vertex_Attribute_Normal = 1 << 3,
+};
+
+//NOTE : Push Constants Of The Vertex Pulling Shaders, Stride And Offsets Count 32 Bit Words Since Every Attribute Size Is A Multiple Of 4
+struct Vertex_Pull_Constants final {
+	static constexpr uint32_t Absent{ numeric_limits<uint32_t>::max() };
+
+	uint32_t Stride{ 0 };
+	uint32_t Position_Offset{ Absent };
+	uint32_t Color_Offset{ Absent };
+	uint32_t TexCoord_Offset{ Absent };
+	uint32_t Quantized{ 0 };
+};
+
+//NOTE : Shader Location Of Each Attribute Is Fixed, So Every Shader Variant Agrees With Every Layout
+struct Vertex_Layout final {
+	uint32_t Attributes{ Vertex_Attribute_Position | Vertex_Attribute_Color | Vertex_Attribute_TexCoord };
+	bool Quantized{ false };
+
+	bool Has(Vertex_Attribute Attribute) const {
+		return 0 != (this->Attributes & Attribute);
+	}
+
+	static const uint32_t Get_Location(Vertex_Attribute Attribute) {
+		switch (Attribute) {
+		case Vertex_Attribute_Position: return 0;
+		case Vertex_Attribute_Color: return 1;
+		case Vertex_Attribute_TexCoord: return 2;
+		case Vertex_Attribute_Normal: return 3;
+		default: throw invalid_argument("Unknown vertex attribute!");
+		}
+	}
+
+	//NOTE : Quantized Position Is UNORM Relative To Mesh AABB, Normal Is Always Octahedral Encoded
+	const VkFormat Get_Format(Vertex_Attribute Attribute) const {
+		switch (Attribute) {
+		case Vertex_Attribute_Position: return this->Quantized ? VK_FORMAT_R16G16B16A16_UNORM : VK_FORMAT_R32G32B32_SFLOAT;
+		case Vertex_Attribute_Color: return this->Quantized ? VK_FORMAT_R8G8B8A8_UNORM : VK_FORMAT_R32G32B32_SFLOAT;
+		case Vertex_Attribute_TexCoord: return this->Quantized ? VK_FORMAT_R16G16_SFLOAT : VK_FORMAT_R32G32_SFLOAT;
+		case Vertex_Attribute_Normal: return this->Quantized ? VK_FORMAT_R16G16_SNORM : VK_FORMAT_R32G32_SFLOAT;
+		default: throw invalid_argument("Unknown vertex attribute!");
+		}
+	}
+
+	const uint32_t Get_Size(Vertex_Attribute Attribute) const {
+		switch (Attribute) {
+		case Vertex_Attribute_Position: return this->Quantized ? 8 : 12;
+		case Vertex_Attribute_Color: return this->Quantized ? 4 : 12;
+		case Vertex_Attribute_TexCoord: return this->Quantized ? 4 : 8;
+		case Vertex_Attribute_Normal: return this->Quantized ? 4 : 8;
+		default: throw invalid_argument("Unknown vertex attribute!");
+		}
+	}
+
+	const uint32_t Get_Offset(Vertex_Attribute Attribute) const {
+		uint32_t Offset{ 0 };
+		for (const auto& Other : All_Attributes) {
+			if (Other == Attribute)
+				return Offset;
+			if (this->Has(Other))
+				Offset += this->Get_Size(Other);
+		}
+		return Offset;
+	}
+
+	const uint32_t Get_Stride(void) const {
+		uint32_t Stride{ 0 };
+		for (const auto& Attribute : All_Attributes)
+			if (this->Has(Attribute))
+				Stride += this->Get_Size(Attribute);
+		return Stride;
+	}
 
-	static const VkVertexInputBindingDescription Get_Binding_Description(void) {
+	const VkVertexInputBindingDescription Get_Binding_Description(void) const {
 		VkVertexInputBindingDescription Binding_Description{};
 		{
 			Binding_Description.binding = 0;
-			Binding_Description.stride = sizeof(Vertex);
+			Binding_Description.stride = this->Get_Stride();
 			Binding_Description.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
 		}
 
 		return Binding_Description;
 	}
 
-	static const std::array<VkVertexInputAttributeDescription, 3> Get_Attribute_Descriptions(void) {
-		std::array<VkVertexInputAttributeDescription, 3> Attribute_Descriptions{};
-		{
+	const vector<VkVertexInputAttributeDescription> Get_Attribute_Descriptions(void) const {
+		vector<VkVertexInputAttributeDescription> Attribute_Descriptions{};
+		for (const auto& Attribute : All_Attributes) {
+			if (!this->Has(Attribute))
+				continue;
+
+			VkVertexInputAttributeDescription Attribute_Description{};
 			{
-				Attribute_Descriptions[0].binding = 0;
-				Attribute_Descriptions[0].location = 0;
-				Attribute_Descriptions[0].format = VK_FORMAT_R32G32B32_SFLOAT;
-				Attribute_Descriptions[0].offset = offsetof(Vertex, Pos);
+				Attribute_Description.binding = 0;
+				Attribute_Description.location = Vertex_Layout::Get_Location(Attribute);
+				Attribute_Description.format = this->Get_Format(Attribute);
+				Attribute_Description.offset = this->Get_Offset(Attribute);
 			}
+			Attribute_Descriptions.emplace_back(Attribute_Description);
+		}
 
-			{
-				Attribute_Descriptions[1].binding = 0;
-				Attribute_Descriptions[1].location = 1;
-				Attribute_Descriptions[1].format = VK_FORMAT_R32G32B32_SFLOAT;
-				Attribute_Descriptions[1].offset = offsetof(Vertex, Color);
+		return Attribute_Descriptions;
+	}
+
+	//NOTE : Shader Variant Only Depends On Which Inputs Exist, Quantized Formats Are Expanded To Float By The Input Assembler
+	const char* Get_Vertex_Shader_File_Path(void) const {
+		switch (this->Attributes) {
+		case Vertex_Attribute_Position | Vertex_Attribute_Color | Vertex_Attribute_TexCoord: return Vertex_Shader_File_Path;
+		case Vertex_Attribute_Position | Vertex_Attribute_TexCoord: return Compact_Vertex_Shader_File_Path;
+		case Vertex_Attribute_Position | Vertex_Attribute_TexCoord | Vertex_Attribute_Normal: return Compact_Normal_Vertex_Shader_File_Path;
+		default: throw runtime_error("Unsupported vertex layout!");
+		}
+	}
+
+	//NOTE : Pulled Vertices Carry The Layout Per Draw Instead, So Meshes Of Different Layouts Share One Pipeline
+	const Vertex_Pull_Constants Get_Pull_Constants(void) const {
+		const auto Get_Word_Offset = [this](Vertex_Attribute Attribute) {
+			return this->Has(Attribute) ? this->Get_Offset(Attribute) / static_cast<uint32_t>(sizeof(uint32_t)) : Vertex_Pull_Constants::Absent;
+		};
+
+		Vertex_Pull_Constants Constants{};
+		{
+			Constants.Stride = this->Get_Stride() / static_cast<uint32_t>(sizeof(uint32_t));
+			Constants.Position_Offset = Get_Word_Offset(Vertex_Attribute_Position);
+			Constants.Color_Offset = Get_Word_Offset(Vertex_Attribute_Color);
+			Constants.TexCoord_Offset = Get_Word_Offset(Vertex_Attribute_TexCoord);
+			Constants.Quantized = this->Quantized ? 1 : 0;
+		}
+
+		return Constants;
+	}
+
+	//NOTE : Only The Compact Layout Has A Variant Reading Per Instance Transforms, Others Return Nullptr
+	const char* Get_Instanced_Vertex_Shader_File_Path(void) const {
+		if ((Vertex_Attribute_Position | Vertex_Attribute_TexCoord) == this->Attributes)
+			return Instanced_Vertex_Shader_File_Path;
+
+		return nullptr;
+	}
+
+	//NOTE : Map The Quantized [0,1] Position Back Into Model Space, Folded Into The Model Matrix
+	const glm::mat4 Get_Position_Dequantize(const Mesh_Bounds& Bounds) const {
+		if (!this->Quantized)
+			return glm::mat4{ 1.0f };
+
+		return glm::scale(glm::translate(glm::mat4{ 1.0f }, Bounds.Min), Bounds.Get_Extent());
+	}
+
+	void Encode(const vector<Vertex>& Vertices, const Mesh_Bounds& Bounds, vector<uint8_t>& Encoded) const {
+		const uint32_t Stride{ this->Get_Stride() };
+		Encoded.resize(static_cast<size_t>(Stride) * Vertices.size());
+
+		const glm::vec3 Inverse_Extent{ 1.0f / Bounds.Get_Extent() };
+
+		for (size_t Index = 0; Index < Vertices.size(); ++Index) {
+			uint8_t* Destination{ Encoded.data() + Index * Stride };
+			const Vertex& Source{ Vertices[Index] };
+
+			if (this->Has(Vertex_Attribute_Position)) {
+				if (this->Quantized) {
+					const uint64_t Packed{ glm::packUnorm4x16(glm::vec4{ (Source.Pos - Bounds.Min) * Inverse_Extent, 1.0f }) };
+					memcpy(Destination, &Packed, sizeof(Packed));
+				}
+				else
+					memcpy(Destination, &Source.Pos, sizeof(Source.Pos));
+				Destination += this->Get_Size(Vertex_Attribute_Position);
 			}
 
-			{
-				Attribute_Descriptions[2].binding = 0;
-				Attribute_Descriptions[2].location = 2;
-				Attribute_Descriptions[2].format = VK_FORMAT_R32G32_SFLOAT;
-				Attribute_Descriptions[2].offset = offsetof(Vertex, TexCoord);
+			if (this->Has(Vertex_Attribute_Color)) {
+				if (this->Quantized) {
+					const uint32_t Packed{ glm::packUnorm4x8(glm::vec4{ Source.Color, 1.0f }) };
+					memcpy(Destination, &Packed, sizeof(Packed));
+				}
+				else
+					memcpy(Destination, &Source.Color, sizeof(Source.Color));
+				Destination += this->Get_Size(Vertex_Attribute_Color);
 			}
-		}
 
-		return Attribute_Descriptions;
+			if (this->Has(Vertex_Attribute_TexCoord)) {
+				if (this->Quantized) {
+					const uint32_t Packed{ glm::packHalf2x16(Source.TexCoord) };
+					memcpy(Destination, &Packed, sizeof(Packed));
+				}
+				else
+					memcpy(Destination, &Source.TexCoord, sizeof(Source.TexCoord));
+				Destination += this->Get_Size(Vertex_Attribute_TexCoord);
+			}
+
+			if (this->Has(Vertex_Attribute_Normal)) {
+				const glm::vec2 Octahedral{ Vertex_Layout::Encode_Octahedral(Source.Normal) };
+				if (this->Quantized) {
+					const uint32_t Packed{ glm::packSnorm2x16(Octahedral) };
+					memcpy(Destination, &Packed, sizeof(Packed));
+				}
+				else
+					memcpy(Destination, &Octahedral, sizeof(Octahedral));
+				Destination += this->Get_Size(Vertex_Attribute_Normal);
+			}
+		}
 	}
 
-	bool operator==(const Vertex& Other) const {
-		return Pos == Other.Pos && Color == Other.Color && TexCoord == Other.TexCoord;
+	static const glm::vec2 Encode_Octahedral(const glm::vec3& Normal) {
+		const float Length{ glm::abs(Normal.x) + glm::abs(Normal.y) + glm::abs(Normal.z) };
+		if (0.0f == Length)
+			return glm::vec2{ 0.0f };
+
+		const glm::vec3 Projected{ Normal / Length };
+		if (Projected.z >= 0.0f)
+			return glm::vec2{ Projected.x, Projected.y };
+
+		//NOTE : Fold The Lower Hemisphere Over The Diagonals
+		return glm::vec2{
+			(1.0f - glm::abs(Projected.y)) * (Projected.x >= 0.0f ? 1.0f : -1.0f),
+			(1.0f - glm::abs(Projected.x)) * (Projected.y >= 0.0f ? 1.0f : -1.0f)
+		};
 	}
+
+	static constexpr Vertex_Attribute All_Attributes[]{ Vertex_Attribute_Position, Vertex_Attribute_Color, Vertex_Attribute_TexCoord, Vertex_Attribute_Normal };
 };
 
-namespace std {
-	template<>
-	struct hash<Vertex> {
-		size_t operator()(Vertex const& Vertex) const {
-			return ((hash<glm::vec3>()(Vertex.Pos) ^ (hash<glm::vec3>()(Vertex.Color) << 1)) >> 1) ^ (hash<glm::vec2>()(Vertex.TexCoord) << 1);
-		}
-	};
-}
+//NOTE : Color Is Always White In Load_Model And Normal Is Not Shaded Yet, So Only Position And TexCoord Reach The GPU
+constexpr uint32_t Vertex_Attribute_Mask{ Vertex_Attribute_Position | Vertex_Attribute_TexCoord };
+constexpr bool Vertex_Quantization_Enable{ true };
+//NOTE : Fetch Vertices From A Storage Buffer In The Vertex Shader Instead Of The Input Assembler, Off Because Fixed Function Fetch Is Usually As Fast, See The vertex_pulling Benchmark
+constexpr bool Vertex_Pulling_Enable{ false };
 
 struct Uniform_Buffer_Object {
 	alignas(16) glm::mat4 Model;
@@ -161,2151 +469,11755 @@ static const std::vector<char> Read_File(const std::filesystem::path& File_Path)
 	return Buffer;
 }
 
-class VK_Application final {
-private:
-	struct Queue_Family_Indices final {
-		uint32_t Graphics_Family;
-		uint32_t Present_Family;
-	};
+struct Vertex_Cache_Statistics final {
+	//NOTE : Average Cache Miss Ratio, Transformed Vertices Per Triangle
+	float ACMR{ 0.0f };
+	//NOTE : Average Transformed Vertex Ratio, Transformed Vertices Per Unique Vertex
+	float ATVR{ 0.0f };
+};
 
-	struct Swap_Chain_Support_Details final {
-		VkSurfaceCapabilitiesKHR Capabilities{};
-		vector<VkSurfaceFormatKHR> Formats{};
-		vector<VkPresentModeKHR> Present_Modes{};
-	};
+struct Mesh_Cache_Header final {
+	uint32_t Magic{ 0x4853454D };
+	uint32_t Version{ 5 };
+	uint64_t Source_Size{ 0 };
+	int64_t Source_Time{ 0 };
+	//NOTE : Sizes Of The Mesh_Codec Vertex And Index Streams Following The Header
+	uint64_t Vertex_Bytes{ 0 };
+	uint64_t Index_Bytes{ 0 };
+	uint32_t Attributes{ 0 };
+	uint32_t Vertex_Count{ 0 };
+	uint32_t Index_Count{ 0 };
+	uint32_t Lod_Count{ 0 };
+	uint32_t Material_Count{ 0 };
+	Vertex_Cache_Statistics Before{};
+	Vertex_Cache_Statistics After{};
+};
 
-public:
-#ifdef _DEBUG
-	vector<const char*> m_Validation_Layer_List{};
+//NOTE : Lossless Codec For The Mesh Cache, Each Word Stream Is Delta And Zigzag Coded, Then Every Block Of 16 Is Split Into Four Byte Planes Stored At 0, 2, 4 Or 8 Bits Per Byte
+struct Mesh_Codec final {
+	static constexpr size_t Block_Size{ 16 };
+	//NOTE : Header Byte Plus Four Raw Planes, The Most One Block Of One Stream Can Take
+	static constexpr size_t Max_Block_Bytes{ 1 + 4 * Block_Size };
+
+	//NOTE : Elements Are Stride Words Apart And Word N Of Every Element Forms Stream N, Blocks Of All Streams Are Interleaved So Decoding Writes Whole Elements
+	static void Encode(const uint32_t* Words, size_t Count, size_t Stride, vector<uint8_t>& Output) {
+		vector<uint32_t> Previous(Stride, 0);
+
+		for (size_t Base = 0; Base < Count; Base += Block_Size) {
+			for (size_t Stream = 0; Stream < Stride; ++Stream) {
+				array<uint8_t, Block_Size> Planes[4]{};
+				for (size_t Element = 0; Element < Block_Size; ++Element) {
+					//NOTE : The Tail Of The Last Block Repeats The Last Word, So Its Deltas Are Zero
+					const uint32_t Word{ Base + Element < Count ? Words[(Base + Element) * Stride + Stream] : Previous[Stream] };
+					const uint32_t Delta{ Word - Previous[Stream] };
+					const uint32_t Zigzag{ (Delta << 1) ^ static_cast<uint32_t>(static_cast<int32_t>(Delta) >> 31) };
+					Previous[Stream] = Word;
+
+					for (size_t Plane = 0; Plane < 4; ++Plane)
+						Planes[Plane][Element] = static_cast<uint8_t>(Zigzag >> (8 * Plane));
+				}
 
-	VkDebugUtilsMessengerEXT m_Debug_Messenger{};
+				const size_t Header{ Output.size() };
+				Output.push_back(0);
+				for (uint32_t Plane = 0; Plane < 4; ++Plane) {
+					const uint8_t Max_Byte{ *std::max_element(Planes[Plane].begin(), Planes[Plane].end()) };
+					const uint32_t Mode{ 0 == Max_Byte ? 0u : (Max_Byte < 4 ? 1u : (Max_Byte < 16 ? 2u : 3u)) };
+					Output[Header] |= static_cast<uint8_t>(Mode << (2 * Plane));
+					Mesh_Codec::Pack_Plane(Planes[Plane].data(), Mode, Output);
+				}
+			}
+		}
+	}
 
-	VkDebugUtilsMessengerCreateInfoEXT m_VkDebugUtilsMessengerCreateInfoEXT{};
+	static const bool Decode(const uint8_t* Data, size_t Size, uint32_t* Words, size_t Count, size_t Stride) {
+#if defined(SIMD_SSE_ENABLE)
+		return Mesh_Codec::Decode_SSE(Data, Size, Words, Count, Stride);
+#else
+		return Mesh_Codec::Decode_Scalar(Data, Size, Words, Count, Stride);
+#endif
+	}
 
-	//TODO : TO Static Function
-	bool Check_Vaildation_Layer_Support(void) {
-		uint32_t Layer_Count;
-		THROW_IF_VK_FAILED(vkEnumerateInstanceLayerProperties(&Layer_Count, nullptr));
+	static const bool Decode_Scalar(const uint8_t* Data, size_t Size, uint32_t* Words, size_t Count, size_t Stride) {
+		const uint8_t* At{ Data };
+		const uint8_t* const End{ Data + Size };
+		vector<uint32_t> Previous(Stride, 0);
 
-		vector<VkLayerProperties> Available_Layers;
-		Available_Layers.resize(Layer_Count);
-		THROW_IF_VK_FAILED(vkEnumerateInstanceLayerProperties(&Layer_Count, Available_Layers.data()));
+		for (size_t Base = 0; Base < Count; Base += Block_Size) {
+			const size_t Element_Count{ std::min(Block_Size, Count - Base) };
 
-		for (const auto& Layer_Name : this->m_Validation_Layer_List) {
-			bool layer_Is_Found = false;
+			for (size_t Stream = 0; Stream < Stride; ++Stream) {
+				if (At >= End)
+					return false;
 
-			for (const auto& Layer_Propery : Available_Layers)
-				if (string{ Layer_Name } == string{ Layer_Propery.layerName }) {
-					layer_Is_Found = true;
-					break;
+				const uint8_t Header{ *At++ };
+				uint32_t Values[Block_Size]{};
+				for (uint32_t Plane = 0; Plane < 4; ++Plane) {
+					uint8_t Bytes[Block_Size]{};
+					if (!Mesh_Codec::Unpack_Plane(At, End, Header >> (2 * Plane) & 3, Bytes))
+						return false;
+
+					for (size_t Element = 0; Element < Block_Size; ++Element)
+						Values[Element] |= static_cast<uint32_t>(Bytes[Element]) << (8 * Plane);
 				}
-			if (!layer_Is_Found)
-				return false;
+
+				for (size_t Element = 0; Element < Element_Count; ++Element) {
+					Previous[Stream] += (Values[Element] >> 1) ^ (0u - (Values[Element] & 1));
+					Words[(Base + Element) * Stride + Stream] = Previous[Stream];
+				}
+			}
 		}
 
-		return true;
+		return At == End;
 	}
 
-	static VKAPI_ATTR VkBool32 VKAPI_CALL Debug_Callback(VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity, VkDebugUtilsMessageTypeFlagsEXT messageType, const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData, void* pUserData) {
-		cerr << "Validation layer: " << pCallbackData->pMessage << endl;
+#if defined(SIMD_SSE_ENABLE)
+	//NOTE : A Block Of One Stream Is Four Registers Of Planes, Transposed Into Words By Unpacking, Then Prefix Summed Within Lanes
+	static const bool Decode_SSE(const uint8_t* Data, size_t Size, uint32_t* Words, size_t Count, size_t Stride) {
+		const uint8_t* At{ Data };
+		const uint8_t* const End{ Data + Size };
+		vector<uint32_t> Previous(Stride, 0);
+		alignas(16) uint32_t Block[Block_Size]{};
+
+		for (size_t Base = 0; Base < Count; Base += Block_Size) {
+			const size_t Element_Count{ std::min(Block_Size, Count - Base) };
+
+			for (size_t Stream = 0; Stream < Stride; ++Stream) {
+				if (At >= End)
+					return false;
+
+				const uint8_t Header{ *At++ };
+				__m128i Planes[4]{};
+				for (uint32_t Plane = 0; Plane < 4; ++Plane)
+					if (!Mesh_Codec::Unpack_Plane_SSE(At, End, Header >> (2 * Plane) & 3, Planes[Plane]))
+						return false;
+
+				const __m128i Low_Pairs{ _mm_unpacklo_epi8(Planes[0], Planes[1]) };
+				const __m128i High_Pairs{ _mm_unpackhi_epi8(Planes[0], Planes[1]) };
+				const __m128i Low_Upper_Pairs{ _mm_unpacklo_epi8(Planes[2], Planes[3]) };
+				const __m128i High_Upper_Pairs{ _mm_unpackhi_epi8(Planes[2], Planes[3]) };
+				__m128i Values[4]{
+					_mm_unpacklo_epi16(Low_Pairs, Low_Upper_Pairs),
+					_mm_unpackhi_epi16(Low_Pairs, Low_Upper_Pairs),
+					_mm_unpacklo_epi16(High_Pairs, High_Upper_Pairs),
+					_mm_unpackhi_epi16(High_Pairs, High_Upper_Pairs),
+				};
 
-		//NOTE : This Return Common Is VK_FALSE, We Should Not  Debug Failedtaion Layer Just it's Warning
-		return VK_FALSE;
-	}
+				//NOTE : The Running Sum Stays In A Register Across The Block, Only Its Last Word Is Carried To The Next Block Of The Stream
+				const __m128i One{ _mm_set1_epi32(1) };
+				__m128i Carry{ _mm_set1_epi32(static_cast<int>(Previous[Stream])) };
+				for (auto& Value : Values) {
+					Value = _mm_xor_si128(_mm_srli_epi32(Value, 1), _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(Value, One)));
+					Value = _mm_add_epi32(Value, _mm_slli_si128(Value, 4));
+					Value = _mm_add_epi32(Value, _mm_slli_si128(Value, 8));
+					Value = _mm_add_epi32(Value, Carry);
+					Carry = _mm_shuffle_epi32(Value, _MM_SHUFFLE(3, 3, 3, 3));
+				}
+				Previous[Stream] = static_cast<uint32_t>(_mm_cvtsi128_si32(Carry));
 
-	const void Build_Debug_Messenger_Create_Info(void) {
-		this->m_VkDebugUtilsMessengerCreateInfoEXT.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
+				//NOTE : Single Streams Are Stored Straight, Interleaved Words Go Through The Block Buffer
+				if (1 == Stride && Block_Size == Element_Count) {
+					for (size_t Quad = 0; Quad < 4; ++Quad)
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(Words + Base + Quad * 4), Values[Quad]);
+					continue;
+				}
 
-		this->m_VkDebugUtilsMessengerCreateInfoEXT.messageSeverity =
-			//VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT |
-			VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT |
-			VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT |
-			VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+				for (size_t Quad = 0; Quad < 4; ++Quad)
+					_mm_store_si128(reinterpret_cast<__m128i*>(Block + Quad * 4), Values[Quad]);
+				for (size_t Element = 0; Element < Element_Count; ++Element)
+					Words[(Base + Element) * Stride + Stream] = Block[Element];
+			}
+		}
 
-		this->m_VkDebugUtilsMessengerCreateInfoEXT.messageType =
-			VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT |
-			VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT |
-			VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
+		return At == End;
+	}
+#endif
 
-		this->m_VkDebugUtilsMessengerCreateInfoEXT.pfnUserCallback = VK_Application::Debug_Callback;
+	//NOTE : Vertices Are Coded As Their Raw Float Bits, Neighbours After Vertex Fetch Optimization Share Sign And Exponent So High Planes Mostly Vanish
+	static const vector<uint8_t> Encode_Vertices(const vector<Vertex>& Vertices) {
+		vector<uint32_t> Words(Vertices.size() * Vertex_Words);
+		if (!Vertices.empty())
+			memcpy(Words.data(), Vertices.data(), Words.size() * sizeof(uint32_t));
 
-		this->m_VkDebugUtilsMessengerCreateInfoEXT.pUserData = nullptr;
+		vector<uint8_t> Output{};
+		Mesh_Codec::Encode(Words.data(), Vertices.size(), Vertex_Words, Output);
+		return Output;
 	}
 
-	static const VkResult Create_DebugUtils_Messenger_EXT(VkInstance Instance, const VkDebugUtilsMessengerCreateInfoEXT* Create_Info, const VkAllocationCallbacks* Allocator, VkDebugUtilsMessengerEXT* m_Debug_Messenger) {
-		auto Func = reinterpret_cast<PFN_vkCreateDebugUtilsMessengerEXT>(vkGetInstanceProcAddr(Instance, "vkCreateDebugUtilsMessengerEXT"));
-		if (nullptr != Func)
-			return Func(Instance, Create_Info, Allocator, m_Debug_Messenger);
-		else
-			return VK_ERROR_EXTENSION_NOT_PRESENT;
-	}
+	static const bool Decode_Vertices(const uint8_t* Data, size_t Size, vector<Vertex>& Vertices) {
+		vector<uint32_t> Words(Vertices.size() * Vertex_Words);
+		if (!Mesh_Codec::Decode(Data, Size, Words.data(), Vertices.size(), Vertex_Words))
+			return false;
 
-	static void Destroy_DebugUtils_Messenger_EXT(VkInstance Instance, VkDebugUtilsMessengerEXT m_Debug_Messenger, const VkAllocationCallbacks* Allocator) {
-		auto Func = reinterpret_cast<PFN_vkDestroyDebugUtilsMessengerEXT>(vkGetInstanceProcAddr(Instance, "vkDestroyDebugUtilsMessengerEXT"));
-		if (nullptr != Func)
-			Func(Instance, m_Debug_Messenger, Allocator);
+		if (!Vertices.empty())
+			memcpy(Vertices.data(), Words.data(), Words.size() * sizeof(uint32_t));
+		return true;
 	}
 
-	void Set_Debug_Messenger() {
-		THROW_IF_VK_FAILED(VK_Application::Create_DebugUtils_Messenger_EXT(
-			this->m_VK_Instance.get(),
-			&this->m_VkDebugUtilsMessengerCreateInfoEXT,
-			nullptr,
-			&this->m_Debug_Messenger)
-		);
+	//NOTE : Cache Optimized Triangles Reuse Recent Vertices, Each Corner Is Coded Against The Same Corner Of The Previous Triangle
+	static const vector<uint8_t> Encode_Indices(const vector<uint32_t>& Indices) {
+		const size_t Stride{ Mesh_Codec::Get_Index_Stride(Indices.size()) };
+
+		vector<uint8_t> Output{};
+		Mesh_Codec::Encode(Indices.data(), Indices.size() / Stride, Stride, Output);
+		return Output;
 	}
-#endif // _DEBUG
 
-public:
-	VK_Application(void) = default;
+	static const bool Decode_Indices(const uint8_t* Data, size_t Size, vector<uint32_t>& Indices) {
+		const size_t Stride{ Mesh_Codec::Get_Index_Stride(Indices.size()) };
+		return Mesh_Codec::Decode(Data, Size, Indices.data(), Indices.size() / Stride, Stride);
+	}
 
-	~VK_Application(void) {
-		this->CleanUp();
+	//NOTE : Every Block Of Every Stream Takes Between Its Header Byte And Max_Block_Bytes, So A Count From Disk Can Be Checked Before Anything Is Allocated
+	static const bool Is_Vertex_Size_Valid(size_t Vertex_Count, uint64_t Size) {
+		return Mesh_Codec::Is_Size_Valid(Vertex_Count, Vertex_Words, Size);
 	}
 
-	void Run(void) {
-		this->Initialize();
-		this->Main_Loop();
+	static const bool Is_Index_Size_Valid(size_t Index_Count, uint64_t Size) {
+		const size_t Stride{ Mesh_Codec::Get_Index_Stride(Index_Count) };
+		return Mesh_Codec::Is_Size_Valid(Index_Count / Stride, Stride, Size);
 	}
 
 private:
-	void Initialize(void) {
-		Init_Window();
-		Init_Vulkan();
-	}
+	static constexpr size_t Vertex_Words{ sizeof(Vertex) / sizeof(uint32_t) };
 
-	void Init_Window(void) {
-		static std::once_flag Initialized_GLWF_Flag{};
+	static const size_t Get_Index_Stride(size_t Count) {
+		return 0 == Count % 3 ? 3 : 1;
+	}
 
-		std::call_once(Initialized_GLWF_Flag, VK_Application::Initialize_GLWF);
+	static const bool Is_Size_Valid(size_t Count, size_t Stride, uint64_t Size) {
+		const uint64_t Stream_Blocks{ (static_cast<uint64_t>(Count) + Block_Size - 1) / Block_Size * Stride };
+		return Stream_Blocks <= Size && Size / Max_Block_Bytes <= Stream_Blocks;
+	}
 
-		GLFWwindow* window{ glfwCreateWindow(WIDTH, HEIGHT, "Vulkan", nullptr, nullptr) };
-		if (nullptr == window)
-			throw std::runtime_error("Failed to create GLFW window");
-		this->m_Window.reset(window);
+	//NOTE : Mode 0 Stores Nothing, 1 Four Bytes Per Output Byte, 2 Two, 3 The Bytes Themselves
+	static void Pack_Plane(const uint8_t* Bytes, uint32_t Mode, vector<uint8_t>& Output) {
+		if (0 == Mode)
+			return;
+		if (3 == Mode) {
+			Output.insert(Output.end(), Bytes, Bytes + Block_Size);
+			return;
+		}
 
-		glfwSetWindowUserPointer(this->m_Window.get(), this);
-		glfwSetFramebufferSizeCallback(this->m_Window.get(), VK_Application::Frame_Buffer_Resize_CallBack);
+		const uint32_t Bits{ 1 == Mode ? 2u : 4u };
+		const uint32_t Per_Byte{ 8 / Bits };
+		for (size_t Element = 0; Element < Block_Size; Element += Per_Byte) {
+			uint8_t Packed{ 0 };
+			for (uint32_t Slot = 0; Slot < Per_Byte; ++Slot)
+				Packed |= static_cast<uint8_t>(Bytes[Element + Slot] << (Slot * Bits));
+			Output.push_back(Packed);
+		}
 	}
 
-	void Init_Vulkan(void) {
-#ifdef _DEBUG
-		this->Build_Debug_Messenger_Create_Info();
-#endif // _DEBUG
+	static const size_t Get_Plane_Bytes(uint32_t Mode) {
+		return 0 == Mode ? 0 : (1 == Mode ? Block_Size / 4 : (2 == Mode ? Block_Size / 2 : Block_Size));
+	}
 
-		this->Create_Instance();
+	static const bool Unpack_Plane(const uint8_t*& At, const uint8_t* End, uint32_t Mode, uint8_t* Bytes) {
+		const size_t Plane_Bytes{ Mesh_Codec::Get_Plane_Bytes(Mode) };
+		if (static_cast<size_t>(End - At) < Plane_Bytes)
+			return false;
 
-#ifdef _DEBUG
-		this->Set_Debug_Messenger();
-#endif // _DEBUG
+		if (3 == Mode)
+			memcpy(Bytes, At, Block_Size);
+		else if (0 != Mode) {
+			const uint32_t Bits{ 1 == Mode ? 2u : 4u };
+			const uint32_t Per_Byte{ 8 / Bits };
+			for (size_t Element = 0; Element < Block_Size; ++Element)
+				Bytes[Element] = static_cast<uint8_t>(At[Element / Per_Byte] >> (Element % Per_Byte * Bits) & ((1u << Bits) - 1));
+		}
 
-		this->Create_Surface();
-		this->Pick_Physical_Device();
-		this->Create_Logical_Device();
-		this->Create_SwapChain();
-		this->Create_SwapChhain_Image_Views();
-		this->Create_Render_Pass();
-		this->Create_Descriptor_Set_Layout();
-		this->Create_GraphicsPipeline();
-		this->Create_Command_Pool();
-		this->Create_Color_Resource();
-		this->Create_Depth_Resource();
-		this->Create_Frame_Buffers();
-		this->Create_Texture_Image();
-		this->Create_Texture_Image_View();
-		this->Create_Texture_Sampler();
-		this->Load_Model();
-		this->Create_Vertex_Buffer();
-		this->Create_Index_Buffer();
-		this->Create_Uniform_Buffers();
-		this->Create_Descriptor_Pool();
-		this->Create_Descriptor_Sets();
-		this->Create_Command_Buffers();
-		this->Create_Sync_Objects();
+		At += Plane_Bytes;
+		return true;
 	}
 
-	void Main_Loop(void) {
-		while (!glfwWindowShouldClose(this->m_Window.get())) {
-			glfwPollEvents();
+#if defined(SIMD_SSE_ENABLE)
+	//NOTE : Packed Fields Are Split By Shifting Whole Registers, Then Interleaved Back Into Element Order
+	static const bool Unpack_Plane_SSE(const uint8_t*& At, const uint8_t* End, uint32_t Mode, __m128i& Bytes) {
+		const size_t Plane_Bytes{ Mesh_Codec::Get_Plane_Bytes(Mode) };
+		if (static_cast<size_t>(End - At) < Plane_Bytes)
+			return false;
 
-			this->Draw_Frame();
+		switch (Mode) {
+		case 0:
+			Bytes = _mm_setzero_si128();
+			break;
+		case 1: {
+			int32_t Packed_Word{ 0 };
+			memcpy(&Packed_Word, At, sizeof(Packed_Word));
+			const __m128i Packed{ _mm_cvtsi32_si128(Packed_Word) };
+			const __m128i Mask{ _mm_set1_epi8(3) };
+			const __m128i Field_0{ _mm_and_si128(Packed, Mask) };
+			const __m128i Field_1{ _mm_and_si128(_mm_srli_epi16(Packed, 2), Mask) };
+			const __m128i Field_2{ _mm_and_si128(_mm_srli_epi16(Packed, 4), Mask) };
+			const __m128i Field_3{ _mm_and_si128(_mm_srli_epi16(Packed, 6), Mask) };
+			Bytes = _mm_unpacklo_epi16(_mm_unpacklo_epi8(Field_0, Field_1), _mm_unpacklo_epi8(Field_2, Field_3));
+			break;
 		}
-		THROW_IF_VK_FAILED(vkDeviceWaitIdle(this->m_Logical_Device.get()));
+		case 2: {
+			const __m128i Packed{ _mm_loadl_epi64(reinterpret_cast<const __m128i*>(At)) };
+			const __m128i Mask{ _mm_set1_epi8(15) };
+			Bytes = _mm_unpacklo_epi8(_mm_and_si128(Packed, Mask), _mm_and_si128(_mm_srli_epi16(Packed, 4), Mask));
+			break;
+		}
+		default:
+			Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(At));
+			break;
+		}
+
+		At += Plane_Bytes;
+		return true;
 	}
+#endif
+};
 
-	void CleanUp_SwapChain(void) {
-		//vkDestroyImageView(this->m_Logical_Device.get(), this->m_Depth_Image_View.get(), nullptr);
-		this->m_Depth_Image_View.reset();
+static_assert(sizeof(Vertex) % sizeof(uint32_t) == 0 && std::is_trivially_copyable_v<Vertex>, "Mesh_Codec codes vertices as whole words");
+
+struct Mesh_Optimizer final {
+	//NOTE : FIFO Model Of A Typical Post Transform Cache, Only Used For Reporting
+	static constexpr uint32_t Analyze_Cache_Size{ 16 };
+	//NOTE : LRU Cache Size Forsyth Scores Are Tuned For
+	static constexpr uint32_t Forsyth_Cache_Size{ 32 };
+	//NOTE : A Cluster May Be Split Where Its Cold Cache ACMR Stays Within This Factor
+	static constexpr float Overdraw_Threshold{ 1.05f };
+
+	static const Vertex_Cache_Statistics Analyze_Vertex_Cache(const vector<uint32_t>& Indices, size_t Vertex_Count) {
+		vector<uint32_t> Cache_Timestamps(Vertex_Count, 0);
+		uint32_t Timestamp{ Analyze_Cache_Size + 1 };
+		uint32_t Misses{ 0 };
+
+		for (const auto& Index : Indices)
+			if (Timestamp - Cache_Timestamps[Index] > Analyze_Cache_Size) {
+				Cache_Timestamps[Index] = Timestamp++;
+				++Misses;
+			}
+
+		Vertex_Cache_Statistics Statistics{};
+		{
+			Statistics.ACMR = Indices.empty() ? 0.0f : static_cast<float>(Misses) / static_cast<float>(Indices.size() / 3);
+			Statistics.ATVR = 0 == Vertex_Count ? 0.0f : static_cast<float>(Misses) / static_cast<float>(Vertex_Count);
+		}
 
-		//vkDestroyImage(this->m_Logical_Device.get(), this->m_Depth_Image.get(), nullptr);
-		this->m_Depth_Image.reset();
+		return Statistics;
+	}
 
-		//vkFreeMemory(this->m_Logical_Device.get(), this->m_Depth_Image_Memory.get(), nullptr);
-		this->m_Depth_Image_Memory.reset();
+	//NOTE : Forsyth Linear Speed Vertex Cache Optimisation, Returns Triangle Index Of Every Cache Restart
+	static const vector<uint32_t> Optimize_Vertex_Cache(vector<uint32_t>& Indices, size_t Vertex_Count) {
+		const size_t Triangle_Count{ Indices.size() / 3 };
+
+		vector<uint32_t> Adjacency_Offsets(Vertex_Count + 1, 0);
+		for (const auto& Index : Indices)
+			++Adjacency_Offsets[Index + 1];
+		for (size_t Index = 0; Index < Vertex_Count; ++Index)
+			Adjacency_Offsets[Index + 1] += Adjacency_Offsets[Index];
+
+		//NOTE : Live Triangles Of Each Vertex Are Kept In Front Of Its Adjacency Range
+		vector<uint32_t> Adjacency(Indices.size());
+		vector<uint32_t> Valence(Vertex_Count, 0);
+		for (size_t Triangle = 0; Triangle < Triangle_Count; ++Triangle)
+			for (size_t Corner = 0; Corner < 3; ++Corner) {
+				const uint32_t Vertex_Index{ Indices[Triangle * 3 + Corner] };
+				Adjacency[Adjacency_Offsets[Vertex_Index] + Valence[Vertex_Index]++] = static_cast<uint32_t>(Triangle);
+			}
 
-		//vkDestroyImageView(this->m_Logical_Device.get(), this->m_Color_Image_View.get(), nullptr);
-		this->m_Color_Image_View.reset();
+		vector<int32_t> Cache_Position(Vertex_Count, -1);
+		vector<float> Vertex_Score(Vertex_Count);
+		for (size_t Index = 0; Index < Vertex_Count; ++Index)
+			Vertex_Score[Index] = Mesh_Optimizer::Get_Forsyth_Score(Cache_Position[Index], Valence[Index]);
+
+		vector<float> Triangle_Score(Triangle_Count);
+		for (size_t Triangle = 0; Triangle < Triangle_Count; ++Triangle)
+			Triangle_Score[Triangle] = Vertex_Score[Indices[Triangle * 3 + 0]] + Vertex_Score[Indices[Triangle * 3 + 1]] + Vertex_Score[Indices[Triangle * 3 + 2]];
+
+		vector<bool> Emitted(Triangle_Count, false);
+		vector<uint32_t> Output{};
+		Output.reserve(Indices.size());
+		vector<uint32_t> Cluster_Starts{};
+
+		array<uint32_t, Forsyth_Cache_Size + 3> Cache{};
+		array<uint32_t, Forsyth_Cache_Size + 3> Next_Cache{};
+		uint32_t Cache_Count{ 0 };
+
+		size_t Dead_End_Cursor{ 0 };
+		int64_t Best_Triangle{ -1 };
+
+		for (size_t Emitted_Count = 0; Emitted_Count < Triangle_Count; ++Emitted_Count) {
+			if (-1 == Best_Triangle) {
+				//NOTE : Nothing Left Around The Cache, Restart From Input Order
+				while (Emitted[Dead_End_Cursor])
+					++Dead_End_Cursor;
+				Best_Triangle = static_cast<int64_t>(Dead_End_Cursor);
+				Cluster_Starts.push_back(static_cast<uint32_t>(Emitted_Count));
+			}
 
-		//vkDestroyImage(this->m_Logical_Device.get(), this->m_Color_Image.get(), nullptr);
-		this->m_Color_Image.reset();
+			const uint32_t* Triangle_Vertices{ &Indices[static_cast<size_t>(Best_Triangle) * 3] };
+			Emitted[static_cast<size_t>(Best_Triangle)] = true;
+			Output.insert(Output.end(), Triangle_Vertices, Triangle_Vertices + 3);
 
-		//vkFreeMemory(this->m_Logical_Device.get(), this->m_Color_Image_Memory.get(), nullptr);
-		this->m_Color_Image_Memory.reset();
+			for (size_t Corner = 0; Corner < 3; ++Corner) {
+				const uint32_t Vertex_Index{ Triangle_Vertices[Corner] };
+				uint32_t* Live_Begin{ &Adjacency[Adjacency_Offsets[Vertex_Index]] };
+				uint32_t* Live_End{ Live_Begin + Valence[Vertex_Index] };
+				*std::find(Live_Begin, Live_End, static_cast<uint32_t>(Best_Triangle)) = *(Live_End - 1);
+				--Valence[Vertex_Index];
+			}
 
-		for (auto& Framebuffer : this->m_Swap_Chain_Frame_buffers) {
-			//vkDestroyFramebuffer(this->m_Logical_Device.get(), Framebuffer.get(), nullptr);
-			Framebuffer.reset();
-		}
+			//NOTE : LRU Update, Emitted Vertices Move To The Front
+			uint32_t Next_Count{ 0 };
+			for (size_t Corner = 0; Corner < 3; ++Corner)
+				Next_Cache[Next_Count++] = Triangle_Vertices[Corner];
+			for (uint32_t Slot = 0; Slot < Cache_Count; ++Slot) {
+				const uint32_t Vertex_Index{ Cache[Slot] };
+				if (Vertex_Index != Triangle_Vertices[0] && Vertex_Index != Triangle_Vertices[1] && Vertex_Index != Triangle_Vertices[2])
+					Next_Cache[Next_Count++] = Vertex_Index;
+			}
 
-		for (auto& Image_View : this->m_Swap_Chain_Image_Views) {
-			//vkDestroyImageView(this->m_Logical_Device.get(), Image_View.get(), nullptr);
+			for (uint32_t Slot = 0; Slot < Next_Count; ++Slot)
+				Cache_Position[Next_Cache[Slot]] = Slot < Forsyth_Cache_Size ? static_cast<int32_t>(Slot) : -1;
+
+			Best_Triangle = -1;
+			float Best_Score{ -1.0f };
+			for (uint32_t Slot = 0; Slot < Next_Count; ++Slot) {
+				const uint32_t Vertex_Index{ Next_Cache[Slot] };
+				const float New_Score{ Mesh_Optimizer::Get_Forsyth_Score(Cache_Position[Vertex_Index], Valence[Vertex_Index]) };
+				const float Delta{ New_Score - Vertex_Score[Vertex_Index] };
+				Vertex_Score[Vertex_Index] = New_Score;
+
+				const uint32_t* Live_Begin{ &Adjacency[Adjacency_Offsets[Vertex_Index]] };
+				for (const uint32_t* Live = Live_Begin; Live != Live_Begin + Valence[Vertex_Index]; ++Live) {
+					Triangle_Score[*Live] += Delta;
+					if (Slot < Forsyth_Cache_Size && Triangle_Score[*Live] > Best_Score) {
+						Best_Score = Triangle_Score[*Live];
+						Best_Triangle = *Live;
+					}
+				}
+			}
 
-			Image_View.reset();
+			Cache_Count = std::min<uint32_t>(Next_Count, Forsyth_Cache_Size);
+			std::copy(Next_Cache.begin(), Next_Cache.begin() + Cache_Count, Cache.begin());
 		}
 
-		this->m_Swap_Chain.reset();
+		Indices.swap(Output);
+		return Cluster_Starts;
 	}
 
-	void CleanUp(void) {
-		//NOTE : Clean Up Logical Device Before Instance and ,First Clean Command Queue Before Logical Device
-
-		this->CleanUp_SwapChain();
+	//NOTE : Split Hard Clusters Where A Cold Cache Costs Little, Then Draw Outward Facing Clusters First
+	static void Optimize_Overdraw(vector<uint32_t>& Indices, const vector<Vertex>& Vertices, const vector<uint32_t>& Hard_Cluster_Starts) {
+		const uint32_t Triangle_Count{ static_cast<uint32_t>(Indices.size() / 3) };
+		if (0 == Triangle_Count)
+			return;
+
+		vector<uint32_t> Cache_Timestamps(Vertices.size(), 0);
+		uint32_t Timestamp{ Analyze_Cache_Size + 1 };
+		const auto Triangle_Misses = [&](uint32_t Triangle) {
+			uint32_t Misses{ 0 };
+			for (size_t Corner = 0; Corner < 3; ++Corner) {
+				const uint32_t Vertex_Index{ Indices[Triangle * 3 + Corner] };
+				if (Timestamp - Cache_Timestamps[Vertex_Index] > Analyze_Cache_Size) {
+					Cache_Timestamps[Vertex_Index] = Timestamp++;
+					++Misses;
+				}
+			}
+			return Misses;
+		};
+		const auto Reset_Cache = [&](void) { Timestamp += Analyze_Cache_Size + 1; };
+
+		vector<uint32_t> Cluster_Starts{};
+		for (size_t Hard = 0; Hard < Hard_Cluster_Starts.size(); ++Hard) {
+			const uint32_t Begin{ Hard_Cluster_Starts[Hard] };
+			const uint32_t End{ Hard + 1 < Hard_Cluster_Starts.size() ? Hard_Cluster_Starts[Hard + 1] : Triangle_Count };
+
+			Reset_Cache();
+			uint32_t Hard_Misses{ 0 };
+			for (uint32_t Triangle = Begin; Triangle < End; ++Triangle)
+				Hard_Misses += Triangle_Misses(Triangle);
+			const float Threshold{ Overdraw_Threshold * static_cast<float>(Hard_Misses) / static_cast<float>(End - Begin) };
+
+			Reset_Cache();
+			uint32_t Soft_Begin{ Begin }, Soft_Misses{ 0 };
+			Cluster_Starts.push_back(Begin);
+			for (uint32_t Triangle = Begin; Triangle < End; ++Triangle) {
+				Soft_Misses += Triangle_Misses(Triangle);
+				if (Triangle + 1 < End && static_cast<float>(Soft_Misses) / static_cast<float>(Triangle + 1 - Soft_Begin) <= Threshold) {
+					Soft_Begin = Triangle + 1;
+					Soft_Misses = 0;
+					Cluster_Starts.push_back(Soft_Begin);
+					Reset_Cache();
+				}
+			}
+		}
 
-		for (size_t Index = 0; Index < MAX_FRAMES_IN_FLIGHT; ++Index) {
-			//vkDestroySemaphore(this->m_Logical_Device.get(), this->m_Render_Finished_Semaphores[Index].get(), nullptr);
-			this->m_Render_Finished_Semaphores[Index].reset();
+		glm::vec3 Mesh_Centroid{ 0.0f };
+		float Mesh_Area{ 0.0f };
+		vector<glm::vec3> Cluster_Centroids(Cluster_Starts.size(), glm::vec3{ 0.0f });
+		vector<glm::vec3> Cluster_Normals(Cluster_Starts.size(), glm::vec3{ 0.0f });
+		for (size_t Cluster = 0; Cluster < Cluster_Starts.size(); ++Cluster) {
+			const uint32_t End{ Cluster + 1 < Cluster_Starts.size() ? Cluster_Starts[Cluster + 1] : Triangle_Count };
+			float Cluster_Area{ 0.0f };
+			for (uint32_t Triangle = Cluster_Starts[Cluster]; Triangle < End; ++Triangle) {
+				const glm::vec3& A{ Vertices[Indices[Triangle * 3 + 0]].Pos };
+				const glm::vec3& B{ Vertices[Indices[Triangle * 3 + 1]].Pos };
+				const glm::vec3& C{ Vertices[Indices[Triangle * 3 + 2]].Pos };
+				const glm::vec3 Cross{ glm::cross(B - A, C - A) };
+				const float Area{ glm::length(Cross) };
+
+				Cluster_Centroids[Cluster] += (A + B + C) * (Area / 3.0f);
+				Cluster_Normals[Cluster] += Cross;
+				Cluster_Area += Area;
+			}
 
-			//vkDestroySemaphore(this->m_Logical_Device.get(), this->m_Image_Available_Semaphores[Index].get(), nullptr);
-			this->m_Image_Available_Semaphores[Index].reset();
+			Mesh_Centroid += Cluster_Centroids[Cluster];
+			Mesh_Area += Cluster_Area;
+			Cluster_Centroids[Cluster] = 0.0f < Cluster_Area ? Cluster_Centroids[Cluster] / Cluster_Area : Vertices[Indices[Cluster_Starts[Cluster] * 3]].Pos;
+		}
+		Mesh_Centroid = 0.0f < Mesh_Area ? Mesh_Centroid / Mesh_Area : glm::vec3{ 0.0f };
 
-			//vkDestroyFence(this->m_Logical_Device.get(), this->m_InFlight_Fences[Index].get(), nullptr);
-			this->m_InFlight_Fences[Index].reset();
+		vector<float> Cluster_Sort_Keys(Cluster_Starts.size());
+		for (size_t Cluster = 0; Cluster < Cluster_Starts.size(); ++Cluster) {
+			const float Normal_Length{ glm::length(Cluster_Normals[Cluster]) };
+			Cluster_Sort_Keys[Cluster] = 0.0f < Normal_Length ? glm::dot(Cluster_Centroids[Cluster] - Mesh_Centroid, Cluster_Normals[Cluster] / Normal_Length) : 0.0f;
 		}
 
-		//vkDestroyDescriptorPool(this->m_Logical_Device.get(), this->m_Descriptor_Pool.get(), nullptr);
-		this->m_Descriptor_Pool.reset();
+		vector<uint32_t> Cluster_Order(Cluster_Starts.size());
+		for (size_t Cluster = 0; Cluster < Cluster_Order.size(); ++Cluster)
+			Cluster_Order[Cluster] = static_cast<uint32_t>(Cluster);
+		std::stable_sort(Cluster_Order.begin(), Cluster_Order.end(), [&](uint32_t Left, uint32_t Right) {return Cluster_Sort_Keys[Left] > Cluster_Sort_Keys[Right]; });
 
-		for (size_t Index = 0; Index < MAX_FRAMES_IN_FLIGHT; ++Index) {
-			//vkDestroyBuffer(this->m_Logical_Device.get(), this->m_Uniform_Buffers[Index].get(), nullptr);
-			this->m_Uniform_Buffers[Index].reset();
-			//vkFreeMemory(this->m_Logical_Device.get(), this->m_Uniform_Buffers_Memory[Index].get(), nullptr);
-			this->m_Uniform_Buffers_Memory[Index].reset();
+		vector<uint32_t> Output{};
+		Output.reserve(Indices.size());
+		for (const auto& Cluster : Cluster_Order) {
+			const uint32_t End{ Cluster + 1 < Cluster_Starts.size() ? Cluster_Starts[Cluster + 1] : Triangle_Count };
+			Output.insert(Output.end(), Indices.begin() + static_cast<size_t>(Cluster_Starts[Cluster]) * 3, Indices.begin() + static_cast<size_t>(End) * 3);
 		}
 
-		//vkDestroyBuffer(this->m_Logical_Device.get(), this->m_Index_Buffer.get(), nullptr);
-		this->m_Index_Buffer.reset();
-
-		//vkFreeMemory(this->m_Logical_Device.get(), this->m_Index_Buffer_Memory.get(), nullptr);
-		this->m_Index_Buffer_Memory.reset();
+		Indices.swap(Output);
+	}
 
-		//vkDestroyBuffer(this->m_Logical_Device.get(), this->m_Vertex_Buffer.get(), nullptr);
-		this->m_Vertex_Buffer.reset();
+	//NOTE : Lay Vertices Out In First Use Order, Unreferenced Vertices Are Dropped
+	static void Optimize_Vertex_Fetch(vector<uint32_t>& Indices, vector<Vertex>& Vertices) {
+		vector<uint32_t> Remap(Vertices.size(), numeric_limits<uint32_t>::max());
+		vector<Vertex> Output{};
+		Output.reserve(Vertices.size());
 
-		//vkFreeMemory(this->m_Logical_Device.get(), this->m_Vertex_Buffer_Memory.get(), nullptr);
-		this->m_Vertex_Buffer_Memory.reset();
+		for (auto& Index : Indices) {
+			if (numeric_limits<uint32_t>::max() == Remap[Index]) {
+				Remap[Index] = static_cast<uint32_t>(Output.size());
+				Output.push_back(Vertices[Index]);
+			}
+			Index = Remap[Index];
+		}
 
-		//vkDestroySampler(this->m_Logical_Device.get(), this->m_Texture_Sampler.get(), nullptr);
-		this->m_Texture_Sampler.reset();
+		Vertices.swap(Output);
+	}
 
-		//vkDestroyImageView(this->m_Logical_Device.get(), this->m_Texture_ImageView.get(), nullptr);
-		this->m_Texture_Image_View.reset();
+private:
+	static const float Get_Forsyth_Score(int32_t Cache_Position, uint32_t Valence) {
+		if (0 == Valence)
+			return -1.0f;
+
+		float Score{ 0.0f };
+		if (0 <= Cache_Position) {
+			//NOTE : The Last Triangle's Vertices Get A Fixed Score So Strips Are Not Favoured Over Fans
+			if (3 > Cache_Position)
+				Score = 0.75f;
+			else
+				Score = std::pow(1.0f - static_cast<float>(Cache_Position - 3) / static_cast<float>(Forsyth_Cache_Size - 3), 1.5f);
+		}
 
-		//vkDestroyImage(this->m_Logical_Device.get(), this->m_Texture_Image.get(), nullptr);
-		this->m_Texture_Image.reset();
+		return Score + 2.0f / std::sqrt(static_cast<float>(Valence));
+	}
+};
 
-		//vkFreeMemory(this->m_Logical_Device.get(), this->m_Texture_Image_Memory.get(), nullptr);
-		this->m_Texture_Image_Memory.reset();
+struct Mesh_Draw_Range final {
+	uint32_t First_Index{ 0 };
+	uint32_t Index_Count{ 0 };
+	int32_t Vertex_Offset{ 0 };
+	//NOTE : Index Into The Mesh Materials, Packing Leaves It To The Caller
+	uint32_t Material{ 0 };
+};
 
-		//vkDestroyCommandPool(this->m_Logical_Device.get(), this->m_Command_Pool.get(), nullptr);
-		this->m_Command_Pool.reset();
+//NOTE : Index Buffer Of One Mesh, 16 Bit Ranges Are Rebased On Their Lowest Vertex And Drawn With vertexOffset
+struct Packed_Indices final {
+	//NOTE : Each Extra Draw From Splitting Has To Save At Least This Many 2 Byte Index Fetches
+	static constexpr size_t Split_Min_Indices_Per_Draw{ 1 << 15 };
 
-		//NOTE : In Clean Up Swap Chain Func
-		//for (auto& Framebuffer : this->m_Swap_Chain_Frame_buffers) {
-		//	//vkDestroyFramebuffer(this->m_Logical_Device.get(), Framebuffer.get(), nullptr);
-		//	Framebuffer.reset();
-		//}
+	VkIndexType Index_Type{ VK_INDEX_TYPE_UINT32 };
+	vector<uint8_t> Data{};
 
-		//vkDestroyPipeline(this->m_Logical_Device.get(), this->m_Graphics_Pipeline.get(), nullptr);
-		this->m_Graphics_Pipeline.reset();
+	static const VkIndexType Choose_Index_Type(const vector<uint32_t>& Indices, size_t Vertex_Count) {
+		if (Vertex_Count <= static_cast<size_t>(numeric_limits<uint16_t>::max()) + 1)
+			return VK_INDEX_TYPE_UINT16;
 
+		//NOTE : No Base Vertex Brings Both Ends Of Such A Triangle Into 16 Bit Range
+		if (Packed_Indices::Has_Wide_Triangle(Indices))
+			return VK_INDEX_TYPE_UINT32;
 
-		//vkDestroyPipelineLayout(this->m_Logical_Device.get(), this->m_Pipeline_Layout.get(), nullptr);
-		this->m_Pipeline_Layout.reset();
+		const size_t Range_Count{ std::max<size_t>(Packed_Indices::Split_Ranges(Indices).size(), 1) };
+		return Indices.size() / Range_Count >= Split_Min_Indices_Per_Draw ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+	}
 
-		//vkDestroyDescriptorSetLayout(this->m_Logical_Device.get(), this->m_Descriptor_Set_Layout.get(), nullptr);
-		this->m_Descriptor_Set_Layout.reset();
+	static const bool Has_Wide_Triangle(const vector<uint32_t>& Indices) {
+		for (size_t Triangle = 0; Triangle + 2 < Indices.size(); Triangle += 3) {
+			const uint32_t Triangle_Min{ std::min({ Indices[Triangle + 0], Indices[Triangle + 1], Indices[Triangle + 2] }) };
+			const uint32_t Triangle_Max{ std::max({ Indices[Triangle + 0], Indices[Triangle + 1], Indices[Triangle + 2] }) };
+			if (Triangle_Max - Triangle_Min > numeric_limits<uint16_t>::max())
+				return true;
+		}
 
-		//vkDestroyRenderPass(this->m_Logical_Device.get(), this->m_Render_Pass.get(), nullptr);
-		this->m_Render_Pass.reset();
+		return false;
+	}
 
-		//NOTE : In Clean Up Swap Chain Func
-		//for (auto& Image_View : this->m_Swap_Chain_Image_Views) {
-		//	//vkDestroyImageView(this->m_Logical_Device.get(), Image_View.get(), nullptr);
+	const uint32_t Get_Index_Size(void) const {
+		return VK_INDEX_TYPE_UINT16 == this->Index_Type ? sizeof(uint16_t) : sizeof(uint32_t);
+	}
 
-		//	Image_View.reset();
-		//}
+	const uint32_t Get_Index_Count(void) const {
+		return static_cast<uint32_t>(this->Data.size() / this->Get_Index_Size());
+	}
 
-		// NOTE : In Clean Up Swap Chain Func
-		////vkDestroySwapchainKHR(this->m_Logical_Device.get(), this->m_Swap_Chain.get(), nullptr);
-		//this->m_Swap_Chain.reset();
+	const vector<Mesh_Draw_Range> Append(const vector<uint32_t>& Indices) {
+		vector<Mesh_Draw_Range> Ranges{};
 
-		//vkDestroyDevice(this->m_Logical_Device.get(), nullptr);
-		this->m_Logical_Device.reset();
+		if (VK_INDEX_TYPE_UINT32 == this->Index_Type) {
+			Mesh_Draw_Range Range{};
+			{
+				Range.First_Index = this->Get_Index_Count();
+				Range.Index_Count = static_cast<uint32_t>(Indices.size());
+				Range.Vertex_Offset = 0;
+			}
+			Ranges.push_back(Range);
 
-#ifdef _DEBUG
-		VK_Application::Destroy_DebugUtils_Messenger_EXT(this->m_VK_Instance.get(), this->m_Debug_Messenger, nullptr);
-#endif // _DEBUG
+			const size_t Offset{ this->Data.size() };
+			this->Data.resize(Offset + Indices.size() * sizeof(uint32_t));
+			memcpy(this->Data.data() + Offset, Indices.data(), Indices.size() * sizeof(uint32_t));
 
-		//vkDestroySurfaceKHR(this->m_VK_Instance.get(), this->m_Surface.get(), nullptr);
-		this->m_Surface.reset();
+			return Ranges;
+		}
 
-		//vkDestroyInstance(m_VK_Instance, nullptr);
-		this->m_VK_Instance.reset();
-		//glfwDestroyWindow(this->m_Window.get());
+		for (const auto& Split : Packed_Indices::Split_Ranges(Indices)) {
+			Mesh_Draw_Range Range{};
+			{
+				Range.First_Index = this->Get_Index_Count();
+				Range.Index_Count = Split.End - Split.Begin;
+				Range.Vertex_Offset = static_cast<int32_t>(Split.Base_Vertex);
+			}
+			Ranges.push_back(Range);
 
-		//glfwDestroyWindow(this->m_Window.get());
-		this->m_Window.reset();
+			const size_t Offset{ this->Data.size() };
+			this->Data.resize(Offset + Range.Index_Count * sizeof(uint16_t));
+			uint16_t* Destination{ reinterpret_cast<uint16_t*>(this->Data.data() + Offset) };
+			for (uint32_t Index = Split.Begin; Index < Split.End; ++Index)
+				*Destination++ = static_cast<uint16_t>(Indices[Index] - Split.Base_Vertex);
+		}
 
-		glfwTerminate();
+		return Ranges;
 	}
 
-	void Re_Create_SwapChain(void) {
-		int Width{ 0 }, Height{ 0 };
-		glfwGetFramebufferSize(this->m_Window.get(), &Width, &Height);
-		while (Width == 0 || Height == 0) {
-			glfwGetFramebufferSize(this->m_Window.get(), &Width, &Height);
-			glfwWaitEvents();
-		}
+private:
+	struct Split_Range final {
+		uint32_t Begin;
+		uint32_t End;
+		uint32_t Base_Vertex;
+	};
 
-		THROW_IF_VK_FAILED(vkDeviceWaitIdle(this->m_Logical_Device.get()));
+	//NOTE : Greedy Over Triangles, Relies On Vertex Fetch Order Keeping Each Range's Vertices Close Together, Wide Triangles Are Ruled Out By Choose_Index_Type
+	static const vector<Split_Range> Split_Ranges(const vector<uint32_t>& Indices) {
+		vector<Split_Range> Ranges{};
+
+		uint32_t Begin{ 0 };
+		uint32_t Min_Vertex{ numeric_limits<uint32_t>::max() }, Max_Vertex{ 0 };
+		for (uint32_t Triangle = 0; Triangle * 3 < Indices.size(); ++Triangle) {
+			const uint32_t Triangle_Min{ std::min({ Indices[Triangle * 3 + 0], Indices[Triangle * 3 + 1], Indices[Triangle * 3 + 2] }) };
+			const uint32_t Triangle_Max{ std::max({ Indices[Triangle * 3 + 0], Indices[Triangle * 3 + 1], Indices[Triangle * 3 + 2] }) };
+
+			if (Triangle_Max - Triangle_Min > numeric_limits<uint16_t>::max())
+				throw runtime_error("Triangle spans more vertices than 16 bit indices reach!");
+
+			//NOTE : A Range Is Only Closed Once It Holds A Triangle, So No Split Is Empty
+			if (Begin < Triangle * 3 && std::max(Max_Vertex, Triangle_Max) - std::min(Min_Vertex, Triangle_Min) > numeric_limits<uint16_t>::max()) {
+				Ranges.push_back(Split_Range{ Begin, Triangle * 3, Min_Vertex });
+				Begin = Triangle * 3;
+				Min_Vertex = numeric_limits<uint32_t>::max();
+				Max_Vertex = 0;
+			}
 
-		this->CleanUp_SwapChain();
+			Min_Vertex = std::min(Min_Vertex, Triangle_Min);
+			Max_Vertex = std::max(Max_Vertex, Triangle_Max);
+		}
 
-		this->Create_SwapChain();
-		this->Create_SwapChhain_Image_Views();
-		this->Create_Render_Pass();
-		this->Create_Color_Resource();
-		this->Create_Depth_Resource();
-		this->Create_Frame_Buffers();
+		if (Begin < Indices.size())
+			Ranges.push_back(Split_Range{ Begin, static_cast<uint32_t>(Indices.size()), Min_Vertex });
+
+		return Ranges;
 	}
+};
 
-private:
-	void Create_Instance(void) {
-		VkApplicationInfo VK_Application_Info{};
-		{
-			VK_Application_Info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
-			VK_Application_Info.pApplicationName = "Hello Triangle";
-			VK_Application_Info.applicationVersion = VK_MAKE_VERSION(1, 0, 0);
-			VK_Application_Info.pEngineName = "No Engine";
-			VK_Application_Info.engineVersion = VK_MAKE_VERSION(1, 0, 0);
-			VK_Application_Info.apiVersion = VK_API_VERSION_1_0;
-		}
+//NOTE : First Fit Over A Free List Kept In Offset Order, A Freed Range Merges With Free Neighbours On Both Sides
+struct Range_Allocator final {
+	void Reset(uint32_t Capacity, uint32_t Used = 0) {
+		this->Capacity = Capacity;
+		this->Free_Ranges.clear();
+		if (Used < Capacity)
+			this->Free_Ranges.emplace(Used, Capacity - Used);
+	}
 
-		const auto& Extensions = VK_Application::Get_Require_Extensions();
-		VkInstanceCreateInfo Instance_Create_Info = {};
-		{
-			Instance_Create_Info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+	const optional<uint32_t> Allocate(uint32_t Count) {
+		for (auto Free = this->Free_Ranges.begin(); Free != this->Free_Ranges.end(); ++Free) {
+			if (Free->second < Count)
+				continue;
 
-			Instance_Create_Info.pApplicationInfo = &VK_Application_Info;
+			const uint32_t Offset{ Free->first };
+			const uint32_t Remaining{ Free->second - Count };
+			this->Free_Ranges.erase(Free);
+			if (0 != Remaining)
+				this->Free_Ranges.emplace(Offset + Count, Remaining);
 
-#ifdef _DEBUG
-			Instance_Create_Info.pNext = reinterpret_cast<const void*>(&this->m_VkDebugUtilsMessengerCreateInfoEXT);
-			Instance_Create_Info.enabledLayerCount = static_cast<uint32_t>(this->m_Validation_Layer_List.size());
-			Instance_Create_Info.ppEnabledLayerNames = this->m_Validation_Layer_List.data();
-#else
-			Instance_Create_Info.pNext = nullptr;
-			Instance_Create_Info.enabledLayerCount = 0;
-			Instance_Create_Info.ppEnabledLayerNames = nullptr;
-#endif // _DEBUG
-			Instance_Create_Info.enabledExtensionCount = static_cast<uint32_t>(Extensions.size());
-			Instance_Create_Info.ppEnabledExtensionNames = Extensions.data();
+			return Offset;
 		}
 
-		VkInstance VK_Instance{ nullptr };
-		THROW_IF_VK_FAILED(vkCreateInstance(&Instance_Create_Info, nullptr, &VK_Instance));
-		this->m_VK_Instance.reset(VK_Instance);
+		return nullopt;
 	}
 
-	void Create_Surface(void) {
-		VkSurfaceKHR Surface{ nullptr };
-		THROW_IF_VK_FAILED(glfwCreateWindowSurface(this->m_VK_Instance.get(), this->m_Window.get(), nullptr, &Surface));
+	void Free(uint32_t Offset, uint32_t Count) {
+		if (0 == Count)
+			return;
 
+		auto Next = this->Free_Ranges.lower_bound(Offset);
+		if (this->Free_Ranges.end() != Next && Offset + Count == Next->first) {
+			Count += Next->second;
+			Next = this->Free_Ranges.erase(Next);
+		}
 
-		this->m_Surface.get_deleter() = [Instance = this->m_VK_Instance.get()](VkSurfaceKHR Surface) {vkDestroySurfaceKHR(Instance, Surface, nullptr); };
-		this->m_Surface.reset(Surface);
+		if (this->Free_Ranges.begin() != Next) {
+			const auto Previous = std::prev(Next);
+			if (Previous->first + Previous->second == Offset) {
+				Previous->second += Count;
+				return;
+			}
+		}
+
+		this->Free_Ranges.emplace(Offset, Count);
 	}
 
-	void Pick_Physical_Device(void) {
-		uint32_t Device_Count{ 0 };
-		THROW_IF_VK_FAILED(vkEnumeratePhysicalDevices(this->m_VK_Instance.get(), &Device_Count, nullptr));
+	const uint32_t Get_Capacity(void) const {
+		return this->Capacity;
+	}
 
-		if (0 == Device_Count)
-			throw runtime_error("Failed to find GPUs with Vulkan support!");
+	const uint32_t Get_Free_Count(void) const {
+		uint32_t Free_Count{ 0 };
+		for (const auto& [Offset, Count] : this->Free_Ranges)
+			Free_Count += Count;
 
-		vector<VkPhysicalDevice> Devices{};
-		Devices.resize(Device_Count);
-		THROW_IF_VK_FAILED(vkEnumeratePhysicalDevices(this->m_VK_Instance.get(), &Device_Count, Devices.data()));
-		for (const auto& Device : Devices)
-			if (Is_Device_Suitable(Device)) {
-				this->m_Physical_Device = Device;
-				break;
-			}
+		return Free_Count;
+	}
 
-		if (nullptr == this->m_Physical_Device)
-			throw runtime_error("Failed to find a suitable GPU!");
+	const uint32_t Get_Largest_Free(void) const {
+		uint32_t Largest{ 0 };
+		for (const auto& [Offset, Count] : this->Free_Ranges)
+			Largest = std::max(Largest, Count);
 
-		//NOTE : Note Phyiscsal Device Info
-		this->m_Msaa_Samples = Get_Max_Usable_Sample_Count(this->m_Physical_Device);
+		return Largest;
 	}
 
-	void Create_Logical_Device(void) {
-		this->m_Queue_Family_Indices.Graphics_Family =
-			this->Find_Queue_Families(VK_QUEUE_GRAPHICS_BIT);
+	const size_t Get_Free_Range_Count(void) const {
+		return this->Free_Ranges.size();
+	}
 
-		if (numeric_limits<uint32_t>::max() == this->m_Queue_Family_Indices.Graphics_Family)
-			throw runtime_error("Failed to find a queue family with graphics bit!");
+private:
+	uint32_t Capacity{ 0 };
+	map<uint32_t, uint32_t> Free_Ranges{};
+};
 
-		this->m_Queue_Family_Indices.Present_Family = this->Get_Physical_Device_Queue_Present_Family();
+//NOTE : Where One Mesh Lives In The Shared Buffers, Base Vertex And First Index Go Straight Into Its Draws
+struct Geometry_Allocation final {
+	uint32_t Base_Vertex{ 0 };
+	uint32_t Vertex_Count{ 0 };
+	uint32_t First_Index{ 0 };
+	uint32_t Index_Count{ 0 };
+};
 
-		if (numeric_limits<uint32_t>::max() == this->m_Queue_Family_Indices.Present_Family)
-			throw runtime_error("Failed to find a queue family with present bit!");
+//NOTE : Byte Regions For vkCmdCopyBuffer From The Old Buffers Into Freshly Created Ones, Copies Within One Buffer Must Not Overlap
+struct Geometry_Defragment_Plan final {
+	vector<VkBufferCopy> Vertex_Copies{};
+	vector<VkBufferCopy> Index_Copies{};
+};
 
-		//NOTE : Queue Family Should Be Unique,Because It Maybe Same
-		unordered_set<uint32_t> Unique_Queue_Families{
-			this->m_Queue_Family_Indices.Graphics_Family,
-			this->m_Queue_Family_Indices.Present_Family
-		};
+//NOTE : Every Mesh Sub Allocated From One Vertex And One Index Buffer, So A Frame Binds Geometry Once And Multi Draw Indirect Spans All Meshes
+//NOTE : Handles Stay Valid Across Defragmentation, Only The Ranges Behind Them Move
+struct Geometry_Pool final {
+	using Handle = uint32_t;
+
+	void Reset(uint32_t Vertex_Capacity, uint32_t Index_Capacity, uint32_t Vertex_Stride, VkIndexType Index_Type) {
+		this->Vertices.Reset(Vertex_Capacity);
+		this->Indices.Reset(Index_Capacity);
+		this->Vertex_Stride = Vertex_Stride;
+		this->Index_Type = Index_Type;
+		this->Allocations.clear();
+		this->Free_Handles.clear();
+	}
 
-		//NOTE : Refence Continue From Create_Instance
-		constexpr float Queue_Priority{ 1.0f };
+	//NOTE : Both Ranges Or Neither, A Mesh Never Holds Half An Allocation
+	const optional<Handle> Allocate(uint32_t Vertex_Count, uint32_t Index_Count) {
+		const optional<uint32_t> Base_Vertex{ this->Vertices.Allocate(Vertex_Count) };
+		if (!Base_Vertex.has_value())
+			return nullopt;
 
-		vector<VkDeviceQueueCreateInfo> Queue_Create_Info_List;
-		Queue_Create_Info_List.reserve(Unique_Queue_Families.size());
-		{
-			for (const auto& Queue_Family : Unique_Queue_Families) {
-				VkDeviceQueueCreateInfo Queue_Create_Info{};
-				Queue_Create_Info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-				Queue_Create_Info.queueFamilyIndex = Queue_Family;
-				Queue_Create_Info.queueCount = 1;
-				Queue_Create_Info.pQueuePriorities = &Queue_Priority;
-				Queue_Create_Info_List.emplace_back(Queue_Create_Info);
-			}
+		const optional<uint32_t> First_Index{ this->Indices.Allocate(Index_Count) };
+		if (!First_Index.has_value()) {
+			this->Vertices.Free(Base_Vertex.value(), Vertex_Count);
+			return nullopt;
 		}
 
-		VkPhysicalDeviceFeatures Device_Features{};
-		{
-			Device_Features.samplerAnisotropy = VK_TRUE;
-		}
-		VkDeviceCreateInfo Device_Create_Info{};
+		Geometry_Allocation Allocation{};
 		{
-			Device_Create_Info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-			Device_Create_Info.queueCreateInfoCount = static_cast<uint32_t>(Queue_Create_Info_List.size());
-			Device_Create_Info.pQueueCreateInfos = Queue_Create_Info_List.data();
-			Device_Create_Info.enabledExtensionCount = 1;
-			Device_Create_Info.ppEnabledExtensionNames = &Device_EXT_SwapChain;
-			Device_Create_Info.pEnabledFeatures = &Device_Features;
+			Allocation.Base_Vertex = Base_Vertex.value();
+			Allocation.Vertex_Count = Vertex_Count;
+			Allocation.First_Index = First_Index.value();
+			Allocation.Index_Count = Index_Count;
 		}
 
-		VkDevice Logical_Device{ nullptr };
-		THROW_IF_VK_FAILED(vkCreateDevice(this->m_Physical_Device, &Device_Create_Info, nullptr, &Logical_Device));
-		this->m_Logical_Device.reset(Logical_Device);
+		if (this->Free_Handles.empty()) {
+			this->Allocations.push_back(Allocation);
+			return static_cast<Handle>(this->Allocations.size() - 1);
+		}
 
-		vkGetDeviceQueue(this->m_Logical_Device.get(), this->m_Queue_Family_Indices.Graphics_Family, 0, &this->m_Graphics_Queue);
+		const Handle Reused{ this->Free_Handles.back() };
+		this->Free_Handles.pop_back();
+		this->Allocations[Reused] = Allocation;
+		return Reused;
+	}
 
-		vkGetDeviceQueue(this->m_Logical_Device.get(), this->m_Queue_Family_Indices.Present_Family, 0, &this->m_Present_Queue);
+	void Free(Handle Mesh) {
+		const Geometry_Allocation& Allocation{ this->Get(Mesh) };
+		this->Vertices.Free(Allocation.Base_Vertex, Allocation.Vertex_Count);
+		this->Indices.Free(Allocation.First_Index, Allocation.Index_Count);
 
+		this->Allocations[Mesh].reset();
+		this->Free_Handles.push_back(Mesh);
 	}
 
-	void Create_SwapChain(void) {
-		this->Query_Swap_Chain_Support_Details();
+	const Geometry_Allocation& Get(Handle Mesh) const {
+		if (this->Allocations.size() <= Mesh || !this->Allocations[Mesh].has_value())
+			throw logic_error("Geometry pool handle is not allocated!");
 
-		const VkSurfaceFormatKHR Surface_Format{ Choose_SwapChain_Surface_Format(this->m_Swap_Chain_Support_Details.Formats) };
-		const VkPresentModeKHR Present_Mode{ Choose_SwapChain_Present_Mode(this->m_Swap_Chain_Support_Details.Present_Modes) };
-		const VkExtent2D Swap_Chain_Extent{ Choose_SwapChain_Extent(this->m_Swap_Chain_Support_Details.Capabilities) };
+		return this->Allocations[Mesh].value();
+	}
 
-		//NOTE : Choose Image Count ,We Want One More Image Than Min Image Count
-		uint32_t Image_Count{ this->m_Swap_Chain_Support_Details.Capabilities.minImageCount + 1 };
-		Image_Count = std::clamp(Image_Count, this->m_Swap_Chain_Support_Details.Capabilities.minImageCount, this->m_Swap_Chain_Support_Details.Capabilities.maxImageCount);
+	const VkDeviceSize Get_Vertex_Byte_Offset(Handle Mesh) const {
+		return static_cast<VkDeviceSize>(this->Get(Mesh).Base_Vertex) * this->Vertex_Stride;
+	}
 
-		//TODO : Why We Need Graphics And Present Family
-		vector<uint32_t> Queue_Family_Indices{ this->m_Queue_Family_Indices.Graphics_Family,this->m_Queue_Family_Indices.Present_Family };
-		VkSharingMode Sharing_Mode{ VK_SHARING_MODE_EXCLUSIVE };
+	const VkDeviceSize Get_Index_Byte_Offset(Handle Mesh) const {
+		return static_cast<VkDeviceSize>(this->Get(Mesh).First_Index) * this->Get_Index_Size();
+	}
 
-		if (this->m_Queue_Family_Indices.Graphics_Family != this->m_Queue_Family_Indices.Present_Family)
-			Sharing_Mode = VK_SHARING_MODE_CONCURRENT;
+	const uint32_t Get_Vertex_Capacity(void) const {
+		return this->Vertices.Get_Capacity();
+	}
 
-		VkSwapchainCreateInfoKHR Swap_Chain_Create_Info{};
-		{
-			Swap_Chain_Create_Info.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
-			Swap_Chain_Create_Info.surface = this->m_Surface.get();
-			Swap_Chain_Create_Info.minImageCount = Image_Count;
-			Swap_Chain_Create_Info.imageFormat = Surface_Format.format;
-			Swap_Chain_Create_Info.imageColorSpace = Surface_Format.colorSpace;
-			Swap_Chain_Create_Info.imageExtent = Swap_Chain_Extent;
-			Swap_Chain_Create_Info.imageArrayLayers = 1;
-			Swap_Chain_Create_Info.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
-			Swap_Chain_Create_Info.imageSharingMode = Sharing_Mode;
-			Swap_Chain_Create_Info.queueFamilyIndexCount = static_cast<uint32_t>(Queue_Family_Indices.size());
-			Swap_Chain_Create_Info.pQueueFamilyIndices = Queue_Family_Indices.data();
-			Swap_Chain_Create_Info.preTransform = this->m_Swap_Chain_Support_Details.Capabilities.currentTransform;
-			Swap_Chain_Create_Info.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
-			Swap_Chain_Create_Info.presentMode = Present_Mode;
-			//NOTE : SHould Not Read Back Buffer
-			Swap_Chain_Create_Info.clipped = VK_TRUE;
-			Swap_Chain_Create_Info.oldSwapchain = VK_NULL_HANDLE;
-		}
+	const uint32_t Get_Index_Capacity(void) const {
+		return this->Indices.Get_Capacity();
+	}
 
-		VkSwapchainKHR Swap_Chain{ nullptr };
-		THROW_IF_VK_FAILED(vkCreateSwapchainKHR(this->m_Logical_Device.get(), &Swap_Chain_Create_Info, nullptr, &Swap_Chain));
+	const VkDeviceSize Get_Vertex_Buffer_Size(void) const {
+		return static_cast<VkDeviceSize>(this->Vertices.Get_Capacity()) * this->Vertex_Stride;
+	}
 
-		this->m_Swap_Chain.get_deleter() = [Device = this->m_Logical_Device.get()](VkSwapchainKHR Swap_Chain) {vkDestroySwapchainKHR(Device, Swap_Chain, nullptr); };
-		this->m_Swap_Chain.reset(Swap_Chain);
+	const VkDeviceSize Get_Index_Buffer_Size(void) const {
+		return static_cast<VkDeviceSize>(this->Indices.Get_Capacity()) * this->Get_Index_Size();
+	}
 
-		THROW_IF_VK_FAILED(vkGetSwapchainImagesKHR(this->m_Logical_Device.get(), this->m_Swap_Chain.get(), &Image_Count, nullptr));
-		this->m_Swap_Chain_Images.resize(Image_Count);
-		THROW_IF_VK_FAILED(vkGetSwapchainImagesKHR(this->m_Logical_Device.get(), this->m_Swap_Chain.get(), &Image_Count, this->m_Swap_Chain_Images.data()));
+	const VkIndexType Get_Index_Type(void) const {
+		return this->Index_Type;
+	}
 
-		this->m_Swap_Chain_Image_Format = Surface_Format.format;
-		this->m_Swap_Chain_Extent = Swap_Chain_Extent;
+	const uint32_t Get_Index_Size(void) const {
+		return VK_INDEX_TYPE_UINT16 == this->Index_Type ? sizeof(uint16_t) : sizeof(uint32_t);
 	}
 
-	void Create_SwapChhain_Image_Views(void) {
+	//NOTE : Share Of Free Space Outside The Largest Hole, 0 When One Allocation Of All Free Space Would Still Fit
+	const float Get_Fragmentation(void) const {
+		const auto Get_Range_Fragmentation = [](const Range_Allocator& Allocator) {
+			const uint32_t Free_Count{ Allocator.Get_Free_Count() };
+			return 0 == Free_Count ? 0.0f : 1.0f - static_cast<float>(Allocator.Get_Largest_Free()) / static_cast<float>(Free_Count);
+		};
 
-		this->m_Swap_Chain_Image_Views.resize(this->m_Swap_Chain_Images.size());
-		for (size_t Index = 0; Index < this->m_Swap_Chain_Images.size(); ++Index) {
+		return std::max(Get_Range_Fragmentation(this->Vertices), Get_Range_Fragmentation(this->Indices));
+	}
 
-			VkImageView Image_View{ this->Create_Image_View(
-				this->m_Swap_Chain_Images[Index],
-				1,
-				this->m_Swap_Chain_Image_Format,
-				VK_IMAGE_ASPECT_COLOR_BIT)
-			};
+	const uint32_t Get_Used_Vertices(void) const {
+		return this->Vertices.Get_Capacity() - this->Vertices.Get_Free_Count();
+	}
 
-			this->m_Swap_Chain_Image_Views[Index].get_deleter() = [Device = this->m_Logical_Device.get()](VkImageView Image_View) {if (nullptr != Image_View) vkDestroyImageView(Device, Image_View, nullptr); };
-			this->m_Swap_Chain_Image_Views[Index].reset(Image_View);
-		}
+	const uint32_t Get_Used_Indices(void) const {
+		return this->Indices.Get_Capacity() - this->Indices.Get_Free_Count();
 	}
 
-	void Create_Render_Pass(void) {
-		VkAttachmentDescription Color_Attachment{};
-		{
-			Color_Attachment.format = this->m_Swap_Chain_Image_Format;
-			Color_Attachment.samples = this->m_Msaa_Samples;
-			Color_Attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-			Color_Attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-			Color_Attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-			Color_Attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-			Color_Attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-			Color_Attachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-		}
+	//NOTE : Packs Live Meshes To The Front In Their Current Order Into New Capacities, Neighbouring Meshes Share One Copy Region
+	const Geometry_Defragment_Plan Defragment(uint32_t Vertex_Capacity, uint32_t Index_Capacity) {
+		if (Vertex_Capacity < this->Get_Used_Vertices() || Index_Capacity < this->Get_Used_Indices())
+			throw logic_error("Geometry pool capacity is smaller than the live geometry!");
 
-		VkAttachmentDescription Depth_Attachment{};
-		{
-			Depth_Attachment.format = this->Find_Depth_Format();
-			Depth_Attachment.samples = this->m_Msaa_Samples;
-			Depth_Attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-			Depth_Attachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-			Depth_Attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-			Depth_Attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-			Depth_Attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-			Depth_Attachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-		}
+		vector<Handle> Live{};
+		for (Handle Mesh = 0; Mesh < this->Allocations.size(); ++Mesh)
+			if (this->Allocations[Mesh].has_value())
+				Live.push_back(Mesh);
 
-		VkAttachmentDescription Color_Attachment_Resolve{};
-		{
-			Color_Attachment_Resolve.format = this->m_Swap_Chain_Image_Format;
-			Color_Attachment_Resolve.samples = VK_SAMPLE_COUNT_1_BIT;
-			Color_Attachment_Resolve.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-			Color_Attachment_Resolve.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-			Color_Attachment_Resolve.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-			Color_Attachment_Resolve.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-			Color_Attachment_Resolve.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-			Color_Attachment_Resolve.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
-		}
+		Geometry_Defragment_Plan Plan{};
+		const auto Append_Copy = [](vector<VkBufferCopy>& Copies, VkDeviceSize Source, VkDeviceSize Destination, VkDeviceSize Size) {
+			if (0 == Size)
+				return;
 
-		VkAttachmentReference Color_Attachment_Ref{};
-		{
-			Color_Attachment_Ref.attachment = 0;
-			Color_Attachment_Ref.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-		}
+			if (!Copies.empty() && Copies.back().srcOffset + Copies.back().size == Source && Copies.back().dstOffset + Copies.back().size == Destination)
+				Copies.back().size += Size;
+			else
+				Copies.push_back(VkBufferCopy{ Source, Destination, Size });
+		};
 
-		VkAttachmentReference Depth_Attachment_Ref{};
-		{
-			Depth_Attachment_Ref.attachment = 1;
-			Depth_Attachment_Ref.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+		//NOTE : Vertex And Index Ranges Of A Mesh Need Not Share An Order, So Each Buffer Is Packed On Its Own
+		sort(Live.begin(), Live.end(), [this](Handle Left, Handle Right) { return this->Allocations[Left]->Base_Vertex < this->Allocations[Right]->Base_Vertex; });
+		uint32_t Vertex_End{ 0 };
+		for (const Handle Mesh : Live) {
+			Geometry_Allocation& Allocation{ this->Allocations[Mesh].value() };
+			Append_Copy(Plan.Vertex_Copies,
+				static_cast<VkDeviceSize>(Allocation.Base_Vertex) * this->Vertex_Stride,
+				static_cast<VkDeviceSize>(Vertex_End) * this->Vertex_Stride,
+				static_cast<VkDeviceSize>(Allocation.Vertex_Count) * this->Vertex_Stride);
+
+			Allocation.Base_Vertex = Vertex_End;
+			Vertex_End += Allocation.Vertex_Count;
 		}
 
-		VkAttachmentReference Color_Attachment_Resolve_Ref{};
-		{
-			Color_Attachment_Resolve_Ref.attachment = 2;
-			Color_Attachment_Resolve_Ref.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+		sort(Live.begin(), Live.end(), [this](Handle Left, Handle Right) { return this->Allocations[Left]->First_Index < this->Allocations[Right]->First_Index; });
+		uint32_t Index_End{ 0 };
+		for (const Handle Mesh : Live) {
+			Geometry_Allocation& Allocation{ this->Allocations[Mesh].value() };
+			Append_Copy(Plan.Index_Copies,
+				static_cast<VkDeviceSize>(Allocation.First_Index) * this->Get_Index_Size(),
+				static_cast<VkDeviceSize>(Index_End) * this->Get_Index_Size(),
+				static_cast<VkDeviceSize>(Allocation.Index_Count) * this->Get_Index_Size());
+
+			Allocation.First_Index = Index_End;
+			Index_End += Allocation.Index_Count;
 		}
 
-		VkSubpassDescription Subpass{};
-		{
-			Subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
-			Subpass.colorAttachmentCount = 1;
-			Subpass.pColorAttachments = &Color_Attachment_Ref;
-			Subpass.pDepthStencilAttachment = &Depth_Attachment_Ref;
-			Subpass.pResolveAttachments = &Color_Attachment_Resolve_Ref;
-		}
+		this->Vertices.Reset(Vertex_Capacity, Vertex_End);
+		this->Indices.Reset(Index_Capacity, Index_End);
 
-		VkSubpassDependency Dependency{};
-		{
-			Dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
-			Dependency.dstSubpass = 0;
-			Dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
-			Dependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
-			Dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
-			Dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
-		}
+		return Plan;
+	}
 
-		array<VkAttachmentDescription, 3> Attachments{ Color_Attachment, Depth_Attachment, Color_Attachment_Resolve };
+private:
+	Range_Allocator Vertices{};
+	Range_Allocator Indices{};
+	uint32_t Vertex_Stride{ 0 };
+	VkIndexType Index_Type{ VK_INDEX_TYPE_UINT32 };
+	vector<optional<Geometry_Allocation>> Allocations{};
+	vector<Handle> Free_Handles{};
+};
 
-		VkRenderPassCreateInfo Render_Pass_Create_Info{};
+//NOTE : Plane Quadric Accumulated With Area Weights, Evaluates To The Mean Squared Distance To Its Planes
+struct Quadric final {
+	double A2{ 0 }, AB{ 0 }, AC{ 0 }, AD{ 0 };
+	double B2{ 0 }, BC{ 0 }, BD{ 0 };
+	double C2{ 0 }, CD{ 0 };
+	double D2{ 0 };
+	double W{ 0 };
+
+	static const Quadric From_Plane(const glm::dvec3& Normal, double Distance, double Weight) {
+		Quadric Result{};
 		{
-			Render_Pass_Create_Info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-			Render_Pass_Create_Info.attachmentCount = static_cast<uint32_t>(Attachments.size());
-			Render_Pass_Create_Info.pAttachments = Attachments.data();
-			Render_Pass_Create_Info.subpassCount = 1;
-			Render_Pass_Create_Info.pSubpasses = &Subpass;
-			Render_Pass_Create_Info.dependencyCount = 1;
-			Render_Pass_Create_Info.pDependencies = &Dependency;
+			Result.A2 = Weight * Normal.x * Normal.x; Result.AB = Weight * Normal.x * Normal.y; Result.AC = Weight * Normal.x * Normal.z; Result.AD = Weight * Normal.x * Distance;
+			Result.B2 = Weight * Normal.y * Normal.y; Result.BC = Weight * Normal.y * Normal.z; Result.BD = Weight * Normal.y * Distance;
+			Result.C2 = Weight * Normal.z * Normal.z; Result.CD = Weight * Normal.z * Distance;
+			Result.D2 = Weight * Distance * Distance;
+			Result.W = Weight;
 		}
 
-		VkRenderPass Render_Pass{ nullptr };
-		THROW_IF_VK_FAILED(vkCreateRenderPass(this->m_Logical_Device.get(), &Render_Pass_Create_Info, nullptr, &Render_Pass));
+		return Result;
+	}
 
-		this->m_Render_Pass.get_deleter() = [Device = this->m_Logical_Device.get()](VkRenderPass Render_Pass) {if (nullptr != Render_Pass) vkDestroyRenderPass(Device, Render_Pass, nullptr); };
-		this->m_Render_Pass.reset(Render_Pass);
+	Quadric& operator+=(const Quadric& Other) {
+		this->A2 += Other.A2; this->AB += Other.AB; this->AC += Other.AC; this->AD += Other.AD;
+		this->B2 += Other.B2; this->BC += Other.BC; this->BD += Other.BD;
+		this->C2 += Other.C2; this->CD += Other.CD;
+		this->D2 += Other.D2;
+		this->W += Other.W;
+		return *this;
 	}
 
-	void Create_Descriptor_Set_Layout(void) {
-		VkDescriptorSetLayoutBinding Ubo_Layout_Binding{};
-		{
-			Ubo_Layout_Binding.binding = 0;
-			Ubo_Layout_Binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-			Ubo_Layout_Binding.descriptorCount = 1;
-			Ubo_Layout_Binding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
-			Ubo_Layout_Binding.pImmutableSamplers = nullptr;
-		}
+	const double Evaluate(const glm::dvec3& Point) const {
+		const double X{ Point.x }, Y{ Point.y }, Z{ Point.z };
+		const double Error{
+			this->A2 * X * X + 2 * this->AB * X * Y + 2 * this->AC * X * Z + 2 * this->AD * X +
+			this->B2 * Y * Y + 2 * this->BC * Y * Z + 2 * this->BD * Y +
+			this->C2 * Z * Z + 2 * this->CD * Z +
+			this->D2 };
 
-		VkDescriptorSetLayoutBinding Sampler_Layout_Binding{};
-		{
-			Sampler_Layout_Binding.binding = 1;
-			Sampler_Layout_Binding.descriptorCount = 1;
-			Sampler_Layout_Binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-			Sampler_Layout_Binding.pImmutableSamplers = nullptr;
-			Sampler_Layout_Binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
-		}
+		return 0.0 < this->W ? std::max(Error, 0.0) / this->W : 0.0;
+	}
+};
 
-		array<VkDescriptorSetLayoutBinding, 2> Bindings{ Ubo_Layout_Binding, Sampler_Layout_Binding };
+//NOTE : Only The Diffuse Map Is Drawn, Materials Naming The Same Texture Share Its Slot
+struct Mesh_Material final {
+	string Name{};
+	string Texture_Path{};
+	//NOTE : Image Index Inside The GLB Named By Texture_Path, Negative For A Standalone Image File
+	int32_t Embedded_Image{ -1 };
+};
 
-		VkDescriptorSetLayoutCreateInfo Layout_Info{};
-		{
-			Layout_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-			Layout_Info.bindingCount = static_cast<uint32_t>(Bindings.size());
-			Layout_Info.pBindings = Bindings.data();
-		}
+//NOTE : Triangles Of One Material Within A LOD, Every Face Of That Material In Any Shape Is Batched Into It
+struct Mesh_Submesh final {
+	uint32_t First_Index{ 0 };
+	uint32_t Index_Count{ 0 };
+	uint32_t Material{ 0 };
+};
 
-		VkDescriptorSetLayout Descriptor_Set_Layout{ nullptr };
-		THROW_IF_VK_FAILED(vkCreateDescriptorSetLayout(this->m_Logical_Device.get(), &Layout_Info, nullptr, &Descriptor_Set_Layout));
+//NOTE : Submeshes Tile The LOD's Index Range In Order, So Its Draw Ranges Still Cover The LOD Front To Back
+struct Mesh_Lod final {
+	uint32_t First_Index{ 0 };
+	uint32_t Index_Count{ 0 };
+	//NOTE : Model Space Deviation From LOD 0, Used For Screen Space Selection
+	float Error{ 0.0f };
+	vector<Mesh_Submesh> Submeshes{};
+	vector<Mesh_Draw_Range> Draw_Ranges{};
+};
 
-		this->m_Descriptor_Set_Layout.get_deleter() = [Device = this->m_Logical_Device.get()](VkDescriptorSetLayout Descriptor_Set_Layout) {if (nullptr != Descriptor_Set_Layout) vkDestroyDescriptorSetLayout(Device, Descriptor_Set_Layout, nullptr); };
-		this->m_Descriptor_Set_Layout.reset(Descriptor_Set_Layout);
-	}
+//NOTE : What A Model File Parses Into, LOD 0 Comes Out As One Submesh Per Material In Use
+struct Model_Data final {
+	vector<Vertex> Vertices{};
+	vector<uint32_t> Indices{};
+	vector<Mesh_Material> Materials{};
+	vector<Mesh_Submesh> Submeshes{};
 
-	void Create_GraphicsPipeline(void) {
-		const auto& Vertex_Shader_Code = Read_File(std::filesystem::path(Vertex_Shader_File_Path, std::filesystem::path::generic_format));
-		const auto& Fragment_Shader_Code = Read_File(std::filesystem::path(Fragment_Shader_File_Path, std::filesystem::path::generic_format));
+	//NOTE : Buckets Hold The Indices Of One Source Material Each, Empty Ones Are Dropped So Unused Materials Take No Texture Slot
+	void Append_Buckets(const vector<vector<uint32_t>>& Buckets, const vector<Mesh_Material>& Bucket_Materials) {
+		for (size_t Bucket = 0; Bucket < Buckets.size(); ++Bucket) {
+			if (Buckets[Bucket].empty())
+				continue;
 
-		const auto& Vertex_Shader_Module = Create_Shader_Module(Vertex_Shader_Code);
-		const auto& Fragment_Shader_Module = Create_Shader_Module(Fragment_Shader_Code);
+			Mesh_Submesh Submesh{};
+			{
+				Submesh.First_Index = static_cast<uint32_t>(this->Indices.size());
+				Submesh.Index_Count = static_cast<uint32_t>(Buckets[Bucket].size());
+				Submesh.Material = static_cast<uint32_t>(this->Materials.size());
+			}
+			this->Submeshes.push_back(Submesh);
 
-		VkPipelineShaderStageCreateInfo Vertex_Shader_Stage_Info{};
-		{
-			Vertex_Shader_Stage_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-			Vertex_Shader_Stage_Info.stage = VK_SHADER_STAGE_VERTEX_BIT;
-			Vertex_Shader_Stage_Info.module = Vertex_Shader_Module;
-			Vertex_Shader_Stage_Info.pName = "main";
-			Vertex_Shader_Stage_Info.pSpecializationInfo = nullptr;
+			this->Materials.push_back(Bucket_Materials[Bucket]);
+			this->Indices.insert(this->Indices.end(), Buckets[Bucket].begin(), Buckets[Bucket].end());
 		}
+	}
 
-		VkPipelineShaderStageCreateInfo Fragment_Shader_Stage_Info{};
+	//NOTE : Faces Without A Material Draw With The Model Texture
+	static const Mesh_Material Get_Default_Material(void) {
+		Mesh_Material Material{};
 		{
-			Fragment_Shader_Stage_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-			Fragment_Shader_Stage_Info.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-			Fragment_Shader_Stage_Info.module = Fragment_Shader_Module;
-			Fragment_Shader_Stage_Info.pName = "main";
-			Fragment_Shader_Stage_Info.pSpecializationInfo = nullptr;
+			Material.Name = "default";
+			Material.Texture_Path = std::filesystem::path{ Model_Texture_File_Path, std::filesystem::path::generic_format }.generic_string();
 		}
 
-		const auto& Binding_Description = Vertex::Get_Binding_Description();
+		return Material;
+	}
+};
 
-		const auto& Attribute_Descriptions = Vertex::Get_Attribute_Descriptions();
+//NOTE : Faces Are Gathered Per Material Across Every Shape, Vertices Are Deduplicated Since OBJ Indexes Each Attribute On Its Own
+struct Obj_Loader final {
+	static const Model_Data Load(const std::filesystem::path& Path, const Vertex_Layout& Layout) {
+		tinyobj::attrib_t Attrib;
+		vector<tinyobj::shape_t> Shapes;
+		vector<tinyobj::material_t> Materials;
+		string Warning, Error;
 
-		VkPipelineVertexInputStateCreateInfo Vertex_Input_Info{};
-		{
-			Vertex_Input_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-			Vertex_Input_Info.vertexBindingDescriptionCount = 1;
-			Vertex_Input_Info.pVertexBindingDescriptions = &Binding_Description;
-			Vertex_Input_Info.vertexAttributeDescriptionCount = static_cast<uint32_t>(Attribute_Descriptions.size());
-			Vertex_Input_Info.pVertexAttributeDescriptions = Attribute_Descriptions.data();
-		}
+		//NOTE : Material Libraries And The Textures They Name Are Relative To The Model
+		const std::filesystem::path Model_Directory{ Path.parent_path() };
 
-		VkPipelineInputAssemblyStateCreateInfo Input_Assembly_Info{};
-		{
-			Input_Assembly_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-			Input_Assembly_Info.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-			Input_Assembly_Info.primitiveRestartEnable = VK_FALSE;
-		}
+		if (!tinyobj::LoadObj(&Attrib, &Shapes, &Materials, &Warning, &Error, Path.generic_string().c_str(), Model_Directory.generic_string().c_str()))
+			throw runtime_error(Warning + Error);
 
-		VkViewport Viewport{};
-		{
-			Viewport.x = 0.0f;
-			Viewport.y = 0.0f;
-			Viewport.width = static_cast<float>(this->m_Swap_Chain_Extent.width);
-			Viewport.height = static_cast<float>(this->m_Swap_Chain_Extent.height);
-			Viewport.minDepth = 0.0f;
-			Viewport.maxDepth = 1.0f;
-		}
+		Model_Data Model{};
+		unordered_map<Vertex, uint32_t> Unique_Vertices{};
 
-		VkRect2D Scissor{};
-		{
-			Scissor.offset = { 0, 0 };
-			Scissor.extent = this->m_Swap_Chain_Extent;
-		}
+		//NOTE : Bucket 0 Holds Faces Without A Material, Bucket N Those Of OBJ Material N - 1
+		vector<vector<uint32_t>> Buckets(Materials.size() + 1);
 
-		VkPipelineViewportStateCreateInfo Viewport_State_Info{};
-		{
-			//TODO : Ignore Some Field
-			Viewport_State_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
-			Viewport_State_Info.viewportCount = 1;
-			//Viewport_State_Info.pViewports = &Viewport;
-			Viewport_State_Info.scissorCount = 1;
-			//Viewport_State_Info.pScissors = &Scissor;
-		}
+		for (const auto& Shape : Shapes) {
+			for (size_t Corner = 0; Corner < Shape.mesh.indices.size(); ++Corner) {
+				const auto& Index{ Shape.mesh.indices[Corner] };
 
-		VkPipelineRasterizationStateCreateInfo Rasterizer{};
-		{
-			Rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
-			Rasterizer.depthClampEnable = VK_FALSE;
-			Rasterizer.rasterizerDiscardEnable = VK_FALSE;
-			Rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
-			Rasterizer.cullMode = VK_CULL_MODE_BACK_BIT;
-			Rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
-			Rasterizer.depthBiasEnable = VK_FALSE;
-			Rasterizer.depthBiasConstantFactor = 0.0f;
-			Rasterizer.depthBiasClamp = 0.0f;
-			Rasterizer.depthBiasSlopeFactor = 0.0f;
-			Rasterizer.lineWidth = 1.0f;
-		}
+				Vertex Vertex{};
 
-		VkPipelineMultisampleStateCreateInfo Multisampling{};
-		{
-			Multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-			Multisampling.rasterizationSamples = this->m_Msaa_Samples;
-			Multisampling.sampleShadingEnable = VK_FALSE;
-			Multisampling.minSampleShading = 0.f;
-			Multisampling.pSampleMask = nullptr;
-			Multisampling.alphaToCoverageEnable = VK_FALSE;
-			Multisampling.alphaToOneEnable = VK_FALSE;
+				Vertex.Pos = {
+					Attrib.vertices[3 * Index.vertex_index + 0],
+					Attrib.vertices[3 * Index.vertex_index + 1],
+					Attrib.vertices[3 * Index.vertex_index + 2]
+				};
 
-		}
+				if (0 <= Index.texcoord_index)
+					Vertex.TexCoord = {
+						Attrib.texcoords[2 * Index.texcoord_index + 0],
+						1.0f - Attrib.texcoords[2 * Index.texcoord_index + 1]
+					};
 
-		VkPipelineDepthStencilStateCreateInfo Depth_Stencile{};
-		{
-			Depth_Stencile.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
-			Depth_Stencile.depthTestEnable = VK_TRUE;
-			Depth_Stencile.depthWriteEnable = VK_TRUE;
-			Depth_Stencile.depthCompareOp = VK_COMPARE_OP_LESS;
-			Depth_Stencile.depthBoundsTestEnable = VK_FALSE;
-			Depth_Stencile.minDepthBounds = 0.0f;
-			Depth_Stencile.maxDepthBounds = 1.0f;
-			Depth_Stencile.stencilTestEnable = VK_FALSE;
-			Depth_Stencile.front = {};
-			Depth_Stencile.back = {};
-		}
+				Vertex.Color = { 1.0f, 1.0f, 1.0f };
 
-		VkPipelineColorBlendAttachmentState Color_Blend_Attachment{};
-		{
-			Color_Blend_Attachment.blendEnable = VK_FALSE;
-			Color_Blend_Attachment.srcColorBlendFactor = VK_BLEND_FACTOR_ZERO;
-			Color_Blend_Attachment.dstColorBlendFactor = VK_BLEND_FACTOR_ZERO;
-			Color_Blend_Attachment.colorBlendOp = VK_BLEND_OP_ADD;
-			Color_Blend_Attachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
-			Color_Blend_Attachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
-			Color_Blend_Attachment.alphaBlendOp = VK_BLEND_OP_ADD;
-			Color_Blend_Attachment.colorWriteMask =
-				VK_COLOR_COMPONENT_R_BIT |
-				VK_COLOR_COMPONENT_G_BIT |
-				VK_COLOR_COMPONENT_B_BIT |
-				VK_COLOR_COMPONENT_A_BIT;
-		}
+				//NOTE : Unused Attributes Stay Zero So They Do Not Split Otherwise Identical Vertices
+				if (Layout.Has(Vertex_Attribute_Normal) && 0 <= Index.normal_index)
+					Vertex.Normal = {
+						Attrib.normals[3 * Index.normal_index + 0],
+						Attrib.normals[3 * Index.normal_index + 1],
+						Attrib.normals[3 * Index.normal_index + 2]
+					};
 
-		VkPipelineColorBlendStateCreateInfo Color_Blending{};
-		{
-			Color_Blending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-			//NOTE : If Attend This Object, It Will Be Disable Color Blend
-			Color_Blending.logicOpEnable = VK_FALSE;
-			Color_Blending.logicOp = VK_LOGIC_OP_COPY;
-			Color_Blending.attachmentCount = 1;
-			Color_Blending.pAttachments = &Color_Blend_Attachment;
-			Color_Blending.blendConstants[0] = 0.0f;
-			Color_Blending.blendConstants[1] = 0.0f;
-			Color_Blending.blendConstants[2] = 0.0f;
-			Color_Blending.blendConstants[3] = 0.0f;
-		}
+				if (Unique_Vertices.count(Vertex) == 0) {
+					Unique_Vertices[Vertex] = static_cast<uint32_t>(Model.Vertices.size());
 
-		vector<VkDynamicState> Dynamic_States{
-			VK_DYNAMIC_STATE_VIEWPORT,
-			VK_DYNAMIC_STATE_SCISSOR
-		};
+					Model.Vertices.push_back(Vertex);
+				}
 
-		//NOTE : If Set Dynamic Field ,Old Static Field Will Be Disable, So We Should Set All Field In Feature 
-		VkPipelineDynamicStateCreateInfo Dynamic_State{};
-		{
-			Dynamic_State.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
-			Dynamic_State.dynamicStateCount = static_cast<uint32_t>(Dynamic_States.size());
-			Dynamic_State.pDynamicStates = Dynamic_States.data();
+				//NOTE : Faces Are Triangulated On Load, So Every Three Corners Share One Material Id
+				const size_t Face{ Corner / 3 };
+				const int Material_Id{ Face < Shape.mesh.material_ids.size() ? Shape.mesh.material_ids[Face] : -1 };
+				const size_t Bucket{ 0 <= Material_Id && static_cast<size_t>(Material_Id) < Materials.size() ? static_cast<size_t>(Material_Id) + 1 : 0 };
+				Buckets[Bucket].push_back(Unique_Vertices[Vertex]);
+			}
 		}
 
-		VkDescriptorSetLayout Set_Layouts[] = { this->m_Descriptor_Set_Layout.get() };
-		VkPipelineLayoutCreateInfo Pipeline_Layout_Info{};
+		vector<Mesh_Material> Bucket_Materials{ Model_Data::Get_Default_Material() };
+		for (const auto& Source : Materials)
+			Bucket_Materials.push_back(Obj_Loader::Get_Material(Source, Model_Directory));
+
+		Model.Append_Buckets(Buckets, Bucket_Materials);
+		return Model;
+	}
+
+	static const Mesh_Material Get_Material(const tinyobj::material_t& Source, const std::filesystem::path& Model_Directory) {
+		Mesh_Material Material{};
 		{
-			Pipeline_Layout_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-			Pipeline_Layout_Info.setLayoutCount = 1;
-			Pipeline_Layout_Info.pSetLayouts = Set_Layouts;
-			Pipeline_Layout_Info.pushConstantRangeCount = 0;
-			Pipeline_Layout_Info.pPushConstantRanges = nullptr;
+			Material.Name = Source.name;
+			if (!Source.diffuse_texname.empty())
+				Material.Texture_Path = (Model_Directory / std::filesystem::path{ Source.diffuse_texname, std::filesystem::path::generic_format }).generic_string();
 		}
 
-		VkPipelineLayout Pipeline_Layout{ nullptr };
-		THROW_IF_VK_FAILED(vkCreatePipelineLayout(this->m_Logical_Device.get(), &Pipeline_Layout_Info, nullptr, &Pipeline_Layout));
+		return Material;
+	}
+};
 
-		this->m_Pipeline_Layout.get_deleter() = [Device = this->m_Logical_Device.get()](VkPipelineLayout Pipeline_Layout) {if (nullptr != Pipeline_Layout) vkDestroyPipelineLayout(Device, Pipeline_Layout, nullptr); };
-		this->m_Pipeline_Layout.reset(Pipeline_Layout);
+//NOTE : Read Only View Of A Whole File, Pages Are Faulted In As They Are Touched Rather Than Copied Up Front
+struct Mapped_File final {
+	explicit Mapped_File(const std::filesystem::path& Path) {
+#ifdef _WIN32
+		this->File = CreateFileW(Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (INVALID_HANDLE_VALUE == this->File)
+			throw runtime_error("Failed to open file!");
+
+		LARGE_INTEGER File_Size{};
+		if (!GetFileSizeEx(this->File, &File_Size)) {
+			CloseHandle(this->File);
+			throw runtime_error("Failed to open file!");
+		}
 
-		const VkPipelineShaderStageCreateInfo Shader_Stages[] = { Vertex_Shader_Stage_Info,Fragment_Shader_Stage_Info };
+		this->Size = static_cast<size_t>(File_Size.QuadPart);
+		if (0 == this->Size)
+			return;
 
-		VkGraphicsPipelineCreateInfo Pipeline_Info{};
-		{
-			Pipeline_Info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-			Pipeline_Info.stageCount = 2;
-			Pipeline_Info.pStages = Shader_Stages;
-			Pipeline_Info.pVertexInputState = &Vertex_Input_Info;
-			Pipeline_Info.pInputAssemblyState = &Input_Assembly_Info;
-			Pipeline_Info.pTessellationState = nullptr;
-			Pipeline_Info.pViewportState = &Viewport_State_Info;
-			Pipeline_Info.pRasterizationState = &Rasterizer;
-			Pipeline_Info.pMultisampleState = &Multisampling;
-			Pipeline_Info.pDepthStencilState = &Depth_Stencile;
-			Pipeline_Info.pColorBlendState = &Color_Blending;
-			Pipeline_Info.pDynamicState = &Dynamic_State;
-			Pipeline_Info.layout = this->m_Pipeline_Layout.get();
-			Pipeline_Info.renderPass = this->m_Render_Pass.get();
-			Pipeline_Info.subpass = 0;
-			//NOTE : Only Flag Use VK PIPELINE CREATE DERIVATIVE BIT Can Be Usefual 
-			Pipeline_Info.basePipelineHandle = VK_NULL_HANDLE;
-			//Pipeline_Info.basePipelineIndex = -1;
+		this->Mapping = CreateFileMappingW(this->File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		this->Data = nullptr == this->Mapping ? nullptr : static_cast<const uint8_t*>(MapViewOfFile(this->Mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+		this->File = open(Path.c_str(), O_RDONLY);
+		if (0 > this->File)
+			throw runtime_error("Failed to open file!");
+
+		struct stat File_Status {};
+		if (0 != fstat(this->File, &File_Status)) {
+			close(this->File);
+			throw runtime_error("Failed to open file!");
 		}
 
-		VkPipeline Graphics_Pipeline{ nullptr };
-		THROW_IF_VK_FAILED(vkCreateGraphicsPipelines(this->m_Logical_Device.get(), VK_NULL_HANDLE, 1, &Pipeline_Info, nullptr, &Graphics_Pipeline));
-
-		this->m_Graphics_Pipeline.get_deleter() = [Device = this->m_Logical_Device.get()](VkPipeline Graphics_Pipeline) {if (nullptr != Graphics_Pipeline) vkDestroyPipeline(Device, Graphics_Pipeline, nullptr); };
-		this->m_Graphics_Pipeline.reset(Graphics_Pipeline);
+		this->Size = static_cast<size_t>(File_Status.st_size);
+		if (0 == this->Size)
+			return;
 
-		vkDestroyShaderModule(this->m_Logical_Device.get(), Fragment_Shader_Module, nullptr);
-		vkDestroyShaderModule(this->m_Logical_Device.get(), Vertex_Shader_Module, nullptr);
+		void* const View{ mmap(nullptr, this->Size, PROT_READ, MAP_PRIVATE, this->File, 0) };
+		this->Data = MAP_FAILED == View ? nullptr : static_cast<const uint8_t*>(View);
+#endif
+		if (nullptr == this->Data) {
+			this->Release();
+			throw runtime_error("Failed to map file!");
+		}
 	}
 
-	void Create_Command_Pool(void) {
-		VkCommandPoolCreateInfo Command_Pool_Info{};
-		{
-			Command_Pool_Info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-			Command_Pool_Info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-			Command_Pool_Info.queueFamilyIndex = this->m_Queue_Family_Indices.Graphics_Family;
-		}
+	Mapped_File(const Mapped_File&) = delete;
+	Mapped_File& operator=(const Mapped_File&) = delete;
 
-		VkCommandPool Command_Pool{ nullptr };
-		THROW_IF_VK_FAILED(vkCreateCommandPool(this->m_Logical_Device.get(), &Command_Pool_Info, nullptr, &Command_Pool));
+	~Mapped_File(void) {
+		this->Release();
+	}
 
-		this->m_Command_Pool.get_deleter() = [Device = this->m_Logical_Device.get()](VkCommandPool Command_Pool) {if (nullptr != Command_Pool) vkDestroyCommandPool(Device, Command_Pool, nullptr); };
-		this->m_Command_Pool.reset(Command_Pool);
+	const uint8_t* Get_Data(void) const {
+		return this->Data;
 	}
 
-	void Create_Color_Resource(void) {
-		VkFormat Color_Format{ this->m_Swap_Chain_Image_Format };
+	//NOTE : Drops The Resident Pages Of A Range Already Read, Offset Has To Be Page Aligned, Clean File Pages Fault Back In If Touched Again
+	void Evict(size_t Offset, size_t Length) const {
+		if (nullptr == this->Data || Offset >= this->Size)
+			return;
 
-		VkImage Color_Image{ nullptr };
-		VkDeviceMemory Color_Image_Memory{ nullptr };
-		this->Create_Image(
-			this->m_Swap_Chain_Extent.width,
-			this->m_Swap_Chain_Extent.height,
-			1,
-			Color_Format,
-			this->m_Msaa_Samples,
-			VK_IMAGE_TILING_OPTIMAL,
-			VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
-			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-			Color_Image,
-			Color_Image_Memory
-		);
-
-		this->m_Color_Image.get_deleter() = [Device = this->m_Logical_Device.get()](VkImage Color_Image) {if (nullptr != Color_Image) vkDestroyImage(Device, Color_Image, nullptr); };
-		this->m_Color_Image.reset(Color_Image);
-
-		this->m_Color_Image_Memory.get_deleter() = [Device = this->m_Logical_Device.get()](VkDeviceMemory Color_Image_Memory) {if (nullptr != Color_Image_Memory) vkFreeMemory(Device, Color_Image_Memory, nullptr); };
-		this->m_Color_Image_Memory.reset(Color_Image_Memory);
+		Length = std::min(Length, this->Size - Offset);
+#ifdef _WIN32
+		//NOTE : Unlocking Pages That Were Never Locked Removes Them From The Working Set
+		VirtualUnlock(const_cast<uint8_t*>(this->Data + Offset), Length);
+#else
+		madvise(const_cast<uint8_t*>(this->Data + Offset), Length, MADV_DONTNEED);
+#endif
+	}
 
-		this->m_Color_Image_View.get_deleter() = [Device = this->m_Logical_Device.get()](VkImageView Color_Image_View) {if (nullptr != Color_Image_View) vkDestroyImageView(Device, Color_Image_View, nullptr); };
-		this->m_Color_Image_View.reset(this->Create_Image_View(this->m_Color_Image.get(), 1, Color_Format, VK_IMAGE_ASPECT_COLOR_BIT));
+	const size_t Get_Size(void) const {
+		return this->Size;
 	}
 
-	const VkFormat Find_Depth_Format(void) {
-		return this->Find_Supported_Format(
-			{ VK_FORMAT_D32_SFLOAT,VK_FORMAT_D32_SFLOAT_S8_UINT,VK_FORMAT_D24_UNORM_S8_UINT },
-			VK_IMAGE_TILING_OPTIMAL,
-			VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT
-		);
+private:
+	void Release(void) {
+#ifdef _WIN32
+		if (nullptr != this->Data)
+			UnmapViewOfFile(this->Data);
+		if (nullptr != this->Mapping)
+			CloseHandle(this->Mapping);
+		if (INVALID_HANDLE_VALUE != this->File)
+			CloseHandle(this->File);
+		this->Mapping = nullptr;
+		this->File = INVALID_HANDLE_VALUE;
+#else
+		if (nullptr != this->Data)
+			munmap(const_cast<uint8_t*>(this->Data), this->Size);
+		if (0 <= this->File)
+			close(this->File);
+		this->File = -1;
+#endif
+		this->Data = nullptr;
 	}
 
-	void Create_Depth_Resource() {
-		VkFormat Depth_Format{ this->Find_Depth_Format() };
+#ifdef _WIN32
+	HANDLE File{ INVALID_HANDLE_VALUE };
+	HANDLE Mapping{ nullptr };
+#else
+	int File{ -1 };
+#endif
+	const uint8_t* Data{ nullptr };
+	size_t Size{ 0 };
+};
 
-		VkImage Depth_Image{ nullptr };
-		VkDeviceMemory Depth_Image_Memory{ nullptr };
-		this->Create_Image(
-			this->m_Swap_Chain_Extent.width,
-			this->m_Swap_Chain_Extent.height,
-			1,
-			Depth_Format,
-			this->m_Msaa_Samples,
-			VK_IMAGE_TILING_OPTIMAL,
-			VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
-			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-			Depth_Image,
-			Depth_Image_Memory
-		);
+//NOTE : Just Enough JSON For glTF, Numbers Are Doubles And Object Members Keep Their File Order
+struct Json_Value final {
+	enum class Type : uint32_t { Null, Boolean, Number, String, Array, Object };
+
+	Type Kind{ Type::Null };
+	bool Boolean{ false };
+	double Number{ 0.0 };
+	string String{};
+	//NOTE : Array Elements, Or Object Member Values Alongside Keys
+	vector<Json_Value> Elements{};
+	vector<string> Keys{};
+
+	static const Json_Value Parse(const char* Begin, const char* End) {
+		const char* At{ Begin };
+		Json_Value Value{ Json_Value::Parse_Value(At, End, 0) };
+		Json_Value::Skip_Space(At, End);
+		//NOTE : The GLB JSON Chunk Is Padded With Spaces, Which Skip_Space Already Consumed
+		if (At != End)
+			throw runtime_error("Malformed JSON!");
+
+		return Value;
+	}
 
-		this->m_Depth_Image.get_deleter() = [Device = this->m_Logical_Device.get()](VkImage Depth_Image) {if (nullptr != Depth_Image) vkDestroyImage(Device, Depth_Image, nullptr); };
-		this->m_Depth_Image.reset(Depth_Image);
+	const Json_Value* Find(const string& Key) const {
+		if (Type::Object != this->Kind)
+			return nullptr;
 
-		this->m_Depth_Image_Memory.get_deleter() = [Device = this->m_Logical_Device.get()](VkDeviceMemory Depth_Image_Memory) {if (nullptr != Depth_Image_Memory) vkFreeMemory(Device, Depth_Image_Memory, nullptr); };
-		this->m_Depth_Image_Memory.reset(Depth_Image_Memory);
+		for (size_t Index = 0; Index < this->Keys.size(); ++Index)
+			if (Key == this->Keys[Index])
+				return &this->Elements[Index];
 
-		this->m_Depth_Image_View.get_deleter() = [Device = this->m_Logical_Device.get()](VkImageView Depth_Image_View) {if (nullptr != Depth_Image_View) vkDestroyImageView(Device, Depth_Image_View, nullptr); };
-		this->m_Depth_Image_View.reset(this->Create_Image_View(this->m_Depth_Image.get(), 1, Depth_Format, VK_IMAGE_ASPECT_DEPTH_BIT));
+		return nullptr;
 	}
 
-	void Create_Frame_Buffers(void) {
-		this->m_Swap_Chain_Frame_buffers.resize(this->m_Swap_Chain_Image_Views.size());
-
-		for (size_t Index = 0; Index < this->m_Swap_Chain_Image_Views.size(); ++Index) {
-			array<VkImageView, 3> Attachments{ this->m_Color_Image_View.get(),this->m_Depth_Image_View.get(),this->m_Swap_Chain_Image_Views[Index].get()
-			};
+	//NOTE : Missing Members And Members Of Another Type Read As The Default, Optional glTF Properties Need No Special Casing
+	const double Get_Number(const string& Key, double Default) const {
+		const Json_Value* Value{ this->Find(Key) };
+		return nullptr != Value && Type::Number == Value->Kind ? Value->Number : Default;
+	}
 
-			VkFramebufferCreateInfo Framebuffer_Info{};
-			{
-				Framebuffer_Info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-				Framebuffer_Info.renderPass = this->m_Render_Pass.get();
-				Framebuffer_Info.attachmentCount = static_cast<uint32_t>(Attachments.size());
-				Framebuffer_Info.pAttachments = Attachments.data();
-				Framebuffer_Info.width = this->m_Swap_Chain_Extent.width;
-				Framebuffer_Info.height = this->m_Swap_Chain_Extent.height;
-				Framebuffer_Info.layers = 1;
-			}
+	//NOTE : Indices, Counts And Byte Offsets, Negative Or Fractional Values Read As Out Of Range So Bounds Checks Reject Them
+	const size_t Get_Index(const string& Key, size_t Default = numeric_limits<size_t>::max()) const {
+		const Json_Value* Value{ this->Find(Key) };
+		return nullptr != Value ? Value->As_Index() : Default;
+	}
 
-			VkFramebuffer Framebuffer{ nullptr };
-			THROW_IF_VK_FAILED(vkCreateFramebuffer(this->m_Logical_Device.get(), &Framebuffer_Info, nullptr, &Framebuffer));
+	const size_t As_Index(void) const {
+		return Type::Number == this->Kind && 0.0 <= this->Number && this->Number < 4294967296.0 && std::floor(this->Number) == this->Number ? static_cast<size_t>(this->Number) : numeric_limits<size_t>::max();
+	}
 
-			this->m_Swap_Chain_Frame_buffers[Index].get_deleter() = [Device = this->m_Logical_Device.get()](VkFramebuffer Framebuffer) {if (nullptr != Framebuffer) vkDestroyFramebuffer(Device, Framebuffer, nullptr); };
-			this->m_Swap_Chain_Frame_buffers[Index].reset(Framebuffer);
-		}
+	const string Get_String(const string& Key) const {
+		const Json_Value* Value{ this->Find(Key) };
+		return nullptr != Value && Type::String == Value->Kind ? Value->String : string{};
 	}
 
-	void Create_Texture_Image(void) {
-		int Width{ 0 }, Height{ 0 }, Channels{ 0 };
-		stbi_uc* Pixels = stbi_load(
-			std::filesystem::path{ Model_Texture_File_Path,std::filesystem::path::generic_format }.generic_string().c_str(),
-			&Width,
-			&Height,
-			&Channels,
-			STBI_rgb_alpha
-		);
-		if (nullptr == Pixels)
-			throw runtime_error("Failed to load texture image!");
+	//NOTE : Elements Of An Array Member, Empty When It Is Missing
+	const vector<Json_Value>& Get_Array(const string& Key) const {
+		static const vector<Json_Value> Empty{};
+		const Json_Value* Value{ this->Find(Key) };
+		return nullptr != Value && Type::Array == Value->Kind ? Value->Elements : Empty;
+	}
 
-		this->m_Mip_Levels = static_cast<uint32_t>(std::floor(std::log2(std::max(Width, Height)))) + 1;
+private:
+	//NOTE : Deep Enough For Any glTF, Shallow Enough That A Hostile File Cannot Exhaust The Stack
+	static constexpr uint32_t Max_Depth{ 64 };
 
-		VkDeviceSize Image_Size = static_cast<VkDeviceSize>(Width * Height * 4);
+	static void Skip_Space(const char*& At, const char* End) {
+		while (At < End && (' ' == *At || '\t' == *At || '\n' == *At || '\r' == *At))
+			++At;
+	}
 
-		VkBuffer Staging_Buffer{ nullptr };
-		VkDeviceMemory Staging_Buffer_Memory{ nullptr };
-		this->Create_Buffer(
-			Image_Size,
-			VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-			Staging_Buffer,
-			Staging_Buffer_Memory
-		);
+	static void Expect(const char*& At, const char* End, const char* Literal) {
+		for (; '\0' != *Literal; ++Literal, ++At)
+			if (At >= End || *At != *Literal)
+				throw runtime_error("Malformed JSON!");
+	}
 
-		void* Data{ nullptr };
-		THROW_IF_VK_FAILED(vkMapMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory, 0, Image_Size, 0, &Data));
-		memcpy(Data, Pixels, static_cast<size_t>(Image_Size));
-		vkUnmapMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory);
+	static const Json_Value Parse_Value(const char*& At, const char* End, uint32_t Depth) {
+		Json_Value::Skip_Space(At, End);
+		if (At >= End || Depth > Max_Depth)
+			throw runtime_error("Malformed JSON!");
+
+		Json_Value Value{};
+		switch (*At) {
+		case '{': {
+			Value.Kind = Type::Object;
+			++At;
+			Json_Value::Skip_Space(At, End);
+			if (At < End && '}' == *At) {
+				++At;
+				break;
+			}
 
-		stbi_image_free(Pixels);
+			while (true) {
+				Json_Value::Skip_Space(At, End);
+				Value.Keys.push_back(Json_Value::Parse_String(At, End));
+				Json_Value::Skip_Space(At, End);
+				Json_Value::Expect(At, End, ":");
+				Value.Elements.push_back(Json_Value::Parse_Value(At, End, Depth + 1));
+				Json_Value::Skip_Space(At, End);
+				if (At < End && ',' == *At) {
+					++At;
+					continue;
+				}
+				Json_Value::Expect(At, End, "}");
+				break;
+			}
+			break;
+		}
+		case '[': {
+			Value.Kind = Type::Array;
+			++At;
+			Json_Value::Skip_Space(At, End);
+			if (At < End && ']' == *At) {
+				++At;
+				break;
+			}
 
-		VkImage Texture_Image{ nullptr };
-		VkDeviceMemory Texture_Image_Memory{ nullptr };
-		this->Create_Image(
-			Width, Height,
-			this->m_Mip_Levels,
-			VK_FORMAT_R8G8B8A8_SRGB,
-			VK_SAMPLE_COUNT_1_BIT,
-			VK_IMAGE_TILING_OPTIMAL,
-			VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-			Texture_Image,
-			Texture_Image_Memory
-		);
+			while (true) {
+				Value.Elements.push_back(Json_Value::Parse_Value(At, End, Depth + 1));
+				Json_Value::Skip_Space(At, End);
+				if (At < End && ',' == *At) {
+					++At;
+					continue;
+				}
+				Json_Value::Expect(At, End, "]");
+				break;
+			}
+			break;
+		}
+		case '"':
+			Value.Kind = Type::String;
+			Value.String = Json_Value::Parse_String(At, End);
+			break;
+		case 't':
+			Json_Value::Expect(At, End, "true");
+			Value.Kind = Type::Boolean;
+			Value.Boolean = true;
+			break;
+		case 'f':
+			Json_Value::Expect(At, End, "false");
+			Value.Kind = Type::Boolean;
+			break;
+		case 'n':
+			Json_Value::Expect(At, End, "null");
+			break;
+		default: {
+			//NOTE : from_chars Takes No Leading Plus, Neither Does JSON
+			const auto Result{ std::from_chars(At, End, Value.Number) };
+			if (std::errc{} != Result.ec)
+				throw runtime_error("Malformed JSON!");
+
+			Value.Kind = Type::Number;
+			At = Result.ptr;
+			break;
+		}
+		}
 
-		this->m_Texture_Image.get_deleter() = [Device = this->m_Logical_Device.get()](VkImage Texture_Image) {if (nullptr != Texture_Image) vkDestroyImage(Device, Texture_Image, nullptr); };
-		this->m_Texture_Image.reset(Texture_Image);
+		return Value;
+	}
 
-		this->m_Texture_Image_Memory.get_deleter() = [Device = this->m_Logical_Device.get()](VkDeviceMemory Texture_Image_Memory) {if (nullptr != Texture_Image_Memory) vkFreeMemory(Device, Texture_Image_Memory, nullptr); };
-		this->m_Texture_Image_Memory.reset(Texture_Image_Memory);
+	static const string Parse_String(const char*& At, const char* End) {
+		Json_Value::Expect(At, End, "\"");
 
-		this->Transition_Image_Layout(
-			this->m_Texture_Image.get(),
-			this->m_Mip_Levels,
-			VK_FORMAT_R8G8B8A8_SRGB,
-			VK_IMAGE_LAYOUT_UNDEFINED,
-			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
-		);
+		string Text{};
+		while (At < End && '"' != *At) {
+			if ('\\' != *At) {
+				Text.push_back(*At++);
+				continue;
+			}
 
-		this->Copy_Buffer_To_Image(Staging_Buffer, this->m_Texture_Image.get(), static_cast<uint32_t>(Width), static_cast<uint32_t>(Height));
+			if (++At >= End)
+				break;
 
-		vkDestroyBuffer(this->m_Logical_Device.get(), Staging_Buffer, nullptr);
-		vkFreeMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory, nullptr);
+			switch (*At++) {
+			case '"': Text.push_back('"'); break;
+			case '\\': Text.push_back('\\'); break;
+			case '/': Text.push_back('/'); break;
+			case 'b': Text.push_back('\b'); break;
+			case 'f': Text.push_back('\f'); break;
+			case 'n': Text.push_back('\n'); break;
+			case 'r': Text.push_back('\r'); break;
+			case 't': Text.push_back('\t'); break;
+			case 'u': {
+				uint32_t Code_Point{ Json_Value::Parse_Hex4(At, End) };
+				//NOTE : Characters Outside The Basic Plane Arrive As A Surrogate Pair
+				if (0xD800 <= Code_Point && Code_Point < 0xDC00 && End - At >= 6 && '\\' == At[0] && 'u' == At[1]) {
+					At += 2;
+					Code_Point = 0x10000 + ((Code_Point - 0xD800) << 10) + (Json_Value::Parse_Hex4(At, End) - 0xDC00);
+				}
 
-		/*this->Transition_Image_Layout(
-			this->m_Texture_Image.get(),
-			this->m_Mip_Levels,
-			VK_FORMAT_R8G8B8A8_SRGB,
-			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-			VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
-		);*/
+				if (Code_Point < 0x80)
+					Text.push_back(static_cast<char>(Code_Point));
+				else if (Code_Point < 0x800) {
+					Text.push_back(static_cast<char>(0xC0 | Code_Point >> 6));
+					Text.push_back(static_cast<char>(0x80 | (Code_Point & 0x3F)));
+				}
+				else if (Code_Point < 0x10000) {
+					Text.push_back(static_cast<char>(0xE0 | Code_Point >> 12));
+					Text.push_back(static_cast<char>(0x80 | (Code_Point >> 6 & 0x3F)));
+					Text.push_back(static_cast<char>(0x80 | (Code_Point & 0x3F)));
+				}
+				else {
+					Text.push_back(static_cast<char>(0xF0 | Code_Point >> 18));
+					Text.push_back(static_cast<char>(0x80 | (Code_Point >> 12 & 0x3F)));
+					Text.push_back(static_cast<char>(0x80 | (Code_Point >> 6 & 0x3F)));
+					Text.push_back(static_cast<char>(0x80 | (Code_Point & 0x3F)));
+				}
+				break;
+			}
+			default:
+				throw runtime_error("Malformed JSON!");
+			}
+		}
 
-		this->Generate_Mipmaps(this->m_Texture_Image.get(), VK_FORMAT_R8G8B8A8_SRGB, Width, Height, this->m_Mip_Levels);
+		Json_Value::Expect(At, End, "\"");
+		return Text;
 	}
 
-	void Generate_Mipmaps(VkImage Image, VkFormat Image_Format, int32_t Width, int32_t Height, uint32_t Mip_Levels) {
-		VkFormatProperties Format_Properties{};
-		vkGetPhysicalDeviceFormatProperties(this->m_Physical_Device, Image_Format, &Format_Properties);
-
-		if (!(Format_Properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT))
-			throw runtime_error("Texture image format does not support linear blitting!");
+	static const uint32_t Parse_Hex4(const char*& At, const char* End) {
+		uint32_t Value{ 0 };
+		const auto Result{ std::from_chars(At, std::min(At + 4, End), Value, 16) };
+		if (std::errc{} != Result.ec || Result.ptr != At + 4)
+			throw runtime_error("Malformed JSON!");
 
-		VkCommandBuffer Command_Buffer{ this->Begin_SingleTime_Commands() };
+		At = Result.ptr;
+		return Value;
+	}
+};
 
-		VkImageSubresourceRange Subresource_Range{};
-		{
-			Subresource_Range.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-			Subresource_Range.baseArrayLayer = 0;
-			Subresource_Range.layerCount = 1;
-			Subresource_Range.levelCount = 1;
+//NOTE : Binary glTF 2.0, The JSON Chunk Is Parsed And Every Buffer View Is Read In Place From The BIN Chunk Of The Mapped File
+struct Glb_File final {
+	static constexpr uint32_t Magic{ 0x46546C67 };
+	static constexpr uint32_t Json_Chunk{ 0x4E4F534A };
+	static constexpr uint32_t Binary_Chunk{ 0x004E4942 };
+
+	//NOTE : Accessor componentType Values Of The Specification
+	static constexpr uint32_t Component_Byte{ 5120 };
+	static constexpr uint32_t Component_Unsigned_Byte{ 5121 };
+	static constexpr uint32_t Component_Short{ 5122 };
+	static constexpr uint32_t Component_Unsigned_Short{ 5123 };
+	static constexpr uint32_t Component_Unsigned_Int{ 5125 };
+	static constexpr uint32_t Component_Float{ 5126 };
+
+	//NOTE : Primitive mode Of Triangle Lists, The Only One Drawn
+	static constexpr uint32_t Mode_Triangles{ 4 };
+
+	struct Accessor final {
+		const uint8_t* Data{ nullptr };
+		size_t Count{ 0 };
+		size_t Stride{ 0 };
+		uint32_t Component_Type{ 0 };
+		uint32_t Components{ 0 };
+		bool Normalized{ false };
+
+		//NOTE : True When Elements Are Plain Floats, Which Are Copied Instead Of Converted
+		const bool Is_Float(uint32_t Expected_Components) const {
+			return Component_Float == this->Component_Type && Expected_Components == this->Components;
 		}
+	};
 
-		VkImageMemoryBarrier Barrier{};
-		{
-			Barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-			Barrier.image = Image;
-			Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-			Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-			Barrier.subresourceRange = Subresource_Range;
+	Json_Value Json{};
+	const uint8_t* Binary{ nullptr };
+	size_t Binary_Size{ 0 };
+
+	//NOTE : Data Has To Outlive The Result, Accessors Point Into It
+	static const Glb_File Parse(const uint8_t* Data, size_t Size) {
+		if (Size < 20 || Magic != Glb_File::Read_U32(Data) || 2 != Glb_File::Read_U32(Data + 4))
+			throw runtime_error("Not a glTF 2.0 binary!");
+
+		const size_t Length{ std::min<size_t>(Size, Glb_File::Read_U32(Data + 8)) };
+
+		Glb_File File{};
+		bool Has_Json{ false };
+		for (size_t Offset = 12; Offset + 8 <= Length;) {
+			const size_t Chunk_Length{ Glb_File::Read_U32(Data + Offset) };
+			const uint32_t Chunk_Type{ Glb_File::Read_U32(Data + Offset + 4) };
+			const uint8_t* Chunk{ Data + Offset + 8 };
+			if (Chunk_Length > Length - Offset - 8)
+				throw runtime_error("Truncated glTF binary!");
+
+			if (Json_Chunk == Chunk_Type && !Has_Json) {
+				File.Json = Json_Value::Parse(reinterpret_cast<const char*>(Chunk), reinterpret_cast<const char*>(Chunk + Chunk_Length));
+				Has_Json = true;
+			}
+			else if (Binary_Chunk == Chunk_Type && nullptr == File.Binary) {
+				File.Binary = Chunk;
+				File.Binary_Size = Chunk_Length;
+			}
+
+			Offset += 8 + Chunk_Length;
 		}
 
-		int32_t Mip_Width = Width, Mip_Height = Height;
-		for (uint32_t Mip_Level = 1; Mip_Level < Mip_Levels; ++Mip_Level) {
-			Barrier.subresourceRange.baseMipLevel = Mip_Level - 1;
-			Barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-			Barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-			Barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-			Barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+		if (!Has_Json)
+			throw runtime_error("glTF binary without JSON chunk!");
 
-			vkCmdPipelineBarrier(
-				Command_Buffer,
-				VK_PIPELINE_STAGE_TRANSFER_BIT,
-				VK_PIPELINE_STAGE_TRANSFER_BIT,
-				0,
-				0, nullptr,
-				0, nullptr,
-				1, &Barrier
-			);
+		return File;
+	}
 
-			VkImageBlit Blit{};
-			{
-				{
-					Blit.srcOffsets[0] = { 0,0,0 };
-					Blit.srcOffsets[1] = { Mip_Width,Mip_Height,1 };
-					Blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-					Blit.srcSubresource.mipLevel = Mip_Level - 1;
-					Blit.srcSubresource.baseArrayLayer = 0;
-					Blit.srcSubresource.layerCount = 1;
-				}
+	//NOTE : Only The Buffer Stored In The BIN Chunk Is Readable, External And Data URI Buffers Are Not Supported
+	const pair<const uint8_t*, size_t> Get_Buffer_View(size_t Index) const {
+		const vector<Json_Value>& Views{ this->Json.Get_Array("bufferViews") };
+		if (Index >= Views.size())
+			throw runtime_error("glTF buffer view out of range!");
 
-				{
-					Blit.dstOffsets[0] = { 0,0,0 };
-					Blit.dstOffsets[1] = {
-						Mip_Width > 1 ? Mip_Width / 2 : 1,
-						Mip_Height > 1 ? Mip_Height / 2 : 1,
-						1
-					};
-					Blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-					Blit.dstSubresource.mipLevel = Mip_Level;
-					Blit.dstSubresource.baseArrayLayer = 0;
-					Blit.dstSubresource.layerCount = 1;
-				}
-			}
+		const Json_Value& View{ Views[Index] };
+		const vector<Json_Value>& Buffers{ this->Json.Get_Array("buffers") };
+		const size_t Buffer{ View.Get_Index("buffer") };
+		if (0 != Buffer || Buffers.empty() || nullptr != Buffers[0].Find("uri") || nullptr == this->Binary)
+			throw runtime_error("glTF buffers outside the binary chunk are not supported!");
 
-			vkCmdBlitImage(
-				Command_Buffer,
-				Image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-				Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-				1, &Blit,
-				VK_FILTER_LINEAR
-			);
+		const size_t Offset{ View.Get_Index("byteOffset", 0) };
+		const size_t Length{ View.Get_Index("byteLength") };
+		if (Offset > this->Binary_Size || Length > this->Binary_Size - Offset)
+			throw runtime_error("glTF buffer view out of range!");
 
-			{
-				Barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-				Barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-				Barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-				Barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-			}
+		return { this->Binary + Offset, Length };
+	}
 
-			vkCmdPipelineBarrier(
-				Command_Buffer,
-				VK_PIPELINE_STAGE_TRANSFER_BIT,
-				VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-				0,
-				0, nullptr,
-				0, nullptr,
-				1, &Barrier
-			);
+	const Accessor Get_Accessor(size_t Index) const {
+		const vector<Json_Value>& Accessors{ this->Json.Get_Array("accessors") };
+		if (Index >= Accessors.size())
+			throw runtime_error("glTF accessor out of range!");
 
-			if (Mip_Width > 1) Mip_Width /= 2;
-			if (Mip_Height > 1) Mip_Height /= 2;
-		}
+		const Json_Value& Source{ Accessors[Index] };
+		if (nullptr == Source.Find("bufferView") || nullptr != Source.Find("sparse"))
+			throw runtime_error("Sparse or bufferless glTF accessors are not supported!");
 
+		Accessor Result{};
 		{
-			Barrier.subresourceRange.baseMipLevel = Mip_Levels - 1;
-			Barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-			Barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-			Barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-			Barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+			Result.Count = Source.Get_Index("count");
+			Result.Component_Type = static_cast<uint32_t>(Source.Get_Number("componentType", 0));
+			Result.Components = Glb_File::Get_Components(Source.Get_String("type"));
+			Result.Normalized = nullptr != Source.Find("normalized") && Source.Find("normalized")->Boolean;
 		}
 
-		vkCmdPipelineBarrier(
-			Command_Buffer,
-			VK_PIPELINE_STAGE_TRANSFER_BIT,
-			VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-			0,
-			0, nullptr,
-			0, nullptr,
-			1, &Barrier
-		);
-
-		this->End_SingleTime_Commands(Command_Buffer);
-	}
+		const size_t Element_Size{ Glb_File::Get_Component_Size(Result.Component_Type) * Result.Components };
+		if (0 == Element_Size)
+			throw runtime_error("Unsupported glTF accessor type!");
 
-	void Create_Texture_Image_View(void) {
+		const auto [View_Data, View_Length] { this->Get_Buffer_View(Source.Get_Index("bufferView")) };
+		const size_t Offset{ Source.Get_Index("byteOffset", 0) };
+		const Json_Value& View{ this->Json.Get_Array("bufferViews")[Source.Get_Index("bufferView")] };
 
-		VkImageView Texture_Image_View{ this->Create_Image_View(
-			this->m_Texture_Image.get(),
-			this->m_Mip_Levels,
-			VK_FORMAT_R8G8B8A8_SRGB,
-			VK_IMAGE_ASPECT_COLOR_BIT)
-		};
+		Result.Data = View_Data + std::min(Offset, View_Length);
+		Result.Stride = View.Get_Index("byteStride", Element_Size);
+		if (Result.Stride < Element_Size || Offset > View_Length ||
+			(0 != Result.Count && (Element_Size > View_Length - Offset || Result.Count - 1 > (View_Length - Offset - Element_Size) / Result.Stride)))
+			throw runtime_error("glTF accessor out of range!");
 
-		this->m_Texture_Image_View.get_deleter() = [Device = this->m_Logical_Device.get()](VkImageView Texture_Image_View) {if (nullptr != Texture_Image_View) vkDestroyImageView(Device, Texture_Image_View, nullptr); };
-		this->m_Texture_Image_View.reset(Texture_Image_View);
+		return Result;
 	}
 
-	void Create_Texture_Sampler(void) {
-		VkPhysicalDeviceProperties Properties{};
-		vkGetPhysicalDeviceProperties(this->m_Physical_Device, &Properties);
+	//NOTE : Normalized Integers Map To [0,1] Or [-1,1] As The Specification Defines
+	static const float Read_Float(const Accessor& Source, size_t Element, uint32_t Component) {
+		const uint8_t* Data{ Source.Data + Element * Source.Stride };
+		switch (Source.Component_Type) {
+		case Component_Float: {
+			float Value{};
+			memcpy(&Value, Data + Component * sizeof(float), sizeof(float));
+			return Value;
+		}
+		case Component_Unsigned_Byte: {
+			const float Value{ static_cast<float>(Data[Component]) };
+			return Source.Normalized ? Value / 255.0f : Value;
+		}
+		case Component_Byte: {
+			const float Value{ static_cast<float>(static_cast<int8_t>(Data[Component])) };
+			return Source.Normalized ? std::max(Value / 127.0f, -1.0f) : Value;
+		}
+		case Component_Unsigned_Short: {
+			uint16_t Value{};
+			memcpy(&Value, Data + Component * sizeof(uint16_t), sizeof(uint16_t));
+			return Source.Normalized ? static_cast<float>(Value) / 65535.0f : static_cast<float>(Value);
+		}
+		case Component_Short: {
+			int16_t Value{};
+			memcpy(&Value, Data + Component * sizeof(int16_t), sizeof(int16_t));
+			return Source.Normalized ? std::max(static_cast<float>(Value) / 32767.0f, -1.0f) : static_cast<float>(Value);
+		}
+		default:
+			return 0.0f;
+		}
+	}
 
-		VkSamplerCreateInfo Sampler_Info{};
-		{
-			Sampler_Info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
-			Sampler_Info.magFilter = VK_FILTER_LINEAR;
-			Sampler_Info.minFilter = VK_FILTER_LINEAR;
-			Sampler_Info.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-			Sampler_Info.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-			Sampler_Info.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-			Sampler_Info.anisotropyEnable = VK_TRUE;
-			Sampler_Info.maxAnisotropy = Properties.limits.maxSamplerAnisotropy;
-			Sampler_Info.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
-			Sampler_Info.unnormalizedCoordinates = VK_FALSE;
-			Sampler_Info.compareEnable = VK_FALSE;
-			Sampler_Info.compareOp = VK_COMPARE_OP_ALWAYS;
-			Sampler_Info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
-			Sampler_Info.mipLodBias = 0.0f;
-			Sampler_Info.minLod = 0.0f;
-			Sampler_Info.maxLod = VK_LOD_CLAMP_NONE;
+	static const uint32_t Read_Index(const Accessor& Source, size_t Element) {
+		const uint8_t* Data{ Source.Data + Element * Source.Stride };
+		switch (Source.Component_Type) {
+		case Component_Unsigned_Byte:
+			return Data[0];
+		case Component_Unsigned_Short: {
+			uint16_t Value{};
+			memcpy(&Value, Data, sizeof(Value));
+			return Value;
+		}
+		case Component_Unsigned_Int: {
+			uint32_t Value{};
+			memcpy(&Value, Data, sizeof(Value));
+			return Value;
 		}
+		default:
+			throw runtime_error("glTF indices have to be unsigned integers!");
+		}
+	}
 
-		VkSampler Sampler{ nullptr };
-		THROW_IF_VK_FAILED(vkCreateSampler(this->m_Logical_Device.get(), &Sampler_Info, nullptr, &Sampler));
+private:
+	static const uint32_t Read_U32(const uint8_t* Data) {
+		uint32_t Value{};
+		memcpy(&Value, Data, sizeof(Value));
+		return Value;
+	}
 
-		this->m_Texture_Sampler.get_deleter() = [Device = this->m_Logical_Device.get()](VkSampler Sampler) {if (nullptr != Sampler) vkDestroySampler(Device, Sampler, nullptr); };
-		this->m_Texture_Sampler.reset(Sampler);
+	static const uint32_t Get_Components(const string& Type) {
+		if ("SCALAR" == Type) return 1;
+		if ("VEC2" == Type) return 2;
+		if ("VEC3" == Type) return 3;
+		if ("VEC4" == Type) return 4;
+		return 0;
 	}
 
-	void Create_Uniform_Buffers(void) {
-		this->m_Uniform_Buffers.resize(MAX_FRAMES_IN_FLIGHT);
-		this->m_Uniform_Buffers_Memory.resize(MAX_FRAMES_IN_FLIGHT);
+	static const size_t Get_Component_Size(uint32_t Component_Type) {
+		switch (Component_Type) {
+		case Component_Byte:
+		case Component_Unsigned_Byte: return 1;
+		case Component_Short:
+		case Component_Unsigned_Short: return 2;
+		case Component_Unsigned_Int:
+		case Component_Float: return 4;
+		default: return 0;
+		}
+	}
+};
 
-		this->Uniform_Buffers_Mapped.resize(MAX_FRAMES_IN_FLIGHT);
+//NOTE : glTF Vertices Are Already Unique Per Primitive, So Unlike OBJ Nothing Is Hashed, Attributes Are Copied Out Of The Mapping Into Place
+struct Glb_Loader final {
+	static const bool Is_Glb(const std::filesystem::path& Path) {
+		string Extension{ Path.extension().generic_string() };
+		std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](char Character) { return static_cast<char>(std::tolower(static_cast<unsigned char>(Character))); });
+		return ".glb" == Extension;
+	}
 
-		VkDeviceSize Buffer_Size{ sizeof(Uniform_Buffer_Object) };
+	static const Model_Data Load(const std::filesystem::path& Path, const Vertex_Layout& Layout) {
+		const Mapped_File File{ Path };
+		const Glb_File Glb{ Glb_File::Parse(File.Get_Data(), File.Get_Size()) };
 
-		VkBuffer Uniform_Buffer{ nullptr };
-		VkDeviceMemory Uniform_Buffer_Memory{ nullptr };
+		const vector<Json_Value>& Meshes{ Glb.Json.Get_Array("meshes") };
+		const vector<Json_Value>& Materials{ Glb.Json.Get_Array("materials") };
 
-		const auto Delete_Buffer = [Device = this->m_Logical_Device.get()](VkBuffer Buffer) {if (nullptr != Buffer) vkDestroyBuffer(Device, Buffer, nullptr); };
-		const auto Delete_Memory = [Device = this->m_Logical_Device.get()](VkDeviceMemory Memory) {if (nullptr != Memory) vkFreeMemory(Device, Memory, nullptr); };
+		Model_Data Model{};
 
-		for (size_t Index = 0; Index < MAX_FRAMES_IN_FLIGHT; ++Index) {
-			this->Create_Buffer(Buffer_Size, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, Uniform_Buffer, Uniform_Buffer_Memory);
+		//NOTE : Bucket 0 Holds Primitives Without A Material, Bucket N Those Of glTF Material N - 1
+		vector<vector<uint32_t>> Buckets(Materials.size() + 1);
 
-			this->m_Uniform_Buffers[Index].get_deleter() = Delete_Buffer;
-			this->m_Uniform_Buffers[Index].reset(Uniform_Buffer);
+		for (const auto& [Mesh, Transform] : Glb_Loader::Get_Mesh_Instances(Glb.Json)) {
+			if (Mesh >= Meshes.size())
+				continue;
 
-			this->m_Uniform_Buffers_Memory[Index].get_deleter() = Delete_Memory;
-			this->m_Uniform_Buffers_Memory[Index].reset(Uniform_Buffer_Memory);
+			for (const auto& Primitive : Meshes[Mesh].Get_Array("primitives")) {
+				const Json_Value* Attributes{ Primitive.Find("attributes") };
+				if (Glb_File::Mode_Triangles != static_cast<uint32_t>(Primitive.Get_Number("mode", Glb_File::Mode_Triangles)) || nullptr == Attributes || nullptr == Attributes->Find("POSITION"))
+					continue;
 
-			THROW_IF_VK_FAILED(vkMapMemory(this->m_Logical_Device.get(), this->m_Uniform_Buffers_Memory[Index].get(), 0, Buffer_Size, 0, &this->Uniform_Buffers_Mapped[Index]));
+				const size_t Base_Vertex{ Model.Vertices.size() };
+				Glb_Loader::Read_Vertices(Glb, *Attributes, Layout, Transform, Model.Vertices);
+
+				const double Material_Id{ Primitive.Get_Number("material", -1) };
+				const size_t Bucket{ 0 <= Material_Id && static_cast<size_t>(Material_Id) < Materials.size() ? static_cast<size_t>(Material_Id) + 1 : 0 };
+				//NOTE : A Mirroring Node Transform Turns Baked Triangles Inside Out, Swapping Two Corners Restores Their Winding
+				Glb_Loader::Read_Indices(Glb, Primitive, static_cast<uint32_t>(Base_Vertex), Model.Vertices.size() - Base_Vertex, glm::determinant(Transform) < 0.0f, Buckets[Bucket]);
+			}
 		}
+
+		vector<Mesh_Material> Bucket_Materials{ Model_Data::Get_Default_Material() };
+		for (const auto& Source : Materials)
+			Bucket_Materials.push_back(Glb_Loader::Get_Material(Glb.Json, Source, Path));
+
+		Model.Append_Buckets(Buckets, Bucket_Materials);
+		return Model;
 	}
 
-	void Load_Model(void) {
-		tinyobj::attrib_t Attrib;
-		vector<tinyobj::shape_t> Shapes;
-		vector<tinyobj::material_t> Materials;
-		string Warning, Error;
+	//NOTE : Decodes An Image Stored In A Buffer View Straight From The Mapping, Failures Return Null Like stbi_load
+	static stbi_uc* Load_Image(const std::filesystem::path& Path, uint32_t Image, int* Width, int* Height) {
+		try {
+			const Mapped_File File{ Path };
+			const Glb_File Glb{ Glb_File::Parse(File.Get_Data(), File.Get_Size()) };
+
+			const vector<Json_Value>& Images{ Glb.Json.Get_Array("images") };
+			if (Image >= Images.size() || nullptr == Images[Image].Find("bufferView"))
+				return nullptr;
+
+			const auto [Data, Length] { Glb.Get_Buffer_View(Images[Image].Get_Index("bufferView")) };
+			if (Length > static_cast<size_t>(numeric_limits<int>::max()))
+				return nullptr;
+
+			int Channels{ 0 };
+			return stbi_load_from_memory(Data, static_cast<int>(Length), Width, Height, &Channels, STBI_rgb_alpha);
+		}
+		catch (const runtime_error&) {
+			return nullptr;
+		}
+	}
+
+private:
+	//NOTE : Every Mesh Reached From The Default Scene With Its Node Transform, A File Without Scenes Places Its Root Nodes, One Without Nodes Every Mesh Once
+	static const vector<pair<size_t, glm::mat4>> Get_Mesh_Instances(const Json_Value& Json) {
+		const vector<Json_Value>& Nodes{ Json.Get_Array("nodes") };
+		vector<pair<size_t, glm::mat4>> Instances{};
+
+		if (Nodes.empty()) {
+			for (size_t Mesh = 0; Mesh < Json.Get_Array("meshes").size(); ++Mesh)
+				Instances.emplace_back(Mesh, glm::mat4{ 1.0f });
+			return Instances;
+		}
+
+		vector<size_t> Roots{};
+		const vector<Json_Value>& Scenes{ Json.Get_Array("scenes") };
+		const size_t Scene{ Json.Get_Index("scene", 0) };
+		if (Scene < Scenes.size())
+			for (const auto& Node : Scenes[Scene].Get_Array("nodes"))
+				Roots.push_back(Node.As_Index());
+		else {
+			vector<bool> Is_Child(Nodes.size(), false);
+			for (const auto& Node : Nodes)
+				for (const auto& Child : Node.Get_Array("children"))
+					if (Child.As_Index() < Nodes.size())
+						Is_Child[Child.As_Index()] = true;
+
+			for (size_t Node = 0; Node < Nodes.size(); ++Node)
+				if (!Is_Child[Node])
+					Roots.push_back(Node);
+		}
+
+		//NOTE : A Valid Hierarchy Is A Forest, The Depth Bound Only Stops Cycles In Broken Files
+		vector<tuple<size_t, glm::mat4, size_t>> Stack{};
+		for (const size_t Root : Roots)
+			Stack.emplace_back(Root, glm::mat4{ 1.0f }, 0);
+
+		while (!Stack.empty()) {
+			const auto [Node, Parent, Depth] { Stack.back() };
+			Stack.pop_back();
+			if (Node >= Nodes.size() || Depth > Nodes.size())
+				continue;
+
+			const glm::mat4 World{ Parent * Glb_Loader::Get_Local_Transform(Nodes[Node]) };
+			if (nullptr != Nodes[Node].Find("mesh"))
+				Instances.emplace_back(Nodes[Node].Get_Index("mesh"), World);
+
+			for (const auto& Child : Nodes[Node].Get_Array("children"))
+				Stack.emplace_back(Child.As_Index(), World, Depth + 1);
+		}
+
+		return Instances;
+	}
+
+	//NOTE : Either A Column Major matrix Or Translation, Rotation Quaternion And Scale Applied As T * R * S
+	static const glm::mat4 Get_Local_Transform(const Json_Value& Node) {
+		const vector<Json_Value>& Matrix{ Node.Get_Array("matrix") };
+		if (16 == Matrix.size()) {
+			glm::mat4 Local{};
+			for (glm::length_t Column = 0; Column < 4; ++Column)
+				for (glm::length_t Row = 0; Row < 4; ++Row)
+					Local[Column][Row] = static_cast<float>(Matrix[Column * 4 + Row].Number);
+			return Local;
+		}
+
+		const vector<Json_Value>& Translation{ Node.Get_Array("translation") };
+		const vector<Json_Value>& Rotation{ Node.Get_Array("rotation") };
+		const vector<Json_Value>& Scale{ Node.Get_Array("scale") };
+
+		glm::mat4 Local{ 1.0f };
+		if (3 == Translation.size())
+			Local = glm::translate(Local, glm::vec3{ Translation[0].Number, Translation[1].Number, Translation[2].Number });
+		if (4 == Rotation.size())
+			Local *= glm::mat4_cast(glm::quat{ static_cast<float>(Rotation[3].Number), static_cast<float>(Rotation[0].Number), static_cast<float>(Rotation[1].Number), static_cast<float>(Rotation[2].Number) });
+		if (3 == Scale.size())
+			Local = glm::scale(Local, glm::vec3{ Scale[0].Number, Scale[1].Number, Scale[2].Number });
+
+		return Local;
+	}
+
+	//NOTE : Float Attributes Are Copied Element By Element Out Of The Mapping, Only Other Component Types Go Through Conversion
+	static void Read_Vertices(const Glb_File& Glb, const Json_Value& Attributes, const Vertex_Layout& Layout, const glm::mat4& Transform, vector<Vertex>& Vertices) {
+		const Glb_File::Accessor Positions{ Glb.Get_Accessor(Attributes.Get_Index("POSITION")) };
+		if (3 != Positions.Components)
+			throw runtime_error("glTF positions have to be three component vectors!");
+
+		const size_t Base_Vertex{ Vertices.size() };
+		Vertices.resize(Base_Vertex + Positions.Count);
+		Vertex* const Destination{ Vertices.data() + Base_Vertex };
+
+		for (size_t Element = 0; Element < Positions.Count; ++Element) {
+			Destination[Element].Color = { 1.0f, 1.0f, 1.0f };
+			if (Positions.Is_Float(3))
+				memcpy(&Destination[Element].Pos, Positions.Data + Element * Positions.Stride, sizeof(glm::vec3));
+			else
+				Destination[Element].Pos = { Glb_File::Read_Float(Positions, Element, 0), Glb_File::Read_Float(Positions, Element, 1), Glb_File::Read_Float(Positions, Element, 2) };
+		}
+
+		//NOTE : glTF Puts The Texture Origin Top Left Like Vulkan, So Unlike OBJ V Is Not Flipped
+		if (nullptr != Attributes.Find("TEXCOORD_0")) {
+			const Glb_File::Accessor TexCoords{ Glb.Get_Accessor(Attributes.Get_Index("TEXCOORD_0")) };
+			const size_t Count{ std::min(TexCoords.Count, Positions.Count) };
+			for (size_t Element = 0; Element < Count && 2 == TexCoords.Components; ++Element)
+				if (TexCoords.Is_Float(2))
+					memcpy(&Destination[Element].TexCoord, TexCoords.Data + Element * TexCoords.Stride, sizeof(glm::vec2));
+				else
+					Destination[Element].TexCoord = { Glb_File::Read_Float(TexCoords, Element, 0), Glb_File::Read_Float(TexCoords, Element, 1) };
+		}
+
+		//NOTE : Unused Attributes Stay Zero Like In The OBJ Path, So The Mesh Cache Content Does Not Depend On The Format
+		if (Layout.Has(Vertex_Attribute_Normal) && nullptr != Attributes.Find("NORMAL")) {
+			const Glb_File::Accessor Normals{ Glb.Get_Accessor(Attributes.Get_Index("NORMAL")) };
+			const size_t Count{ std::min(Normals.Count, Positions.Count) };
+			for (size_t Element = 0; Element < Count && 3 == Normals.Components; ++Element)
+				if (Normals.Is_Float(3))
+					memcpy(&Destination[Element].Normal, Normals.Data + Element * Normals.Stride, sizeof(glm::vec3));
+				else
+					Destination[Element].Normal = { Glb_File::Read_Float(Normals, Element, 0), Glb_File::Read_Float(Normals, Element, 1), Glb_File::Read_Float(Normals, Element, 2) };
+		}
+
+		//NOTE : Node Transforms Are Baked In, A Mesh Placed At The Root Keeps Its Values Bit For Bit
+		if (glm::mat4{ 1.0f } == Transform)
+			return;
+
+		const glm::mat3 Normal_Transform{ glm::transpose(glm::inverse(glm::mat3{ Transform })) };
+		for (size_t Element = 0; Element < Positions.Count; ++Element) {
+			Destination[Element].Pos = glm::vec3{ Transform * glm::vec4{ Destination[Element].Pos, 1.0f } };
+			if (glm::vec3{ 0.0f } != Destination[Element].Normal)
+				Destination[Element].Normal = glm::normalize(Normal_Transform * Destination[Element].Normal);
+		}
+	}
+
+	//NOTE : 32 Bit Index Views Are Copied Whole, Then Rebased Onto The Primitive's First Vertex, A Primitive Without Indices Draws Its Vertices In Order
+	static void Read_Indices(const Glb_File& Glb, const Json_Value& Primitive, uint32_t Base_Vertex, size_t Vertex_Count, bool Flip_Winding, vector<uint32_t>& Indices) {
+		const size_t Offset{ Indices.size() };
+		const auto Apply_Winding = [&Indices, Offset, Flip_Winding](void) {
+			for (size_t Triangle = Offset; Flip_Winding && Triangle < Indices.size(); Triangle += 3)
+				std::swap(Indices[Triangle + 1], Indices[Triangle + 2]);
+		};
+
+		if (nullptr == Primitive.Find("indices")) {
+			Indices.resize(Offset + Vertex_Count / 3 * 3);
+			std::iota(Indices.begin() + Offset, Indices.end(), Base_Vertex);
+			Apply_Winding();
+			return;
+		}
+
+		//NOTE : glTF Only Allows Unsigned Index Components, Anything Else Would Be Misread
+		const Glb_File::Accessor Source{ Glb.Get_Accessor(Primitive.Get_Index("indices")) };
+		if (1 != Source.Components ||
+			(Glb_File::Component_Unsigned_Byte != Source.Component_Type && Glb_File::Component_Unsigned_Short != Source.Component_Type && Glb_File::Component_Unsigned_Int != Source.Component_Type))
+			throw runtime_error("Unsupported glTF index accessor!");
+
+		const size_t Count{ Source.Count / 3 * 3 };
+		Indices.resize(Offset + Count);
+		if (Glb_File::Component_Unsigned_Int == Source.Component_Type && sizeof(uint32_t) == Source.Stride)
+			memcpy(Indices.data() + Offset, Source.Data, Count * sizeof(uint32_t));
+		else
+			for (size_t Element = 0; Element < Count; ++Element)
+				Indices[Offset + Element] = Glb_File::Read_Index(Source, Element);
+
+		//NOTE : An Index Past The Primitive's Vertices Would Read Another Primitive's, Or Past The Vertex Buffer
+		for (size_t Element = Offset; Element < Indices.size(); ++Element) {
+			if (Indices[Element] >= Vertex_Count)
+				throw runtime_error("glTF index out of range!");
+			Indices[Element] += Base_Vertex;
+		}
+
+		Apply_Winding();
+	}
+
+	//NOTE : The Base Color Texture Stands In For The Diffuse Map, An Embedded Image Is Named By The GLB Path And Its Image Index
+	static const Mesh_Material Get_Material(const Json_Value& Json, const Json_Value& Source, const std::filesystem::path& Path) {
+		Mesh_Material Material{};
+		Material.Name = Source.Get_String("name");
+
+		const Json_Value* Pbr{ Source.Find("pbrMetallicRoughness") };
+		const Json_Value* Base_Color{ nullptr != Pbr ? Pbr->Find("baseColorTexture") : nullptr };
+		if (nullptr == Base_Color)
+			return Material;
+
+		const vector<Json_Value>& Textures{ Json.Get_Array("textures") };
+		const size_t Texture{ Base_Color->Get_Index("index") };
+		if (Texture >= Textures.size() || nullptr == Textures[Texture].Find("source"))
+			return Material;
+
+		const vector<Json_Value>& Images{ Json.Get_Array("images") };
+		const size_t Image{ Textures[Texture].Get_Index("source") };
+		if (Image >= Images.size())
+			return Material;
+
+		if (nullptr != Images[Image].Find("bufferView")) {
+			Material.Texture_Path = Path.generic_string();
+			Material.Embedded_Image = static_cast<int32_t>(Image);
+		}
+		//NOTE : Data URIs Are Not Decoded, Such Materials Draw With The Model Texture
+		else if (const string Uri{ Images[Image].Get_String("uri") }; !Uri.empty() && 0 != Uri.rfind("data:", 0))
+			Material.Texture_Path = (Path.parent_path() / std::filesystem::path{ Uri, std::filesystem::path::generic_format }).generic_string();
+
+		return Material;
+	}
+};
+
+//NOTE : What The Streaming OBJ Loader Held Besides The Model It Returns
+struct Obj_Stream_Statistics final {
+	size_t File_Bytes{ 0 };
+	uint32_t Chunk_Count{ 0 };
+	//NOTE : Most Text Resident At Once, Pages Behind The Parser Are Dropped After Every Chunk
+	size_t Text_Bytes{ 0 };
+	//NOTE : Source Positions, Texcoords And Normals, Faces May Reference Any Earlier One So These Grow With The Model
+	size_t Attribute_Bytes{ 0 };
+	size_t Table_Bytes{ 0 };
+	uint32_t Skipped_Faces{ 0 };
+};
+
+//NOTE : Single Pass Over The Mapped Text In Fixed Size Chunks, Corners Are Deduplicated As Each Face Is Read Instead Of After The Whole File Is Indexed
+struct Obj_Stream_Loader final {
+	static constexpr size_t Chunk_Size{ 8u << 20 };
+	//NOTE : Multiple Of Every Page Size And Of The Windows Allocation Granularity
+	static constexpr size_t Evict_Alignment{ 1u << 16 };
+
+	static const Model_Data Load(const std::filesystem::path& Path, const Vertex_Layout& Layout, Obj_Stream_Statistics* Statistics = nullptr) {
+		const Mapped_File File{ Path };
+		const char* const Text{ reinterpret_cast<const char*>(File.Get_Data()) };
+		const char* const End{ Text + File.Get_Size() };
+
+		Obj_Stream_Loader Loader{ Path.parent_path(), Layout };
+
+		uint32_t Chunk_Count{ 0 };
+		size_t Evicted{ 0 };
+		for (const char* At = Text; At < End; ++Chunk_Count) {
+			const char* const Chunk_End{ static_cast<size_t>(End - At) > Chunk_Size ? At + Chunk_Size : End };
+
+			//NOTE : The Last Line Of A Chunk Runs Past Its End, Chunks Only Bound When Pages Are Dropped
+			while (At < Chunk_End) {
+				const char* Line_End{ static_cast<const char*>(memchr(At, '\n', static_cast<size_t>(End - At))) };
+				if (nullptr == Line_End)
+					Line_End = End;
+
+				Loader.Parse_Line(At, Line_End);
+				At = Line_End < End ? Line_End + 1 : End;
+			}
+
+			const size_t Consumed{ static_cast<size_t>(At - Text) / Evict_Alignment * Evict_Alignment };
+			if (Consumed > Evicted) {
+				File.Evict(Evicted, Consumed - Evicted);
+				Evicted = Consumed;
+			}
+		}
+
+		vector<Mesh_Material> Bucket_Materials{ Model_Data::Get_Default_Material() };
+		for (const auto& Source : Loader.Materials)
+			Bucket_Materials.push_back(Obj_Loader::Get_Material(Source, Loader.Model_Directory));
+
+		if (nullptr != Statistics) {
+			Statistics->File_Bytes = File.Get_Size();
+			Statistics->Chunk_Count = Chunk_Count;
+			Statistics->Text_Bytes = std::min(File.Get_Size(), Chunk_Size + Evict_Alignment);
+			Statistics->Attribute_Bytes = Loader.Positions.capacity() * sizeof(glm::vec3) + Loader.TexCoords.capacity() * sizeof(glm::vec2) + Loader.Normals.capacity() * sizeof(glm::vec3);
+			Statistics->Table_Bytes = Loader.Slots.capacity() * sizeof(uint32_t);
+			Statistics->Skipped_Faces = Loader.Skipped_Faces;
+		}
+
+		Loader.Model.Append_Buckets(Loader.Buckets, Bucket_Materials);
+		return std::move(Loader.Model);
+	}
+
+	//NOTE : Eight Digits At A Time Through SWAR, Mantissas Up To 2^53 Scaled By Up To 10^22 Are Exact In Double, Anything Else Goes Through from_chars
+	static const bool Parse_Float(const char*& At, const char* End, float& Value) {
+		static constexpr double Powers_Of_Ten[]{
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+
+		const char* const Begin{ At };
+		const char* Cursor{ At };
+		const bool Negative{ Cursor < End && '-' == *Cursor };
+		if (Cursor < End && ('-' == *Cursor || '+' == *Cursor))
+			++Cursor;
+
+		uint64_t Mantissa{ 0 };
+		int32_t Digit_Count{ 0 };
+		int32_t Exponent{ 0 };
+
+		const char* const Integer_Begin{ Cursor };
+		Obj_Stream_Loader::Parse_Digits(Cursor, End, Mantissa, Digit_Count);
+		bool Has_Digits{ Cursor != Integer_Begin };
+
+		if (Cursor < End && '.' == *Cursor) {
+			const char* const Fraction_Begin{ ++Cursor };
+			Obj_Stream_Loader::Parse_Digits(Cursor, End, Mantissa, Digit_Count);
+			Exponent -= static_cast<int32_t>(Cursor - Fraction_Begin);
+			Has_Digits |= Cursor != Fraction_Begin;
+		}
+
+		//NOTE : Not A Decimal Number, nan, inf And Hex Floats Are Left To from_chars
+		if (!Has_Digits)
+			return Obj_Stream_Loader::Parse_Float_Slow(Begin, End, At, Value);
+
+		if (Cursor < End && ('e' == *Cursor || 'E' == *Cursor)) {
+			const char* Exponent_Cursor{ Cursor + 1 };
+			const bool Negative_Exponent{ Exponent_Cursor < End && '-' == *Exponent_Cursor };
+			if (Exponent_Cursor < End && ('-' == *Exponent_Cursor || '+' == *Exponent_Cursor))
+				++Exponent_Cursor;
+
+			int32_t Exponent_Value{ 0 };
+			const char* const Exponent_Begin{ Exponent_Cursor };
+			for (; Exponent_Cursor < End && '0' <= *Exponent_Cursor && *Exponent_Cursor <= '9' && Exponent_Value < 100000; ++Exponent_Cursor)
+				Exponent_Value = Exponent_Value * 10 + (*Exponent_Cursor - '0');
+
+			//NOTE : A Bare e Is Not Part Of The Number
+			if (Exponent_Cursor != Exponent_Begin) {
+				Exponent += Negative_Exponent ? -Exponent_Value : Exponent_Value;
+				Cursor = Exponent_Cursor;
+			}
+		}
+
+		if (19 < Digit_Count || (uint64_t{ 1 } << 53) < Mantissa || Exponent < -22 || 22 < Exponent)
+			return Obj_Stream_Loader::Parse_Float_Slow(Begin, End, At, Value);
+
+		double Result{ static_cast<double>(Mantissa) };
+		Result = Exponent < 0 ? Result / Powers_Of_Ten[-Exponent] : Result * Powers_Of_Ten[Exponent];
+
+		Value = static_cast<float>(Negative ? -Result : Result);
+		At = Cursor;
+		return true;
+	}
+
+private:
+	Obj_Stream_Loader(const std::filesystem::path& Model_Directory, const Vertex_Layout& Layout) : Model_Directory{ Model_Directory }, Read_Normals{ Layout.Has(Vertex_Attribute_Normal) } {
+	}
+
+	static constexpr uint32_t Empty_Slot{ numeric_limits<uint32_t>::max() };
+
+	std::filesystem::path Model_Directory{};
+	bool Read_Normals{ false };
+
+	vector<glm::vec3> Positions{};
+	vector<glm::vec2> TexCoords{};
+	vector<glm::vec3> Normals{};
+
+	vector<tinyobj::material_t> Materials{};
+	map<string, int> Material_Map{};
+
+	Model_Data Model{};
+	//NOTE : Bucket 0 Holds Faces Without A Material, Bucket N Those Of OBJ Material N - 1
+	vector<vector<uint32_t>> Buckets{ 1 };
+	size_t Bucket{ 0 };
+
+	//NOTE : Open Addressing Over Indices Into The Output Vertices, Four Bytes A Slot Instead Of A Hash Node Holding A Copy Of The Vertex
+	vector<uint32_t> Slots{};
+	uint32_t Slot_Shift{ 64 };
+
+	vector<Vertex> Face{};
+	uint32_t Skipped_Faces{ 0 };
+
+	static void Skip_Space(const char*& At, const char* End) {
+		while (At < End && (' ' == *At || '\t' == *At || '\r' == *At))
+			++At;
+	}
+
+	static const bool Is_Keyword(const char* At, const char* End, const char* Keyword, size_t Length) {
+		return static_cast<size_t>(End - At) > Length && 0 == memcmp(At, Keyword, Length) && (' ' == At[Length] || '\t' == At[Length]);
+	}
+
+	//NOTE : Eight ASCII Digits In One Little Endian Word Are Checked And Combined With A Few Multiplies, As In fast_float
+	static const bool Is_Eight_Digits(uint64_t Word) {
+		return 0 == (((Word & 0xF0F0F0F0F0F0F0F0ull) | (((Word + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) ^ 0x3333333333333333ull);
+	}
+
+	static const uint32_t Combine_Eight_Digits(uint64_t Word) {
+		Word -= 0x3030303030303030ull;
+		Word = Word * 10 + (Word >> 8);
+		Word = (((Word & 0x000000FF000000FFull) * (100 + (1000000ull << 32))) + (((Word >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32)))) >> 32;
+		return static_cast<uint32_t>(Word);
+	}
+
+	//NOTE : Digits Past The Nineteenth Still Advance The Cursor, The Count Sends Such Numbers To The Slow Path
+	static void Parse_Digits(const char*& At, const char* End, uint64_t& Mantissa, int32_t& Digit_Count) {
+		while (8 <= End - At && Digit_Count + 8 <= 19) {
+			uint64_t Word{};
+			memcpy(&Word, At, sizeof(Word));
+			if (!Obj_Stream_Loader::Is_Eight_Digits(Word))
+				break;
+
+			Mantissa = Mantissa * 100000000 + Obj_Stream_Loader::Combine_Eight_Digits(Word);
+			Digit_Count += 8;
+			At += 8;
+		}
+
+		for (; At < End && '0' <= *At && *At <= '9'; ++At, ++Digit_Count)
+			if (Digit_Count < 19)
+				Mantissa = Mantissa * 10 + static_cast<uint64_t>(*At - '0');
+	}
+
+	static const bool Parse_Float_Slow(const char* Begin, const char* End, const char*& At, float& Value) {
+		//NOTE : from_chars Takes No Leading Plus
+		const char* const Number{ Begin < End && '+' == *Begin ? Begin + 1 : Begin };
+		const auto Result{ std::from_chars(Number, End, Value) };
+		if (std::errc{} == Result.ec) {
+			At = Result.ptr;
+			return true;
+		}
+
+		//NOTE : Out Of Float Range Saturates To Infinity Or Flushes To Zero Through Double, Which from_chars Leaves Unset
+		double Wide_Value{ 0.0 };
+		const auto Wide_Result{ std::from_chars(Number, End, Wide_Value) };
+		if (std::errc::result_out_of_range == Result.ec && std::errc{} == Wide_Result.ec) {
+			Value = static_cast<float>(Wide_Value);
+			At = Wide_Result.ptr;
+			return true;
+		}
+
+		return false;
+	}
+
+	static const bool Parse_Index(const char*& At, const char* End, int64_t& Value) {
+		const bool Negative{ At < End && '-' == *At };
+		const char* Cursor{ Negative ? At + 1 : At };
+		const char* const Digits{ Cursor };
+
+		Value = 0;
+		for (; Cursor < End && '0' <= *Cursor && *Cursor <= '9' && Value < (int64_t{ 1 } << 40); ++Cursor)
+			Value = Value * 10 + (*Cursor - '0');
+		if (Cursor == Digits)
+			return false;
+
+		Value = Negative ? -Value : Value;
+		At = Cursor;
+		return true;
+	}
+
+	//NOTE : One Based, Or Negative Counting Back From The Latest, Anything Else Is Out Of Range
+	static const bool Resolve_Index(int64_t Index, size_t Count, size_t& Resolved) {
+		if (0 < Index && static_cast<uint64_t>(Index) <= Count)
+			Resolved = static_cast<size_t>(Index - 1);
+		else if (Index < 0 && static_cast<uint64_t>(-Index) <= Count)
+			Resolved = Count - static_cast<size_t>(-Index);
+		else
+			return false;
+
+		return true;
+	}
+
+	//NOTE : Missing Components Read As Zero Like tinyobjloader Does, Extra Ones Such As Vertex Colors Are Ignored
+	template<glm::length_t Length>
+	static const glm::vec<Length, float> Parse_Vector(const char* At, const char* End) {
+		glm::vec<Length, float> Result{ 0.0f };
+		for (glm::length_t Component = 0; Component < Length; ++Component) {
+			Obj_Stream_Loader::Skip_Space(At, End);
+			if (!Obj_Stream_Loader::Parse_Float(At, End, Result[Component]))
+				break;
+		}
+
+		return Result;
+	}
+
+	void Parse_Line(const char* At, const char* End) {
+		Obj_Stream_Loader::Skip_Space(At, End);
+		if (End - At < 2)
+			return;
+
+		if ('v' == At[0]) {
+			if (' ' == At[1] || '\t' == At[1])
+				this->Positions.push_back(Obj_Stream_Loader::Parse_Vector<3>(At + 2, End));
+			else if (Obj_Stream_Loader::Is_Keyword(At, End, "vt", 2))
+				this->TexCoords.push_back(Obj_Stream_Loader::Parse_Vector<2>(At + 3, End));
+			else if (Obj_Stream_Loader::Is_Keyword(At, End, "vn", 2) && this->Read_Normals)
+				this->Normals.push_back(Obj_Stream_Loader::Parse_Vector<3>(At + 3, End));
+		}
+		else if ('f' == At[0] && (' ' == At[1] || '\t' == At[1]))
+			this->Parse_Face(At + 2, End);
+		else if (Obj_Stream_Loader::Is_Keyword(At, End, "usemtl", 6))
+			this->Use_Material(At + 7, End);
+		else if (Obj_Stream_Loader::Is_Keyword(At, End, "mtllib", 6))
+			this->Load_Material_Libraries(At + 7, End);
+	}
+
+	//NOTE : Corners Are v, v/vt, v//vn Or v/vt/vn, A Face With Any Corner Out Of Range Is Skipped Like tinyobjloader Skips It
+	void Parse_Face(const char* At, const char* End) {
+		this->Face.clear();
+
+		while (true) {
+			Obj_Stream_Loader::Skip_Space(At, End);
+			if (At >= End)
+				break;
+
+			int64_t Position_Index{ 0 }, TexCoord_Index{ 0 }, Normal_Index{ 0 };
+			if (!Obj_Stream_Loader::Parse_Index(At, End, Position_Index))
+				break;
+			if (At < End && '/' == *At) {
+				++At;
+				if (At < End && '/' != *At)
+					Obj_Stream_Loader::Parse_Index(At, End, TexCoord_Index);
+				if (At < End && '/' == *At) {
+					++At;
+					Obj_Stream_Loader::Parse_Index(At, End, Normal_Index);
+				}
+			}
+
+			size_t Position{ 0 }, TexCoord{ 0 }, Normal{ 0 };
+			if (!Obj_Stream_Loader::Resolve_Index(Position_Index, this->Positions.size(), Position) ||
+				(0 != TexCoord_Index && !Obj_Stream_Loader::Resolve_Index(TexCoord_Index, this->TexCoords.size(), TexCoord)) ||
+				(0 != Normal_Index && this->Read_Normals && !Obj_Stream_Loader::Resolve_Index(Normal_Index, this->Normals.size(), Normal))) {
+				++this->Skipped_Faces;
+				return;
+			}
+
+			Vertex Corner{};
+			{
+				Corner.Pos = this->Positions[Position];
+				if (0 != TexCoord_Index)
+					Corner.TexCoord = { this->TexCoords[TexCoord].x, 1.0f - this->TexCoords[TexCoord].y };
+				Corner.Color = { 1.0f, 1.0f, 1.0f };
+				//NOTE : Unused Attributes Stay Zero So They Do Not Split Otherwise Identical Vertices
+				if (0 != Normal_Index && this->Read_Normals)
+					Corner.Normal = this->Normals[Normal];
+			}
+			this->Face.push_back(Corner);
+
+			//NOTE : Trailing Text After A Corner Ends The Face
+			if (At < End && ' ' != *At && '\t' != *At && '\r' != *At)
+				break;
+		}
+
+		if (this->Face.size() < 3) {
+			++this->Skipped_Faces;
+			return;
+		}
+
+		vector<uint32_t>& Indices{ this->Buckets[this->Bucket] };
+		const auto Emit = [&](size_t A, size_t B, size_t C) {
+			Indices.push_back(this->Insert_Vertex(this->Face[A]));
+			Indices.push_back(this->Insert_Vertex(this->Face[B]));
+			Indices.push_back(this->Insert_Vertex(this->Face[C]));
+		};
+
+		//NOTE : Quads Split Along Their Shorter Diagonal As tinyobjloader Splits Them, Larger Polygons Are Fanned
+		if (4 == this->Face.size()) {
+			const glm::vec3 Diagonal_02{ this->Face[2].Pos - this->Face[0].Pos };
+			const glm::vec3 Diagonal_13{ this->Face[3].Pos - this->Face[1].Pos };
+			if (glm::dot(Diagonal_02, Diagonal_02) < glm::dot(Diagonal_13, Diagonal_13)) {
+				Emit(0, 1, 2);
+				Emit(0, 2, 3);
+			}
+			else {
+				Emit(0, 1, 3);
+				Emit(1, 2, 3);
+			}
+			return;
+		}
+
+		for (size_t Corner = 1; Corner + 1 < this->Face.size(); ++Corner)
+			Emit(0, Corner, Corner + 1);
+	}
+
+	const uint32_t Insert_Vertex(const Vertex& Key) {
+		if ((this->Model.Vertices.size() + 1) * 2 > this->Slots.size())
+			this->Grow_Slots();
+
+		const size_t Mask{ this->Slots.size() - 1 };
+		for (size_t Slot = this->Get_Home_Slot(Key);; Slot = (Slot + 1) & Mask) {
+			const uint32_t Index{ this->Slots[Slot] };
+			if (Empty_Slot == Index) {
+				this->Slots[Slot] = static_cast<uint32_t>(this->Model.Vertices.size());
+				this->Model.Vertices.push_back(Key);
+				return this->Slots[Slot];
+			}
+
+			if (this->Model.Vertices[Index] == Key)
+				return Index;
+		}
+	}
+
+	//NOTE : Fibonacci Hashing Spreads The Combined Component Hashes Over The High Bits
+	const size_t Get_Home_Slot(const Vertex& Key) const {
+		return static_cast<size_t>((static_cast<uint64_t>(hash<Vertex>{}(Key)) * 0x9E3779B97F4A7C15ull) >> this->Slot_Shift);
+	}
+
+	//NOTE : Kept At Most Half Full, Growing Rehashes From The Output Vertices Since Slots Store Nothing Else
+	void Grow_Slots(void) {
+		const size_t Capacity{ std::max<size_t>(1024, this->Slots.size() * 2) };
+		this->Slots.assign(Capacity, Empty_Slot);
+		this->Slot_Shift = 64 - static_cast<uint32_t>(std::log2(static_cast<double>(Capacity)));
+
+		const size_t Mask{ Capacity - 1 };
+		for (uint32_t Index = 0; Index < this->Model.Vertices.size(); ++Index) {
+			size_t Slot{ this->Get_Home_Slot(this->Model.Vertices[Index]) };
+			while (Empty_Slot != this->Slots[Slot])
+				Slot = (Slot + 1) & Mask;
+			this->Slots[Slot] = Index;
+		}
+	}
+
+	//NOTE : Unknown Names Fall Back To Bucket 0 Like Faces Before Any usemtl
+	void Use_Material(const char* At, const char* End) {
+		Obj_Stream_Loader::Skip_Space(At, End);
+		while (At < End && (' ' == End[-1] || '\t' == End[-1] || '\r' == End[-1]))
+			--End;
+
+		const auto Material{ this->Material_Map.find(string{ At, End }) };
+		this->Bucket = this->Material_Map.end() != Material ? static_cast<size_t>(Material->second) + 1 : 0;
+	}
+
+	//NOTE : Libraries Are Small And Parsed Whole By tinyobjloader, Names Are Relative To The Model
+	void Load_Material_Libraries(const char* At, const char* End) {
+		while (true) {
+			Obj_Stream_Loader::Skip_Space(At, End);
+			const char* Name_End{ At };
+			while (Name_End < End && ' ' != *Name_End && '\t' != *Name_End && '\r' != *Name_End)
+				++Name_End;
+			if (Name_End == At)
+				break;
+
+			ifstream Library{ this->Model_Directory / std::filesystem::path{ string{ At, Name_End }, std::filesystem::path::generic_format } };
+			if (Library.is_open()) {
+				string Warning, Error;
+				tinyobj::LoadMtl(&this->Material_Map, &this->Materials, &Library, &Warning, &Error);
+			}
+			At = Name_End;
+		}
+
+		this->Buckets.resize(this->Materials.size() + 1);
+	}
+};
+
+//NOTE : Half Edge Collapse Onto Existing Vertices, So Every LOD Shares The LOD 0 Vertex Buffer
+struct Mesh_Simplifier final {
+	//NOTE : Each LOD Targets This Fraction Of The Previous One
+	static constexpr float Lod_Reduction{ 0.5f };
+	static constexpr uint32_t Max_Lod_Count{ 5 };
+	//NOTE : Stop The Chain When A Level Removes Less Than This Fraction
+	static constexpr float Min_Lod_Progress{ 0.1f };
+	//NOTE : Collapse Is Rejected If A Triangle Normal Turns By More Than About 75 Degrees
+	static constexpr double Max_Normal_Cosine{ 0.25 };
+
+	static const float Simplify(const vector<Vertex>& Vertices, const vector<uint32_t>& Indices, size_t Target_Index_Count, vector<uint32_t>& Output) {
+		const size_t Vertex_Count{ Vertices.size() };
+
+		vector<bool> Locked(Vertex_Count, false);
+		Mesh_Simplifier::Classify_Vertices(Vertices, Indices, Locked);
+
+		vector<Quadric> Quadrics(Vertex_Count);
+		for (size_t Triangle = 0; Triangle * 3 < Indices.size(); ++Triangle) {
+			const glm::dvec3 A{ Vertices[Indices[Triangle * 3 + 0]].Pos };
+			const glm::dvec3 B{ Vertices[Indices[Triangle * 3 + 1]].Pos };
+			const glm::dvec3 C{ Vertices[Indices[Triangle * 3 + 2]].Pos };
+			const glm::dvec3 Cross{ glm::cross(B - A, C - A) };
+			const double Length{ glm::length(Cross) };
+			if (0.0 == Length)
+				continue;
+
+			const glm::dvec3 Normal{ Cross / Length };
+			const Quadric Plane{ Quadric::From_Plane(Normal, -glm::dot(Normal, A), Length * 0.5) };
+			for (size_t Corner = 0; Corner < 3; ++Corner)
+				Quadrics[Indices[Triangle * 3 + Corner]] += Plane;
+		}
+
+		Output = Indices;
+		double Max_Error{ 0.0 };
+
+		vector<uint32_t> Collapse_Remap(Vertex_Count);
+		vector<bool> Touched(Vertex_Count);
+		vector<uint32_t> Adjacency_Offsets(Vertex_Count + 1);
+		vector<uint32_t> Adjacency{};
+
+		struct Collapse final {
+			uint32_t From;
+			uint32_t To;
+			double Error;
+		};
+		vector<Collapse> Collapses{};
+
+		while (Output.size() > Target_Index_Count) {
+			std::fill(Adjacency_Offsets.begin(), Adjacency_Offsets.end(), 0);
+			for (const auto& Index : Output)
+				++Adjacency_Offsets[Index + 1];
+			for (size_t Index = 0; Index < Vertex_Count; ++Index)
+				Adjacency_Offsets[Index + 1] += Adjacency_Offsets[Index];
+			Adjacency.resize(Output.size());
+			{
+				vector<uint32_t> Fill(Adjacency_Offsets.begin(), Adjacency_Offsets.end() - 1);
+				for (size_t Index = 0; Index < Output.size(); ++Index)
+					Adjacency[Fill[Output[Index]]++] = static_cast<uint32_t>(Index / 3);
+			}
+
+			Collapses.clear();
+			for (size_t Index = 0; Index < Output.size(); ++Index) {
+				const uint32_t From{ Output[Index] };
+				const uint32_t To{ Output[Index - Index % 3 + (Index + 1) % 3] };
+				for (const auto& [U, V] : { pair<uint32_t, uint32_t>{ From, To }, pair<uint32_t, uint32_t>{ To, From } })
+					if (!Locked[U]) {
+						Quadric Combined{ Quadrics[U] };
+						Combined += Quadrics[V];
+						Collapses.push_back(Collapse{ U, V, Combined.Evaluate(Vertices[V].Pos) });
+					}
+			}
+			std::sort(Collapses.begin(), Collapses.end(), [](const Collapse& Left, const Collapse& Right) {return Left.Error < Right.Error; });
+
+			for (size_t Index = 0; Index < Vertex_Count; ++Index)
+				Collapse_Remap[Index] = static_cast<uint32_t>(Index);
+			std::fill(Touched.begin(), Touched.end(), false);
+
+			//NOTE : Each Interior Collapse Removes Two Triangles, Stop Once The Pass Would Overshoot
+			size_t Triangles_To_Remove{ (Output.size() - Target_Index_Count) / 3 };
+			size_t Collapse_Count{ 0 };
+
+			for (const auto& Candidate : Collapses) {
+				if (Touched[Candidate.From] || Touched[Candidate.To])
+					continue;
+				if (!Mesh_Simplifier::Is_Collapse_Valid(Vertices, Output, Adjacency, Adjacency_Offsets, Candidate.From, Candidate.To))
+					continue;
+
+				size_t Removed{ 0 };
+				for (uint32_t Slot = Adjacency_Offsets[Candidate.From]; Slot < Adjacency_Offsets[Candidate.From + 1]; ++Slot) {
+					const uint32_t* Triangle_Vertices{ &Output[Adjacency[Slot] * 3] };
+					for (size_t Corner = 0; Corner < 3; ++Corner)
+						Touched[Triangle_Vertices[Corner]] = true;
+					if (Triangle_Vertices[0] == Candidate.To || Triangle_Vertices[1] == Candidate.To || Triangle_Vertices[2] == Candidate.To)
+						++Removed;
+				}
+
+				Collapse_Remap[Candidate.From] = Candidate.To;
+				Quadrics[Candidate.To] += Quadrics[Candidate.From];
+				Max_Error = std::max(Max_Error, Candidate.Error);
+				++Collapse_Count;
+
+				if (Removed >= Triangles_To_Remove)
+					break;
+				Triangles_To_Remove -= Removed;
+			}
+
+			if (0 == Collapse_Count)
+				break;
+
+			size_t Write{ 0 };
+			for (size_t Triangle = 0; Triangle * 3 < Output.size(); ++Triangle) {
+				const uint32_t A{ Collapse_Remap[Output[Triangle * 3 + 0]] };
+				const uint32_t B{ Collapse_Remap[Output[Triangle * 3 + 1]] };
+				const uint32_t C{ Collapse_Remap[Output[Triangle * 3 + 2]] };
+				if (A == B || B == C || C == A)
+					continue;
+
+				Output[Write++] = A;
+				Output[Write++] = B;
+				Output[Write++] = C;
+			}
+			Output.resize(Write);
+		}
+
+		return static_cast<float>(std::sqrt(Max_Error));
+	}
+
+private:
+	//NOTE : Vertices On Open Edges Or UV And Normal Seams Stay Put So The Silhouette And Texture Layout Survive
+	static void Classify_Vertices(const vector<Vertex>& Vertices, const vector<uint32_t>& Indices, vector<bool>& Locked) {
+		unordered_map<glm::vec3, uint32_t> Position_Ids{};
+		vector<uint32_t> Welded(Vertices.size());
+		vector<uint32_t> Group_Size{};
+		for (size_t Index = 0; Index < Vertices.size(); ++Index) {
+			const auto [It, Inserted] = Position_Ids.emplace(Vertices[Index].Pos, static_cast<uint32_t>(Group_Size.size()));
+			if (Inserted)
+				Group_Size.push_back(0);
+			Welded[Index] = It->second;
+			++Group_Size[It->second];
+		}
+
+		unordered_map<uint64_t, uint32_t> Edge_Use{};
+		for (size_t Index = 0; Index < Indices.size(); ++Index) {
+			const uint32_t A{ Welded[Indices[Index]] };
+			const uint32_t B{ Welded[Indices[Index - Index % 3 + (Index + 1) % 3]] };
+			++Edge_Use[static_cast<uint64_t>(std::min(A, B)) << 32 | std::max(A, B)];
+		}
+
+		for (size_t Index = 0; Index < Indices.size(); ++Index) {
+			const uint32_t From{ Indices[Index] };
+			const uint32_t To{ Indices[Index - Index % 3 + (Index + 1) % 3] };
+			const uint32_t A{ Welded[From] }, B{ Welded[To] };
+			if (1 != Edge_Use[static_cast<uint64_t>(std::min(A, B)) << 32 | std::max(A, B)])
+				continue;
+
+			Locked[From] = true;
+			Locked[To] = true;
+		}
+
+		for (size_t Index = 0; Index < Vertices.size(); ++Index)
+			if (1 < Group_Size[Welded[Index]])
+				Locked[Index] = true;
+	}
+
+	static bool Is_Collapse_Valid(const vector<Vertex>& Vertices, const vector<uint32_t>& Indices, const vector<uint32_t>& Adjacency, const vector<uint32_t>& Adjacency_Offsets, uint32_t From, uint32_t To) {
+		const glm::dvec3 Target{ Vertices[To].Pos };
+
+		for (uint32_t Slot = Adjacency_Offsets[From]; Slot < Adjacency_Offsets[From + 1]; ++Slot) {
+			const uint32_t* Triangle_Vertices{ &Indices[Adjacency[Slot] * 3] };
+			if (Triangle_Vertices[0] == To || Triangle_Vertices[1] == To || Triangle_Vertices[2] == To)
+				continue;
+
+			glm::dvec3 Before[3]{}, After[3]{};
+			for (size_t Corner = 0; Corner < 3; ++Corner) {
+				Before[Corner] = Vertices[Triangle_Vertices[Corner]].Pos;
+				After[Corner] = Triangle_Vertices[Corner] == From ? Target : Before[Corner];
+			}
+
+			const glm::dvec3 Normal_Before{ glm::cross(Before[1] - Before[0], Before[2] - Before[0]) };
+			const glm::dvec3 Normal_After{ glm::cross(After[1] - After[0], After[2] - After[0]) };
+			const double Length_Product{ glm::length(Normal_Before) * glm::length(Normal_After) };
+			if (0.0 == Length_Product || glm::dot(Normal_Before, Normal_After) < Max_Normal_Cosine * Length_Product)
+				return false;
+		}
+
+		return true;
+	}
+};
+
+struct Bounding_Sphere final {
+	glm::vec3 Center{ 0.0f };
+	float Radius{ 0.0f };
+
+	//NOTE : Ritter Sphere, Within A Few Percent Of Minimal And Tighter Than The AABB Sphere For Elongated Meshes
+	static const Bounding_Sphere From_Points(const vector<Vertex>& Vertices) {
+		Bounding_Sphere Sphere{};
+		if (Vertices.empty())
+			return Sphere;
+
+		const auto Find_Farthest = [&Vertices](const glm::vec3& From) {
+			glm::vec3 Farthest{ From };
+			float Farthest_Distance{ -1.0f };
+			for (const auto& Vertex : Vertices) {
+				const float Distance{ glm::dot(Vertex.Pos - From, Vertex.Pos - From) };
+				if (Distance > Farthest_Distance) {
+					Farthest_Distance = Distance;
+					Farthest = Vertex.Pos;
+				}
+			}
+			return Farthest;
+		};
+
+		const glm::vec3 First{ Find_Farthest(Vertices.front().Pos) };
+		const glm::vec3 Second{ Find_Farthest(First) };
+		Sphere.Center = (First + Second) * 0.5f;
+		Sphere.Radius = glm::length(Second - First) * 0.5f;
+
+		for (const auto& Vertex : Vertices) {
+			const float Distance{ glm::length(Vertex.Pos - Sphere.Center) };
+			if (Distance > Sphere.Radius) {
+				const float New_Radius{ (Sphere.Radius + Distance) * 0.5f };
+				Sphere.Center += (Vertex.Pos - Sphere.Center) * ((New_Radius - Sphere.Radius) / Distance);
+				Sphere.Radius = New_Radius;
+			}
+		}
+
+		return Sphere;
+	}
+
+	const Bounding_Sphere Transform(const glm::mat4& Matrix) const {
+		Bounding_Sphere Sphere{};
+		{
+			Sphere.Center = glm::vec3{ Matrix * glm::vec4{ this->Center, 1.0f } };
+			Sphere.Radius = this->Radius * glm::sqrt(glm::max(glm::dot(glm::vec3{ Matrix[0] }, glm::vec3{ Matrix[0] }),
+				glm::max(glm::dot(glm::vec3{ Matrix[1] }, glm::vec3{ Matrix[1] }), glm::dot(glm::vec3{ Matrix[2] }, glm::vec3{ Matrix[2] }))));
+		}
+
+		return Sphere;
+	}
+};
+
+//NOTE : One Cluster Of The Meshlet Builder, Its Vertices And Triangles Are Runs In The Shared Arrays Of Meshlet_Data
+struct Meshlet final {
+	uint32_t Vertex_Offset{ 0 };
+	uint32_t Vertex_Count{ 0 };
+	//NOTE : Counted In Triangles, Also The First Mesh Triangle Of The Meshlet Since The Builder Never Reorders Them
+	uint32_t Triangle_Offset{ 0 };
+	uint32_t Triangle_Count{ 0 };
+};
+
+//NOTE : Normal Cone As In meshoptimizer, A Cutoff Of 1 Means Some Triangle Faces Too Far From The Axis For The Cone To Ever Cull
+struct Meshlet_Bounds final {
+	glm::vec3 Center{ 0.0f };
+	float Radius{ 0.0f };
+	glm::vec3 Cone_Axis{ 0.0f, 0.0f, 1.0f };
+	float Cone_Cutoff{ 1.0f };
+
+	//NOTE : Every Triangle Faces Away Once The Camera Sits Inside The Negated Cone Widened By The Sphere
+	const bool Is_Backfacing(const glm::vec3& Camera) const {
+		const glm::vec3 Direction{ this->Center - Camera };
+		return glm::dot(Direction, this->Cone_Axis) >= this->Cone_Cutoff * glm::length(Direction) + this->Radius;
+	}
+};
+
+struct Meshlet_Data final {
+	vector<Meshlet> Meshlets{};
+	vector<Meshlet_Bounds> Bounds{};
+	//NOTE : Mesh Vertex Indices, Each Meshlet Owns Vertex_Count Of Them
+	vector<uint32_t> Vertices{};
+	//NOTE : Three Meshlet Local Vertex Indices Per Triangle, 64 Vertices Fit A Byte
+	vector<uint8_t> Triangles{};
+};
+
+struct Meshlet_Builder final {
+	static constexpr uint32_t Max_Vertices{ 64 };
+	//NOTE : A Multiple Of 4, So Triangle Bytes Of A Full Meshlet End On A Word
+	static constexpr uint32_t Max_Triangles{ 124 };
+	//NOTE : Once Some Normal Is More Than About 84 Degrees Off The Axis The Cone Could Almost Never Cull, So It Is Disabled
+	static constexpr float Min_Cone_Dot{ 0.1f };
+
+	//NOTE : Greedy In Index Order, Which The Vertex Cache Optimizer Already Made Local, Boundaries Are First Triangles Of Draw Ranges No Meshlet May Straddle
+	static const Meshlet_Data Build(const vector<Vertex>& Vertices, const vector<uint32_t>& Indices, const vector<uint32_t>& Boundaries) {
+		constexpr uint8_t Unassigned{ numeric_limits<uint8_t>::max() };
+
+		Meshlet_Data Data{};
+		Data.Triangles.reserve(Indices.size());
+
+		vector<uint8_t> Local_Indices(Vertices.size(), Unassigned);
+		Meshlet Current{};
+
+		const auto Flush = [&](void) {
+			if (0 == Current.Triangle_Count)
+				return;
+
+			for (uint32_t Index = 0; Index < Current.Vertex_Count; ++Index)
+				Local_Indices[Data.Vertices[Current.Vertex_Offset + Index]] = Unassigned;
+
+			Data.Bounds.push_back(Meshlet_Builder::Compute_Bounds(Vertices, Data, Current));
+			Data.Meshlets.push_back(Current);
+
+			Current = Meshlet{};
+			{
+				Current.Vertex_Offset = static_cast<uint32_t>(Data.Vertices.size());
+				Current.Triangle_Offset = static_cast<uint32_t>(Data.Triangles.size() / 3);
+			}
+		};
+
+		size_t Next_Boundary{ 0 };
+		for (uint32_t Triangle = 0; Triangle * 3 < Indices.size(); ++Triangle) {
+			for (; Next_Boundary < Boundaries.size() && Boundaries[Next_Boundary] <= Triangle; ++Next_Boundary)
+				Flush();
+
+			const uint32_t* Corners{ &Indices[Triangle * 3] };
+			const uint32_t New_Vertices{
+				(Unassigned == Local_Indices[Corners[0]] ? 1u : 0u) +
+				(Unassigned == Local_Indices[Corners[1]] && Corners[1] != Corners[0] ? 1u : 0u) +
+				(Unassigned == Local_Indices[Corners[2]] && Corners[2] != Corners[0] && Corners[2] != Corners[1] ? 1u : 0u) };
+
+			if (Current.Vertex_Count + New_Vertices > Meshlet_Builder::Max_Vertices || Current.Triangle_Count + 1 > Meshlet_Builder::Max_Triangles)
+				Flush();
+
+			for (uint32_t Corner = 0; Corner < 3; ++Corner) {
+				uint8_t& Local_Index{ Local_Indices[Corners[Corner]] };
+				if (Unassigned == Local_Index) {
+					Local_Index = static_cast<uint8_t>(Current.Vertex_Count++);
+					Data.Vertices.push_back(Corners[Corner]);
+				}
+
+				Data.Triangles.push_back(Local_Index);
+			}
+
+			++Current.Triangle_Count;
+		}
+
+		Flush();
+
+		return Data;
+	}
+
+	//NOTE : Box Center Sphere, The Axis Averages Unit Normals And The Cutoff Comes From The Normal Farthest From It
+	static const Meshlet_Bounds Compute_Bounds(const vector<Vertex>& Vertices, const Meshlet_Data& Data, const Meshlet& Meshlet) {
+		Mesh_Bounds Box{};
+		for (uint32_t Index = 0; Index < Meshlet.Vertex_Count; ++Index)
+			Box.Expand(Vertices[Data.Vertices[Meshlet.Vertex_Offset + Index]].Pos);
+
+		Meshlet_Bounds Bounds{};
+		Bounds.Center = Box.Get_Center();
+		for (uint32_t Index = 0; Index < Meshlet.Vertex_Count; ++Index)
+			Bounds.Radius = std::max(Bounds.Radius, glm::length(Vertices[Data.Vertices[Meshlet.Vertex_Offset + Index]].Pos - Bounds.Center));
+
+		array<glm::vec3, Meshlet_Builder::Max_Triangles> Normals{};
+		uint32_t Normal_Count{ 0 };
+		glm::vec3 Axis{ 0.0f };
+		for (uint32_t Triangle = 0; Triangle < Meshlet.Triangle_Count; ++Triangle) {
+			const uint8_t* Corners{ &Data.Triangles[(Meshlet.Triangle_Offset + Triangle) * 3] };
+			const glm::vec3& A{ Vertices[Data.Vertices[Meshlet.Vertex_Offset + Corners[0]]].Pos };
+			const glm::vec3& B{ Vertices[Data.Vertices[Meshlet.Vertex_Offset + Corners[1]]].Pos };
+			const glm::vec3& C{ Vertices[Data.Vertices[Meshlet.Vertex_Offset + Corners[2]]].Pos };
+
+			//NOTE : Degenerate Triangles Rasterize Nothing, So They Do Not Widen The Cone
+			const glm::vec3 Normal{ glm::cross(B - A, C - A) };
+			const float Length{ glm::length(Normal) };
+			if (0.0f == Length)
+				continue;
+
+			Normals[Normal_Count++] = Normal / Length;
+			Axis += Normal / Length;
+		}
+
+		const float Axis_Length{ glm::length(Axis) };
+		if (0 == Normal_Count || Axis_Length < 1e-6f)
+			return Bounds;
+
+		Bounds.Cone_Axis = Axis / Axis_Length;
+
+		float Min_Dot{ 1.0f };
+		for (uint32_t Index = 0; Index < Normal_Count; ++Index)
+			Min_Dot = std::min(Min_Dot, glm::dot(Normals[Index], Bounds.Cone_Axis));
+
+		Bounds.Cone_Cutoff = Min_Dot <= Meshlet_Builder::Min_Cone_Dot ? 1.0f : glm::sqrt(1.0f - Min_Dot * Min_Dot);
+
+		return Bounds;
+	}
+};
+
+struct Frustum final {
+	//NOTE : Left, Right, Bottom, Top, Near, Far As (Normal, Distance), Normals Point Inside
+	array<glm::vec4, 6> Planes{};
+
+	//NOTE : Gribb-Hartmann Extraction For The 0..1 Clip Depth Range Of GLM_FORCE_DEPTH_ZERO_TO_ONE
+	static const Frustum From_Matrix(const glm::mat4& View_Proj) {
+		const auto Get_Row = [&View_Proj](int Row) { return glm::vec4{ View_Proj[0][Row], View_Proj[1][Row], View_Proj[2][Row], View_Proj[3][Row] }; };
+
+		Frustum Frustum{};
+		{
+			Frustum.Planes[0] = Get_Row(3) + Get_Row(0);
+			Frustum.Planes[1] = Get_Row(3) - Get_Row(0);
+			Frustum.Planes[2] = Get_Row(3) + Get_Row(1);
+			Frustum.Planes[3] = Get_Row(3) - Get_Row(1);
+			Frustum.Planes[4] = Get_Row(2);
+			Frustum.Planes[5] = Get_Row(3) - Get_Row(2);
+		}
+
+		for (auto& Plane : Frustum.Planes)
+			Plane /= glm::length(glm::vec3{ Plane });
+
+		return Frustum;
+	}
+};
+
+//NOTE : World Space Volumes In SoA Order So One SIMD Load Fetches The Same Component Of Consecutive Objects
+struct Bounding_Volumes final {
+	vector<float> Center_X{};
+	vector<float> Center_Y{};
+	vector<float> Center_Z{};
+	vector<float> Radius{};
+	vector<float> Min_X{};
+	vector<float> Min_Y{};
+	vector<float> Min_Z{};
+	vector<float> Max_X{};
+	vector<float> Max_Y{};
+	vector<float> Max_Z{};
+
+	const size_t Get_Count(void) const {
+		return this->Radius.size();
+	}
+
+	void Resize(size_t Count) {
+		for (auto* Component : { &this->Center_X, &this->Center_Y, &this->Center_Z, &this->Radius, &this->Min_X, &this->Min_Y, &this->Min_Z, &this->Max_X, &this->Max_Y, &this->Max_Z })
+			Component->resize(Count);
+	}
+
+	void Set(size_t Index, const Bounding_Sphere& Sphere, const Mesh_Bounds& Bounds) {
+		this->Center_X[Index] = Sphere.Center.x;
+		this->Center_Y[Index] = Sphere.Center.y;
+		this->Center_Z[Index] = Sphere.Center.z;
+		this->Radius[Index] = Sphere.Radius;
+		this->Min_X[Index] = Bounds.Min.x;
+		this->Min_Y[Index] = Bounds.Min.y;
+		this->Min_Z[Index] = Bounds.Min.z;
+		this->Max_X[Index] = Bounds.Max.x;
+		this->Max_Y[Index] = Bounds.Max.y;
+		this->Max_Z[Index] = Bounds.Max.z;
+	}
+
+	//NOTE : Local Volumes Are Moved Into World Space, The AABB With Arvo's Method So It Stays Tight Under Rotation
+	void Set(size_t Index, const Bounding_Sphere& Local_Sphere, const Mesh_Bounds& Local_Bounds, const glm::mat4& Transform) {
+		const glm::vec3 Center{ Transform * glm::vec4{ Local_Bounds.Get_Center(), 1.0f } };
+		const glm::vec3 Half_Extent{ (Local_Bounds.Max - Local_Bounds.Min) * 0.5f };
+
+		glm::vec3 World_Half_Extent{ 0.0f };
+		for (int Column = 0; Column < 3; ++Column)
+			World_Half_Extent += glm::abs(glm::vec3{ Transform[Column] }) * Half_Extent[Column];
+
+		Mesh_Bounds World_Bounds{};
+		{
+			World_Bounds.Min = Center - World_Half_Extent;
+			World_Bounds.Max = Center + World_Half_Extent;
+		}
+
+		this->Set(Index, Local_Sphere.Transform(Transform), World_Bounds);
+	}
+};
+
+//NOTE : An Object Survives When Both Its Sphere And Its AABB Are On The Inner Side Of All Six Planes
+struct Frustum_Culler final {
+	static void Cull(const Frustum& Frustum, const Bounding_Volumes& Volumes, vector<uint32_t>& Visible) {
+#if defined(SIMD_AVX_ENABLE)
+		Frustum_Culler::Cull_AVX(Frustum, Volumes, Visible);
+#elif defined(SIMD_SSE_ENABLE)
+		Frustum_Culler::Cull_SSE(Frustum, Volumes, Visible);
+#else
+		Frustum_Culler::Cull_Scalar(Frustum, Volumes, Visible);
+#endif
+	}
+
+	static void Cull_Scalar(const Frustum& Frustum, const Bounding_Volumes& Volumes, vector<uint32_t>& Visible) {
+		Visible.resize(Volumes.Get_Count());
+		const size_t Visible_Count{ Frustum_Culler::Cull_Range(Frustum, Volumes, 0, Volumes.Get_Count(), Visible.data()) };
+		Visible.resize(Visible_Count);
+	}
+
+#if defined(SIMD_SSE_ENABLE)
+	static void Cull_SSE(const Frustum& Frustum, const Bounding_Volumes& Volumes, vector<uint32_t>& Visible) {
+		const size_t Count{ Volumes.Get_Count() };
+		const size_t Block_Count{ Count / 4 * 4 };
+		Visible.resize(Count + 4);
+
+		size_t Visible_Count{ 0 };
+		for (size_t Base = 0; Base < Block_Count; Base += 4) {
+			const __m128 Center_X{ _mm_loadu_ps(Volumes.Center_X.data() + Base) };
+			const __m128 Center_Y{ _mm_loadu_ps(Volumes.Center_Y.data() + Base) };
+			const __m128 Center_Z{ _mm_loadu_ps(Volumes.Center_Z.data() + Base) };
+			const __m128 Negative_Radius{ _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(Volumes.Radius.data() + Base)) };
+
+			__m128 Inside{ _mm_castsi128_ps(_mm_set1_epi32(-1)) };
+			for (const auto& Plane : Frustum.Planes) {
+				const __m128 Normal_X{ _mm_set1_ps(Plane.x) };
+				const __m128 Normal_Y{ _mm_set1_ps(Plane.y) };
+				const __m128 Normal_Z{ _mm_set1_ps(Plane.z) };
+				const __m128 Distance{ _mm_set1_ps(Plane.w) };
+
+				const __m128 Sphere_Distance{ _mm_add_ps(_mm_add_ps(_mm_mul_ps(Center_X, Normal_X), _mm_mul_ps(Center_Y, Normal_Y)), _mm_add_ps(_mm_mul_ps(Center_Z, Normal_Z), Distance)) };
+
+				//NOTE : Plane Is Uniform Across Lanes, So The Positive Vertex Is Picked Per Component Array Instead Of Per Lane
+				const __m128 Positive_X{ _mm_loadu_ps((0.0f <= Plane.x ? Volumes.Max_X : Volumes.Min_X).data() + Base) };
+				const __m128 Positive_Y{ _mm_loadu_ps((0.0f <= Plane.y ? Volumes.Max_Y : Volumes.Min_Y).data() + Base) };
+				const __m128 Positive_Z{ _mm_loadu_ps((0.0f <= Plane.z ? Volumes.Max_Z : Volumes.Min_Z).data() + Base) };
+				const __m128 Box_Distance{ _mm_add_ps(_mm_add_ps(_mm_mul_ps(Positive_X, Normal_X), _mm_mul_ps(Positive_Y, Normal_Y)), _mm_add_ps(_mm_mul_ps(Positive_Z, Normal_Z), Distance)) };
+
+				Inside = _mm_and_ps(Inside, _mm_and_ps(_mm_cmpge_ps(Sphere_Distance, Negative_Radius), _mm_cmpge_ps(Box_Distance, _mm_setzero_ps())));
+			}
+
+			Visible_Count = Frustum_Culler::Compact(static_cast<uint32_t>(_mm_movemask_ps(Inside)), 4, static_cast<uint32_t>(Base), Visible.data(), Visible_Count);
+		}
+
+		Visible_Count += Frustum_Culler::Cull_Range(Frustum, Volumes, Block_Count, Count, Visible.data() + Visible_Count);
+		Visible.resize(Visible_Count);
+	}
+#endif
+
+#if defined(SIMD_AVX_ENABLE)
+	static void Cull_AVX(const Frustum& Frustum, const Bounding_Volumes& Volumes, vector<uint32_t>& Visible) {
+		const size_t Count{ Volumes.Get_Count() };
+		const size_t Block_Count{ Count / 8 * 8 };
+		Visible.resize(Count + 8);
+
+		size_t Visible_Count{ 0 };
+		for (size_t Base = 0; Base < Block_Count; Base += 8) {
+			const __m256 Center_X{ _mm256_loadu_ps(Volumes.Center_X.data() + Base) };
+			const __m256 Center_Y{ _mm256_loadu_ps(Volumes.Center_Y.data() + Base) };
+			const __m256 Center_Z{ _mm256_loadu_ps(Volumes.Center_Z.data() + Base) };
+			const __m256 Negative_Radius{ _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(Volumes.Radius.data() + Base)) };
+
+			__m256 Inside{ _mm256_castsi256_ps(_mm256_set1_epi32(-1)) };
+			for (const auto& Plane : Frustum.Planes) {
+				const __m256 Normal_X{ _mm256_set1_ps(Plane.x) };
+				const __m256 Normal_Y{ _mm256_set1_ps(Plane.y) };
+				const __m256 Normal_Z{ _mm256_set1_ps(Plane.z) };
+				const __m256 Distance{ _mm256_set1_ps(Plane.w) };
+
+				const __m256 Sphere_Distance{ _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(Center_X, Normal_X), _mm256_mul_ps(Center_Y, Normal_Y)), _mm256_add_ps(_mm256_mul_ps(Center_Z, Normal_Z), Distance)) };
+
+				const __m256 Positive_X{ _mm256_loadu_ps((0.0f <= Plane.x ? Volumes.Max_X : Volumes.Min_X).data() + Base) };
+				const __m256 Positive_Y{ _mm256_loadu_ps((0.0f <= Plane.y ? Volumes.Max_Y : Volumes.Min_Y).data() + Base) };
+				const __m256 Positive_Z{ _mm256_loadu_ps((0.0f <= Plane.z ? Volumes.Max_Z : Volumes.Min_Z).data() + Base) };
+				const __m256 Box_Distance{ _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(Positive_X, Normal_X), _mm256_mul_ps(Positive_Y, Normal_Y)), _mm256_add_ps(_mm256_mul_ps(Positive_Z, Normal_Z), Distance)) };
+
+				Inside = _mm256_and_ps(Inside, _mm256_and_ps(_mm256_cmp_ps(Sphere_Distance, Negative_Radius, _CMP_GE_OQ), _mm256_cmp_ps(Box_Distance, _mm256_setzero_ps(), _CMP_GE_OQ)));
+			}
+
+			Visible_Count = Frustum_Culler::Compact(static_cast<uint32_t>(_mm256_movemask_ps(Inside)), 8, static_cast<uint32_t>(Base), Visible.data(), Visible_Count);
+		}
+
+		Visible_Count += Frustum_Culler::Cull_Range(Frustum, Volumes, Block_Count, Count, Visible.data() + Visible_Count);
+		Visible.resize(Visible_Count);
+	}
+#endif
+
+private:
+	//NOTE : Every Lane Is Written And The Cursor Only Advances For Set Bits, So Compaction Has No Branches
+	static const size_t Compact(uint32_t Mask, uint32_t Lane_Count, uint32_t Base, uint32_t* Visible, size_t Visible_Count) {
+		for (uint32_t Lane = 0; Lane < Lane_Count; ++Lane) {
+			Visible[Visible_Count] = Base + Lane;
+			Visible_Count += (Mask >> Lane) & 1;
+		}
+
+		return Visible_Count;
+	}
+
+	static const size_t Cull_Range(const Frustum& Frustum, const Bounding_Volumes& Volumes, size_t Begin, size_t End, uint32_t* Visible) {
+		size_t Visible_Count{ 0 };
+		for (size_t Index = Begin; Index < End; ++Index) {
+			bool Inside{ true };
+			for (const auto& Plane : Frustum.Planes) {
+				const float Sphere_Distance{ Volumes.Center_X[Index] * Plane.x + Volumes.Center_Y[Index] * Plane.y + Volumes.Center_Z[Index] * Plane.z + Plane.w };
+				const float Box_Distance{ (0.0f <= Plane.x ? Volumes.Max_X[Index] : Volumes.Min_X[Index]) * Plane.x
+					+ (0.0f <= Plane.y ? Volumes.Max_Y[Index] : Volumes.Min_Y[Index]) * Plane.y
+					+ (0.0f <= Plane.z ? Volumes.Max_Z[Index] : Volumes.Min_Z[Index]) * Plane.z + Plane.w };
+				Inside = Inside && Sphere_Distance >= -Volumes.Radius[Index] && Box_Distance >= 0.0f;
+			}
+
+			Visible[Visible_Count] = static_cast<uint32_t>(Index);
+			Visible_Count += Inside ? 1 : 0;
+		}
+
+		return Visible_Count;
+	}
+};
+
+//NOTE : Masked Software Occlusion, Occluders Are Rasterized Into A Coarse Buffer Of 32x8 Pixel Tiles That Each Keep A Coverage Mask,
+//       The Farthest Depth Of A Fully Covered Layer And The Farthest Depth Of The Layer Still Being Filled
+struct Masked_Occlusion_Culler final {
+	static constexpr uint32_t Width{ 256 };
+	static constexpr uint32_t Height{ 128 };
+	static constexpr uint32_t Tile_Width{ 32 };
+	static constexpr uint32_t Tile_Height{ 8 };
+	static constexpr uint32_t Tiles_X{ Width / Tile_Width };
+	static constexpr uint32_t Tiles_Y{ Height / Tile_Height };
+	//NOTE : Clip Space w Below This Counts As Crossing The Camera Plane, Such Occluders Are Dropped And Such Occludees Kept
+	static constexpr float Near_W{ 1.0e-4f };
+	//NOTE : Edges Are Evaluated In Fixed Point So Neighbouring Triangles Meet Without Cracks, Occluders Reaching Past The Guard Band Are Dropped
+	static constexpr int32_t Subpixel_Bits{ 4 };
+	static constexpr int32_t Subpixel_Scale{ 1 << Subpixel_Bits };
+	static constexpr float Guard_Band{ 1024.0f };
+	//NOTE : Tile Origin Edge Values Are Clamped Here, Far Enough That No Step Inside A Tile Can Change Their Sign
+	static constexpr int64_t Edge_Clamp{ 1 << 30 };
+
+	struct Tile final {
+		//NOTE : Bit X Of Row Y Is Pixel (X, Y) Of The Tile
+		array<uint32_t, Tile_Height> Mask{};
+		float Z_Max_0{ 1.0f };
+		float Z_Max_1{ 0.0f };
+	};
+
+	//NOTE : Edge i Is A_i * x + B_i * y + C_i On Subpixel Coordinates, Non Negative Inside, Depth Is Affine In Screen Space After The Divide
+	struct Triangle final {
+		array<int64_t, 3> Edge_A{};
+		array<int64_t, 3> Edge_B{};
+		array<int64_t, 3> Edge_C{};
+		glm::vec3 Depth_Plane{ 0.0f };
+		float Depth_Max{ 0.0f };
+		glm::vec4 Pixel_Bounds{ 0.0f };
+		glm::ivec4 Tile_Bounds{ 0 };
+	};
+
+	void Clear(void) {
+		this->Tiles.assign(Tiles_X * Tiles_Y, Tile{});
+		this->Triangles.clear();
+	}
+
+	//NOTE : Occluders Should Arrive Nearest First, The Layer Merge Keeps The Buffer Conservative In Any Order But Tighter In That One
+	void Add_Occluder(const vector<Vertex>& Vertices, const uint32_t* Indices, size_t Index_Count, const glm::mat4& Model_View_Proj) {
+		for (size_t Index = 0; Index + 2 < Index_Count; Index += 3) {
+			array<glm::vec3, 3> Screen{};
+			bool Clipped{ false };
+			for (size_t Corner = 0; Corner < 3; ++Corner) {
+				const glm::vec4 Clip{ Model_View_Proj * glm::vec4(Vertices[Indices[Index + Corner]].Pos, 1.0f) };
+				if (Near_W > Clip.w) {
+					Clipped = true;
+					break;
+				}
+
+				Screen[Corner] = glm::vec3((Clip.x / Clip.w * 0.5f + 0.5f) * Width, (Clip.y / Clip.w * 0.5f + 0.5f) * Height, Clip.z / Clip.w);
+			}
+
+			if (!Clipped)
+				this->Add_Triangle(Screen);
+		}
+	}
+
+	void Rasterize(uint32_t Thread_Count) {
+		Thread_Count = std::clamp(Thread_Count, 1u, Tiles_Y);
+		if (1 == Thread_Count) {
+			this->Rasterize_Rows(0, Tiles_Y);
+			return;
+		}
+
+		//NOTE : Threads Own Disjoint Bands Of Tile Rows, So No Tile Is Ever Written By Two Of Them
+		vector<thread> Workers{};
+		Workers.reserve(Thread_Count);
+		for (uint32_t Worker = 0; Worker < Thread_Count; ++Worker)
+			Workers.emplace_back(&Masked_Occlusion_Culler::Rasterize_Rows, this, Tiles_Y * Worker / Thread_Count, Tiles_Y * (Worker + 1) / Thread_Count);
+
+		for (auto& Worker : Workers)
+			Worker.join();
+	}
+
+	const bool Is_Visible(const Mesh_Bounds& Bounds, const glm::mat4& Model_View_Proj) const {
+		//NOTE : Corners Are The Transformed Min Corner Plus Transformed Box Edges, Three Scaled Columns Instead Of Eight Full Transforms
+		const glm::vec4 Base{ Model_View_Proj * glm::vec4(Bounds.Min, 1.0f) };
+		const glm::vec3 Size{ Bounds.Max - Bounds.Min };
+		const glm::vec4 Edge_X{ Model_View_Proj[0] * Size.x }, Edge_Y{ Model_View_Proj[1] * Size.y }, Edge_Z{ Model_View_Proj[2] * Size.z };
+
+		glm::vec3 Min_Screen{ numeric_limits<float>::max() };
+		glm::vec3 Max_Screen{ numeric_limits<float>::lowest() };
+		for (uint32_t Corner = 0; Corner < 8; ++Corner) {
+			const glm::vec4 Clip{ Base + ((Corner & 1) ? Edge_X : glm::vec4{ 0.0f }) + ((Corner & 2) ? Edge_Y : glm::vec4{ 0.0f }) + ((Corner & 4) ? Edge_Z : glm::vec4{ 0.0f }) };
+			if (Near_W > Clip.w)
+				return true;
+
+			const glm::vec3 Screen{ (Clip.x / Clip.w * 0.5f + 0.5f) * Width, (Clip.y / Clip.w * 0.5f + 0.5f) * Height, Clip.z / Clip.w };
+			Min_Screen = glm::min(Min_Screen, Screen);
+			Max_Screen = glm::max(Max_Screen, Screen);
+		}
+
+		//NOTE : Off Screen Bounds Are Left To The Frustum Culler
+		if (0.0f >= Max_Screen.x || 0.0f >= Max_Screen.y || Width <= Min_Screen.x || Height <= Min_Screen.y)
+			return true;
+
+		const int32_t First_X{ std::max(0, static_cast<int32_t>(Min_Screen.x) / static_cast<int32_t>(Tile_Width)) };
+		const int32_t First_Y{ std::max(0, static_cast<int32_t>(Min_Screen.y) / static_cast<int32_t>(Tile_Height)) };
+		const int32_t Last_X{ std::min(static_cast<int32_t>(Tiles_X) - 1, static_cast<int32_t>(Max_Screen.x) / static_cast<int32_t>(Tile_Width)) };
+		const int32_t Last_Y{ std::min(static_cast<int32_t>(Tiles_Y) - 1, static_cast<int32_t>(Max_Screen.y) / static_cast<int32_t>(Tile_Height)) };
+
+		for (int32_t Tile_Y = First_Y; Tile_Y <= Last_Y; ++Tile_Y)
+			for (int32_t Tile_X = First_X; Tile_X <= Last_X; ++Tile_X)
+				if (Min_Screen.z <= this->Tiles[Tile_Y * Tiles_X + Tile_X].Z_Max_0)
+					return true;
+
+		return false;
+	}
+
+	vector<Tile> Tiles{ Tiles_X * Tiles_Y };
+	vector<Triangle> Triangles{};
+
+private:
+	void Add_Triangle(const array<glm::vec3, 3>& Screen) {
+		for (const auto& Point : Screen)
+			if (-Guard_Band > Point.x || -Guard_Band > Point.y || Width + Guard_Band < Point.x || Height + Guard_Band < Point.y)
+				return;
+
+		array<glm::i64vec2, 3> Fixed{};
+		for (size_t Corner = 0; Corner < 3; ++Corner)
+			Fixed[Corner] = glm::i64vec2(std::lround(Screen[Corner].x * Subpixel_Scale), std::lround(Screen[Corner].y * Subpixel_Scale));
+
+		Triangle Triangle{};
+		for (size_t Edge = 0; Edge < 3; ++Edge) {
+			const glm::i64vec2& From{ Fixed[Edge] };
+			const glm::i64vec2& To{ Fixed[(Edge + 1) % 3] };
+			Triangle.Edge_A[Edge] = From.y - To.y;
+			Triangle.Edge_B[Edge] = To.x - From.x;
+			Triangle.Edge_C[Edge] = From.x * To.y - From.y * To.x;
+		}
+
+		//NOTE : Both Windings Occlude, Flip Clockwise Ones So Inside Is Always Non Negative
+		const int64_t Area{ Triangle.Edge_A[0] * Fixed[2].x + Triangle.Edge_B[0] * Fixed[2].y + Triangle.Edge_C[0] };
+		if (0 == Area)
+			return;
+
+		if (0 > Area)
+			for (size_t Edge = 0; Edge < 3; ++Edge) {
+				Triangle.Edge_A[Edge] = -Triangle.Edge_A[Edge];
+				Triangle.Edge_B[Edge] = -Triangle.Edge_B[Edge];
+				Triangle.Edge_C[Edge] = -Triangle.Edge_C[Edge];
+			}
+
+		const glm::vec3 Normal{ glm::cross(Screen[1] - Screen[0], Screen[2] - Screen[0]) };
+		Triangle.Depth_Plane = glm::vec3(-Normal.x / Normal.z, -Normal.y / Normal.z, Screen[0].z + (Normal.x * Screen[0].x + Normal.y * Screen[0].y) / Normal.z);
+		Triangle.Depth_Max = std::max({ Screen[0].z, Screen[1].z, Screen[2].z });
+
+		Triangle.Pixel_Bounds = glm::vec4(
+			std::min({ Screen[0].x, Screen[1].x, Screen[2].x }), std::min({ Screen[0].y, Screen[1].y, Screen[2].y }),
+			std::max({ Screen[0].x, Screen[1].x, Screen[2].x }), std::max({ Screen[0].y, Screen[1].y, Screen[2].y }));
+
+		if (0.0f >= Triangle.Pixel_Bounds.z || 0.0f >= Triangle.Pixel_Bounds.w || Width <= Triangle.Pixel_Bounds.x || Height <= Triangle.Pixel_Bounds.y)
+			return;
+
+		Triangle.Tile_Bounds = glm::ivec4(
+			std::max(0, static_cast<int32_t>(Triangle.Pixel_Bounds.x) / static_cast<int32_t>(Tile_Width)),
+			std::max(0, static_cast<int32_t>(Triangle.Pixel_Bounds.y) / static_cast<int32_t>(Tile_Height)),
+			std::min(static_cast<int32_t>(Tiles_X) - 1, static_cast<int32_t>(Triangle.Pixel_Bounds.z) / static_cast<int32_t>(Tile_Width)),
+			std::min(static_cast<int32_t>(Tiles_Y) - 1, static_cast<int32_t>(Triangle.Pixel_Bounds.w) / static_cast<int32_t>(Tile_Height)));
+
+		this->Triangles.push_back(Triangle);
+	}
+
+	void Rasterize_Rows(uint32_t First_Row, uint32_t Last_Row) {
+		for (const auto& Triangle : this->Triangles) {
+			const int32_t First_Y{ std::max(static_cast<int32_t>(First_Row), Triangle.Tile_Bounds.y) };
+			const int32_t Last_Y{ std::min(static_cast<int32_t>(Last_Row) - 1, Triangle.Tile_Bounds.w) };
+
+			for (int32_t Tile_Y = First_Y; Tile_Y <= Last_Y; ++Tile_Y)
+				for (int32_t Tile_X = Triangle.Tile_Bounds.x; Tile_X <= Triangle.Tile_Bounds.z; ++Tile_X)
+					Masked_Occlusion_Culler::Rasterize_Tile(Triangle, Tile_X, Tile_Y, this->Tiles[Tile_Y * Tiles_X + Tile_X]);
+		}
+	}
+
+	static void Rasterize_Tile(const Triangle& Triangle, int32_t Tile_X, int32_t Tile_Y, Tile& Tile) {
+		const float Left{ static_cast<float>(Tile_X * static_cast<int32_t>(Tile_Width)) };
+		const float Top{ static_cast<float>(Tile_Y * static_cast<int32_t>(Tile_Height)) };
+
+		//NOTE : Farthest Point Of The Plane Over The Part Of The Tile The Triangle Can Touch
+		const float Min_X{ std::max(Left, Triangle.Pixel_Bounds.x) }, Max_X{ std::min(Left + Tile_Width, Triangle.Pixel_Bounds.z) };
+		const float Min_Y{ std::max(Top, Triangle.Pixel_Bounds.y) }, Max_Y{ std::min(Top + Tile_Height, Triangle.Pixel_Bounds.w) };
+		const float Depth_X{ Triangle.Depth_Plane.x * (0.0f <= Triangle.Depth_Plane.x ? Max_X : Min_X) };
+		const float Depth_Y{ Triangle.Depth_Plane.y * (0.0f <= Triangle.Depth_Plane.y ? Max_Y : Min_Y) };
+		const float Triangle_Depth{ std::min(Triangle.Depth_Max, Depth_X + Depth_Y + Triangle.Depth_Plane.z) };
+
+		//NOTE : Edge Values At The First Pixel Center, Later Pixels Step By Whole Pixels In Subpixel Units
+		array<int32_t, 3> Origin{}, Step_X{}, Step_Y{};
+		for (size_t Edge = 0; Edge < 3; ++Edge) {
+			const int64_t Sample_X{ static_cast<int64_t>(Tile_X * Tile_Width) * Subpixel_Scale + Subpixel_Scale / 2 };
+			const int64_t Sample_Y{ static_cast<int64_t>(Tile_Y * Tile_Height) * Subpixel_Scale + Subpixel_Scale / 2 };
+			Origin[Edge] = static_cast<int32_t>(std::clamp(Triangle.Edge_A[Edge] * Sample_X + Triangle.Edge_B[Edge] * Sample_Y + Triangle.Edge_C[Edge], -Edge_Clamp, Edge_Clamp));
+			Step_X[Edge] = static_cast<int32_t>(Triangle.Edge_A[Edge] * Subpixel_Scale);
+			Step_Y[Edge] = static_cast<int32_t>(Triangle.Edge_B[Edge] * Subpixel_Scale);
+		}
+
+#if defined(SIMD_AVX2_ENABLE)
+		const __m256i Lanes{ _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7) };
+		const __m256i Outside{ _mm256_set1_epi32(-1) };
+		array<array<__m256i, Tile_Width / 8>, 3> Values{};
+		array<__m256i, 3> Row_Steps{};
+		for (size_t Edge = 0; Edge < 3; ++Edge) {
+			const __m256i First{ _mm256_add_epi32(_mm256_set1_epi32(Origin[Edge]), _mm256_mullo_epi32(_mm256_set1_epi32(Step_X[Edge]), Lanes)) };
+			for (uint32_t Block = 0; Block < Tile_Width / 8; ++Block)
+				Values[Edge][Block] = _mm256_add_epi32(First, _mm256_set1_epi32(Step_X[Edge] * static_cast<int32_t>(Block * 8)));
+			Row_Steps[Edge] = _mm256_set1_epi32(Step_Y[Edge]);
+		}
+
+		alignas(32) array<uint32_t, Tile_Height> Rows{};
+		for (uint32_t Row = 0; Row < Tile_Height; ++Row) {
+			uint32_t Bits{ 0 };
+			for (uint32_t Block = 0; Block < Tile_Width / 8; ++Block) {
+				const __m256i Inside{ _mm256_and_si256(_mm256_and_si256(
+					_mm256_cmpgt_epi32(Values[0][Block], Outside), _mm256_cmpgt_epi32(Values[1][Block], Outside)), _mm256_cmpgt_epi32(Values[2][Block], Outside)) };
+				Bits |= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(Inside))) << (Block * 8);
+
+				for (size_t Edge = 0; Edge < 3; ++Edge)
+					Values[Edge][Block] = _mm256_add_epi32(Values[Edge][Block], Row_Steps[Edge]);
+			}
+			Rows[Row] = Bits;
+		}
+
+		const __m256i Coverage{ _mm256_load_si256(reinterpret_cast<const __m256i*>(Rows.data())) };
+		if (_mm256_testz_si256(Coverage, Coverage))
+			return;
+#else
+		array<uint32_t, Tile_Height> Rows{};
+		bool Covered{ false };
+		for (uint32_t Row = 0; Row < Tile_Height; ++Row) {
+			for (uint32_t Column = 0; Column < Tile_Width; ++Column) {
+				bool Inside{ true };
+				for (size_t Edge = 0; Edge < 3; ++Edge)
+					Inside = Inside && 0 <= Origin[Edge] + Step_X[Edge] * static_cast<int32_t>(Column) + Step_Y[Edge] * static_cast<int32_t>(Row);
+
+				if (Inside)
+					Rows[Row] |= 1u << Column;
+			}
+			Covered = Covered || 0 != Rows[Row];
+		}
+
+		if (!Covered)
+			return;
+#endif
+
+		//NOTE : A Working Layer Much Farther Than The Incoming Triangle Is Discarded Rather Than Pushed Back, As In Andersson Et Al. 2015
+		if (Tile.Z_Max_1 - Triangle_Depth > Tile.Z_Max_0 - Tile.Z_Max_1) {
+			Tile.Z_Max_1 = 0.0f;
+			Tile.Mask.fill(0);
+		}
+
+		Tile.Z_Max_1 = std::max(Tile.Z_Max_1, Triangle_Depth);
+
+#if defined(SIMD_AVX2_ENABLE)
+		const __m256i Merged{ _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(Tile.Mask.data())), Coverage) };
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(Tile.Mask.data()), Merged);
+		const bool Full{ 0 != _mm256_testc_si256(Merged, _mm256_set1_epi32(-1)) };
+#else
+		bool Full{ true };
+		for (uint32_t Row = 0; Row < Tile_Height; ++Row) {
+			Tile.Mask[Row] |= Rows[Row];
+			Full = Full && 0xFFFFFFFFu == Tile.Mask[Row];
+		}
+#endif
+
+		//NOTE : A Full Working Layer Becomes The Reference Layer, Either Layer Alone Already Covers The Whole Tile
+		if (Full) {
+			Tile.Z_Max_0 = std::min(Tile.Z_Max_0, Tile.Z_Max_1);
+			Tile.Z_Max_1 = 0.0f;
+			Tile.Mask.fill(0);
+		}
+	}
+};
+
+//NOTE : Multisampled Color And Depth Only Live Inside The Render Pass, So They Can Skip Backing Memory And Their End Of Pass Stores
+struct Attachment_Policy final {
+	static constexpr uint32_t Report_Frame_Rate{ 60 };
+
+	static const VkDeviceSize Get_Texel_Size(VkFormat Format) {
+		switch (Format) {
+		case VK_FORMAT_D32_SFLOAT_S8_UINT:
+			//NOTE : Packed Depth Stencil Has No Fixed Layout, Drivers Generally Keep Separate 32 And 8 Bit Planes
+			return 5;
+		case VK_FORMAT_R16G16B16A16_SFLOAT:
+			return 8;
+		default:
+			return 4;
+		}
+	}
+
+	static const VkDeviceSize Get_Attachment_Size(const VkExtent2D& Extent, VkFormat Format, VkSampleCountFlagBits Samples) {
+		return static_cast<VkDeviceSize>(Extent.width) * Extent.height * static_cast<VkDeviceSize>(Samples) * Attachment_Policy::Get_Texel_Size(Format);
+	}
+
+	//NOTE : Lazily Allocated Saves The Allocation, DONT_CARE Saves One Write Of Every Sample Per Frame Whether Or Not Memory Is Lazy
+	static void Report(const VkExtent2D& Extent, VkFormat Color_Format, VkFormat Depth_Format, VkSampleCountFlags Sample_Counts, bool Lazily_Allocated, bool Transient) {
+		const auto Megabytes = [](VkDeviceSize Bytes) { return static_cast<double>(Bytes) / (1024.0 * 1024.0); };
+
+		for (uint32_t Samples = VK_SAMPLE_COUNT_1_BIT; Samples <= VK_SAMPLE_COUNT_64_BIT; Samples <<= 1) {
+			if (0 == (Sample_Counts & Samples))
+				continue;
+
+			const VkDeviceSize Color_Size{ Attachment_Policy::Get_Attachment_Size(Extent, Color_Format, static_cast<VkSampleCountFlagBits>(Samples)) };
+			const VkDeviceSize Depth_Size{ Attachment_Policy::Get_Attachment_Size(Extent, Depth_Format, static_cast<VkSampleCountFlagBits>(Samples)) };
+			const VkDeviceSize Memory_Saved{ Lazily_Allocated && Transient ? Color_Size + Depth_Size : 0 };
+			const VkDeviceSize Bandwidth_Saved{ Transient ? Color_Size + Depth_Size : 0 };
+
+			cout << "Attachments " << Extent.width << "x" << Extent.height << " x" << Samples << ": color " << Megabytes(Color_Size) << " MB, depth " << Megabytes(Depth_Size)
+				<< " MB, memory saved " << Megabytes(Memory_Saved) << " MB, store bandwidth saved " << Megabytes(Bandwidth_Saved) << " MB/frame ("
+				<< Megabytes(Bandwidth_Saved * Report_Frame_Rate) / 1024.0 << " GB/s at " << Report_Frame_Rate << " Hz)" << endl;
+		}
+	}
+};
+
+//NOTE : Masks Are Synchronization2 Ones, Without VK_KHR_synchronization2 Flush Folds Everything Queued Into One Legacy vkCmdPipelineBarrier
+struct Barrier_Builder final {
+	//NOTE : Last Write Not Yet Waited On By Everyone, Plus The Stages And Accesses It Is Already Visible To, Which Also Read Since
+	struct Subresource_State final {
+		VkPipelineStageFlags2 Write_Stage{ VK_PIPELINE_STAGE_2_NONE };
+		VkAccessFlags2 Write_Access{ VK_ACCESS_2_NONE };
+		VkPipelineStageFlags2 Read_Stage{ VK_PIPELINE_STAGE_2_NONE };
+		VkAccessFlags2 Read_Access{ VK_ACCESS_2_NONE };
+		VkImageLayout Layout{ VK_IMAGE_LAYOUT_UNDEFINED };
+	};
+
+	struct Image_State final {
+		VkImageAspectFlags Aspect{ VK_IMAGE_ASPECT_COLOR_BIT };
+		uint32_t Mip_Levels{ 1 };
+		uint32_t Array_Layers{ 1 };
+		//NOTE : Indexed By Layer * Mip_Levels + Level
+		vector<Subresource_State> Subresources{};
+	};
+
+	static constexpr VkAccessFlags2 Write_Access_Mask{ VK_ACCESS_2_SHADER_WRITE_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT
+		| VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_2_TRANSFER_WRITE_BIT | VK_ACCESS_2_HOST_WRITE_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT };
+
+	PFN_vkCmdPipelineBarrier2KHR Pipeline_Barrier_2{ nullptr };
+	unordered_map<VkImage, Image_State> Images{};
+	vector<VkMemoryBarrier2> Memory_Barriers{};
+	vector<VkImageMemoryBarrier2> Image_Barriers{};
+	uint32_t Flush_Count{ 0 };
+	uint32_t Barrier_Count{ 0 };
+
+	static const VkPipelineStageFlags Get_Legacy_Stage(VkPipelineStageFlags2 Stage) {
+		VkPipelineStageFlags Legacy_Stage{ static_cast<VkPipelineStageFlags>(Stage & 0xFFFFFFFFull) };
+		if (0 != (Stage & (VK_PIPELINE_STAGE_2_COPY_BIT | VK_PIPELINE_STAGE_2_RESOLVE_BIT | VK_PIPELINE_STAGE_2_BLIT_BIT | VK_PIPELINE_STAGE_2_CLEAR_BIT)))
+			Legacy_Stage |= VK_PIPELINE_STAGE_TRANSFER_BIT;
+		if (0 != (Stage & (VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT | VK_PIPELINE_STAGE_2_VERTEX_ATTRIBUTE_INPUT_BIT)))
+			Legacy_Stage |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+		if (0 != (Stage & VK_PIPELINE_STAGE_2_PRE_RASTERIZATION_SHADERS_BIT))
+			Legacy_Stage |= VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_TESSELLATION_CONTROL_SHADER_BIT | VK_PIPELINE_STAGE_TESSELLATION_EVALUATION_SHADER_BIT | VK_PIPELINE_STAGE_GEOMETRY_SHADER_BIT;
+
+		return Legacy_Stage;
+	}
+
+	static const VkAccessFlags Get_Legacy_Access(VkAccessFlags2 Access) {
+		VkAccessFlags Legacy_Access{ static_cast<VkAccessFlags>(Access & 0xFFFFFFFFull) };
+		if (0 != (Access & (VK_ACCESS_2_SHADER_SAMPLED_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_READ_BIT)))
+			Legacy_Access |= VK_ACCESS_SHADER_READ_BIT;
+		if (0 != (Access & VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT))
+			Legacy_Access |= VK_ACCESS_SHADER_WRITE_BIT;
+
+		return Legacy_Access;
+	}
+
+	void Track_Image(VkImage Image, VkImageAspectFlags Aspect, uint32_t Mip_Levels, uint32_t Array_Layers, VkImageLayout Layout = VK_IMAGE_LAYOUT_UNDEFINED) {
+		Image_State State{};
+		{
+			State.Aspect = Aspect;
+			State.Mip_Levels = Mip_Levels;
+			State.Array_Layers = Array_Layers;
+			State.Subresources.assign(static_cast<size_t>(Mip_Levels) * Array_Layers, Subresource_State{});
+		}
+
+		for (auto& Subresource : State.Subresources)
+			Subresource.Layout = Layout;
+
+		this->Images[Image] = std::move(State);
+	}
+
+	void Forget_Image(VkImage Image) {
+		this->Images.erase(Image);
+	}
+
+	//NOTE : Declares The Next Access To A Range Of Mip Levels On Every Layer, Only Subresources Whose Previous Access Conflicts Get A Barrier
+	void Image(VkImage Image, uint32_t Base_Mip_Level, uint32_t Level_Count, VkPipelineStageFlags2 Stage, VkAccessFlags2 Access, VkImageLayout Layout) {
+		auto& State{ this->Images.at(Image) };
+		const bool Write{ 0 != (Access & Write_Access_Mask) };
+
+		for (uint32_t Layer = 0; Layer < State.Array_Layers; ++Layer)
+			for (uint32_t Level = Base_Mip_Level; Level < Base_Mip_Level + Level_Count; ++Level) {
+				auto& Current{ State.Subresources[static_cast<size_t>(Layer) * State.Mip_Levels + Level] };
+
+				if (Current.Layout != Layout || Write) {
+					//NOTE : Write After Read Needs Only Execution Order, The Rest Also Makes The Earlier Write Available
+					const VkPipelineStageFlags2 Source_Stage{ Current.Write_Stage | Current.Read_Stage };
+					if (Current.Layout != Layout || VK_PIPELINE_STAGE_2_NONE != Source_Stage)
+						this->Queue_Image_Barrier(Image, State.Aspect, Level, Layer, Source_Stage, Current.Write_Access, Stage, Access, Current.Layout, Layout);
+
+					//NOTE : A Layout Transition Is Itself A Write, Ordered Before The Destination Stage Only
+					Current = { Stage, Access & Write_Access_Mask, Write ? VK_PIPELINE_STAGE_2_NONE : Stage, Write ? VK_ACCESS_2_NONE : Access, Layout };
+					continue;
+				}
+
+				//NOTE : Reads After Reads Need Nothing Once The Write Is Visible To Their Stage And Access
+				if (VK_PIPELINE_STAGE_2_NONE != Current.Write_Stage && (0 != (Stage & ~Current.Read_Stage) || 0 != (Access & ~Current.Read_Access)))
+					this->Queue_Image_Barrier(Image, State.Aspect, Level, Layer, Current.Write_Stage, Current.Write_Access, Stage, Access, Layout, Layout);
+
+				Current.Read_Stage |= Stage;
+				Current.Read_Access |= Access;
+			}
+	}
+
+	//NOTE : Untracked Barriers For Callers That Track Hazards Themselves, Memory Barriers With The Same Stages Merge
+	void Memory(VkPipelineStageFlags2 Source_Stage, VkAccessFlags2 Source_Access, VkPipelineStageFlags2 Destination_Stage, VkAccessFlags2 Destination_Access) {
+		for (auto& Barrier : this->Memory_Barriers)
+			if (Barrier.srcStageMask == Source_Stage && Barrier.dstStageMask == Destination_Stage) {
+				Barrier.srcAccessMask |= Source_Access;
+				Barrier.dstAccessMask |= Destination_Access;
+				return;
+			}
+
+		VkMemoryBarrier2 Barrier{};
+		{
+			Barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2;
+			Barrier.srcStageMask = Source_Stage;
+			Barrier.srcAccessMask = Source_Access;
+			Barrier.dstStageMask = Destination_Stage;
+			Barrier.dstAccessMask = Destination_Access;
+		}
+
+		this->Memory_Barriers.push_back(Barrier);
+	}
+
+	void Image_Transition(VkImage Image, const VkImageSubresourceRange& Range, VkPipelineStageFlags2 Source_Stage, VkAccessFlags2 Source_Access,
+		VkPipelineStageFlags2 Destination_Stage, VkAccessFlags2 Destination_Access, VkImageLayout Old_Layout, VkImageLayout New_Layout) {
+		VkImageMemoryBarrier2 Barrier{};
+		{
+			Barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+			Barrier.srcStageMask = Source_Stage;
+			Barrier.srcAccessMask = Source_Access;
+			Barrier.dstStageMask = Destination_Stage;
+			Barrier.dstAccessMask = Destination_Access;
+			Barrier.oldLayout = Old_Layout;
+			Barrier.newLayout = New_Layout;
+			Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			Barrier.image = Image;
+			Barrier.subresourceRange = Range;
+		}
+
+		this->Image_Barriers.push_back(Barrier);
+	}
+
+	void Flush(VkCommandBuffer Command_Buffer) {
+		if (this->Memory_Barriers.empty() && this->Image_Barriers.empty())
+			return;
+
+		if (nullptr != this->Pipeline_Barrier_2) {
+			VkDependencyInfo Dependency_Info{};
+			{
+				Dependency_Info.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+				Dependency_Info.memoryBarrierCount = static_cast<uint32_t>(this->Memory_Barriers.size());
+				Dependency_Info.pMemoryBarriers = this->Memory_Barriers.data();
+				Dependency_Info.imageMemoryBarrierCount = static_cast<uint32_t>(this->Image_Barriers.size());
+				Dependency_Info.pImageMemoryBarriers = this->Image_Barriers.data();
+			}
+
+			this->Pipeline_Barrier_2(Command_Buffer, &Dependency_Info);
+		}
+		else
+			this->Flush_Legacy(Command_Buffer);
+
+		++this->Flush_Count;
+		this->Barrier_Count += static_cast<uint32_t>(this->Memory_Barriers.size() + this->Image_Barriers.size());
+		this->Memory_Barriers.clear();
+		this->Image_Barriers.clear();
+	}
+
+	//NOTE : Counts Since The Last Report
+	void Report(const string& Name) {
+		cout << Name << ": " << this->Barrier_Count << " barriers in " << this->Flush_Count << " flushes through "
+			<< (nullptr != this->Pipeline_Barrier_2 ? "vkCmdPipelineBarrier2" : "vkCmdPipelineBarrier") << endl;
+
+		this->Flush_Count = 0;
+		this->Barrier_Count = 0;
+	}
+
+private:
+	//NOTE : Neighbouring Mip Levels Of One Layer Leaving The Same State Share One Barrier
+	void Queue_Image_Barrier(VkImage Image, VkImageAspectFlags Aspect, uint32_t Level, uint32_t Layer, VkPipelineStageFlags2 Source_Stage, VkAccessFlags2 Source_Access,
+		VkPipelineStageFlags2 Destination_Stage, VkAccessFlags2 Destination_Access, VkImageLayout Old_Layout, VkImageLayout New_Layout) {
+		if (!this->Image_Barriers.empty()) {
+			auto& Last{ this->Image_Barriers.back() };
+			if (Last.image == Image && Last.subresourceRange.baseArrayLayer == Layer && Last.subresourceRange.baseMipLevel + Last.subresourceRange.levelCount == Level
+				&& Last.srcStageMask == Source_Stage && Last.srcAccessMask == Source_Access && Last.dstStageMask == Destination_Stage && Last.dstAccessMask == Destination_Access
+				&& Last.oldLayout == Old_Layout && Last.newLayout == New_Layout) {
+				++Last.subresourceRange.levelCount;
+				return;
+			}
+		}
+
+		this->Image_Transition(Image, { Aspect, Level, 1, Layer, 1 }, Source_Stage, Source_Access, Destination_Stage, Destination_Access, Old_Layout, New_Layout);
+	}
+
+	void Flush_Legacy(VkCommandBuffer Command_Buffer) {
+		VkPipelineStageFlags Source_Stage{ 0 }, Destination_Stage{ 0 };
+
+		VkMemoryBarrier Memory_Barrier{};
+		{
+			Memory_Barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		}
+
+		for (const auto& Barrier : this->Memory_Barriers) {
+			Source_Stage |= Barrier_Builder::Get_Legacy_Stage(Barrier.srcStageMask);
+			Destination_Stage |= Barrier_Builder::Get_Legacy_Stage(Barrier.dstStageMask);
+			Memory_Barrier.srcAccessMask |= Barrier_Builder::Get_Legacy_Access(Barrier.srcAccessMask);
+			Memory_Barrier.dstAccessMask |= Barrier_Builder::Get_Legacy_Access(Barrier.dstAccessMask);
+		}
+
+		vector<VkImageMemoryBarrier> Image_Barriers{};
+		Image_Barriers.reserve(this->Image_Barriers.size());
+		for (const auto& Barrier : this->Image_Barriers) {
+			Source_Stage |= Barrier_Builder::Get_Legacy_Stage(Barrier.srcStageMask);
+			Destination_Stage |= Barrier_Builder::Get_Legacy_Stage(Barrier.dstStageMask);
+
+			VkImageMemoryBarrier Image_Barrier{};
+			{
+				Image_Barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+				Image_Barrier.srcAccessMask = Barrier_Builder::Get_Legacy_Access(Barrier.srcAccessMask);
+				Image_Barrier.dstAccessMask = Barrier_Builder::Get_Legacy_Access(Barrier.dstAccessMask);
+				Image_Barrier.oldLayout = Barrier.oldLayout;
+				Image_Barrier.newLayout = Barrier.newLayout;
+				Image_Barrier.srcQueueFamilyIndex = Barrier.srcQueueFamilyIndex;
+				Image_Barrier.dstQueueFamilyIndex = Barrier.dstQueueFamilyIndex;
+				Image_Barrier.image = Barrier.image;
+				Image_Barrier.subresourceRange = Barrier.subresourceRange;
+			}
+
+			Image_Barriers.push_back(Image_Barrier);
+		}
+
+		vkCmdPipelineBarrier(Command_Buffer,
+			0 != Source_Stage ? Source_Stage : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT),
+			0 != Destination_Stage ? Destination_Stage : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT),
+			0,
+			this->Memory_Barriers.empty() ? 0u : 1u, &Memory_Barrier,
+			0, nullptr,
+			static_cast<uint32_t>(Image_Barriers.size()), Image_Barriers.data());
+	}
+};
+
+//NOTE : Every Way A Pass Can Touch A Resource, Each Maps To One Stage, Access Mask And Image Layout
+enum Render_Graph_Access : uint32_t {
+	Render_Graph_Access_None = 0,
+	Render_Graph_Access_Transfer_Write,
+	Render_Graph_Access_Compute_Read,
+	Render_Graph_Access_Compute_Write,
+	Render_Graph_Access_Compute_Read_Write,
+	Render_Graph_Access_Compute_Depth_Read,
+	Render_Graph_Access_Fragment_Read,
+	Render_Graph_Access_Indirect_Read,
+	Render_Graph_Access_Mesh_Task_Read,
+	Render_Graph_Access_Color_Attachment,
+	Render_Graph_Access_Depth_Attachment,
+	Render_Graph_Access_Present,
+	Render_Graph_Access_Host_Read,
+};
+
+struct Render_Graph_State final {
+	VkPipelineStageFlags2 Stage{ 0 };
+	VkAccessFlags2 Access{ 0 };
+	VkImageLayout Layout{ VK_IMAGE_LAYOUT_UNDEFINED };
+	bool Read{ false };
+	bool Write{ false };
+};
+
+//NOTE : Attachments Are Transitioned And Synchronized By Their Render Pass, The Graph Only Checks The Layout They Arrive In And Tracks The One They Leave In
+struct Render_Graph_Use final {
+	uint32_t Resource{ 0 };
+	Render_Graph_Access Access{ Render_Graph_Access_None };
+	bool Attachment{ false };
+	//NOTE : UNDEFINED Means The Render Pass Discards What Was There
+	VkImageLayout Initial_Layout{ VK_IMAGE_LAYOUT_UNDEFINED };
+	//NOTE : What The Render Pass Final Layout And Outgoing Dependency Already Made It Ready For
+	Render_Graph_Access Final_Access{ Render_Graph_Access_None };
+	//NOTE : A Use Outside A Render Pass That Overwrites Everything, Its Transition Starts From UNDEFINED
+	bool Discard{ false };
+};
+
+struct Render_Graph_Resource final {
+	string Name{};
+	bool Is_Image{ false };
+	//NOTE : Transient Images Are Created By The Graph, Live Within One Frame And May Share Memory With Others Whose Lifetimes Do Not Overlap
+	bool Transient{ false };
+	//NOTE : Persistent Resources Carry Their Contents Into The Next Frame, So That Frame Starts From The State This One Ends In
+	bool Persistent{ false };
+	//NOTE : Output Resources Are Left In This State At The End Of The Frame, None Means Nothing Outside The Graph Consumes Them
+	Render_Graph_Access Final_Access{ Render_Graph_Access_None };
+	//NOTE : Stage A Semaphore Wait Outside The Graph Already Orders Before The First Use, Such As The Swap Chain Acquire
+	Render_Graph_Access Initial_Access{ Render_Graph_Access_None };
+
+	VkImage Image{ nullptr };
+	VkImageAspectFlags Aspect{ VK_IMAGE_ASPECT_COLOR_BIT };
+	uint32_t Mip_Levels{ 1 };
+
+	VkImageCreateInfo Image_Info{};
+	VkMemoryPropertyFlags Memory_Properties{ 0 };
+	unique_ptr<VkImage_T, function<void(VkImage)>> Owned_Image{ nullptr };
+
+	uint32_t First_Pass{ numeric_limits<uint32_t>::max() };
+	uint32_t Last_Pass{ 0 };
+	VkMemoryRequirements Memory_Requirements{};
+	uint32_t Memory_Block{ numeric_limits<uint32_t>::max() };
+	VkDeviceSize Memory_Offset{ 0 };
+	//NOTE : Earlier Transients Whose Memory This One Reuses, Its First Use Waits For Their Last
+	vector<uint32_t> Aliased_Resources{};
+};
+
+struct Render_Graph_Image_Barrier final {
+	uint32_t Resource{ 0 };
+	VkImageLayout Old_Layout{ VK_IMAGE_LAYOUT_UNDEFINED };
+	VkImageLayout New_Layout{ VK_IMAGE_LAYOUT_UNDEFINED };
+	VkPipelineStageFlags2 Source_Stage{ 0 };
+	VkPipelineStageFlags2 Destination_Stage{ 0 };
+	VkAccessFlags2 Source_Access{ 0 };
+	VkAccessFlags2 Destination_Access{ 0 };
+};
+
+//NOTE : Everything A Pass Waits For Folds Into One Barrier Flush, Buffers And Same Layout Images Share One Global Memory Barrier, Transitions Carry Their Own Stages
+struct Render_Graph_Batch final {
+	VkPipelineStageFlags2 Source_Stage{ 0 };
+	VkPipelineStageFlags2 Destination_Stage{ 0 };
+	VkAccessFlags2 Source_Access{ 0 };
+	VkAccessFlags2 Destination_Access{ 0 };
+	vector<Render_Graph_Image_Barrier> Image_Barriers{};
+
+	const bool Empty(void) const {
+		return 0 == this->Destination_Stage && this->Image_Barriers.empty();
+	}
+};
+
+struct Render_Graph_Pass final {
+	string Name{};
+	vector<Render_Graph_Use> Uses{};
+	function<void(VkCommandBuffer)> Record{};
+	bool Culled{ false };
+	Render_Graph_Batch Barriers{};
+};
+
+struct Render_Graph_Memory_Block final {
+	VkMemoryPropertyFlags Memory_Properties{ 0 };
+	uint32_t Memory_Type_Bits{ 0 };
+	VkDeviceSize Size{ 0 };
+	VkDeviceSize Alignment{ 1 };
+	unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> Memory{ nullptr };
+};
+
+struct Render_Graph_Statistics final {
+	uint32_t Pass_Count{ 0 };
+	uint32_t Culled_Pass_Count{ 0 };
+	uint32_t Barrier_Count{ 0 };
+	uint32_t Image_Barrier_Count{ 0 };
+	uint32_t Transient_Count{ 0 };
+	VkDeviceSize Transient_Size{ 0 };
+	VkDeviceSize Unaliased_Size{ 0 };
+};
+
+//NOTE : Passes Declare What They Read And Write, Compile Culls What Feeds No Output, Places Transients And Derives The Barriers Once, Execute Replays Them
+struct Render_Graph final {
+	vector<Render_Graph_Resource> Resources{};
+	vector<Render_Graph_Pass> Passes{};
+	vector<Render_Graph_Memory_Block> Memory_Blocks{};
+	Render_Graph_Batch Final_Barriers{};
+	Render_Graph_Statistics Statistics{};
+
+	static const Render_Graph_State Get_Access_State(Render_Graph_Access Access) {
+		Render_Graph_State State{};
+		switch (Access) {
+		case Render_Graph_Access_Transfer_Write:
+			State = { VK_PIPELINE_STAGE_2_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, false, true };
+			break;
+		case Render_Graph_Access_Compute_Read:
+			State = { VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_READ_BIT | VK_ACCESS_2_SHADER_SAMPLED_READ_BIT, VK_IMAGE_LAYOUT_GENERAL, true, false };
+			break;
+		case Render_Graph_Access_Compute_Write:
+			State = { VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT, VK_IMAGE_LAYOUT_GENERAL, false, true };
+			break;
+		case Render_Graph_Access_Compute_Read_Write:
+			State = { VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT, VK_IMAGE_LAYOUT_GENERAL, true, true };
+			break;
+		case Render_Graph_Access_Compute_Depth_Read:
+			State = { VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_SAMPLED_READ_BIT, VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL, true, false };
+			break;
+		case Render_Graph_Access_Fragment_Read:
+			State = { VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_ACCESS_2_SHADER_SAMPLED_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, true, false };
+			break;
+		case Render_Graph_Access_Indirect_Read:
+			State = { VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT, VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT, VK_IMAGE_LAYOUT_UNDEFINED, true, false };
+			break;
+		case Render_Graph_Access_Mesh_Task_Read:
+			State = { VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_2_MESH_SHADER_BIT_EXT, VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_READ_BIT, VK_IMAGE_LAYOUT_UNDEFINED, true, false };
+			break;
+		case Render_Graph_Access_Color_Attachment:
+			State = { VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, true, true };
+			break;
+		case Render_Graph_Access_Depth_Attachment:
+			State = { VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT, VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, true, true };
+			break;
+		case Render_Graph_Access_Present:
+			State = { VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT, VK_ACCESS_2_NONE, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, true, false };
+			break;
+		case Render_Graph_Access_Host_Read:
+			State = { VK_PIPELINE_STAGE_2_HOST_BIT, VK_ACCESS_2_HOST_READ_BIT, VK_IMAGE_LAYOUT_GENERAL, true, false };
+			break;
+		default:
+			break;
+		}
+
+		return State;
+	}
+
+	static const Render_Graph_Use Use(uint32_t Resource, Render_Graph_Access Access) {
+		Render_Graph_Use Graph_Use{};
+		{
+			Graph_Use.Resource = Resource;
+			Graph_Use.Access = Access;
+		}
+
+		return Graph_Use;
+	}
+
+	static const Render_Graph_Use Discard(uint32_t Resource, Render_Graph_Access Access) {
+		Render_Graph_Use Graph_Use{};
+		{
+			Graph_Use.Resource = Resource;
+			Graph_Use.Access = Access;
+			Graph_Use.Discard = true;
+		}
+
+		return Graph_Use;
+	}
+
+	static const Render_Graph_Use Attachment(uint32_t Resource, Render_Graph_Access Access, VkImageLayout Initial_Layout, Render_Graph_Access Final_Access) {
+		Render_Graph_Use Graph_Use{};
+		{
+			Graph_Use.Resource = Resource;
+			Graph_Use.Access = Access;
+			Graph_Use.Attachment = true;
+			Graph_Use.Initial_Layout = Initial_Layout;
+			Graph_Use.Final_Access = Final_Access;
+		}
+
+		return Graph_Use;
+	}
+
+	void Reset(void) {
+		this->Passes.clear();
+		this->Resources.clear();
+		this->Memory_Blocks.clear();
+		this->Final_Barriers = {};
+		this->Statistics = {};
+	}
+
+	//NOTE : Buffers Only Ever Need Global Memory Barriers, So The Graph Never Needs Their Handles
+	const uint32_t Import_Buffer(const string& Name, bool Persistent, Render_Graph_Access Final_Access = Render_Graph_Access_None) {
+		Render_Graph_Resource Resource{};
+		{
+			Resource.Name = Name;
+			Resource.Persistent = Persistent;
+			Resource.Final_Access = Final_Access;
+		}
+
+		this->Resources.push_back(std::move(Resource));
+		return static_cast<uint32_t>(this->Resources.size() - 1);
+	}
+
+	const uint32_t Import_Image(const string& Name, VkImageAspectFlags Aspect, uint32_t Mip_Levels, bool Persistent, Render_Graph_Access Final_Access = Render_Graph_Access_None,
+		Render_Graph_Access Initial_Access = Render_Graph_Access_None) {
+		Render_Graph_Resource Resource{};
+		{
+			Resource.Name = Name;
+			Resource.Is_Image = true;
+			Resource.Persistent = Persistent;
+			Resource.Final_Access = Final_Access;
+			Resource.Initial_Access = Initial_Access;
+			Resource.Aspect = Aspect;
+			Resource.Mip_Levels = Mip_Levels;
+		}
+
+		this->Resources.push_back(std::move(Resource));
+		return static_cast<uint32_t>(this->Resources.size() - 1);
+	}
+
+	const uint32_t Create_Image(const string& Name, const VkImageCreateInfo& Image_Info, VkImageAspectFlags Aspect, VkMemoryPropertyFlags Memory_Properties) {
+		Render_Graph_Resource Resource{};
+		{
+			Resource.Name = Name;
+			Resource.Is_Image = true;
+			Resource.Transient = true;
+			Resource.Aspect = Aspect;
+			Resource.Mip_Levels = Image_Info.mipLevels;
+			Resource.Image_Info = Image_Info;
+			Resource.Memory_Properties = Memory_Properties;
+		}
+
+		this->Resources.push_back(std::move(Resource));
+		return static_cast<uint32_t>(this->Resources.size() - 1);
+	}
+
+	const uint32_t Add_Pass(const string& Name, const vector<Render_Graph_Use>& Uses, const function<void(VkCommandBuffer)>& Record) {
+		Render_Graph_Pass Pass{};
+		{
+			Pass.Name = Name;
+			Pass.Uses = Uses;
+			Pass.Record = Record;
+		}
+
+		this->Passes.push_back(std::move(Pass));
+		return static_cast<uint32_t>(this->Passes.size() - 1);
+	}
+
+	//NOTE : Imported Images May Change Every Frame, Such As The Swap Chain Image, The Compiled Barriers Only Refer To Resource Indices
+	void Set_Image(uint32_t Resource, VkImage Image) {
+		this->Resources[Resource].Image = Image;
+	}
+
+	VkImage Get_Image(uint32_t Resource) const {
+		return this->Resources[Resource].Image;
+	}
+
+	//NOTE : Requirements Are Asked Only For Transients Some Live Pass Uses, The Callback Creates The Image Into Image And Owned_Image
+	void Compile(const function<const VkMemoryRequirements(Render_Graph_Resource&)>& Get_Requirements) {
+		this->Cull_Passes();
+
+		for (uint32_t Pass_Index = 0; Pass_Index < this->Passes.size(); ++Pass_Index)
+			if (!this->Passes[Pass_Index].Culled)
+				for (const auto& Use : this->Passes[Pass_Index].Uses) {
+					auto& Resource{ this->Resources[Use.Resource] };
+					Resource.First_Pass = std::min(Resource.First_Pass, Pass_Index);
+					Resource.Last_Pass = std::max(Resource.Last_Pass, Pass_Index);
+				}
+
+		for (auto& Resource : this->Resources)
+			if (Resource.Transient && numeric_limits<uint32_t>::max() != Resource.First_Pass) {
+				Resource.Memory_Requirements = Get_Requirements(Resource);
+				++this->Statistics.Transient_Count;
+				this->Statistics.Unaliased_Size += Resource.Memory_Requirements.size;
+			}
+
+		this->Place_Transients();
+
+		//NOTE : First Walk Only Finds Where Persistent Resources End The Frame, The Second Starts From There As The Next Frame Would
+		vector<Render_Graph_Tracked> Tracked{};
+		for (const auto& Resource : this->Resources)
+			Tracked.push_back(Render_Graph::Get_Initial_State(Resource));
+		this->Derive_Barriers(Tracked);
+		for (size_t Index = 0; Index < this->Resources.size(); ++Index)
+			if (!this->Resources[Index].Persistent)
+				Tracked[Index] = Render_Graph::Get_Initial_State(this->Resources[Index]);
+		this->Derive_Barriers(Tracked);
+
+		this->Statistics.Pass_Count = static_cast<uint32_t>(this->Passes.size());
+		for (const auto& Pass : this->Passes) {
+			this->Statistics.Culled_Pass_Count += Pass.Culled ? 1 : 0;
+			this->Statistics.Barrier_Count += !Pass.Culled && !Pass.Barriers.Empty() ? 1 : 0;
+			this->Statistics.Image_Barrier_Count += Pass.Culled ? 0 : static_cast<uint32_t>(Pass.Barriers.Image_Barriers.size());
+		}
+		this->Statistics.Barrier_Count += !this->Final_Barriers.Empty() ? 1 : 0;
+		this->Statistics.Image_Barrier_Count += static_cast<uint32_t>(this->Final_Barriers.Image_Barriers.size());
+
+		for (const auto& Block : this->Memory_Blocks)
+			this->Statistics.Transient_Size += Block.Size;
+	}
+
+	//NOTE : One Allocation Per Block, Every Transient Placed In It Is Bound At Its Offset
+	void Allocate(VkDevice Device, const function<uint32_t(uint32_t, VkMemoryPropertyFlags)>& Find_Memory_Type) {
+		for (auto& Block : this->Memory_Blocks) {
+			VkMemoryAllocateInfo Memory_Allocate_Info{};
+			{
+				Memory_Allocate_Info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+				Memory_Allocate_Info.allocationSize = Block.Size;
+				Memory_Allocate_Info.memoryTypeIndex = Find_Memory_Type(Block.Memory_Type_Bits, Block.Memory_Properties);
+			}
+
+			VkDeviceMemory Memory{ nullptr };
+			THROW_IF_VK_FAILED(vkAllocateMemory(Device, &Memory_Allocate_Info, nullptr, &Memory));
+
+			Block.Memory.get_deleter() = [Device](VkDeviceMemory Memory) {if (nullptr != Memory) vkFreeMemory(Device, Memory, nullptr); };
+			Block.Memory.reset(Memory);
+		}
+
+		for (auto& Resource : this->Resources)
+			if (Resource.Transient && numeric_limits<uint32_t>::max() != Resource.Memory_Block)
+				THROW_IF_VK_FAILED(vkBindImageMemory(Device, Resource.Image, this->Memory_Blocks[Resource.Memory_Block].Memory.get(), Resource.Memory_Offset));
+	}
+
+	void Execute(VkCommandBuffer Command_Buffer, Barrier_Builder& Barriers) const {
+		for (const auto& Pass : this->Passes) {
+			if (Pass.Culled)
+				continue;
+
+			this->Record_Barriers(Command_Buffer, Barriers, Pass.Barriers);
+			Pass.Record(Command_Buffer);
+		}
+
+		this->Record_Barriers(Command_Buffer, Barriers, this->Final_Barriers);
+	}
+
+	void Report(void) const {
+		const auto Megabytes = [](VkDeviceSize Bytes) { return static_cast<double>(Bytes) / (1024.0 * 1024.0); };
+
+		cout << "Render graph: " << this->Statistics.Pass_Count - this->Statistics.Culled_Pass_Count << " of " << this->Statistics.Pass_Count << " passes ("
+			<< this->Statistics.Culled_Pass_Count << " culled), " << this->Statistics.Barrier_Count << " barrier batches (" << this->Statistics.Image_Barrier_Count
+			<< " image transitions), " << this->Statistics.Transient_Count << " transients in " << Megabytes(this->Statistics.Transient_Size) << " MB ("
+			<< Megabytes(this->Statistics.Unaliased_Size) << " MB without aliasing)" << endl;
+	}
+
+private:
+	//NOTE : Writes Since The Last Barrier, Readers Since The Last Write, And Which Stage And Access That Write Is Already Visible To
+	struct Render_Graph_Tracked final {
+		VkPipelineStageFlags2 Write_Stage{ 0 };
+		VkAccessFlags2 Write_Access{ 0 };
+		VkPipelineStageFlags2 Read_Stage{ 0 };
+		VkPipelineStageFlags2 Visible_Stage{ 0 };
+		VkAccessFlags2 Visible_Access{ 0 };
+		VkImageLayout Layout{ VK_IMAGE_LAYOUT_UNDEFINED };
+		VkPipelineStageFlags2 Last_Stage{ 0 };
+	};
+
+	static constexpr VkAccessFlags2 Write_Access_Mask{ Barrier_Builder::Write_Access_Mask };
+
+	static const bool Is_Read(const Render_Graph_Use& Use) {
+		//NOTE : An Attachment That Is Loaded Reads What Came Before, One That Is Cleared Or Discarded Does Not
+		return Use.Attachment ? VK_IMAGE_LAYOUT_UNDEFINED != Use.Initial_Layout : !Use.Discard && Render_Graph::Get_Access_State(Use.Access).Read;
+	}
+
+	//NOTE : Unwritten Contents, Ordered After The Initial Access Stage Without Any Memory To Make Visible
+	static const Render_Graph_Tracked Get_Initial_State(const Render_Graph_Resource& Resource) {
+		const VkPipelineStageFlags2 Stage{ Render_Graph::Get_Access_State(Resource.Initial_Access).Stage };
+		return { Stage, 0, 0, 0, 0, VK_IMAGE_LAYOUT_UNDEFINED, Stage };
+	}
+
+	static const bool Is_Write(const Render_Graph_Use& Use) {
+		return Use.Attachment || Render_Graph::Get_Access_State(Use.Access).Write;
+	}
+
+	//NOTE : Walks Back From The Outputs, A Pass Lives Only If Something Live Reads What It Writes, A Discarding Attachment Ends What Came Before It
+	void Cull_Passes(void) {
+		vector<bool> Needed(this->Resources.size(), false);
+		for (size_t Index = 0; Index < this->Resources.size(); ++Index)
+			Needed[Index] = this->Resources[Index].Persistent || Render_Graph_Access_None != this->Resources[Index].Final_Access;
+
+		for (size_t Pass_Index = this->Passes.size(); Pass_Index-- > 0;) {
+			auto& Pass{ this->Passes[Pass_Index] };
+			Pass.Culled = none_of(Pass.Uses.begin(), Pass.Uses.end(), [&](const Render_Graph_Use& Use) { return Render_Graph::Is_Write(Use) && Needed[Use.Resource]; });
+			if (Pass.Culled)
+				continue;
+
+			for (const auto& Use : Pass.Uses)
+				if (Use.Discard || (Use.Attachment && !Render_Graph::Is_Read(Use)))
+					Needed[Use.Resource] = false;
+
+			for (const auto& Use : Pass.Uses)
+				if (Render_Graph::Is_Read(Use))
+					Needed[Use.Resource] = true;
+		}
+	}
+
+	//NOTE : Largest First, Each Transient Takes The Lowest Offset Clear Of Every Placed Transient Whose Lifetime Overlaps Its Own
+	void Place_Transients(void) {
+		vector<uint32_t> Order{};
+		for (uint32_t Index = 0; Index < this->Resources.size(); ++Index)
+			if (this->Resources[Index].Transient && numeric_limits<uint32_t>::max() != this->Resources[Index].First_Pass)
+				Order.push_back(Index);
+
+		stable_sort(Order.begin(), Order.end(), [&](uint32_t Left, uint32_t Right) { return this->Resources[Left].Memory_Requirements.size > this->Resources[Right].Memory_Requirements.size; });
+
+		vector<vector<uint32_t>> Placed{};
+		for (const uint32_t Index : Order) {
+			auto& Resource{ this->Resources[Index] };
+			const auto& Requirements{ Resource.Memory_Requirements };
+
+			uint32_t Block_Index{ 0 };
+			for (; Block_Index < this->Memory_Blocks.size(); ++Block_Index)
+				if (this->Memory_Blocks[Block_Index].Memory_Properties == Resource.Memory_Properties && 0 != (this->Memory_Blocks[Block_Index].Memory_Type_Bits & Requirements.memoryTypeBits))
+					break;
+
+			if (this->Memory_Blocks.size() == Block_Index) {
+				Render_Graph_Memory_Block Block{};
+				{
+					Block.Memory_Properties = Resource.Memory_Properties;
+					Block.Memory_Type_Bits = Requirements.memoryTypeBits;
+				}
+
+				this->Memory_Blocks.push_back(std::move(Block));
+				Placed.emplace_back();
+			}
+
+			auto& Block{ this->Memory_Blocks[Block_Index] };
+			const auto Align = [&](VkDeviceSize Offset) { return (Offset + Requirements.alignment - 1) / Requirements.alignment * Requirements.alignment; };
+			const auto Overlaps_Lifetime = [&](const Render_Graph_Resource& Other) { return Other.First_Pass <= Resource.Last_Pass && Resource.First_Pass <= Other.Last_Pass; };
+			const auto Overlaps_Memory = [&](const Render_Graph_Resource& Other, VkDeviceSize Offset) {
+				return Other.Memory_Offset < Offset + Requirements.size && Offset < Other.Memory_Offset + Other.Memory_Requirements.size;
+			};
+
+			vector<VkDeviceSize> Candidates{ 0 };
+			for (const uint32_t Other : Placed[Block_Index])
+				if (Overlaps_Lifetime(this->Resources[Other]))
+					Candidates.push_back(Align(this->Resources[Other].Memory_Offset + this->Resources[Other].Memory_Requirements.size));
+			sort(Candidates.begin(), Candidates.end());
+
+			VkDeviceSize Offset{ Candidates.back() };
+			for (const VkDeviceSize Candidate : Candidates)
+				if (none_of(Placed[Block_Index].begin(), Placed[Block_Index].end(), [&](uint32_t Other) { return Overlaps_Lifetime(this->Resources[Other]) && Overlaps_Memory(this->Resources[Other], Candidate); })) {
+					Offset = Candidate;
+					break;
+				}
+
+			Resource.Memory_Block = Block_Index;
+			Resource.Memory_Offset = Offset;
+			for (const uint32_t Other : Placed[Block_Index]) {
+				if (Overlaps_Lifetime(this->Resources[Other]) || !Overlaps_Memory(this->Resources[Other], Offset))
+					continue;
+
+				if (this->Resources[Other].Last_Pass < Resource.First_Pass)
+					Resource.Aliased_Resources.push_back(Other);
+				else
+					this->Resources[Other].Aliased_Resources.push_back(Index);
+			}
+
+			Block.Memory_Type_Bits &= Requirements.memoryTypeBits;
+			Block.Alignment = std::max(Block.Alignment, Requirements.alignment);
+			Block.Size = std::max(Block.Size, Offset + Requirements.size);
+			Placed[Block_Index].push_back(Index);
+		}
+	}
+
+	void Add_Barrier(Render_Graph_Batch& Batch, VkPipelineStageFlags2 Source_Stage, VkAccessFlags2 Source_Access, VkPipelineStageFlags2 Destination_Stage, VkAccessFlags2 Destination_Access) {
+		Batch.Source_Stage |= Source_Stage;
+		Batch.Destination_Stage |= Destination_Stage;
+		Batch.Source_Access |= Source_Access;
+		Batch.Destination_Access |= Destination_Access;
+	}
+
+	void Apply_Use(Render_Graph_Batch& Batch, vector<Render_Graph_Tracked>& Tracked, uint32_t Resource_Index, Render_Graph_Access Access, bool Discard = false) {
+		const Render_Graph_State State{ Render_Graph::Get_Access_State(Access) };
+		const auto& Resource{ this->Resources[Resource_Index] };
+		auto& Current{ Tracked[Resource_Index] };
+
+		VkPipelineStageFlags2 Pending_Stage{ Current.Write_Stage | Current.Read_Stage };
+		if (0 == Current.Last_Stage)
+			for (const uint32_t Aliased : Resource.Aliased_Resources)
+				Pending_Stage |= Tracked[Aliased].Last_Stage;
+
+		if (Resource.Is_Image && State.Layout != Current.Layout) {
+			Render_Graph_Image_Barrier Image_Barrier{};
+			{
+				Image_Barrier.Resource = Resource_Index;
+				Image_Barrier.Old_Layout = Discard ? VK_IMAGE_LAYOUT_UNDEFINED : Current.Layout;
+				Image_Barrier.New_Layout = State.Layout;
+				Image_Barrier.Source_Stage = Pending_Stage;
+				Image_Barrier.Destination_Stage = State.Stage;
+				Image_Barrier.Source_Access = Current.Write_Access;
+				Image_Barrier.Destination_Access = State.Access;
+			}
+
+			Batch.Image_Barriers.push_back(Image_Barrier);
+
+			//NOTE : The Transition Itself Counts As A Write The Destination Stage Is Ordered After
+			Current = { State.Stage, State.Access & Write_Access_Mask, 0, State.Write ? 0 : State.Stage, State.Write ? 0 : State.Access, State.Layout, State.Stage };
+			return;
+		}
+
+		if (State.Write) {
+			//NOTE : Write After Read Needs Only Execution Order, Write After Write Also Needs The Earlier Write Made Available
+			if (0 != Pending_Stage)
+				this->Add_Barrier(Batch, Pending_Stage, Current.Write_Access, State.Stage, State.Access);
+
+			Current = { State.Stage, State.Access & Write_Access_Mask, 0, 0, 0, Current.Layout, State.Stage };
+			return;
+		}
+
+		if (0 != Current.Write_Stage && ((State.Stage & ~Current.Visible_Stage) || (State.Access & ~Current.Visible_Access))) {
+			this->Add_Barrier(Batch, Current.Write_Stage, Current.Write_Access, State.Stage, State.Access);
+			Current.Visible_Stage |= State.Stage;
+			Current.Visible_Access |= State.Access;
+		}
+		else if (0 == Current.Last_Stage && 0 != Pending_Stage)
+			this->Add_Barrier(Batch, Pending_Stage, 0, State.Stage, 0);
+
+		Current.Read_Stage |= State.Stage;
+		Current.Last_Stage = State.Stage;
+	}
+
+	void Apply_Attachment(Render_Graph_Batch& Batch, vector<Render_Graph_Tracked>& Tracked, const Render_Graph_Pass& Pass, const Render_Graph_Use& Use) {
+		const Render_Graph_State State{ Render_Graph::Get_Access_State(Use.Access) };
+		const Render_Graph_State Final{ Render_Graph::Get_Access_State(Use.Final_Access) };
+		const auto& Resource{ this->Resources[Use.Resource] };
+		auto& Current{ Tracked[Use.Resource] };
+
+		if (VK_IMAGE_LAYOUT_UNDEFINED != Use.Initial_Layout && Use.Initial_Layout != Current.Layout)
+			throw logic_error("Render graph pass " + Pass.Name + " loads " + Resource.Name + " in a layout it is not in!");
+
+		//NOTE : The Render Pass Dependency Only Orders Against Earlier Attachment Work, Memory Reused From Another Transient Needs Its Own Wait
+		if (0 == Current.Last_Stage)
+			for (const uint32_t Aliased : Resource.Aliased_Resources)
+				this->Add_Barrier(Batch, Tracked[Aliased].Last_Stage, 0, State.Stage, 0);
+
+		Current = { State.Stage, State.Access & Write_Access_Mask, 0, Final.Stage, Final.Access, Final.Layout, State.Stage };
+	}
+
+	void Derive_Barriers(vector<Render_Graph_Tracked>& Tracked) {
+		for (auto& Pass : this->Passes) {
+			Pass.Barriers = {};
+			if (Pass.Culled)
+				continue;
+
+			for (const auto& Use : Pass.Uses)
+				if (Use.Attachment)
+					this->Apply_Attachment(Pass.Barriers, Tracked, Pass, Use);
+				else
+					this->Apply_Use(Pass.Barriers, Tracked, Use.Resource, Use.Access, Use.Discard);
+		}
+
+		this->Final_Barriers = {};
+		for (uint32_t Index = 0; Index < this->Resources.size(); ++Index)
+			if (Render_Graph_Access_None != this->Resources[Index].Final_Access)
+				this->Apply_Use(this->Final_Barriers, Tracked, Index, this->Resources[Index].Final_Access);
+	}
+
+	void Record_Barriers(VkCommandBuffer Command_Buffer, Barrier_Builder& Barriers, const Render_Graph_Batch& Batch) const {
+		if (0 != Batch.Destination_Stage)
+			Barriers.Memory(Batch.Source_Stage, Batch.Source_Access, Batch.Destination_Stage, Batch.Destination_Access);
+
+		for (const auto& Barrier : Batch.Image_Barriers) {
+			const auto& Resource{ this->Resources[Barrier.Resource] };
+			Barriers.Image_Transition(Resource.Image, { Resource.Aspect, 0, Resource.Mip_Levels, 0, 1 }, Barrier.Source_Stage, Barrier.Source_Access,
+				Barrier.Destination_Stage, Barrier.Destination_Access, Barrier.Old_Layout, Barrier.New_Layout);
+		}
+
+		Barriers.Flush(Command_Buffer);
+	}
+};
+
+//NOTE : firstInstance Carries The Texture Slot Above The Instance Index, Every Scene Shader Splits gl_InstanceIndex The Same Way
+struct Draw_Instance final {
+	static constexpr uint32_t Instance_Bits{ 20 };
+	static constexpr uint32_t Max_Instances{ 1u << Instance_Bits };
+	static constexpr uint32_t Max_Texture_Slots{ 1u << (32 - Instance_Bits) };
+
+	static constexpr uint32_t Pack(uint32_t Instance, uint32_t Texture_Slot) {
+		return Instance | Texture_Slot << Instance_Bits;
+	}
+
+	//NOTE : Materials Past The Table, Or Meshes Loaded Without One, Draw With Slot 0
+	static const uint32_t Get_Texture_Slot(const vector<uint32_t>& Texture_Slots, uint32_t Material) {
+		return Material < Texture_Slots.size() ? Texture_Slots[Material] : 0;
+	}
+};
+
+static_assert(Max_Material_Textures <= Draw_Instance::Max_Texture_Slots, "Texture slots have to fit above the instance index");
+
+//NOTE : GPU Side Records Of cull.comp, Field Order And Padding Follow std430
+struct Gpu_Instance final {
+	glm::mat4 Model{ 1.0f };
+	glm::vec4 Sphere{ 0.0f };
+};
+
+struct Gpu_Lod final {
+	uint32_t First_Range{ 0 };
+	uint32_t Range_Count{ 0 };
+	float Error{ 0.0f };
+	uint32_t Padding{ 0 };
+};
+
+struct Gpu_Draw_Range final {
+	uint32_t Index_Count{ 0 };
+	uint32_t First_Index{ 0 };
+	int32_t Vertex_Offset{ 0 };
+	uint32_t Texture_Slot{ 0 };
+};
+
+//NOTE : Sphere And Cone Are Stored Against The Instance Model Matrix, Radius Relative To The Instance Sphere, The Draw Fields Address The Index Buffer And The Meshlet Fields Its Mesh Shader Arrays
+struct Gpu_Cluster final {
+	glm::vec4 Sphere{ 0.0f };
+	glm::vec4 Cone{ 0.0f, 0.0f, 1.0f, 1.0f };
+	uint32_t Index_Count{ 0 };
+	uint32_t First_Index{ 0 };
+	int32_t Vertex_Offset{ 0 };
+	uint32_t Texture_Slot{ 0 };
+	uint32_t Meshlet_Vertex_Offset{ 0 };
+	uint32_t Meshlet_Vertex_Count{ 0 };
+	uint32_t Meshlet_Triangle_Offset{ 0 };
+	uint32_t Meshlet_Triangle_Count{ 0 };
+};
+
+//NOTE : Cull Constants Are Already At The Push Constant Limit, So What Else The Cluster Pass Needs Heads Its Buffer
+struct Gpu_Cluster_Header final {
+	uint32_t Cluster_Count{ 0 };
+	uint32_t Cone_Culling{ 0 };
+	uint32_t Padding[2]{ 0, 0 };
+};
+
+struct Gpu_Cull_Constants final {
+	array<glm::vec4, 6> Planes{};
+	glm::vec4 Camera{ 0.0f };
+	uint32_t Instance_Count{ 0 };
+	uint32_t Lod_Count{ 0 };
+	uint32_t Max_Draw_Count{ 0 };
+	float Lod_Pixel_Threshold{ 0.0f };
+};
+
+struct Gpu_Occlusion_Uniforms final {
+	glm::mat4 View_Proj{ 1.0f };
+	glm::mat4 Previous_View_Proj{ 1.0f };
+	glm::vec4 Pyramid{ 0.0f };
+};
+
+struct Gpu_Occlusion_Statistics final {
+	uint32_t Frustum_Culled{ 0 };
+	uint32_t Early_Visible{ 0 };
+	uint32_t Late_Visible{ 0 };
+	uint32_t Occluded{ 0 };
+};
+
+struct Gpu_Pyramid_Constants final {
+	glm::ivec2 Source_Size{ 0 };
+	glm::ivec2 Destination_Size{ 0 };
+	int32_t Sample_Count{ 1 };
+};
+
+//NOTE : Occlusion Culling Splits The Frame Around The Depth Pyramid Build, Early Keeps Depth For Sampling And Late Loads It Back
+enum Render_Pass_Phase : uint32_t {
+	Render_Pass_Complete,
+	Render_Pass_Early,
+	Render_Pass_Late,
+};
+
+//NOTE : Load And Store Ops Are Shared By The Render Pass Objects And Dynamic Rendering, So Both Paths Keep The Same Attachment Traffic
+struct Scene_Pass final {
+	static const VkAttachmentLoadOp Get_Load_Op(Render_Pass_Phase Phase) {
+		return Render_Pass_Late == Phase ? VK_ATTACHMENT_LOAD_OP_LOAD : VK_ATTACHMENT_LOAD_OP_CLEAR;
+	}
+
+	//NOTE : Only The Resolve Target Leaves The Pass, Unless The Late Pass Still Has To Load The Samples
+	static const VkAttachmentStoreOp Get_Store_Op(Render_Pass_Phase Phase) {
+		return Render_Pass_Early == Phase ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE;
+	}
+
+	//NOTE : The Early Pass Keeps Its Samples For The Late One, So Only The Passes That Finish The Frame Resolve
+	static const VkResolveModeFlagBits Get_Resolve_Mode(Render_Pass_Phase Phase) {
+		return Render_Pass_Early == Phase ? VK_RESOLVE_MODE_NONE : VK_RESOLVE_MODE_AVERAGE_BIT;
+	}
+
+	static const VkRenderPass Build_Render_Pass(VkDevice Device, VkFormat Color_Format, VkFormat Depth_Format, VkSampleCountFlagBits Samples, Render_Pass_Phase Phase) {
+		VkAttachmentDescription Color_Attachment{};
+		{
+			Color_Attachment.format = Color_Format;
+			Color_Attachment.samples = Samples;
+			Color_Attachment.loadOp = Scene_Pass::Get_Load_Op(Phase);
+			Color_Attachment.storeOp = Scene_Pass::Get_Store_Op(Phase);
+			Color_Attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+			Color_Attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+			Color_Attachment.initialLayout = Render_Pass_Late == Phase ? VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL : VK_IMAGE_LAYOUT_UNDEFINED;
+			Color_Attachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+		}
+
+		VkAttachmentDescription Depth_Attachment{};
+		{
+			Depth_Attachment.format = Depth_Format;
+			Depth_Attachment.samples = Samples;
+			Depth_Attachment.loadOp = Scene_Pass::Get_Load_Op(Phase);
+			Depth_Attachment.storeOp = Scene_Pass::Get_Store_Op(Phase);
+			Depth_Attachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+			Depth_Attachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+			Depth_Attachment.initialLayout = Render_Pass_Late == Phase ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_UNDEFINED;
+			Depth_Attachment.finalLayout = Render_Pass_Early == Phase ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+		}
+
+		VkAttachmentDescription Color_Attachment_Resolve{};
+		{
+			Color_Attachment_Resolve.format = Color_Format;
+			Color_Attachment_Resolve.samples = VK_SAMPLE_COUNT_1_BIT;
+			Color_Attachment_Resolve.loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+			//NOTE : Early Pass Resolve Is Overwritten By The Late Pass, It Only Exists To Keep The Passes Compatible
+			Color_Attachment_Resolve.storeOp = Render_Pass_Early == Phase ? VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE;
+			Color_Attachment_Resolve.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+			Color_Attachment_Resolve.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+			Color_Attachment_Resolve.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+			Color_Attachment_Resolve.finalLayout = Render_Pass_Early == Phase ? VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+		}
+
+		VkAttachmentReference Color_Attachment_Ref{};
+		{
+			Color_Attachment_Ref.attachment = 0;
+			Color_Attachment_Ref.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+		}
+
+		VkAttachmentReference Depth_Attachment_Ref{};
+		{
+			Depth_Attachment_Ref.attachment = 1;
+			Depth_Attachment_Ref.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+		}
+
+		VkAttachmentReference Color_Attachment_Resolve_Ref{};
+		{
+			Color_Attachment_Resolve_Ref.attachment = 2;
+			Color_Attachment_Resolve_Ref.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+		}
+
+		VkSubpassDescription Subpass{};
+		{
+			Subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+			Subpass.colorAttachmentCount = 1;
+			Subpass.pColorAttachments = &Color_Attachment_Ref;
+			Subpass.pDepthStencilAttachment = &Depth_Attachment_Ref;
+			Subpass.pResolveAttachments = &Color_Attachment_Resolve_Ref;
+		}
+
+		VkSubpassDependency Dependency{};
+		{
+			Dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+			Dependency.dstSubpass = 0;
+			Dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+			Dependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+			Dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+			Dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+		}
+
+		//NOTE : Late Pass Loads Depth The Pyramid Build Has Been Reading, Early Pass Hands Depth Over To That Build
+		if (Render_Pass_Late == Phase) {
+			Dependency.srcStageMask |= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+			Dependency.dstAccessMask |= VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT;
+		}
+
+		VkSubpassDependency Pyramid_Dependency{};
+		{
+			Pyramid_Dependency.srcSubpass = 0;
+			Pyramid_Dependency.dstSubpass = VK_SUBPASS_EXTERNAL;
+			Pyramid_Dependency.srcStageMask = VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+			Pyramid_Dependency.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+			Pyramid_Dependency.dstStageMask = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+			Pyramid_Dependency.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+		}
+
+		const array<VkSubpassDependency, 2> Dependencies{ Dependency, Pyramid_Dependency };
+
+		array<VkAttachmentDescription, 3> Attachments{ Color_Attachment, Depth_Attachment, Color_Attachment_Resolve };
+
+		VkRenderPassCreateInfo Render_Pass_Create_Info{};
+		{
+			Render_Pass_Create_Info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+			Render_Pass_Create_Info.attachmentCount = static_cast<uint32_t>(Attachments.size());
+			Render_Pass_Create_Info.pAttachments = Attachments.data();
+			Render_Pass_Create_Info.subpassCount = 1;
+			Render_Pass_Create_Info.pSubpasses = &Subpass;
+			Render_Pass_Create_Info.dependencyCount = Render_Pass_Early == Phase ? 2 : 1;
+			Render_Pass_Create_Info.pDependencies = Dependencies.data();
+		}
+
+		VkRenderPass Render_Pass{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateRenderPass(Device, &Render_Pass_Create_Info, nullptr, &Render_Pass));
+
+		return Render_Pass;
+	}
+};
+
+//NOTE : Fixed Function State A Material Chooses, Defaults Are The Opaque Scene Material
+struct Material_State final {
+	VkCullModeFlags Cull_Mode{ VK_CULL_MODE_BACK_BIT };
+	VkPrimitiveTopology Topology{ VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST };
+	bool Primitive_Restart{ false };
+	bool Depth_Test{ true };
+	bool Depth_Write{ true };
+	VkCompareOp Depth_Compare{ VK_COMPARE_OP_LESS };
+	bool Depth_Bias{ false };
+	bool Blend{ false };
+
+	const uint64_t Get_Key(void) const {
+		return
+			static_cast<uint64_t>(this->Cull_Mode) |
+			static_cast<uint64_t>(this->Topology) << 2 |
+			static_cast<uint64_t>(this->Primitive_Restart) << 6 |
+			static_cast<uint64_t>(this->Depth_Test) << 7 |
+			static_cast<uint64_t>(this->Depth_Write) << 8 |
+			static_cast<uint64_t>(this->Depth_Compare) << 9 |
+			static_cast<uint64_t>(this->Depth_Bias) << 12 |
+			static_cast<uint64_t>(this->Blend) << 13;
+	}
+};
+
+//NOTE : Everything A Scene Pipeline Variant Is Built From, A Null Render Pass Means Dynamic Rendering
+struct Graphics_Pipeline_Desc final {
+	VkShaderModule Vertex_Shader{ nullptr };
+	VkShaderModule Fragment_Shader{ nullptr };
+	VkPipelineLayout Layout{ nullptr };
+	Vertex_Layout Vertices{};
+	//NOTE : No Vertex Input State At All, The Vertex Shader Reads Vertices From A Storage Buffer
+	bool Vertex_Pulling{ false };
+	//NOTE : Vertex_Shader Then Holds A Mesh Shader, Which Has No Vertex Input Or Input Assembly State
+	bool Mesh_Shading{ false };
+	VkSampleCountFlagBits Samples{ VK_SAMPLE_COUNT_1_BIT };
+	VkFormat Color_Format{ VK_FORMAT_UNDEFINED };
+	VkFormat Depth_Format{ VK_FORMAT_UNDEFINED };
+	VkRenderPass Render_Pass{ nullptr };
+	Material_State Material{};
+	vector<VkDynamicState> Dynamic_States{};
+	//NOTE : Size Of The Fragment Shader's Texture Array, Specialization Constant 0
+	uint32_t Texture_Count{ 1 };
+};
+
+//NOTE : Each Level Adds The State Of One More Extended Dynamic State Extension, Levels Only Exist On Top Of Each Other
+enum Dynamic_State_Level : uint32_t {
+	Dynamic_State_Level_None,
+	Dynamic_State_Level_1,
+	Dynamic_State_Level_2,
+	Dynamic_State_Level_3,
+};
+
+//NOTE : Material State The Level Covers Is Set While Recording, So One Pipeline Stands In For Every Material Differing Only There
+struct Extended_Dynamic_State final {
+	Dynamic_State_Level Level{ Dynamic_State_Level_None };
+	bool Unrestricted_Topology{ false };
+	bool Dynamic_Samples{ false };
+
+	PFN_vkCmdSetCullModeEXT Set_Cull_Mode{ nullptr };
+	PFN_vkCmdSetPrimitiveTopologyEXT Set_Primitive_Topology{ nullptr };
+	PFN_vkCmdSetDepthTestEnableEXT Set_Depth_Test_Enable{ nullptr };
+	PFN_vkCmdSetDepthWriteEnableEXT Set_Depth_Write_Enable{ nullptr };
+	PFN_vkCmdSetDepthCompareOpEXT Set_Depth_Compare_Op{ nullptr };
+	PFN_vkCmdSetDepthBiasEnableEXT Set_Depth_Bias_Enable{ nullptr };
+	PFN_vkCmdSetPrimitiveRestartEnableEXT Set_Primitive_Restart_Enable{ nullptr };
+	PFN_vkCmdSetColorBlendEnableEXT Set_Color_Blend_Enable{ nullptr };
+	PFN_vkCmdSetRasterizationSamplesEXT Set_Rasterization_Samples{ nullptr };
+
+	//NOTE : Sample Count Only Goes Dynamic Without Render Pass Objects, Their Compatibility Rules Still Compare Attachment Samples
+	void Load(VkDevice Device, Dynamic_State_Level Level, bool Unrestricted_Topology, bool Dynamic_Rendering) {
+		this->Level = Level;
+		this->Unrestricted_Topology = Unrestricted_Topology;
+		this->Dynamic_Samples = Dynamic_State_Level_3 <= Level && Dynamic_Rendering;
+
+		const auto Load_Function = [Device](auto& Function, const char* Name) {
+			Function = reinterpret_cast<remove_reference_t<decltype(Function)>>(vkGetDeviceProcAddr(Device, Name));
+		};
+
+		if (Dynamic_State_Level_1 <= Level) {
+			Load_Function(this->Set_Cull_Mode, "vkCmdSetCullModeEXT");
+			Load_Function(this->Set_Primitive_Topology, "vkCmdSetPrimitiveTopologyEXT");
+			Load_Function(this->Set_Depth_Test_Enable, "vkCmdSetDepthTestEnableEXT");
+			Load_Function(this->Set_Depth_Write_Enable, "vkCmdSetDepthWriteEnableEXT");
+			Load_Function(this->Set_Depth_Compare_Op, "vkCmdSetDepthCompareOpEXT");
+		}
+
+		if (Dynamic_State_Level_2 <= Level) {
+			Load_Function(this->Set_Depth_Bias_Enable, "vkCmdSetDepthBiasEnableEXT");
+			Load_Function(this->Set_Primitive_Restart_Enable, "vkCmdSetPrimitiveRestartEnableEXT");
+		}
+
+		if (Dynamic_State_Level_3 <= Level) {
+			Load_Function(this->Set_Color_Blend_Enable, "vkCmdSetColorBlendEnableEXT");
+			Load_Function(this->Set_Rasterization_Samples, "vkCmdSetRasterizationSamplesEXT");
+		}
+	}
+
+	//NOTE : Dynamic Fields Are Reset To One Value, Descs That Then Compare Equal Are Served By The Same Pipeline
+	const Graphics_Pipeline_Desc Get_Baked_Desc(const Graphics_Pipeline_Desc& Desc) const {
+		Graphics_Pipeline_Desc Baked{ Desc };
+		const Material_State Default{};
+
+		if (Dynamic_State_Level_1 <= this->Level) {
+			Baked.Material.Cull_Mode = Default.Cull_Mode;
+			Baked.Material.Depth_Test = Default.Depth_Test;
+			Baked.Material.Depth_Write = Default.Depth_Write;
+			Baked.Material.Depth_Compare = Default.Depth_Compare;
+			Baked.Dynamic_States.insert(Baked.Dynamic_States.end(), {
+				VK_DYNAMIC_STATE_CULL_MODE_EXT,
+				VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT,
+				VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT,
+				VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT,
+				VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT });
+		}
+
+		if (Dynamic_State_Level_2 <= this->Level) {
+			Baked.Material.Depth_Bias = Default.Depth_Bias;
+			Baked.Material.Primitive_Restart = Default.Primitive_Restart;
+			Baked.Dynamic_States.insert(Baked.Dynamic_States.end(), {
+				VK_DYNAMIC_STATE_DEPTH_BIAS_ENABLE_EXT,
+				VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE_EXT });
+		}
+
+		//NOTE : A Baked Primitive Restart Keeps Its Strip, Restart On A List Topology Needs Yet Another Feature
+		if (Dynamic_State_Level_1 <= this->Level && !Baked.Material.Primitive_Restart)
+			Baked.Material.Topology = this->Unrestricted_Topology ? Default.Topology : Extended_Dynamic_State::Get_Topology_Class(Desc.Material.Topology);
+
+		if (Dynamic_State_Level_3 <= this->Level) {
+			Baked.Material.Blend = Default.Blend;
+			Baked.Dynamic_States.push_back(VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT);
+		}
+
+		if (this->Dynamic_Samples) {
+			Baked.Samples = VK_SAMPLE_COUNT_1_BIT;
+			Baked.Dynamic_States.push_back(VK_DYNAMIC_STATE_RASTERIZATION_SAMPLES_EXT);
+		}
+
+		return Baked;
+	}
+
+	//NOTE : Pipelines Of One Level Share Their Dynamic States, So These Survive A Pipeline Bind And Only Change With The Material
+	void Record(VkCommandBuffer Command_Buffer, const Material_State& Material, VkSampleCountFlagBits Samples) const {
+		if (Dynamic_State_Level_1 <= this->Level) {
+			this->Set_Cull_Mode(Command_Buffer, Material.Cull_Mode);
+			this->Set_Primitive_Topology(Command_Buffer, Material.Topology);
+			this->Set_Depth_Test_Enable(Command_Buffer, Material.Depth_Test ? VK_TRUE : VK_FALSE);
+			this->Set_Depth_Write_Enable(Command_Buffer, Material.Depth_Write ? VK_TRUE : VK_FALSE);
+			this->Set_Depth_Compare_Op(Command_Buffer, Material.Depth_Compare);
+		}
+
+		if (Dynamic_State_Level_2 <= this->Level) {
+			this->Set_Depth_Bias_Enable(Command_Buffer, Material.Depth_Bias ? VK_TRUE : VK_FALSE);
+			this->Set_Primitive_Restart_Enable(Command_Buffer, Material.Primitive_Restart ? VK_TRUE : VK_FALSE);
+		}
+
+		if (Dynamic_State_Level_3 <= this->Level) {
+			const VkBool32 Blend_Enable{ Material.Blend ? VK_TRUE : VK_FALSE };
+			this->Set_Color_Blend_Enable(Command_Buffer, 0, 1, &Blend_Enable);
+		}
+
+		if (this->Dynamic_Samples)
+			this->Set_Rasterization_Samples(Command_Buffer, Samples);
+	}
+
+private:
+	//NOTE : Without dynamicPrimitiveTopologyUnrestricted The Pipeline Still Fixes Points, Lines Or Triangles
+	static const VkPrimitiveTopology Get_Topology_Class(VkPrimitiveTopology Topology) {
+		switch (Topology) {
+		case VK_PRIMITIVE_TOPOLOGY_POINT_LIST:
+			return VK_PRIMITIVE_TOPOLOGY_POINT_LIST;
+		case VK_PRIMITIVE_TOPOLOGY_LINE_LIST:
+		case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP:
+		case VK_PRIMITIVE_TOPOLOGY_LINE_LIST_WITH_ADJACENCY:
+		case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP_WITH_ADJACENCY:
+			return VK_PRIMITIVE_TOPOLOGY_LINE_LIST;
+		case VK_PRIMITIVE_TOPOLOGY_PATCH_LIST:
+			return VK_PRIMITIVE_TOPOLOGY_PATCH_LIST;
+		default:
+			return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		}
+	}
+};
+
+struct Draw_State_Statistics final {
+	uint32_t Draw_Count{ 0 };
+	uint32_t Dispatch_Count{ 0 };
+	uint32_t Bind_Count{ 0 };
+	uint32_t Elided_Bind_Count{ 0 };
+	uint32_t Push_Count{ 0 };
+	uint32_t Elided_Push_Count{ 0 };
+	uint32_t Dynamic_State_Count{ 0 };
+	uint32_t Elided_Dynamic_State_Count{ 0 };
+	uint32_t Barrier_Count{ 0 };
+	uint32_t Barrier_Flush_Count{ 0 };
+};
+
+//NOTE : Every Bind, Push And Dynamic State Of One Command Buffer Goes Through Here, Whatever Matches What Is Already Set Is Never Recorded
+//NOTE : State Survives Render Pass Boundaries Inside A Command Buffer, Only Begin Forgets It, Graphics Pipelines Here All Share The Dynamic States Of Their Level
+struct Draw_State_Cache final {
+	static constexpr uint32_t Max_Push_Constant_Size{ 128 };
+
+	//NOTE : Off Still Counts, Every Call Is Then Recorded So The Two Can Be Compared
+	bool Elide{ Draw_State_Cache_Enable };
+	Draw_State_Statistics Statistics{};
+
+	//NOTE : Statistics Restart With Every Command Buffer, Barriers Are Counted From The Builder's Own Totals
+	void Begin(VkCommandBuffer Command_Buffer, const Barrier_Builder& Barriers) {
+		this->Command_Buffer = Command_Buffer;
+		this->Bind_Points = {};
+		this->Vertex_Buffer = {};
+		this->Index_Buffer = {};
+		this->Viewport.reset();
+		this->Scissor.reset();
+		this->Material_Key.reset();
+		this->Statistics = {};
+		this->Barrier_Base = { Barriers.Barrier_Count, Barriers.Flush_Count };
+	}
+
+	void End(const Barrier_Builder& Barriers) {
+		this->Statistics.Barrier_Count = Barriers.Barrier_Count - this->Barrier_Base.first;
+		this->Statistics.Barrier_Flush_Count = Barriers.Flush_Count - this->Barrier_Base.second;
+		this->Command_Buffer = nullptr;
+	}
+
+	void Bind_Pipeline(VkPipelineBindPoint Bind_Point, VkPipeline Pipeline) {
+		auto& State{ this->Get_Bind_Point(Bind_Point) };
+		if (!this->Count_Bind(State.Pipeline == Pipeline))
+			return;
+
+		State.Pipeline = Pipeline;
+		vkCmdBindPipeline(this->Command_Buffer, Bind_Point, Pipeline);
+	}
+
+	//NOTE : Set 0 Only, Every Layout Here Has One Set, A Different Layout Is Always Rebound Since Compatibility Is Not Tracked
+	void Bind_Descriptor_Set(VkPipelineBindPoint Bind_Point, VkPipelineLayout Layout, VkDescriptorSet Descriptor_Set) {
+		auto& State{ this->Get_Bind_Point(Bind_Point) };
+		if (!this->Count_Bind(State.Set_Layout == Layout && State.Descriptor_Set == Descriptor_Set))
+			return;
+
+		State.Set_Layout = Layout;
+		State.Descriptor_Set = Descriptor_Set;
+		vkCmdBindDescriptorSets(this->Command_Buffer, Bind_Point, Layout, 0, 1, &Descriptor_Set, 0, nullptr);
+	}
+
+	//NOTE : Whole Range From Offset 0, Pushed Again Only When The Layout, Stages Or Bytes Differ From The Last Push
+	template<typename T>
+	void Push_Constants(VkPipelineBindPoint Bind_Point, VkPipelineLayout Layout, VkShaderStageFlags Stages, const T& Constants) {
+		static_assert(sizeof(T) <= Max_Push_Constant_Size, "Push constants exceed the guaranteed minimum size");
+
+		auto& State{ this->Get_Bind_Point(Bind_Point) };
+		const bool Redundant{ State.Push_Layout == Layout && State.Push_Stages == Stages && State.Push_Size == sizeof(T) && 0 == memcmp(State.Push_Data.data(), &Constants, sizeof(T)) };
+
+		if (!this->Count(Redundant, this->Statistics.Push_Count, this->Statistics.Elided_Push_Count))
+			return;
+
+		State.Push_Layout = Layout;
+		State.Push_Stages = Stages;
+		State.Push_Size = sizeof(T);
+		memcpy(State.Push_Data.data(), &Constants, sizeof(T));
+		vkCmdPushConstants(this->Command_Buffer, Layout, Stages, 0, sizeof(T), &Constants);
+	}
+
+	void Bind_Vertex_Buffer(VkBuffer Buffer, VkDeviceSize Offset) {
+		if (!this->Count_Bind(this->Vertex_Buffer == make_pair(Buffer, Offset)))
+			return;
+
+		this->Vertex_Buffer = { Buffer, Offset };
+		vkCmdBindVertexBuffers(this->Command_Buffer, 0, 1, &Buffer, &Offset);
+	}
+
+	void Bind_Index_Buffer(VkBuffer Buffer, VkDeviceSize Offset, VkIndexType Type) {
+		if (!this->Count_Bind(this->Index_Buffer == make_tuple(Buffer, Offset, Type)))
+			return;
+
+		this->Index_Buffer = { Buffer, Offset, Type };
+		vkCmdBindIndexBuffer(this->Command_Buffer, Buffer, Offset, Type);
+	}
+
+	void Set_Viewport(const VkViewport& Viewport) {
+		const bool Redundant{ this->Viewport.has_value() && 0 == memcmp(&*this->Viewport, &Viewport, sizeof(Viewport)) };
+		if (!this->Count_Dynamic_State(Redundant))
+			return;
+
+		this->Viewport = Viewport;
+		vkCmdSetViewport(this->Command_Buffer, 0, 1, &Viewport);
+	}
+
+	void Set_Scissor(const VkRect2D& Scissor) {
+		const bool Redundant{ this->Scissor.has_value() && 0 == memcmp(&*this->Scissor, &Scissor, sizeof(Scissor)) };
+		if (!this->Count_Dynamic_State(Redundant))
+			return;
+
+		this->Scissor = Scissor;
+		vkCmdSetScissor(this->Command_Buffer, 0, 1, &Scissor);
+	}
+
+	//NOTE : Material Key And Sample Count Stand For Everything Extended_Dynamic_State Records, Nothing Is Recorded Without A Level
+	void Set_Material(const Extended_Dynamic_State& State, const Material_State& Material, VkSampleCountFlagBits Samples) {
+		if (Dynamic_State_Level_None == State.Level)
+			return;
+
+		const pair<uint64_t, VkSampleCountFlagBits> Key{ Material.Get_Key(), Samples };
+		if (!this->Count_Dynamic_State(this->Material_Key == Key))
+			return;
+
+		this->Material_Key = Key;
+		State.Record(this->Command_Buffer, Material, Samples);
+	}
+
+	void Draw(uint32_t Vertex_Count, uint32_t Instance_Count, uint32_t First_Vertex, uint32_t First_Instance) {
+		++this->Statistics.Draw_Count;
+		vkCmdDraw(this->Command_Buffer, Vertex_Count, Instance_Count, First_Vertex, First_Instance);
+	}
+
+	void Draw_Indexed(uint32_t Index_Count, uint32_t Instance_Count, uint32_t First_Index, int32_t Vertex_Offset, uint32_t First_Instance) {
+		++this->Statistics.Draw_Count;
+		vkCmdDrawIndexed(this->Command_Buffer, Index_Count, Instance_Count, First_Index, Vertex_Offset, First_Instance);
+	}
+
+	//NOTE : Indirect Draws Count Once, How Many Draws The GPU Generated Is Not Known While Recording
+	void Draw_Indexed_Indirect_Count(VkBuffer Buffer, VkDeviceSize Offset, VkBuffer Count_Buffer, VkDeviceSize Count_Offset, uint32_t Max_Draw_Count, uint32_t Stride) {
+		++this->Statistics.Draw_Count;
+		vkCmdDrawIndexedIndirectCount(this->Command_Buffer, Buffer, Offset, Count_Buffer, Count_Offset, Max_Draw_Count, Stride);
+	}
+
+	void Draw_Mesh_Tasks_Indirect(PFN_vkCmdDrawMeshTasksIndirectEXT Draw_Mesh_Tasks_Indirect, VkBuffer Buffer, VkDeviceSize Offset, uint32_t Draw_Count, uint32_t Stride) {
+		++this->Statistics.Draw_Count;
+		Draw_Mesh_Tasks_Indirect(this->Command_Buffer, Buffer, Offset, Draw_Count, Stride);
+	}
+
+	void Dispatch(uint32_t Group_Count_X, uint32_t Group_Count_Y, uint32_t Group_Count_Z) {
+		++this->Statistics.Dispatch_Count;
+		vkCmdDispatch(this->Command_Buffer, Group_Count_X, Group_Count_Y, Group_Count_Z);
+	}
+
+	void Report(const string& Name) const {
+		cout << Name << ": " << this->Statistics.Draw_Count << " draws, " << this->Statistics.Dispatch_Count << " dispatches, "
+			<< this->Statistics.Bind_Count << " binds (" << this->Statistics.Elided_Bind_Count << " elided), "
+			<< this->Statistics.Push_Count << " pushes (" << this->Statistics.Elided_Push_Count << " elided), "
+			<< this->Statistics.Dynamic_State_Count << " dynamic state sets (" << this->Statistics.Elided_Dynamic_State_Count << " elided), "
+			<< this->Statistics.Barrier_Count << " barriers in " << this->Statistics.Barrier_Flush_Count << " flushes" << endl;
+	}
+
+private:
+	struct Bind_Point_State final {
+		VkPipeline Pipeline{ nullptr };
+		VkPipelineLayout Set_Layout{ nullptr };
+		VkDescriptorSet Descriptor_Set{ nullptr };
+		VkPipelineLayout Push_Layout{ nullptr };
+		VkShaderStageFlags Push_Stages{ 0 };
+		uint32_t Push_Size{ 0 };
+		array<uint8_t, Max_Push_Constant_Size> Push_Data{};
+	};
+
+	VkCommandBuffer Command_Buffer{ nullptr };
+	//NOTE : Indexed By VkPipelineBindPoint, Graphics And Compute Only
+	array<Bind_Point_State, 2> Bind_Points{};
+	pair<VkBuffer, VkDeviceSize> Vertex_Buffer{};
+	tuple<VkBuffer, VkDeviceSize, VkIndexType> Index_Buffer{};
+	optional<VkViewport> Viewport{};
+	optional<VkRect2D> Scissor{};
+	optional<pair<uint64_t, VkSampleCountFlagBits>> Material_Key{};
+	pair<uint32_t, uint32_t> Barrier_Base{};
+
+	Bind_Point_State& Get_Bind_Point(VkPipelineBindPoint Bind_Point) {
+		return this->Bind_Points.at(static_cast<size_t>(Bind_Point));
+	}
+
+	//NOTE : True When The Call Still Has To Be Recorded
+	const bool Count(bool Redundant, uint32_t& Recorded, uint32_t& Elided) {
+		const bool Record{ !Redundant || !this->Elide };
+		++(Record ? Recorded : Elided);
+		return Record;
+	}
+
+	const bool Count_Bind(bool Redundant) {
+		return this->Count(Redundant, this->Statistics.Bind_Count, this->Statistics.Elided_Bind_Count);
+	}
+
+	const bool Count_Dynamic_State(bool Redundant) {
+		return this->Count(Redundant, this->Statistics.Dynamic_State_Count, this->Statistics.Elided_Dynamic_State_Count);
+	}
+};
+
+//NOTE : Fields From Most To Least Significant, Sorted Keys Group Draws By Pass, Then Pipeline, Material And Mesh, Nearest First Within Those
+struct Draw_Sort_Key final {
+	static constexpr uint32_t Pass_Bits{ 4 };
+	static constexpr uint32_t Pipeline_Bits{ 10 };
+	static constexpr uint32_t Material_Bits{ 10 };
+	static constexpr uint32_t Mesh_Bits{ 16 };
+	static constexpr uint32_t Depth_Bits{ 24 };
+
+	static constexpr uint32_t Depth_Shift{ 0 };
+	static constexpr uint32_t Mesh_Shift{ Depth_Shift + Depth_Bits };
+	static constexpr uint32_t Material_Shift{ Mesh_Shift + Mesh_Bits };
+	static constexpr uint32_t Pipeline_Shift{ Material_Shift + Material_Bits };
+	static constexpr uint32_t Pass_Shift{ Pipeline_Shift + Pipeline_Bits };
+	static_assert(64 == Pass_Shift + Pass_Bits, "Sort key fields must fill 64 bits");
+
+	//NOTE : Fields Wider Than Their Bits Are Masked, Callers Keep Their Ids Within Range
+	static const uint64_t Build(uint32_t Pass, uint32_t Pipeline, uint32_t Material, uint32_t Mesh, float Depth) {
+		return
+			static_cast<uint64_t>(Pass & Draw_Sort_Key::Get_Mask(Pass_Bits)) << Pass_Shift |
+			static_cast<uint64_t>(Pipeline & Draw_Sort_Key::Get_Mask(Pipeline_Bits)) << Pipeline_Shift |
+			static_cast<uint64_t>(Material & Draw_Sort_Key::Get_Mask(Material_Bits)) << Material_Shift |
+			static_cast<uint64_t>(Mesh & Draw_Sort_Key::Get_Mask(Mesh_Bits)) << Mesh_Shift |
+			static_cast<uint64_t>(Draw_Sort_Key::Quantize_Depth(Depth)) << Depth_Shift;
+	}
+
+	static const uint32_t Get_Field(uint64_t Key, uint32_t Shift, uint32_t Bits) {
+		return static_cast<uint32_t>(Key >> Shift) & Draw_Sort_Key::Get_Mask(Bits);
+	}
+
+	//NOTE : Bits Of A Non Negative Float Order Like Its Value, The Top 24 Below The Sign Keep The Exponent And 16 Mantissa Bits
+	static const uint32_t Quantize_Depth(float Depth) {
+		uint32_t Bits{};
+		memcpy(&Bits, &Depth, sizeof(Bits));
+		return Depth > 0.0f ? Bits >> (31 - Depth_Bits) : 0;
+	}
+
+private:
+	static constexpr uint32_t Get_Mask(uint32_t Bits) {
+		return static_cast<uint32_t>((1ull << Bits) - 1);
+	}
+};
+
+static_assert(Max_Material_Textures <= 1u << Draw_Sort_Key::Material_Bits, "Every texture slot needs its own sort key material");
+
+//NOTE : Only What vkCmdDrawIndexed Needs, Everything Bound Around It Is Encoded In The Sort Key
+struct Draw_Packet final {
+	uint32_t Index_Count{ 0 };
+	uint32_t First_Index{ 0 };
+	int32_t Vertex_Offset{ 0 };
+	uint32_t First_Instance{ 0 };
+};
+
+struct Draw_Queue_Entry final {
+	uint64_t Key{ 0 };
+	uint32_t Packet{ 0 };
+	uint32_t Padding{ 0 };
+};
+
+//NOTE : Packets Stay Where They Were Pushed, Only 16 Byte Key Entries Move While Sorting
+struct Draw_Queue final {
+	//NOTE : Below This Many Entries Per Thread The Barriers Cost More Than The Scatter They Split
+	static constexpr size_t Min_Entries_Per_Thread{ 16384 };
+
+	vector<Draw_Packet> Packets{};
+	vector<Draw_Queue_Entry> Entries{};
+
+	void Clear(void) {
+		this->Packets.clear();
+		this->Entries.clear();
+	}
+
+	void Push(uint64_t Key, const Draw_Packet& Packet) {
+		this->Entries.push_back({ Key, static_cast<uint32_t>(this->Packets.size()), 0 });
+		this->Packets.push_back(Packet);
+	}
+
+	void Sort(uint32_t Thread_Count) {
+		Draw_Queue::Radix_Sort(this->Entries, this->Scratch, Thread_Count);
+	}
+
+	void Record(Draw_State_Cache& Draw_State) const {
+		for (const auto& Entry : this->Entries) {
+			const Draw_Packet& Packet{ this->Packets[Entry.Packet] };
+			Draw_State.Draw_Indexed(Packet.Index_Count, 1, Packet.First_Index, Packet.Vertex_Offset, Packet.First_Instance);
+		}
+	}
+
+	//NOTE : LSD Radix Sort, Eight Passes Of One Byte, Stable So Equal Keys Keep Their Push Order
+	//NOTE : Each Thread Counts Its Own Slice, Then Scatters It To Where Every Earlier Digit And Every Earlier Slice Of Its Digit End
+	//NOTE : A Byte Every Key Shares Would Move Nothing, Such Passes Are Skipped, Which Is Most Of Them For Narrow Ids
+	static void Radix_Sort(vector<Draw_Queue_Entry>& Entries, vector<Draw_Queue_Entry>& Scratch, uint32_t Thread_Count) {
+		const size_t Count{ Entries.size() };
+		if (Count < 2)
+			return;
+
+		Scratch.resize(Count);
+		Thread_Count = static_cast<uint32_t>(std::clamp<size_t>(Thread_Count, 1, std::max<size_t>(1, Count / Min_Entries_Per_Thread)));
+
+		vector<array<uint32_t, 256>> Histograms(Thread_Count);
+		Sort_Barrier Barrier{ Thread_Count };
+		bool In_Scratch{ false };
+
+		const auto Work = [&](uint32_t Worker) {
+			const size_t Begin{ Count * Worker / Thread_Count };
+			const size_t End{ Count * (Worker + 1) / Thread_Count };
+			Draw_Queue_Entry* Source{ Entries.data() };
+			Draw_Queue_Entry* Destination{ Scratch.data() };
+
+			for (uint32_t Shift = 0; Shift < 64; Shift += 8) {
+				auto& Histogram{ Histograms[Worker] };
+				Histogram.fill(0);
+				for (size_t Index = Begin; Index < End; ++Index)
+					++Histogram[(Source[Index].Key >> Shift) & 0xFF];
+
+				Barrier.Wait();
+
+				array<uint32_t, 256> Offsets{};
+				bool Shared_Digit{ false };
+				uint32_t Total{ 0 };
+				for (uint32_t Digit = 0; Digit < 256; ++Digit) {
+					uint32_t Digit_Total{ 0 };
+					for (uint32_t Slice = 0; Slice < Thread_Count; ++Slice) {
+						if (Slice == Worker)
+							Offsets[Digit] = Total + Digit_Total;
+						Digit_Total += Histograms[Slice][Digit];
+					}
+
+					Shared_Digit |= Digit_Total == Count;
+					Total += Digit_Total;
+				}
+
+				if (!Shared_Digit) {
+					for (size_t Index = Begin; Index < End; ++Index)
+						Destination[Offsets[(Source[Index].Key >> Shift) & 0xFF]++] = Source[Index];
+					std::swap(Source, Destination);
+				}
+
+				//NOTE : Nobody Counts The Next Byte Before Everyone Has Scattered And Read The Histograms Of This One
+				Barrier.Wait();
+			}
+
+			if (0 == Worker)
+				In_Scratch = Source != Entries.data();
+		};
+
+		vector<thread> Workers{};
+		Workers.reserve(Thread_Count - 1);
+		for (uint32_t Worker = 1; Worker < Thread_Count; ++Worker)
+			Workers.emplace_back(Work, Worker);
+
+		Work(0);
+		for (auto& Worker : Workers)
+			Worker.join();
+
+		if (In_Scratch)
+			Entries.swap(Scratch);
+	}
+
+private:
+	//NOTE : Reusable, The Last Thread To Arrive Starts The Next Generation And Wakes The Rest
+	struct Sort_Barrier final {
+		explicit Sort_Barrier(uint32_t Thread_Count) : Thread_Count{ Thread_Count } {}
+
+		void Wait(void) {
+			unique_lock<mutex> Lock{ this->Mutex };
+			const uint64_t Arrival_Generation{ this->Generation };
+			if (++this->Arrived == this->Thread_Count) {
+				this->Arrived = 0;
+				++this->Generation;
+				this->Condition.notify_all();
+				return;
+			}
+
+			this->Condition.wait(Lock, [this, Arrival_Generation](void) { return Arrival_Generation != this->Generation; });
+		}
+
+		const uint32_t Thread_Count{ 1 };
+		uint32_t Arrived{ 0 };
+		uint64_t Generation{ 0 };
+		mutex Mutex{};
+		condition_variable Condition{};
+	};
+
+	vector<Draw_Queue_Entry> Scratch{};
+};
+
+//NOTE : Fixed Function State Points Into The Builder Itself, So It Is Built In Place And Never Copied
+struct Graphics_Pipeline_Builder final {
+	//NOTE : VK_EXT_graphics_pipeline_library Splits A Pipeline Into These Parts, Each Owning Part Of The State Below
+	static constexpr array<VkGraphicsPipelineLibraryFlagBitsEXT, 4> Library_Parts{
+		VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,
+		VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+		VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT,
+		VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT,
+	};
+
+	static constexpr VkGraphicsPipelineLibraryFlagsEXT All_Library_Parts{
+		VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT |
+		VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT |
+		VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT |
+		VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT
+	};
+
+	explicit Graphics_Pipeline_Builder(const Graphics_Pipeline_Desc& Desc) :
+		Desc{ Desc },
+		Binding_Description{ Desc.Vertices.Get_Binding_Description() },
+		Attribute_Descriptions{ Desc.Vertices.Get_Attribute_Descriptions() } {
+		{
+			this->Shader_Stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+			this->Shader_Stages[0].stage = Desc.Mesh_Shading ? VK_SHADER_STAGE_MESH_BIT_EXT : VK_SHADER_STAGE_VERTEX_BIT;
+			this->Shader_Stages[0].module = Desc.Vertex_Shader;
+			this->Shader_Stages[0].pName = "main";
+			this->Shader_Stages[0].pSpecializationInfo = nullptr;
+		}
+
+		{
+			this->Shader_Stages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+			this->Shader_Stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+			this->Shader_Stages[1].module = Desc.Fragment_Shader;
+			this->Shader_Stages[1].pName = "main";
+			this->Shader_Stages[1].pSpecializationInfo = &this->Fragment_Specialization;
+		}
+
+		{
+			this->Fragment_Specialization_Entry.constantID = 0;
+			this->Fragment_Specialization_Entry.offset = 0;
+			this->Fragment_Specialization_Entry.size = sizeof(this->Desc.Texture_Count);
+
+			this->Fragment_Specialization.mapEntryCount = 1;
+			this->Fragment_Specialization.pMapEntries = &this->Fragment_Specialization_Entry;
+			this->Fragment_Specialization.dataSize = sizeof(this->Desc.Texture_Count);
+			this->Fragment_Specialization.pData = &this->Desc.Texture_Count;
+		}
+
+		{
+			this->Vertex_Input_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+			this->Vertex_Input_Info.vertexBindingDescriptionCount = Desc.Vertex_Pulling ? 0 : 1;
+			this->Vertex_Input_Info.pVertexBindingDescriptions = Desc.Vertex_Pulling ? nullptr : &this->Binding_Description;
+			this->Vertex_Input_Info.vertexAttributeDescriptionCount = Desc.Vertex_Pulling ? 0 : static_cast<uint32_t>(this->Attribute_Descriptions.size());
+			this->Vertex_Input_Info.pVertexAttributeDescriptions = Desc.Vertex_Pulling ? nullptr : this->Attribute_Descriptions.data();
+		}
+
+		{
+			this->Input_Assembly_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+			this->Input_Assembly_Info.topology = Desc.Material.Topology;
+			this->Input_Assembly_Info.primitiveRestartEnable = Desc.Material.Primitive_Restart ? VK_TRUE : VK_FALSE;
+		}
+
+		//NOTE : Viewport And Scissor Are Dynamic, Only Their Counts Are Baked
+		{
+			this->Viewport_State_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+			this->Viewport_State_Info.viewportCount = 1;
+			this->Viewport_State_Info.scissorCount = 1;
+		}
+
+		{
+			this->Rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+			this->Rasterizer.depthClampEnable = VK_FALSE;
+			this->Rasterizer.rasterizerDiscardEnable = VK_FALSE;
+			this->Rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
+			this->Rasterizer.cullMode = Desc.Material.Cull_Mode;
+			this->Rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+			//NOTE : Bias Factors Are Baked Even When Disabled, A Dynamic Enable Then Pulls Decals Toward The Camera
+			this->Rasterizer.depthBiasEnable = Desc.Material.Depth_Bias ? VK_TRUE : VK_FALSE;
+			this->Rasterizer.depthBiasConstantFactor = -1.0f;
+			this->Rasterizer.depthBiasClamp = 0.0f;
+			this->Rasterizer.depthBiasSlopeFactor = -1.0f;
+			this->Rasterizer.lineWidth = 1.0f;
+		}
+
+		{
+			this->Multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+			this->Multisampling.rasterizationSamples = Desc.Samples;
+			this->Multisampling.sampleShadingEnable = VK_FALSE;
+			this->Multisampling.minSampleShading = 0.f;
+			this->Multisampling.pSampleMask = nullptr;
+			this->Multisampling.alphaToCoverageEnable = VK_FALSE;
+			this->Multisampling.alphaToOneEnable = VK_FALSE;
+		}
+
+		{
+			this->Depth_Stencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+			this->Depth_Stencil.depthTestEnable = Desc.Material.Depth_Test ? VK_TRUE : VK_FALSE;
+			this->Depth_Stencil.depthWriteEnable = Desc.Material.Depth_Write ? VK_TRUE : VK_FALSE;
+			this->Depth_Stencil.depthCompareOp = Desc.Material.Depth_Compare;
+			this->Depth_Stencil.depthBoundsTestEnable = VK_FALSE;
+			this->Depth_Stencil.minDepthBounds = 0.0f;
+			this->Depth_Stencil.maxDepthBounds = 1.0f;
+			this->Depth_Stencil.stencilTestEnable = VK_FALSE;
+			this->Depth_Stencil.front = {};
+			this->Depth_Stencil.back = {};
+		}
+
+		//NOTE : Blend Factors Are Baked Even When Disabled, Like The Depth Bias Factors
+		{
+			this->Color_Blend_Attachment.blendEnable = Desc.Material.Blend ? VK_TRUE : VK_FALSE;
+			this->Color_Blend_Attachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+			this->Color_Blend_Attachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+			this->Color_Blend_Attachment.colorBlendOp = VK_BLEND_OP_ADD;
+			this->Color_Blend_Attachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+			this->Color_Blend_Attachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+			this->Color_Blend_Attachment.alphaBlendOp = VK_BLEND_OP_ADD;
+			this->Color_Blend_Attachment.colorWriteMask =
+				VK_COLOR_COMPONENT_R_BIT |
+				VK_COLOR_COMPONENT_G_BIT |
+				VK_COLOR_COMPONENT_B_BIT |
+				VK_COLOR_COMPONENT_A_BIT;
+		}
+
+		{
+			this->Color_Blending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+			this->Color_Blending.logicOpEnable = VK_FALSE;
+			this->Color_Blending.logicOp = VK_LOGIC_OP_COPY;
+			this->Color_Blending.attachmentCount = 1;
+			this->Color_Blending.pAttachments = &this->Color_Blend_Attachment;
+		}
+
+		//NOTE : If Set Dynamic Field ,Old Static Field Will Be Disable, So We Should Set All Field In Feature 
+		this->Dynamic_States.insert(this->Dynamic_States.end(), Desc.Dynamic_States.begin(), Desc.Dynamic_States.end());
+		//NOTE : Mesh Pipelines Must Not Name Input Assembly State As Dynamic, The Mesh Shader Declares Its Own Primitives
+		if (Desc.Mesh_Shading)
+			this->Dynamic_States.erase(std::remove_if(this->Dynamic_States.begin(), this->Dynamic_States.end(), [](VkDynamicState State) {
+				return VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT == State || VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE_EXT == State;
+			}), this->Dynamic_States.end());
+		{
+			this->Dynamic_State.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+			this->Dynamic_State.dynamicStateCount = static_cast<uint32_t>(this->Dynamic_States.size());
+			this->Dynamic_State.pDynamicStates = this->Dynamic_States.data();
+		}
+
+		//NOTE : Dynamic Rendering Pipelines Name Attachment Formats Instead Of A Render Pass, Depth Is Bound Without Its Stencil Aspect
+		{
+			this->Rendering_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+			this->Rendering_Info.colorAttachmentCount = 1;
+			this->Rendering_Info.pColorAttachmentFormats = &this->Desc.Color_Format;
+			this->Rendering_Info.depthAttachmentFormat = Desc.Depth_Format;
+			this->Rendering_Info.stencilAttachmentFormat = VK_FORMAT_UNDEFINED;
+		}
+	}
+
+	Graphics_Pipeline_Builder(const Graphics_Pipeline_Builder&) = delete;
+	Graphics_Pipeline_Builder& operator=(const Graphics_Pipeline_Builder&) = delete;
+
+	const VkPipeline Create(VkDevice Device, VkPipelineCache Pipeline_Cache) const {
+		const VkGraphicsPipelineCreateInfo Pipeline_Info{ this->Get_Pipeline_Info(Graphics_Pipeline_Builder::All_Library_Parts, this->Get_Rendering_Info()) };
+
+		VkPipeline Pipeline{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateGraphicsPipelines(Device, Pipeline_Cache, 1, &Pipeline_Info, nullptr, &Pipeline));
+
+		return Pipeline;
+	}
+
+	//NOTE : Link Time Optimization Info Is Retained, So The Same Parts Can Later Be Linked Again With Full Optimization
+	const VkPipeline Create_Library(VkDevice Device, VkPipelineCache Pipeline_Cache, VkGraphicsPipelineLibraryFlagsEXT Parts) const {
+		VkGraphicsPipelineLibraryCreateInfoEXT Library_Info{};
+		{
+			Library_Info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+			Library_Info.pNext = this->Get_Rendering_Info();
+			Library_Info.flags = Parts;
+		}
+
+		VkGraphicsPipelineCreateInfo Pipeline_Info{ this->Get_Pipeline_Info(Parts, &Library_Info) };
+		{
+			Pipeline_Info.flags = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+		}
+
+		VkPipeline Pipeline{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateGraphicsPipelines(Device, Pipeline_Cache, 1, &Pipeline_Info, nullptr, &Pipeline));
+
+		return Pipeline;
+	}
+
+	//NOTE : Without Optimization This Only Stitches Compiled Parts Together, Cheap Enough To Do When A Variant Is First Needed
+	static const VkPipeline Link(VkDevice Device, VkPipelineCache Pipeline_Cache, VkPipelineLayout Layout, const vector<VkPipeline>& Libraries, bool Optimize) {
+		VkPipelineLibraryCreateInfoKHR Linking_Info{};
+		{
+			Linking_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+			Linking_Info.libraryCount = static_cast<uint32_t>(Libraries.size());
+			Linking_Info.pLibraries = Libraries.data();
+		}
+
+		VkGraphicsPipelineCreateInfo Pipeline_Info{};
+		{
+			Pipeline_Info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+			Pipeline_Info.pNext = &Linking_Info;
+			Pipeline_Info.flags = Optimize ? VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT : 0;
+			Pipeline_Info.layout = Layout;
+			Pipeline_Info.basePipelineHandle = VK_NULL_HANDLE;
+			Pipeline_Info.basePipelineIndex = -1;
+		}
+
+		VkPipeline Pipeline{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateGraphicsPipelines(Device, Pipeline_Cache, 1, &Pipeline_Info, nullptr, &Pipeline));
+
+		return Pipeline;
+	}
+
+private:
+	const void* Get_Rendering_Info(void) const {
+		return nullptr == this->Desc.Render_Pass ? &this->Rendering_Info : nullptr;
+	}
+
+	//NOTE : Each Part Only Gets The State It Owns, Multisampling Is Shared By Both Fragment Parts
+	const VkGraphicsPipelineCreateInfo Get_Pipeline_Info(VkGraphicsPipelineLibraryFlagsEXT Parts, const void* Next) const {
+		const bool Vertex_Input{ 0 != (Parts & VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT) };
+		const bool Pre_Rasterization{ 0 != (Parts & VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT) };
+		const bool Fragment_Shader{ 0 != (Parts & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT) };
+		const bool Fragment_Output{ 0 != (Parts & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT) };
+
+		VkGraphicsPipelineCreateInfo Pipeline_Info{};
+		{
+			Pipeline_Info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+			Pipeline_Info.pNext = Next;
+			Pipeline_Info.stageCount = (Pre_Rasterization ? 1 : 0) + (Fragment_Shader ? 1 : 0);
+			Pipeline_Info.pStages = 0 == Pipeline_Info.stageCount ? nullptr : Pre_Rasterization ? &this->Shader_Stages[0] : &this->Shader_Stages[1];
+			Pipeline_Info.pVertexInputState = Vertex_Input && !this->Desc.Mesh_Shading ? &this->Vertex_Input_Info : nullptr;
+			Pipeline_Info.pInputAssemblyState = Vertex_Input && !this->Desc.Mesh_Shading ? &this->Input_Assembly_Info : nullptr;
+			Pipeline_Info.pTessellationState = nullptr;
+			Pipeline_Info.pViewportState = Pre_Rasterization ? &this->Viewport_State_Info : nullptr;
+			Pipeline_Info.pRasterizationState = Pre_Rasterization ? &this->Rasterizer : nullptr;
+			Pipeline_Info.pMultisampleState = Fragment_Shader || Fragment_Output ? &this->Multisampling : nullptr;
+			Pipeline_Info.pDepthStencilState = Fragment_Shader ? &this->Depth_Stencil : nullptr;
+			Pipeline_Info.pColorBlendState = Fragment_Output ? &this->Color_Blending : nullptr;
+			Pipeline_Info.pDynamicState = &this->Dynamic_State;
+			Pipeline_Info.layout = Pre_Rasterization || Fragment_Shader ? this->Desc.Layout : VK_NULL_HANDLE;
+			Pipeline_Info.renderPass = Vertex_Input && !Pre_Rasterization ? VK_NULL_HANDLE : this->Desc.Render_Pass;
+			Pipeline_Info.subpass = 0;
+			//NOTE : Only Flag Use VK PIPELINE CREATE DERIVATIVE BIT Can Be Usefual 
+			Pipeline_Info.basePipelineHandle = VK_NULL_HANDLE;
+			Pipeline_Info.basePipelineIndex = -1;
+		}
+
+		return Pipeline_Info;
+	}
+
+private:
+	Graphics_Pipeline_Desc Desc{};
+	array<VkPipelineShaderStageCreateInfo, 2> Shader_Stages{};
+	VkSpecializationMapEntry Fragment_Specialization_Entry{};
+	VkSpecializationInfo Fragment_Specialization{};
+	VkVertexInputBindingDescription Binding_Description{};
+	vector<VkVertexInputAttributeDescription> Attribute_Descriptions{};
+	VkPipelineVertexInputStateCreateInfo Vertex_Input_Info{};
+	VkPipelineInputAssemblyStateCreateInfo Input_Assembly_Info{};
+	VkPipelineViewportStateCreateInfo Viewport_State_Info{};
+	VkPipelineRasterizationStateCreateInfo Rasterizer{};
+	VkPipelineMultisampleStateCreateInfo Multisampling{};
+	VkPipelineDepthStencilStateCreateInfo Depth_Stencil{};
+	VkPipelineColorBlendAttachmentState Color_Blend_Attachment{};
+	VkPipelineColorBlendStateCreateInfo Color_Blending{};
+	vector<VkDynamicState> Dynamic_States{ VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+	VkPipelineDynamicStateCreateInfo Dynamic_State{};
+	VkPipelineRenderingCreateInfoKHR Rendering_Info{};
+};
+
+//NOTE : Worker Threads Compile Into One Shared Pipeline Cache, Callers Keep A Future And Draw With A Fallback Until It Resolves
+struct Pipeline_Manager final {
+	using Build_Function = function<const VkPipeline(VkPipelineCache)>;
+
+	Pipeline_Manager(void) = default;
+	Pipeline_Manager(const Pipeline_Manager&) = delete;
+	Pipeline_Manager& operator=(const Pipeline_Manager&) = delete;
+
+	~Pipeline_Manager(void) {
+		this->Stop();
+	}
+
+	//NOTE : The Driver Checks The Cache Header Itself And Starts Empty When The Data Came From Another Device Or Driver
+	void Start(VkDevice Device, const vector<char>& Cache_Data, uint32_t Thread_Count) {
+		VkPipelineCacheCreateInfo Cache_Info{};
+		{
+			Cache_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+			Cache_Info.initialDataSize = Cache_Data.size();
+			Cache_Info.pInitialData = Cache_Data.empty() ? nullptr : Cache_Data.data();
+		}
+
+		THROW_IF_VK_FAILED(vkCreatePipelineCache(Device, &Cache_Info, nullptr, &this->Cache));
+		this->Device = Device;
+		this->Stopping = false;
+
+		for (uint32_t Index = 0; Index < max(1u, Thread_Count); ++Index)
+			this->Workers.emplace_back([this](void) { this->Work(); });
+	}
+
+	//NOTE : Queued Builds Still Run, So Every Future Handed Out Resolves And Its Owner Can Destroy What It Built
+	void Stop(void) {
+		{
+			lock_guard<mutex> Lock{ this->Mutex };
+			this->Stopping = true;
+		}
+		this->Condition.notify_all();
+
+		for (auto& Worker : this->Workers)
+			Worker.join();
+		this->Workers.clear();
+
+		if (nullptr != this->Cache)
+			vkDestroyPipelineCache(this->Device, this->Cache, nullptr);
+		this->Cache = nullptr;
+	}
+
+	const shared_future<VkPipeline> Submit(Build_Function Build) {
+		packaged_task<VkPipeline(void)> Task{ [this, Build = std::move(Build)](void) {
+			const auto Start_Time{ chrono::high_resolution_clock::now() };
+			const VkPipeline Pipeline{ Build(this->Cache) };
+			const chrono::duration<double, milli> Elapsed{ chrono::high_resolution_clock::now() - Start_Time };
+
+			lock_guard<mutex> Lock{ this->Mutex };
+			++this->Compiled_Count;
+			this->Compile_Milliseconds += Elapsed.count();
+			return Pipeline;
+		} };
+
+		const shared_future<VkPipeline> Future{ Task.get_future().share() };
+		{
+			lock_guard<mutex> Lock{ this->Mutex };
+			this->Tasks.push_back(std::move(Task));
+		}
+		this->Condition.notify_one();
+
+		return Future;
+	}
+
+	static const bool Is_Ready(const shared_future<VkPipeline>& Future) {
+		return Future.valid() && future_status::ready == Future.wait_for(chrono::seconds{ 0 });
+	}
+
+	const vector<char> Get_Cache_Data(void) const {
+		size_t Data_Size{ 0 };
+		THROW_IF_VK_FAILED(vkGetPipelineCacheData(this->Device, this->Cache, &Data_Size, nullptr));
+
+		vector<char> Data(Data_Size);
+		THROW_IF_VK_FAILED(vkGetPipelineCacheData(this->Device, this->Cache, &Data_Size, Data.data()));
+		Data.resize(Data_Size);
+
+		return Data;
+	}
+
+	void Report(void) {
+		lock_guard<mutex> Lock{ this->Mutex };
+		cout << "Pipeline manager: " << this->Compiled_Count << " pipelines compiled on " << this->Workers.size() << " threads, "
+			<< this->Compile_Milliseconds << " ms of compile time off the frame loop" << endl;
+	}
+
+private:
+	void Work(void) {
+		while (true) {
+			packaged_task<VkPipeline(void)> Task{};
+			{
+				unique_lock<mutex> Lock{ this->Mutex };
+				this->Condition.wait(Lock, [this](void) { return this->Stopping || !this->Tasks.empty(); });
+				if (this->Tasks.empty())
+					return;
+
+				Task = std::move(this->Tasks.front());
+				this->Tasks.pop_front();
+			}
+
+			//NOTE : A Failed Build Surfaces Through The Future, Where The Owner Rethrows It
+			Task();
+		}
+	}
+
+private:
+	VkDevice Device{ nullptr };
+	VkPipelineCache Cache{ nullptr };
+	vector<thread> Workers{};
+	deque<packaged_task<VkPipeline(void)>> Tasks{};
+	mutex Mutex{};
+	condition_variable Condition{};
+	bool Stopping{ false };
+	uint32_t Compiled_Count{ 0 };
+	double Compile_Milliseconds{ 0.0 };
+};
+
+
+//NOTE : Push Constants Are Only Guaranteed Up To 128 Bytes
+static_assert(128 >= sizeof(Gpu_Cull_Constants), "Cull constants exceed the guaranteed push constant size!");
+
+struct Gpu_Culling final {
+	static constexpr uint32_t Group_Size{ 64 };
+
+	//NOTE : Draw Count Lives In Front Of The Commands So One Buffer Serves Both Indirect Arguments
+	static constexpr VkDeviceSize Draw_Commands_Offset{ 16 };
+
+	//NOTE : Mesh Task Grids Wrap Into Rows Of This Many Workgroups, The Smallest maxMeshWorkGroupCount A Device May Report
+	static constexpr uint32_t Mesh_Task_Row_Width{ 65535 };
+
+	static const uint32_t Get_Group_Count(uint32_t Instance_Count) {
+		return (Instance_Count + Gpu_Culling::Group_Size - 1) / Gpu_Culling::Group_Size;
+	}
+
+	//NOTE : Level 0 Matches The Depth Attachment, Each Further Level Rounds Up So No Edge Texel Is Dropped
+	static const uint32_t Get_Pyramid_Level_Count(const VkExtent2D& Extent) {
+		uint32_t Level_Count{ 1 };
+		for (uint32_t Size = std::max(Extent.width, Extent.height); Size > 1; Size = (Size + 1) / 2)
+			++Level_Count;
+
+		return Level_Count;
+	}
+
+	static const VkExtent2D Get_Pyramid_Level_Extent(const VkExtent2D& Extent, uint32_t Level) {
+		VkExtent2D Level_Extent{ Extent };
+		for (uint32_t Index = 0; Index < Level; ++Index) {
+			Level_Extent.width = std::max(1u, (Level_Extent.width + 1) / 2);
+			Level_Extent.height = std::max(1u, (Level_Extent.height + 1) / 2);
+		}
+
+		return Level_Extent;
+	}
+
+	static const VkDeviceSize Get_Draw_Buffer_Size(uint32_t Max_Draw_Count) {
+		return Gpu_Culling::Draw_Commands_Offset + sizeof(VkDrawIndexedIndirectCommand) * static_cast<VkDeviceSize>(Max_Draw_Count);
+	}
+
+	static const Gpu_Instance Build_Instance(const glm::mat4& Placement, const glm::mat4& Dequantize, const Bounding_Sphere& Local_Sphere) {
+		const Bounding_Sphere Sphere{ Local_Sphere.Transform(Placement) };
+
+		Gpu_Instance Instance{};
+		{
+			Instance.Model = Placement * Dequantize;
+			Instance.Sphere = glm::vec4{ Sphere.Center, Sphere.Radius };
+		}
+
+		return Instance;
+	}
+
+	//NOTE : First Triangle Of Every Draw Range After The First, A Cluster Has To Be Drawable With One Range's Vertex Offset
+	static const vector<uint32_t> Get_Range_Boundaries(const Mesh_Lod& Lod) {
+		vector<uint32_t> Boundaries{};
+		uint32_t Triangle{ 0 };
+		for (const auto& Range : Lod.Draw_Ranges) {
+			if (0 != Triangle)
+				Boundaries.push_back(Triangle);
+			Triangle += Range.Index_Count / 3;
+		}
+
+		return Boundaries;
+	}
+
+	//NOTE : Lod Is LOD 0 With Its Ranges Already Placed In The Geometry Pool, Meshlet Triangles Map One To One Onto Its Triangles
+	static const vector<Gpu_Cluster> Build_Clusters(const Meshlet_Data& Meshlets, const Mesh_Lod& Lod, const glm::mat4& Dequantize, const Bounding_Sphere& Mesh_Sphere, const vector<uint32_t>& Texture_Slots) {
+		const glm::mat4 Quantize{ glm::inverse(Dequantize) };
+		const glm::mat3 Quantize_Axis{ glm::inverse(glm::mat3{ Dequantize }) };
+		const float Radius_Scale{ 0.0f < Mesh_Sphere.Radius ? 1.0f / Mesh_Sphere.Radius : 0.0f };
+
+		vector<Gpu_Cluster> Clusters{};
+		Clusters.reserve(Meshlets.Meshlets.size());
+
+		size_t Range_Index{ 0 };
+		uint32_t Range_First_Triangle{ 0 };
+		for (size_t Index = 0; Index < Meshlets.Meshlets.size(); ++Index) {
+			const Meshlet& Meshlet{ Meshlets.Meshlets[Index] };
+			const Meshlet_Bounds& Bounds{ Meshlets.Bounds[Index] };
+
+			while (Meshlet.Triangle_Offset >= Range_First_Triangle + Lod.Draw_Ranges[Range_Index].Index_Count / 3) {
+				Range_First_Triangle += Lod.Draw_Ranges[Range_Index].Index_Count / 3;
+				++Range_Index;
+			}
+			const Mesh_Draw_Range& Range{ Lod.Draw_Ranges[Range_Index] };
+
+			Gpu_Cluster Cluster{};
+			{
+				Cluster.Sphere = glm::vec4{ glm::vec3{ Quantize * glm::vec4{ Bounds.Center, 1.0f } }, Bounds.Radius * Radius_Scale };
+				Cluster.Cone = glm::vec4{ Quantize_Axis * Bounds.Cone_Axis, Bounds.Cone_Cutoff };
+				Cluster.Index_Count = Meshlet.Triangle_Count * 3;
+				Cluster.First_Index = Range.First_Index + (Meshlet.Triangle_Offset - Range_First_Triangle) * 3;
+				Cluster.Vertex_Offset = Range.Vertex_Offset;
+				Cluster.Texture_Slot = Draw_Instance::Get_Texture_Slot(Texture_Slots, Range.Material);
+				Cluster.Meshlet_Vertex_Offset = Meshlet.Vertex_Offset;
+				Cluster.Meshlet_Vertex_Count = Meshlet.Vertex_Count;
+				Cluster.Meshlet_Triangle_Offset = Meshlet.Triangle_Offset;
+				Cluster.Meshlet_Triangle_Count = Meshlet.Triangle_Count;
+			}
+			Clusters.push_back(Cluster);
+		}
+
+		return Clusters;
+	}
+
+	//NOTE : Returns The Largest Range Count Of Any LOD, Which Bounds The Commands One Instance Can Emit
+	static const uint32_t Build_Tables(const vector<Mesh_Lod>& Lods, const vector<uint32_t>& Texture_Slots, vector<Gpu_Lod>& Gpu_Lods, vector<Gpu_Draw_Range>& Gpu_Ranges) {
+		Gpu_Lods.clear();
+		Gpu_Ranges.clear();
+
+		uint32_t Max_Range_Count{ 0 };
+		for (const auto& Lod : Lods) {
+			Gpu_Lod Gpu_Lod{};
+			{
+				Gpu_Lod.First_Range = static_cast<uint32_t>(Gpu_Ranges.size());
+				Gpu_Lod.Range_Count = static_cast<uint32_t>(Lod.Draw_Ranges.size());
+				Gpu_Lod.Error = Lod.Error;
+			}
+			Gpu_Lods.push_back(Gpu_Lod);
+
+			for (const auto& Range : Lod.Draw_Ranges) {
+				Gpu_Draw_Range Gpu_Range{};
+				{
+					Gpu_Range.Index_Count = Range.Index_Count;
+					Gpu_Range.First_Index = Range.First_Index;
+					Gpu_Range.Vertex_Offset = Range.Vertex_Offset;
+					Gpu_Range.Texture_Slot = Draw_Instance::Get_Texture_Slot(Texture_Slots, Range.Material);
+				}
+				Gpu_Ranges.push_back(Gpu_Range);
+			}
+
+			Max_Range_Count = std::max(Max_Range_Count, Gpu_Lod.Range_Count);
+		}
+
+		return Max_Range_Count;
+	}
+
+	//NOTE : Planes And Camera Are Moved Into The Space Of The Instance Spheres So The Shader Never Touches The Scene Matrix
+	static const Gpu_Cull_Constants Build_Constants(const glm::mat4& Scene, const glm::mat4& View, const glm::mat4& Proj, float Viewport_Height, uint32_t Instance_Count, uint32_t Lod_Count, uint32_t Max_Draw_Count) {
+		const Frustum World_Frustum{ Frustum::From_Matrix(Proj * View) };
+		const glm::mat4 Scene_Transpose{ glm::transpose(Scene) };
+
+		Gpu_Cull_Constants Constants{};
+		{
+			for (size_t Index = 0; Index < World_Frustum.Planes.size(); ++Index) {
+				const glm::vec4 Plane{ Scene_Transpose * World_Frustum.Planes[Index] };
+				Constants.Planes[Index] = Plane / glm::length(glm::vec3{ Plane });
+			}
+
+			Constants.Camera = glm::vec4{ glm::vec3{ glm::inverse(View * Scene)[3] }, 0.5f * Viewport_Height * glm::abs(Proj[1][1]) };
+			Constants.Instance_Count = Instance_Count;
+			Constants.Lod_Count = Lod_Count;
+			Constants.Max_Draw_Count = Max_Draw_Count;
+			Constants.Lod_Pixel_Threshold = Lod_Pixel_Threshold;
+		}
+
+		return Constants;
+	}
+};
+
+class VK_Application final {
+private:
+	struct Queue_Family_Indices final {
+		uint32_t Graphics_Family;
+		uint32_t Present_Family;
+	};
+
+	struct Device_Capabilities final {
+		bool Draw_Indirect_Count{ false };
+		bool Multi_Draw_Indirect{ false };
+		bool Draw_Indirect_First_Instance{ false };
+		bool Compute_On_Graphics_Queue{ false };
+		bool Synchronization2{ false };
+		bool Timeline_Semaphore{ false };
+		bool Dynamic_Rendering{ false };
+		bool Graphics_Pipeline_Library{ false };
+		bool Extended_Dynamic_State{ false };
+		bool Extended_Dynamic_State2{ false };
+		bool Extended_Dynamic_State3{ false };
+		bool Dynamic_Primitive_Topology_Unrestricted{ false };
+		bool Mesh_Shader{ false };
+		uint32_t Max_Mesh_Tasks{ 0 };
+		bool Sampler_Dynamic_Indexing{ false };
+		bool Sampler_Non_Uniform_Indexing{ false };
+		uint32_t Max_Fragment_Samplers{ 1 };
+	};
+
+	struct Swap_Chain_Support_Details final {
+		VkSurfaceCapabilitiesKHR Capabilities{};
+		vector<VkSurfaceFormatKHR> Formats{};
+		vector<VkPresentModeKHR> Present_Modes{};
+	};
+
+public:
+#ifdef _DEBUG
+	vector<const char*> m_Validation_Layer_List{};
+
+	VkDebugUtilsMessengerEXT m_Debug_Messenger{};
+
+	VkDebugUtilsMessengerCreateInfoEXT m_VkDebugUtilsMessengerCreateInfoEXT{};
+
+	//TODO : TO Static Function
+	bool Check_Vaildation_Layer_Support(void) {
+		uint32_t Layer_Count;
+		THROW_IF_VK_FAILED(vkEnumerateInstanceLayerProperties(&Layer_Count, nullptr));
+
+		vector<VkLayerProperties> Available_Layers;
+		Available_Layers.resize(Layer_Count);
+		THROW_IF_VK_FAILED(vkEnumerateInstanceLayerProperties(&Layer_Count, Available_Layers.data()));
+
+		for (const auto& Layer_Name : this->m_Validation_Layer_List) {
+			bool layer_Is_Found = false;
+
+			for (const auto& Layer_Propery : Available_Layers)
+				if (string{ Layer_Name } == string{ Layer_Propery.layerName }) {
+					layer_Is_Found = true;
+					break;
+				}
+			if (!layer_Is_Found)
+				return false;
+		}
+
+		return true;
+	}
+
+	static VKAPI_ATTR VkBool32 VKAPI_CALL Debug_Callback(VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity, VkDebugUtilsMessageTypeFlagsEXT messageType, const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData, void* pUserData) {
+		cerr << "Validation layer: " << pCallbackData->pMessage << endl;
+
+		//NOTE : This Return Common Is VK_FALSE, We Should Not  Debug Failedtaion Layer Just it's Warning
+		return VK_FALSE;
+	}
+
+	const void Build_Debug_Messenger_Create_Info(void) {
+		this->m_VkDebugUtilsMessengerCreateInfoEXT.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
+
+		this->m_VkDebugUtilsMessengerCreateInfoEXT.messageSeverity =
+			//VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT |
+			VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT |
+			VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT |
+			VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+
+		this->m_VkDebugUtilsMessengerCreateInfoEXT.messageType =
+			VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT |
+			VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT |
+			VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
+
+		this->m_VkDebugUtilsMessengerCreateInfoEXT.pfnUserCallback = VK_Application::Debug_Callback;
+
+		this->m_VkDebugUtilsMessengerCreateInfoEXT.pUserData = nullptr;
+	}
+
+	static const VkResult Create_DebugUtils_Messenger_EXT(VkInstance Instance, const VkDebugUtilsMessengerCreateInfoEXT* Create_Info, const VkAllocationCallbacks* Allocator, VkDebugUtilsMessengerEXT* m_Debug_Messenger) {
+		auto Func = reinterpret_cast<PFN_vkCreateDebugUtilsMessengerEXT>(vkGetInstanceProcAddr(Instance, "vkCreateDebugUtilsMessengerEXT"));
+		if (nullptr != Func)
+			return Func(Instance, Create_Info, Allocator, m_Debug_Messenger);
+		else
+			return VK_ERROR_EXTENSION_NOT_PRESENT;
+	}
+
+	static void Destroy_DebugUtils_Messenger_EXT(VkInstance Instance, VkDebugUtilsMessengerEXT m_Debug_Messenger, const VkAllocationCallbacks* Allocator) {
+		auto Func = reinterpret_cast<PFN_vkDestroyDebugUtilsMessengerEXT>(vkGetInstanceProcAddr(Instance, "vkDestroyDebugUtilsMessengerEXT"));
+		if (nullptr != Func)
+			Func(Instance, m_Debug_Messenger, Allocator);
+	}
+
+	void Set_Debug_Messenger() {
+		THROW_IF_VK_FAILED(VK_Application::Create_DebugUtils_Messenger_EXT(
+			this->m_VK_Instance.get(),
+			&this->m_VkDebugUtilsMessengerCreateInfoEXT,
+			nullptr,
+			&this->m_Debug_Messenger)
+		);
+	}
+#endif // _DEBUG
+
+public:
+	VK_Application(void) = default;
+
+	~VK_Application(void) {
+		this->CleanUp();
+	}
+
+	void Run(void) {
+		this->Initialize();
+		this->Main_Loop();
+	}
+
+private:
+	void Initialize(void) {
+		Init_Window();
+		Init_Vulkan();
+	}
+
+	void Init_Window(void) {
+		static std::once_flag Initialized_GLWF_Flag{};
+
+		std::call_once(Initialized_GLWF_Flag, VK_Application::Initialize_GLWF);
+
+		GLFWwindow* window{ glfwCreateWindow(WIDTH, HEIGHT, "Vulkan", nullptr, nullptr) };
+		if (nullptr == window)
+			throw std::runtime_error("Failed to create GLFW window");
+		this->m_Window.reset(window);
+
+		glfwSetWindowUserPointer(this->m_Window.get(), this);
+		glfwSetFramebufferSizeCallback(this->m_Window.get(), VK_Application::Frame_Buffer_Resize_CallBack);
+	}
+
+	void Init_Vulkan(void) {
+#ifdef _DEBUG
+		this->Build_Debug_Messenger_Create_Info();
+#endif // _DEBUG
+
+		this->Create_Instance();
+
+#ifdef _DEBUG
+		this->Set_Debug_Messenger();
+#endif // _DEBUG
+
+		this->Create_Surface();
+		this->Pick_Physical_Device();
+		this->Create_Logical_Device();
+		this->Start_Pipeline_Manager();
+		this->Create_SwapChain();
+		this->Create_SwapChhain_Image_Views();
+		this->Select_Vertex_Layout();
+		this->Select_Culling_Path();
+		this->Select_Texture_Slots();
+		if (!this->m_Dynamic_Rendering)
+			this->Create_Render_Pass();
+		this->Create_Descriptor_Set_Layout();
+		//NOTE : Pipelines Compile On The Manager's Workers While Textures And The Model Load, The First Frame Adopts Them
+		this->Create_GraphicsPipeline();
+		if (this->m_Gpu_Culling)
+			this->Create_Gpu_Culling_Pipelines();
+		this->Create_Command_Pool();
+		//NOTE : Uploads Wait On The Frame Timeline Too, So It Has To Exist Before The First One
+		this->Create_Sync_Objects();
+		this->Create_Render_Graph();
+		if (!this->m_Dynamic_Rendering)
+			this->Create_Frame_Buffers();
+		this->Load_Model();
+		//NOTE : After The Model, Its Materials Decide Which Textures Are Loaded
+		this->Create_Texture_Images();
+		this->Create_Texture_Image_Views();
+		this->Create_Texture_Sampler();
+		this->Create_Geometry_Pool();
+		this->Upload_Mesh_Geometry();
+		this->Create_Instance_Buffer();
+		//NOTE : Ahead Of The Scene Descriptor Sets, The Mesh Shader Reads The Cluster Tables And Draw Buffers Through Them
+		if (this->m_Gpu_Culling)
+			this->Create_Gpu_Culling();
+		this->Create_Uniform_Buffers();
+		this->Create_Descriptor_Pool();
+		this->Create_Descriptor_Sets();
+		this->Create_Command_Buffers();
+
+		if (this->m_Occlusion_Culling)
+			this->Create_Depth_Pyramid();
+
+		this->Report_Attachment_Policy();
+		this->m_Render_Graph.Report();
+	}
+
+	void Start_Pipeline_Manager(void) {
+		const std::filesystem::path Cache_Path{ Pipeline_Cache_File_Path, std::filesystem::path::generic_format };
+		const vector<char> Cache_Data{ std::filesystem::exists(Cache_Path) ? Read_File(Cache_Path) : vector<char>{} };
+
+		//NOTE : One Core Stays With The Main Thread, Which Keeps Loading While The Workers Compile
+		const uint32_t Thread_Count{ max(2u, thread::hardware_concurrency()) - 1 };
+		this->m_Pipeline_Manager.Start(this->m_Logical_Device.get(), Cache_Data, min(4u, Thread_Count));
+	}
+
+	//NOTE : Cache Is Only An Accelerator, A Read Only Shader Directory Is Not An Error
+	void Save_Pipeline_Cache(void) {
+		const vector<char> Cache_Data{ this->m_Pipeline_Manager.Get_Cache_Data() };
+
+		ofstream File{ std::filesystem::path{ Pipeline_Cache_File_Path, std::filesystem::path::generic_format }, ios::binary | ios::trunc };
+		if (File.is_open())
+			File.write(Cache_Data.data(), Cache_Data.size());
+	}
+
+	//NOTE : Target Keeps Its Deleter, A Pipeline Already In It Is What Gets Drawn With Until This One Is Adopted
+	void Compile_Pipeline(unique_ptr<VkPipeline_T, function<void(VkPipeline)>>& Target, Pipeline_Manager::Build_Function Build) {
+		Target.get_deleter() = [Device = this->m_Logical_Device.get()](VkPipeline Pipeline) {if (nullptr != Pipeline) vkDestroyPipeline(Device, Pipeline, nullptr); };
+		this->m_Pending_Pipelines.emplace_back(&Target, this->m_Pipeline_Manager.Submit(std::move(Build)));
+	}
+
+	//NOTE : Only Targets Without A Fallback Wait, A Replaced Pipeline May Still Be In Flight So It Is Retired Until Clean Up
+	void Adopt_Pipelines(void) {
+		for (auto Pending = this->m_Pending_Pipelines.begin(); Pending != this->m_Pending_Pipelines.end();) {
+			auto& [Target, Future] { *Pending };
+			if (nullptr != Target->get() && !Pipeline_Manager::Is_Ready(Future)) {
+				++Pending;
+				continue;
+			}
+
+			const VkPipeline Pipeline{ Future.get() };
+			if (nullptr != Target->get())
+				this->m_Retired_Pipelines.emplace_back(Target->release(), Target->get_deleter());
+			Target->reset(Pipeline);
+
+			Pending = this->m_Pending_Pipelines.erase(Pending);
+			if (this->m_Pending_Pipelines.empty())
+				this->m_Pipeline_Manager.Report();
+		}
+	}
+
+	void Main_Loop(void) {
+		while (!glfwWindowShouldClose(this->m_Window.get())) {
+			glfwPollEvents();
+
+			this->Draw_Frame();
+		}
+		THROW_IF_VK_FAILED(vkDeviceWaitIdle(this->m_Logical_Device.get()));
+	}
+
+	void CleanUp_SwapChain(void) {
+		this->m_Pyramid_Descriptor_Pool.reset();
+		for (auto& Level_View : this->m_Pyramid_Level_Views)
+			Level_View.reset();
+		this->m_Pyramid_Image_View.reset();
+		this->m_Pyramid_Image.reset();
+		this->m_Pyramid_Image_Memory.reset();
+
+		//vkDestroyImageView(this->m_Logical_Device.get(), this->m_Depth_Image_View.get(), nullptr);
+		this->m_Depth_Image_View.reset();
+
+		//vkDestroyImageView(this->m_Logical_Device.get(), this->m_Color_Image_View.get(), nullptr);
+		this->m_Color_Image_View.reset();
+
+		//NOTE : Owns The Transient Color And Depth Images And The Memory They Share
+		this->m_Render_Graph.Reset();
+
+		for (auto& Framebuffer : this->m_Swap_Chain_Frame_buffers) {
+			//vkDestroyFramebuffer(this->m_Logical_Device.get(), Framebuffer.get(), nullptr);
+			Framebuffer.reset();
+		}
+
+		for (auto& Image_View : this->m_Swap_Chain_Image_Views) {
+			//vkDestroyImageView(this->m_Logical_Device.get(), Image_View.get(), nullptr);
+
+			Image_View.reset();
+		}
+
+		this->m_Swap_Chain.reset();
+	}
+
+	void CleanUp(void) {
+		//NOTE : Clean Up Logical Device Before Instance and ,First Clean Command Queue Before Logical Device
+
+		//NOTE : Compiles Still Running Have To Finish Before Their Libraries And The Device Go Away
+		for (auto& [Target, Future] : this->m_Pending_Pipelines)
+			vkDestroyPipeline(this->m_Logical_Device.get(), Future.get(), nullptr);
+		this->m_Pending_Pipelines.clear();
+
+		this->Save_Pipeline_Cache();
+		this->m_Pipeline_Manager.Stop();
+
+		this->CleanUp_SwapChain();
+
+		for (size_t Index = 0; Index < MAX_FRAMES_IN_FLIGHT; ++Index) {
+			//vkDestroySemaphore(this->m_Logical_Device.get(), this->m_Render_Finished_Semaphores[Index].get(), nullptr);
+			this->m_Render_Finished_Semaphores[Index].reset();
+
+			//vkDestroySemaphore(this->m_Logical_Device.get(), this->m_Image_Available_Semaphores[Index].get(), nullptr);
+			this->m_Image_Available_Semaphores[Index].reset();
+		}
+
+		this->m_Timeline_Semaphore.reset();
+
+		//vkDestroyDescriptorPool(this->m_Logical_Device.get(), this->m_Descriptor_Pool.get(), nullptr);
+		this->m_Descriptor_Pool.reset();
+
+		for (size_t Index = 0; Index < MAX_FRAMES_IN_FLIGHT; ++Index) {
+			//vkDestroyBuffer(this->m_Logical_Device.get(), this->m_Uniform_Buffers[Index].get(), nullptr);
+			this->m_Uniform_Buffers[Index].reset();
+			//vkFreeMemory(this->m_Logical_Device.get(), this->m_Uniform_Buffers_Memory[Index].get(), nullptr);
+			this->m_Uniform_Buffers_Memory[Index].reset();
+		}
+
+		this->m_Pyramid_Reduce_Pipeline.reset();
+		this->m_Pyramid_Copy_Pipeline.reset();
+		this->m_Pyramid_Pipeline_Layout.reset();
+		this->m_Pyramid_Descriptor_Set_Layout.reset();
+		this->m_Pyramid_Sampler.reset();
+		this->m_Late_Cull_Pipeline.reset();
+		for (size_t Index = 0; Index < this->m_Late_Draw_Buffers.size(); ++Index) {
+			this->m_Late_Draw_Buffers[Index].reset();
+			this->m_Late_Draw_Buffers_Memory[Index].reset();
+		}
+		for (size_t Index = 0; Index < this->m_Occlusion_Uniform_Buffers.size(); ++Index) {
+			this->m_Occlusion_Uniform_Buffers[Index].reset();
+			this->m_Occlusion_Uniform_Buffers_Memory[Index].reset();
+			this->m_Occlusion_Statistics_Buffers[Index].reset();
+			this->m_Occlusion_Statistics_Buffers_Memory[Index].reset();
+		}
+		this->m_Occlusion_State_Buffer.reset();
+		this->m_Occlusion_State_Buffer_Memory.reset();
+
+		this->m_Cull_Pipeline.reset();
+		this->m_Cull_Pipeline_Layout.reset();
+		this->m_Cull_Descriptor_Pool.reset();
+		this->m_Cull_Descriptor_Set_Layout.reset();
+		for (size_t Index = 0; Index < this->m_Draw_Buffers.size(); ++Index) {
+			this->m_Draw_Buffers[Index].reset();
+			this->m_Draw_Buffers_Memory[Index].reset();
+		}
+		this->m_Meshlet_Triangle_Buffer.reset();
+		this->m_Meshlet_Triangle_Buffer_Memory.reset();
+		this->m_Meshlet_Vertex_Buffer.reset();
+		this->m_Meshlet_Vertex_Buffer_Memory.reset();
+		this->m_Cluster_Buffer.reset();
+		this->m_Cluster_Buffer_Memory.reset();
+		this->m_Draw_Range_Buffer.reset();
+		this->m_Draw_Range_Buffer_Memory.reset();
+		this->m_Lod_Buffer.reset();
+		this->m_Lod_Buffer_Memory.reset();
+		this->m_Instance_Buffer.reset();
+		this->m_Instance_Buffer_Memory.reset();
+
+		//vkDestroyBuffer(this->m_Logical_Device.get(), this->m_Index_Buffer.get(), nullptr);
+		this->m_Index_Buffer.reset();
+
+		//vkFreeMemory(this->m_Logical_Device.get(), this->m_Index_Buffer_Memory.get(), nullptr);
+		this->m_Index_Buffer_Memory.reset();
+
+		//vkDestroyBuffer(this->m_Logical_Device.get(), this->m_Vertex_Buffer.get(), nullptr);
+		this->m_Vertex_Buffer.reset();
+
+		//vkFreeMemory(this->m_Logical_Device.get(), this->m_Vertex_Buffer_Memory.get(), nullptr);
+		this->m_Vertex_Buffer_Memory.reset();
+
+		//vkDestroySampler(this->m_Logical_Device.get(), this->m_Texture_Sampler.get(), nullptr);
+		this->m_Texture_Sampler.reset();
+
+		this->m_Texture_Image_Views.clear();
+		this->m_Texture_Images.clear();
+		this->m_Texture_Image_Memories.clear();
+
+		//vkDestroyCommandPool(this->m_Logical_Device.get(), this->m_Command_Pool.get(), nullptr);
+		this->m_Command_Pool.reset();
+
+		//NOTE : In Clean Up Swap Chain Func
+		//for (auto& Framebuffer : this->m_Swap_Chain_Frame_buffers) {
+		//	//vkDestroyFramebuffer(this->m_Logical_Device.get(), Framebuffer.get(), nullptr);
+		//	Framebuffer.reset();
+		//}
+
+		//vkDestroyPipeline(this->m_Logical_Device.get(), this->m_Graphics_Pipeline.get(), nullptr);
+		this->m_Graphics_Pipeline.reset();
+		this->m_Retired_Pipelines.clear();
+		this->m_Pipeline_Libraries.clear();
+
+
+		//vkDestroyPipelineLayout(this->m_Logical_Device.get(), this->m_Pipeline_Layout.get(), nullptr);
+		this->m_Pipeline_Layout.reset();
+
+		//vkDestroyDescriptorSetLayout(this->m_Logical_Device.get(), this->m_Descriptor_Set_Layout.get(), nullptr);
+		this->m_Descriptor_Set_Layout.reset();
+
+		//vkDestroyRenderPass(this->m_Logical_Device.get(), this->m_Render_Pass.get(), nullptr);
+		this->m_Render_Pass.reset();
+		this->m_Early_Render_Pass.reset();
+		this->m_Late_Render_Pass.reset();
+
+		//NOTE : In Clean Up Swap Chain Func
+		//for (auto& Image_View : this->m_Swap_Chain_Image_Views) {
+		//	//vkDestroyImageView(this->m_Logical_Device.get(), Image_View.get(), nullptr);
+
+		//	Image_View.reset();
+		//}
+
+		// NOTE : In Clean Up Swap Chain Func
+		////vkDestroySwapchainKHR(this->m_Logical_Device.get(), this->m_Swap_Chain.get(), nullptr);
+		//this->m_Swap_Chain.reset();
+
+		//vkDestroyDevice(this->m_Logical_Device.get(), nullptr);
+		this->m_Logical_Device.reset();
+
+#ifdef _DEBUG
+		VK_Application::Destroy_DebugUtils_Messenger_EXT(this->m_VK_Instance.get(), this->m_Debug_Messenger, nullptr);
+#endif // _DEBUG
+
+		//vkDestroySurfaceKHR(this->m_VK_Instance.get(), this->m_Surface.get(), nullptr);
+		this->m_Surface.reset();
+
+		//vkDestroyInstance(m_VK_Instance, nullptr);
+		this->m_VK_Instance.reset();
+		//glfwDestroyWindow(this->m_Window.get());
+
+		//glfwDestroyWindow(this->m_Window.get());
+		this->m_Window.reset();
+
+		glfwTerminate();
+	}
+
+	void Re_Create_SwapChain(void) {
+		int Width{ 0 }, Height{ 0 };
+		glfwGetFramebufferSize(this->m_Window.get(), &Width, &Height);
+		while (Width == 0 || Height == 0) {
+			glfwGetFramebufferSize(this->m_Window.get(), &Width, &Height);
+			glfwWaitEvents();
+		}
+
+		THROW_IF_VK_FAILED(vkDeviceWaitIdle(this->m_Logical_Device.get()));
+
+		const auto Start{ chrono::high_resolution_clock::now() };
+
+		this->CleanUp_SwapChain();
+
+		this->Create_SwapChain();
+		this->Create_SwapChhain_Image_Views();
+		if (!this->m_Dynamic_Rendering)
+			this->Create_Render_Pass();
+		this->Create_Render_Graph();
+		if (!this->m_Dynamic_Rendering)
+			this->Create_Frame_Buffers();
+
+		if (this->m_Occlusion_Culling)
+			this->Create_Depth_Pyramid();
+
+		const chrono::duration<double, milli> Elapsed{ chrono::high_resolution_clock::now() - Start };
+		cout << "Swap chain recreated in " << Elapsed.count() << " ms (" << (this->m_Dynamic_Rendering ? "dynamic rendering" : "render pass and framebuffers") << ")" << endl;
+	}
+
+private:
+	void Create_Instance(void) {
+		VkApplicationInfo VK_Application_Info{};
+		{
+			VK_Application_Info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+			VK_Application_Info.pApplicationName = "Hello Triangle";
+			VK_Application_Info.applicationVersion = VK_MAKE_VERSION(1, 0, 0);
+			VK_Application_Info.pEngineName = "No Engine";
+			VK_Application_Info.engineVersion = VK_MAKE_VERSION(1, 0, 0);
+			VK_Application_Info.apiVersion = VK_API_VERSION_1_2;
+		}
+
+		const auto& Extensions = VK_Application::Get_Require_Extensions();
+		VkInstanceCreateInfo Instance_Create_Info = {};
+		{
+			Instance_Create_Info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+
+			Instance_Create_Info.pApplicationInfo = &VK_Application_Info;
+
+#ifdef _DEBUG
+			Instance_Create_Info.pNext = reinterpret_cast<const void*>(&this->m_VkDebugUtilsMessengerCreateInfoEXT);
+			Instance_Create_Info.enabledLayerCount = static_cast<uint32_t>(this->m_Validation_Layer_List.size());
+			Instance_Create_Info.ppEnabledLayerNames = this->m_Validation_Layer_List.data();
+#else
+			Instance_Create_Info.pNext = nullptr;
+			Instance_Create_Info.enabledLayerCount = 0;
+			Instance_Create_Info.ppEnabledLayerNames = nullptr;
+#endif // _DEBUG
+			Instance_Create_Info.enabledExtensionCount = static_cast<uint32_t>(Extensions.size());
+			Instance_Create_Info.ppEnabledExtensionNames = Extensions.data();
+		}
+
+		VkInstance VK_Instance{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateInstance(&Instance_Create_Info, nullptr, &VK_Instance));
+		this->m_VK_Instance.reset(VK_Instance);
+	}
+
+	void Create_Surface(void) {
+		VkSurfaceKHR Surface{ nullptr };
+		THROW_IF_VK_FAILED(glfwCreateWindowSurface(this->m_VK_Instance.get(), this->m_Window.get(), nullptr, &Surface));
+
+
+		this->m_Surface.get_deleter() = [Instance = this->m_VK_Instance.get()](VkSurfaceKHR Surface) {vkDestroySurfaceKHR(Instance, Surface, nullptr); };
+		this->m_Surface.reset(Surface);
+	}
+
+	void Pick_Physical_Device(void) {
+		uint32_t Device_Count{ 0 };
+		THROW_IF_VK_FAILED(vkEnumeratePhysicalDevices(this->m_VK_Instance.get(), &Device_Count, nullptr));
+
+		if (0 == Device_Count)
+			throw runtime_error("Failed to find GPUs with Vulkan support!");
+
+		vector<VkPhysicalDevice> Devices{};
+		Devices.resize(Device_Count);
+		THROW_IF_VK_FAILED(vkEnumeratePhysicalDevices(this->m_VK_Instance.get(), &Device_Count, Devices.data()));
+		for (const auto& Device : Devices)
+			if (Is_Device_Suitable(Device)) {
+				this->m_Physical_Device = Device;
+				break;
+			}
+
+		if (nullptr == this->m_Physical_Device)
+			throw runtime_error("Failed to find a suitable GPU!");
+
+		//NOTE : Note Phyiscsal Device Info
+		this->m_Msaa_Samples = Get_Max_Usable_Sample_Count(this->m_Physical_Device);
+		this->m_Device_Capabilities = Query_Device_Capabilities(this->m_Physical_Device);
+	}
+
+	void Create_Logical_Device(void) {
+		this->m_Queue_Family_Indices.Graphics_Family =
+			this->Find_Queue_Families(VK_QUEUE_GRAPHICS_BIT);
+
+		if (numeric_limits<uint32_t>::max() == this->m_Queue_Family_Indices.Graphics_Family)
+			throw runtime_error("Failed to find a queue family with graphics bit!");
+
+		this->m_Queue_Family_Indices.Present_Family = this->Get_Physical_Device_Queue_Present_Family();
+
+		if (numeric_limits<uint32_t>::max() == this->m_Queue_Family_Indices.Present_Family)
+			throw runtime_error("Failed to find a queue family with present bit!");
+
+		//NOTE : Queue Family Should Be Unique,Because It Maybe Same
+		unordered_set<uint32_t> Unique_Queue_Families{
+			this->m_Queue_Family_Indices.Graphics_Family,
+			this->m_Queue_Family_Indices.Present_Family
+		};
+
+		//NOTE : Refence Continue From Create_Instance
+		constexpr float Queue_Priority{ 1.0f };
+
+		vector<VkDeviceQueueCreateInfo> Queue_Create_Info_List;
+		Queue_Create_Info_List.reserve(Unique_Queue_Families.size());
+		{
+			for (const auto& Queue_Family : Unique_Queue_Families) {
+				VkDeviceQueueCreateInfo Queue_Create_Info{};
+				Queue_Create_Info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+				Queue_Create_Info.queueFamilyIndex = Queue_Family;
+				Queue_Create_Info.queueCount = 1;
+				Queue_Create_Info.pQueuePriorities = &Queue_Priority;
+				Queue_Create_Info_List.emplace_back(Queue_Create_Info);
+			}
+		}
+
+		VkPhysicalDeviceFeatures Device_Features{};
+		{
+			Device_Features.samplerAnisotropy = VK_TRUE;
+			Device_Features.multiDrawIndirect = this->m_Device_Capabilities.Multi_Draw_Indirect ? VK_TRUE : VK_FALSE;
+			Device_Features.drawIndirectFirstInstance = this->m_Device_Capabilities.Draw_Indirect_First_Instance ? VK_TRUE : VK_FALSE;
+			Device_Features.shaderSampledImageArrayDynamicIndexing = this->m_Device_Capabilities.Sampler_Dynamic_Indexing ? VK_TRUE : VK_FALSE;
+		}
+
+		VkPhysicalDeviceVulkan12Features Vulkan12_Features{};
+		{
+			Vulkan12_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+			Vulkan12_Features.drawIndirectCount = this->m_Device_Capabilities.Draw_Indirect_Count ? VK_TRUE : VK_FALSE;
+			Vulkan12_Features.timelineSemaphore = VK_TRUE;
+			Vulkan12_Features.shaderSampledImageArrayNonUniformIndexing = this->m_Device_Capabilities.Sampler_Non_Uniform_Indexing ? VK_TRUE : VK_FALSE;
+		}
+
+		//NOTE : Extension Feature Structs Only Join The Chain When Their Extension Is Enabled
+		void* Feature_Chain{ &Vulkan12_Features };
+		vector<const char*> Device_Extensions{ Device_EXT_SwapChain };
+
+		VkPhysicalDeviceSynchronization2FeaturesKHR Synchronization2_Features{};
+		{
+			Synchronization2_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+			Synchronization2_Features.synchronization2 = VK_TRUE;
+		}
+
+		if (this->m_Device_Capabilities.Synchronization2) {
+			Synchronization2_Features.pNext = Feature_Chain;
+			Feature_Chain = &Synchronization2_Features;
+			Device_Extensions.push_back(Device_EXT_Synchronization2);
+		}
+
+		VkPhysicalDeviceDynamicRenderingFeaturesKHR Dynamic_Rendering_Features{};
+		{
+			Dynamic_Rendering_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+			Dynamic_Rendering_Features.dynamicRendering = VK_TRUE;
+		}
+
+		if (this->m_Device_Capabilities.Dynamic_Rendering) {
+			Dynamic_Rendering_Features.pNext = Feature_Chain;
+			Feature_Chain = &Dynamic_Rendering_Features;
+			Device_Extensions.push_back(Device_EXT_Dynamic_Rendering);
+		}
+
+		VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT Graphics_Pipeline_Library_Features{};
+		{
+			Graphics_Pipeline_Library_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+			Graphics_Pipeline_Library_Features.graphicsPipelineLibrary = VK_TRUE;
+		}
+
+		if (this->m_Device_Capabilities.Graphics_Pipeline_Library) {
+			Graphics_Pipeline_Library_Features.pNext = Feature_Chain;
+			Feature_Chain = &Graphics_Pipeline_Library_Features;
+			Device_Extensions.push_back(Device_EXT_Pipeline_Library);
+			Device_Extensions.push_back(Device_EXT_Graphics_Pipeline_Library);
+		}
+
+		const Dynamic_State_Level Dynamic_Level{ this->Select_Dynamic_State_Level() };
+
+		VkPhysicalDeviceExtendedDynamicStateFeaturesEXT Extended_Dynamic_State_Features{};
+		{
+			Extended_Dynamic_State_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+			Extended_Dynamic_State_Features.extendedDynamicState = VK_TRUE;
+		}
+
+		if (Dynamic_State_Level_1 <= Dynamic_Level) {
+			Extended_Dynamic_State_Features.pNext = Feature_Chain;
+			Feature_Chain = &Extended_Dynamic_State_Features;
+			Device_Extensions.push_back(Device_EXT_Extended_Dynamic_State);
+		}
+
+		VkPhysicalDeviceExtendedDynamicState2FeaturesEXT Extended_Dynamic_State2_Features{};
+		{
+			Extended_Dynamic_State2_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT;
+			Extended_Dynamic_State2_Features.extendedDynamicState2 = VK_TRUE;
+		}
+
+		if (Dynamic_State_Level_2 <= Dynamic_Level) {
+			Extended_Dynamic_State2_Features.pNext = Feature_Chain;
+			Feature_Chain = &Extended_Dynamic_State2_Features;
+			Device_Extensions.push_back(Device_EXT_Extended_Dynamic_State2);
+		}
+
+		VkPhysicalDeviceExtendedDynamicState3FeaturesEXT Extended_Dynamic_State3_Features{};
+		{
+			Extended_Dynamic_State3_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+			Extended_Dynamic_State3_Features.extendedDynamicState3ColorBlendEnable = VK_TRUE;
+			Extended_Dynamic_State3_Features.extendedDynamicState3RasterizationSamples = VK_TRUE;
+		}
+
+		if (Dynamic_State_Level_3 <= Dynamic_Level) {
+			Extended_Dynamic_State3_Features.pNext = Feature_Chain;
+			Feature_Chain = &Extended_Dynamic_State3_Features;
+			Device_Extensions.push_back(Device_EXT_Extended_Dynamic_State3);
+		}
+
+		VkPhysicalDeviceMeshShaderFeaturesEXT Mesh_Shader_Features{};
+		{
+			Mesh_Shader_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT;
+			Mesh_Shader_Features.meshShader = VK_TRUE;
+		}
+
+		if (Mesh_Shader_Enable && this->m_Device_Capabilities.Mesh_Shader) {
+			Mesh_Shader_Features.pNext = Feature_Chain;
+			Feature_Chain = &Mesh_Shader_Features;
+			Device_Extensions.push_back(Device_EXT_Mesh_Shader);
+		}
+
+		VkDeviceCreateInfo Device_Create_Info{};
+		{
+			Device_Create_Info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+			//NOTE : Vulkan 1.2 Features Chain Alongside pEnabledFeatures, Only VkPhysicalDeviceFeatures2 Would Conflict With It
+			Device_Create_Info.pNext = Feature_Chain;
+			Device_Create_Info.queueCreateInfoCount = static_cast<uint32_t>(Queue_Create_Info_List.size());
+			Device_Create_Info.pQueueCreateInfos = Queue_Create_Info_List.data();
+			Device_Create_Info.enabledExtensionCount = static_cast<uint32_t>(Device_Extensions.size());
+			Device_Create_Info.ppEnabledExtensionNames = Device_Extensions.data();
+			Device_Create_Info.pEnabledFeatures = &Device_Features;
+		}
+
+		VkDevice Logical_Device{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateDevice(this->m_Physical_Device, &Device_Create_Info, nullptr, &Logical_Device));
+		this->m_Logical_Device.reset(Logical_Device);
+
+		//NOTE : Left Null Without The Extension, Barriers Then Fold Into Legacy vkCmdPipelineBarrier
+		if (this->m_Device_Capabilities.Synchronization2)
+			this->m_Barrier_Builder.Pipeline_Barrier_2 = reinterpret_cast<PFN_vkCmdPipelineBarrier2KHR>(vkGetDeviceProcAddr(this->m_Logical_Device.get(), "vkCmdPipelineBarrier2KHR"));
+
+		this->m_Dynamic_Rendering = Dynamic_Rendering_Enable && this->m_Device_Capabilities.Dynamic_Rendering;
+		this->m_Pipeline_Library = Pipeline_Library_Enable && this->m_Device_Capabilities.Graphics_Pipeline_Library;
+		if (this->m_Dynamic_Rendering) {
+			this->m_Cmd_Begin_Rendering = reinterpret_cast<PFN_vkCmdBeginRenderingKHR>(vkGetDeviceProcAddr(this->m_Logical_Device.get(), "vkCmdBeginRenderingKHR"));
+			this->m_Cmd_End_Rendering = reinterpret_cast<PFN_vkCmdEndRenderingKHR>(vkGetDeviceProcAddr(this->m_Logical_Device.get(), "vkCmdEndRenderingKHR"));
+		}
+
+		this->m_Extended_Dynamic_State.Load(this->m_Logical_Device.get(), Dynamic_Level, this->m_Device_Capabilities.Dynamic_Primitive_Topology_Unrestricted, this->m_Dynamic_Rendering);
+
+		if (Mesh_Shader_Enable && this->m_Device_Capabilities.Mesh_Shader)
+			this->m_Cmd_Draw_Mesh_Tasks_Indirect = reinterpret_cast<PFN_vkCmdDrawMeshTasksIndirectEXT>(vkGetDeviceProcAddr(this->m_Logical_Device.get(), "vkCmdDrawMeshTasksIndirectEXT"));
+
+		vkGetDeviceQueue(this->m_Logical_Device.get(), this->m_Queue_Family_Indices.Graphics_Family, 0, &this->m_Graphics_Queue);
+
+		vkGetDeviceQueue(this->m_Logical_Device.get(), this->m_Queue_Family_Indices.Present_Family, 0, &this->m_Present_Queue);
+
+	}
+
+	//NOTE : Levels Build On Each Other, Extended Dynamic State 3 Alone Buys Nothing Here
+	const Dynamic_State_Level Select_Dynamic_State_Level(void) const {
+		if (!Extended_Dynamic_State_Enable || !this->m_Device_Capabilities.Extended_Dynamic_State)
+			return Dynamic_State_Level_None;
+		if (!this->m_Device_Capabilities.Extended_Dynamic_State2)
+			return Dynamic_State_Level_1;
+		if (!this->m_Device_Capabilities.Extended_Dynamic_State3)
+			return Dynamic_State_Level_2;
+
+		return Dynamic_State_Level_3;
+	}
+
+	void Create_SwapChain(void) {
+		this->Query_Swap_Chain_Support_Details();
+
+		const VkSurfaceFormatKHR Surface_Format{ Choose_SwapChain_Surface_Format(this->m_Swap_Chain_Support_Details.Formats) };
+		const VkPresentModeKHR Present_Mode{ Choose_SwapChain_Present_Mode(this->m_Swap_Chain_Support_Details.Present_Modes) };
+		const VkExtent2D Swap_Chain_Extent{ Choose_SwapChain_Extent(this->m_Swap_Chain_Support_Details.Capabilities) };
+
+		//NOTE : Choose Image Count ,We Want One More Image Than Min Image Count
+		uint32_t Image_Count{ this->m_Swap_Chain_Support_Details.Capabilities.minImageCount + 1 };
+		Image_Count = std::clamp(Image_Count, this->m_Swap_Chain_Support_Details.Capabilities.minImageCount, this->m_Swap_Chain_Support_Details.Capabilities.maxImageCount);
+
+		//TODO : Why We Need Graphics And Present Family
+		vector<uint32_t> Queue_Family_Indices{ this->m_Queue_Family_Indices.Graphics_Family,this->m_Queue_Family_Indices.Present_Family };
+		VkSharingMode Sharing_Mode{ VK_SHARING_MODE_EXCLUSIVE };
+
+		if (this->m_Queue_Family_Indices.Graphics_Family != this->m_Queue_Family_Indices.Present_Family)
+			Sharing_Mode = VK_SHARING_MODE_CONCURRENT;
+
+		VkSwapchainCreateInfoKHR Swap_Chain_Create_Info{};
+		{
+			Swap_Chain_Create_Info.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
+			Swap_Chain_Create_Info.surface = this->m_Surface.get();
+			Swap_Chain_Create_Info.minImageCount = Image_Count;
+			Swap_Chain_Create_Info.imageFormat = Surface_Format.format;
+			Swap_Chain_Create_Info.imageColorSpace = Surface_Format.colorSpace;
+			Swap_Chain_Create_Info.imageExtent = Swap_Chain_Extent;
+			Swap_Chain_Create_Info.imageArrayLayers = 1;
+			Swap_Chain_Create_Info.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+			Swap_Chain_Create_Info.imageSharingMode = Sharing_Mode;
+			Swap_Chain_Create_Info.queueFamilyIndexCount = static_cast<uint32_t>(Queue_Family_Indices.size());
+			Swap_Chain_Create_Info.pQueueFamilyIndices = Queue_Family_Indices.data();
+			Swap_Chain_Create_Info.preTransform = this->m_Swap_Chain_Support_Details.Capabilities.currentTransform;
+			Swap_Chain_Create_Info.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+			Swap_Chain_Create_Info.presentMode = Present_Mode;
+			//NOTE : SHould Not Read Back Buffer
+			Swap_Chain_Create_Info.clipped = VK_TRUE;
+			Swap_Chain_Create_Info.oldSwapchain = VK_NULL_HANDLE;
+		}
+
+		VkSwapchainKHR Swap_Chain{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateSwapchainKHR(this->m_Logical_Device.get(), &Swap_Chain_Create_Info, nullptr, &Swap_Chain));
+
+		this->m_Swap_Chain.get_deleter() = [Device = this->m_Logical_Device.get()](VkSwapchainKHR Swap_Chain) {vkDestroySwapchainKHR(Device, Swap_Chain, nullptr); };
+		this->m_Swap_Chain.reset(Swap_Chain);
+
+		THROW_IF_VK_FAILED(vkGetSwapchainImagesKHR(this->m_Logical_Device.get(), this->m_Swap_Chain.get(), &Image_Count, nullptr));
+		this->m_Swap_Chain_Images.resize(Image_Count);
+		THROW_IF_VK_FAILED(vkGetSwapchainImagesKHR(this->m_Logical_Device.get(), this->m_Swap_Chain.get(), &Image_Count, this->m_Swap_Chain_Images.data()));
+
+		this->m_Swap_Chain_Image_Format = Surface_Format.format;
+		this->m_Swap_Chain_Extent = Swap_Chain_Extent;
+	}
+
+	void Create_SwapChhain_Image_Views(void) {
+
+		this->m_Swap_Chain_Image_Views.resize(this->m_Swap_Chain_Images.size());
+		for (size_t Index = 0; Index < this->m_Swap_Chain_Images.size(); ++Index) {
+
+			VkImageView Image_View{ this->Create_Image_View(
+				this->m_Swap_Chain_Images[Index],
+				1,
+				this->m_Swap_Chain_Image_Format,
+				VK_IMAGE_ASPECT_COLOR_BIT)
+			};
+
+			this->m_Swap_Chain_Image_Views[Index].get_deleter() = [Device = this->m_Logical_Device.get()](VkImageView Image_View) {if (nullptr != Image_View) vkDestroyImageView(Device, Image_View, nullptr); };
+			this->m_Swap_Chain_Image_Views[Index].reset(Image_View);
+		}
+	}
+
+	void Create_Render_Pass(void) {
+		const auto Delete_Render_Pass = [Device = this->m_Logical_Device.get()](VkRenderPass Render_Pass) {if (nullptr != Render_Pass) vkDestroyRenderPass(Device, Render_Pass, nullptr); };
+
+		this->m_Render_Pass.get_deleter() = Delete_Render_Pass;
+		this->m_Render_Pass.reset(Scene_Pass::Build_Render_Pass(this->m_Logical_Device.get(), this->m_Swap_Chain_Image_Format, this->Find_Depth_Format(), this->m_Msaa_Samples, Render_Pass_Complete));
+
+		//NOTE : Same Attachments As The Complete Pass, So Pipelines And Framebuffers Stay Compatible With All Three
+		if (this->m_Occlusion_Culling) {
+			this->m_Early_Render_Pass.get_deleter() = Delete_Render_Pass;
+			this->m_Early_Render_Pass.reset(Scene_Pass::Build_Render_Pass(this->m_Logical_Device.get(), this->m_Swap_Chain_Image_Format, this->Find_Depth_Format(), this->m_Msaa_Samples, Render_Pass_Early));
+
+			this->m_Late_Render_Pass.get_deleter() = Delete_Render_Pass;
+			this->m_Late_Render_Pass.reset(Scene_Pass::Build_Render_Pass(this->m_Logical_Device.get(), this->m_Swap_Chain_Image_Format, this->Find_Depth_Format(), this->m_Msaa_Samples, Render_Pass_Late));
+		}
+	}
+
+	void Create_Descriptor_Set_Layout(void) {
+		VkDescriptorSetLayoutBinding Ubo_Layout_Binding{};
+		{
+			Ubo_Layout_Binding.binding = 0;
+			Ubo_Layout_Binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+			Ubo_Layout_Binding.descriptorCount = 1;
+			Ubo_Layout_Binding.stageFlags = this->Get_Geometry_Stage();
+			Ubo_Layout_Binding.pImmutableSamplers = nullptr;
+		}
+
+		VkDescriptorSetLayoutBinding Sampler_Layout_Binding{};
+		{
+			Sampler_Layout_Binding.binding = 1;
+			Sampler_Layout_Binding.descriptorCount = this->m_Texture_Slot_Count;
+			Sampler_Layout_Binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+			Sampler_Layout_Binding.pImmutableSamplers = nullptr;
+			Sampler_Layout_Binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+		}
+
+		VkDescriptorSetLayoutBinding Instance_Layout_Binding{};
+		{
+			Instance_Layout_Binding.binding = 2;
+			Instance_Layout_Binding.descriptorCount = 1;
+			Instance_Layout_Binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+			Instance_Layout_Binding.pImmutableSamplers = nullptr;
+			Instance_Layout_Binding.stageFlags = this->Get_Geometry_Stage();
+		}
+
+		//NOTE : The Shared Vertex Buffer, Read By The Vertex Pulling Shaders And The Mesh Shader Only
+		VkDescriptorSetLayoutBinding Vertex_Layout_Binding{};
+		{
+			Vertex_Layout_Binding.binding = 3;
+			Vertex_Layout_Binding.descriptorCount = 1;
+			Vertex_Layout_Binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+			Vertex_Layout_Binding.pImmutableSamplers = nullptr;
+			Vertex_Layout_Binding.stageFlags = this->Get_Geometry_Stage();
+		}
+
+		vector<VkDescriptorSetLayoutBinding> Bindings{ Ubo_Layout_Binding, Sampler_Layout_Binding, Instance_Layout_Binding, Vertex_Layout_Binding };
+
+		//NOTE : Clusters, Meshlet Vertices, Meshlet Triangles And The Tasks The Cluster Pass Appended, In That Order
+		if (this->m_Mesh_Shading)
+			for (uint32_t Binding = 4; Binding < 8; ++Binding) {
+				VkDescriptorSetLayoutBinding Mesh_Layout_Binding{};
+				{
+					Mesh_Layout_Binding.binding = Binding;
+					Mesh_Layout_Binding.descriptorCount = 1;
+					Mesh_Layout_Binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+					Mesh_Layout_Binding.pImmutableSamplers = nullptr;
+					Mesh_Layout_Binding.stageFlags = VK_SHADER_STAGE_MESH_BIT_EXT;
+				}
+
+				Bindings.push_back(Mesh_Layout_Binding);
+			}
+
+		VkDescriptorSetLayoutCreateInfo Layout_Info{};
+		{
+			Layout_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+			Layout_Info.bindingCount = static_cast<uint32_t>(Bindings.size());
+			Layout_Info.pBindings = Bindings.data();
+		}
+
+		VkDescriptorSetLayout Descriptor_Set_Layout{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateDescriptorSetLayout(this->m_Logical_Device.get(), &Layout_Info, nullptr, &Descriptor_Set_Layout));
+
+		this->m_Descriptor_Set_Layout.get_deleter() = [Device = this->m_Logical_Device.get()](VkDescriptorSetLayout Descriptor_Set_Layout) {if (nullptr != Descriptor_Set_Layout) vkDestroyDescriptorSetLayout(Device, Descriptor_Set_Layout, nullptr); };
+		this->m_Descriptor_Set_Layout.reset(Descriptor_Set_Layout);
+	}
+
+	void Select_Vertex_Layout(void) {
+		Vertex_Layout Layout{};
+		{
+			Layout.Attributes = Vertex_Attribute_Mask;
+			Layout.Quantized = Vertex_Quantization_Enable;
+		}
+
+		this->m_Vertex_Pulling = Vertex_Pulling_Enable && std::filesystem::exists(std::filesystem::path(Pull_Vertex_Shader_File_Path, std::filesystem::path::generic_format));
+
+		//NOTE : Keep The Full Float Layout If The Matching Shader Variant Has Not Been Compiled, The Pulling Shader Decodes Every Layout
+		if (this->m_Vertex_Pulling || std::filesystem::exists(std::filesystem::path(Layout.Get_Vertex_Shader_File_Path(), std::filesystem::path::generic_format)))
+			this->m_Vertex_Layout = Layout;
+		else
+			this->m_Vertex_Layout = Vertex_Layout{};
+
+		const char* Instanced_Path{ this->m_Vertex_Pulling ? Pull_Instanced_Vertex_Shader_File_Path : this->m_Vertex_Layout.Get_Instanced_Vertex_Shader_File_Path() };
+		this->m_Instanced_Drawing = nullptr != Instanced_Path && std::filesystem::exists(std::filesystem::path(Instanced_Path, std::filesystem::path::generic_format));
+	}
+
+	//NOTE : GPU Culling Needs Per Instance Transforms In The Vertex Shader, Otherwise The CPU Culler Keeps Feeding Direct Draws
+	void Select_Culling_Path(void) {
+		this->m_Gpu_Culling =
+			Gpu_Culling_Enable &&
+			this->m_Instanced_Drawing &&
+			this->m_Device_Capabilities.Draw_Indirect_Count &&
+			this->m_Device_Capabilities.Multi_Draw_Indirect &&
+			this->m_Device_Capabilities.Draw_Indirect_First_Instance &&
+			this->m_Device_Capabilities.Compute_On_Graphics_Queue &&
+			std::filesystem::exists(std::filesystem::path(Cull_Compute_Shader_File_Path, std::filesystem::path::generic_format));
+
+		VkFormatProperties Depth_Format_Properties{};
+		vkGetPhysicalDeviceFormatProperties(this->m_Physical_Device, this->Find_Depth_Format(), &Depth_Format_Properties);
+
+		VkPhysicalDeviceProperties Device_Properties{};
+		vkGetPhysicalDeviceProperties(this->m_Physical_Device, &Device_Properties);
+
+		//NOTE : Pyramid Level 0 Is Read With sampler2DMS, So A Single Sample Depth Attachment Is Not Supported Here
+		this->m_Occlusion_Culling =
+			Occlusion_Culling_Enable &&
+			this->m_Gpu_Culling &&
+			VK_SAMPLE_COUNT_1_BIT != this->m_Msaa_Samples &&
+			0 != (Device_Properties.limits.sampledImageDepthSampleCounts & this->m_Msaa_Samples) &&
+			0 != (Depth_Format_Properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) &&
+			std::filesystem::exists(std::filesystem::path(Cull_Occlusion_Compute_Shader_File_Path, std::filesystem::path::generic_format)) &&
+			std::filesystem::exists(std::filesystem::path(Depth_Pyramid_Copy_Shader_File_Path, std::filesystem::path::generic_format)) &&
+			std::filesystem::exists(std::filesystem::path(Depth_Pyramid_Reduce_Shader_File_Path, std::filesystem::path::generic_format));
+
+		//NOTE : Two Phase Occlusion Keeps Culling Whole Instances, Clusters Only Refine The Frustum Only Path
+		this->m_Cluster_Culling =
+			Cluster_Culling_Enable &&
+			this->m_Gpu_Culling &&
+			!this->m_Occlusion_Culling &&
+			std::filesystem::exists(std::filesystem::path(Cull_Cluster_Compute_Shader_File_Path, std::filesystem::path::generic_format));
+
+		this->m_Mesh_Shading =
+			Mesh_Shader_Enable &&
+			this->m_Cluster_Culling &&
+			this->m_Device_Capabilities.Mesh_Shader &&
+			std::filesystem::exists(std::filesystem::path(Cull_Cluster_Mesh_Compute_Shader_File_Path, std::filesystem::path::generic_format)) &&
+			std::filesystem::exists(std::filesystem::path(Meshlet_Mesh_Shader_File_Path, std::filesystem::path::generic_format));
+	}
+
+	//NOTE : The Slot Count Is Baked Into The Pipeline Before Any Material Is Loaded, So It Is What The Device Allows Rather Than What The Model Needs
+	void Select_Texture_Slots(void) {
+		//NOTE : Indirect Draws Each Pick One Texture, But A Mesh Shader Workgroup Mixes Clusters Of Different Materials Across Its Invocations
+		const bool Indexing{
+			this->m_Mesh_Shading ?
+			this->m_Device_Capabilities.Sampler_Non_Uniform_Indexing && std::filesystem::exists(std::filesystem::path(Nonuniform_Fragment_Shader_File_Path, std::filesystem::path::generic_format)) :
+			this->m_Device_Capabilities.Sampler_Dynamic_Indexing };
+
+		this->m_Texture_Slot_Count = Indexing ? std::max(1u, std::min(Max_Material_Textures, this->m_Device_Capabilities.Max_Fragment_Samplers)) : 1;
+		this->m_Fragment_Shader_Path = this->m_Mesh_Shading && 1 < this->m_Texture_Slot_Count ? Nonuniform_Fragment_Shader_File_Path : Fragment_Shader_File_Path;
+	}
+
+	//NOTE : The Stage That Positions Vertices, It Reads The Scene Uniforms, Instances, Pulled Vertices And Push Constants
+	const VkShaderStageFlags Get_Geometry_Stage(void) const {
+		return this->m_Mesh_Shading ? VK_SHADER_STAGE_MESH_BIT_EXT : VK_SHADER_STAGE_VERTEX_BIT;
+	}
+
+	void Create_GraphicsPipeline(void) {
+		const char* Vertex_Shader_Path{
+			this->m_Mesh_Shading ? Meshlet_Mesh_Shader_File_Path :
+			this->m_Vertex_Pulling ? (this->m_Instanced_Drawing ? Pull_Instanced_Vertex_Shader_File_Path : Pull_Vertex_Shader_File_Path) :
+			this->m_Instanced_Drawing ? this->m_Vertex_Layout.Get_Instanced_Vertex_Shader_File_Path() : this->m_Vertex_Layout.Get_Vertex_Shader_File_Path() };
+
+		VkPushConstantRange Pull_Constant_Range{};
+		{
+			Pull_Constant_Range.stageFlags = this->Get_Geometry_Stage();
+			Pull_Constant_Range.offset = 0;
+			Pull_Constant_Range.size = sizeof(Vertex_Pull_Constants);
+		}
+
+		//NOTE : The Mesh Shader Decodes Vertices Just Like The Pulling Shaders, So It Takes The Same Constants
+		const bool Pushes_Layout{ this->m_Vertex_Pulling || this->m_Mesh_Shading };
+
+		VkDescriptorSetLayout Set_Layouts[] = { this->m_Descriptor_Set_Layout.get() };
+		VkPipelineLayoutCreateInfo Pipeline_Layout_Info{};
+		{
+			Pipeline_Layout_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+			Pipeline_Layout_Info.setLayoutCount = 1;
+			Pipeline_Layout_Info.pSetLayouts = Set_Layouts;
+			Pipeline_Layout_Info.pushConstantRangeCount = Pushes_Layout ? 1 : 0;
+			Pipeline_Layout_Info.pPushConstantRanges = Pushes_Layout ? &Pull_Constant_Range : nullptr;
+		}
+
+		VkPipelineLayout Pipeline_Layout{ nullptr };
+		THROW_IF_VK_FAILED(vkCreatePipelineLayout(this->m_Logical_Device.get(), &Pipeline_Layout_Info, nullptr, &Pipeline_Layout));
+
+		this->m_Pipeline_Layout.get_deleter() = [Device = this->m_Logical_Device.get()](VkPipelineLayout Pipeline_Layout) {if (nullptr != Pipeline_Layout) vkDestroyPipelineLayout(Device, Pipeline_Layout, nullptr); };
+		this->m_Pipeline_Layout.reset(Pipeline_Layout);
+
+		Graphics_Pipeline_Desc Desc{};
+		{
+			Desc.Layout = this->m_Pipeline_Layout.get();
+			Desc.Vertices = this->m_Vertex_Layout;
+			Desc.Vertex_Pulling = this->m_Vertex_Pulling;
+			Desc.Mesh_Shading = this->m_Mesh_Shading;
+			Desc.Samples = this->m_Msaa_Samples;
+			Desc.Color_Format = this->m_Swap_Chain_Image_Format;
+			Desc.Depth_Format = this->Find_Depth_Format();
+			Desc.Material = this->m_Scene_Material;
+			Desc.Texture_Count = this->m_Texture_Slot_Count;
+		}
+
+		Desc = this->m_Extended_Dynamic_State.Get_Baked_Desc(Desc);
+		cout << "Graphics pipeline: " << (this->m_Mesh_Shading ? "meshlets drawn by a mesh shader" : this->m_Vertex_Pulling ? "vertices pulled from a storage buffer" : "fixed function vertex fetch") << ", " << Vertex_Shader_Path << endl;
+		cout << "Graphics pipeline: extended dynamic state level " << this->m_Extended_Dynamic_State.Level << ", " << Desc.Dynamic_States.size() << " material states set while recording" << endl;
+		cout << "Graphics pipeline: " << this->m_Texture_Slot_Count << " material texture slots, " << this->m_Fragment_Shader_Path << endl;
+
+		//NOTE : Mesh Pipelines Are Built Whole, Without A Vertex Input Part The Library Split Below Does Not Apply
+		if (!this->m_Pipeline_Library || this->m_Mesh_Shading) {
+			//NOTE : Built Against Its Own Compatible Render Pass, So A Resize During The Compile Cannot Pull One Away
+			this->Compile_Pipeline(this->m_Graphics_Pipeline, [this, Desc, Vertex_Shader_Path, Fragment_Shader_Path = this->m_Fragment_Shader_Path, Dynamic_Rendering = this->m_Dynamic_Rendering](VkPipelineCache Pipeline_Cache) {
+				Graphics_Pipeline_Desc Variant{ Desc };
+				{
+					Variant.Vertex_Shader = this->Create_Shader_Module(Read_File(std::filesystem::path(Vertex_Shader_Path, std::filesystem::path::generic_format)));
+					Variant.Fragment_Shader = this->Create_Shader_Module(Read_File(std::filesystem::path(Fragment_Shader_Path, std::filesystem::path::generic_format)));
+					Variant.Render_Pass = Dynamic_Rendering ? VK_NULL_HANDLE : Scene_Pass::Build_Render_Pass(this->m_Logical_Device.get(), Desc.Color_Format, Desc.Depth_Format, Desc.Samples, Render_Pass_Complete);
+				}
+
+				const VkPipeline Pipeline{ Graphics_Pipeline_Builder{ Variant }.Create(this->m_Logical_Device.get(), Pipeline_Cache) };
+
+				vkDestroyRenderPass(this->m_Logical_Device.get(), Variant.Render_Pass, nullptr);
+				vkDestroyShaderModule(this->m_Logical_Device.get(), Variant.Fragment_Shader, nullptr);
+				vkDestroyShaderModule(this->m_Logical_Device.get(), Variant.Vertex_Shader, nullptr);
+				return Pipeline;
+			});
+
+			return;
+		}
+
+		const auto& Vertex_Shader_Code = Read_File(std::filesystem::path(Vertex_Shader_Path, std::filesystem::path::generic_format));
+		const auto& Fragment_Shader_Code = Read_File(std::filesystem::path(this->m_Fragment_Shader_Path, std::filesystem::path::generic_format));
+
+		{
+			Desc.Vertex_Shader = Create_Shader_Module(Vertex_Shader_Code);
+			Desc.Fragment_Shader = Create_Shader_Module(Fragment_Shader_Code);
+			Desc.Render_Pass = this->m_Dynamic_Rendering ? VK_NULL_HANDLE : this->m_Render_Pass.get();
+		}
+
+		const Graphics_Pipeline_Builder Builder{ Desc };
+		const auto Delete_Pipeline = [Device = this->m_Logical_Device.get()](VkPipeline Pipeline) {if (nullptr != Pipeline) vkDestroyPipeline(Device, Pipeline, nullptr); };
+
+		const auto Start_Time{ chrono::high_resolution_clock::now() };
+
+		//NOTE : The Four Parts Compile Side By Side On The Workers, The Fast Link Needs Them All
+		vector<shared_future<VkPipeline>> Parts{};
+		for (const auto Part : Graphics_Pipeline_Builder::Library_Parts)
+			Parts.push_back(this->m_Pipeline_Manager.Submit([&Builder, Part, Device = this->m_Logical_Device.get()](VkPipelineCache Pipeline_Cache) {
+				return Builder.Create_Library(Device, Pipeline_Cache, Part);
+			}));
+
+		//NOTE : Every Part Borrows The Builder, So All Of Them Finish Before A Failed One Rethrows
+		for (const auto& Part : Parts)
+			Part.wait();
+
+		vector<VkPipeline> Libraries{};
+		for (const auto& Part : Parts) {
+			this->m_Pipeline_Libraries.emplace_back(Part.get(), Delete_Pipeline);
+			Libraries.push_back(this->m_Pipeline_Libraries.back().get());
+		}
+
+		const auto Link_Time{ chrono::high_resolution_clock::now() };
+
+		this->m_Graphics_Pipeline.get_deleter() = Delete_Pipeline;
+		this->m_Graphics_Pipeline.reset(Graphics_Pipeline_Builder::Link(this->m_Logical_Device.get(), VK_NULL_HANDLE, this->m_Pipeline_Layout.get(), Libraries, false));
+
+		const auto End_Time{ chrono::high_resolution_clock::now() };
+		cout << "Graphics pipeline: libraries " << chrono::duration<double, milli>(Link_Time - Start_Time).count() << " ms, fast link " << chrono::duration<double, milli>(End_Time - Link_Time).count() << " ms" << endl;
+
+		//NOTE : Frames Draw With The Fast Linked Pipeline Until The Optimized Link Is Adopted
+		this->Compile_Pipeline(this->m_Graphics_Pipeline, [Device = this->m_Logical_Device.get(), Layout = this->m_Pipeline_Layout.get(), Libraries](VkPipelineCache Pipeline_Cache) {
+			return Graphics_Pipeline_Builder::Link(Device, Pipeline_Cache, Layout, Libraries, true);
+		});
+
+		vkDestroyShaderModule(this->m_Logical_Device.get(), Desc.Fragment_Shader, nullptr);
+		vkDestroyShaderModule(this->m_Logical_Device.get(), Desc.Vertex_Shader, nullptr);
+	}
+
+	void Create_Command_Pool(void) {
+		VkCommandPoolCreateInfo Command_Pool_Info{};
+		{
+			Command_Pool_Info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+			Command_Pool_Info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+			Command_Pool_Info.queueFamilyIndex = this->m_Queue_Family_Indices.Graphics_Family;
+		}
+
+		VkCommandPool Command_Pool{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateCommandPool(this->m_Logical_Device.get(), &Command_Pool_Info, nullptr, &Command_Pool));
+
+		this->m_Command_Pool.get_deleter() = [Device = this->m_Logical_Device.get()](VkCommandPool Command_Pool) {if (nullptr != Command_Pool) vkDestroyCommandPool(Device, Command_Pool, nullptr); };
+		this->m_Command_Pool.reset(Command_Pool);
+	}
+
+	void Create_Color_Resource(void) {
+		this->m_Graph_Color = this->m_Render_Graph.Create_Image("Multisampled Color",
+			this->Build_Image_Info(this->m_Swap_Chain_Extent.width, this->m_Swap_Chain_Extent.height, 1, this->m_Swap_Chain_Image_Format, this->m_Msaa_Samples,
+				VK_IMAGE_TILING_OPTIMAL, this->Get_Attachment_Usage(VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT)),
+			VK_IMAGE_ASPECT_COLOR_BIT,
+			this->Get_Attachment_Memory_Properties());
+	}
+
+	//NOTE : Occlusion Culling Stores Color And Depth Across Two Passes And Samples Depth, So Neither Can Be Transient Then
+	const bool Are_Attachments_Transient(void) const {
+		return !this->m_Occlusion_Culling;
+	}
+
+	const VkImageUsageFlags Get_Attachment_Usage(VkImageUsageFlags Usage) const {
+		return this->Are_Attachments_Transient() ? Usage | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT : Usage;
+	}
+
+	const VkMemoryPropertyFlags Get_Attachment_Memory_Properties(void) const {
+		return this->Are_Attachments_Transient() ? VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+	}
+
+	void Report_Attachment_Policy(void) {
+		VkMemoryRequirements Memory_Requirements{};
+		vkGetImageMemoryRequirements(this->m_Logical_Device.get(), this->m_Render_Graph.Get_Image(this->m_Graph_Color), &Memory_Requirements);
+
+		const bool Lazily_Allocated{ this->Are_Attachments_Transient() && this->Has_Memory_Type(Memory_Requirements.memoryTypeBits, this->Get_Attachment_Memory_Properties()) };
+		cout << "Attachments: " << (this->Are_Attachments_Transient() ? "transient" : "stored") << ", " << (Lazily_Allocated ? "lazily allocated" : "device local") << " memory" << endl;
+
+		VkPhysicalDeviceProperties Device_Properties{};
+		vkGetPhysicalDeviceProperties(this->m_Physical_Device, &Device_Properties);
+		const VkSampleCountFlags Sample_Counts{ Device_Properties.limits.framebufferColorSampleCounts & Device_Properties.limits.framebufferDepthSampleCounts };
+
+		Attachment_Policy::Report(this->m_Swap_Chain_Extent, this->m_Swap_Chain_Image_Format, this->Find_Depth_Format(), Sample_Counts, Lazily_Allocated, this->Are_Attachments_Transient());
+		Attachment_Policy::Report({ 3840, 2160 }, this->m_Swap_Chain_Image_Format, this->Find_Depth_Format(), Sample_Counts, Lazily_Allocated, this->Are_Attachments_Transient());
+	}
+
+	const VkFormat Find_Depth_Format(void) {
+		return this->Find_Supported_Format(
+			{ VK_FORMAT_D32_SFLOAT,VK_FORMAT_D32_SFLOAT_S8_UINT,VK_FORMAT_D24_UNORM_S8_UINT },
+			VK_IMAGE_TILING_OPTIMAL,
+			VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT
+		);
+	}
+
+	void Create_Depth_Resource(void) {
+		this->m_Graph_Depth = this->m_Render_Graph.Create_Image("Multisampled Depth",
+			this->Build_Image_Info(this->m_Swap_Chain_Extent.width, this->m_Swap_Chain_Extent.height, 1, this->Find_Depth_Format(), this->m_Msaa_Samples,
+				VK_IMAGE_TILING_OPTIMAL, this->Get_Attachment_Usage(VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | (this->m_Occlusion_Culling ? VK_IMAGE_USAGE_SAMPLED_BIT : 0))),
+			VK_IMAGE_ASPECT_DEPTH_BIT,
+			this->Get_Attachment_Memory_Properties());
+	}
+
+	//NOTE : Rebuilt With The Swap Chain, Each Culling Path Declares Its Passes Here And The Graph Works Out Their Barriers And Attachment Memory
+	void Create_Render_Graph(void) {
+		this->m_Render_Graph.Reset();
+
+		this->Create_Color_Resource();
+		this->Create_Depth_Resource();
+		//NOTE : Acquire Is Waited On At Color Attachment Output, So Dynamic Rendering Starts The Swap Chain There
+		this->m_Graph_Swap_Chain = this->m_Render_Graph.Import_Image("Swap Chain", VK_IMAGE_ASPECT_COLOR_BIT, 1, false, Render_Graph_Access_Present,
+			this->m_Dynamic_Rendering ? Render_Graph_Access_Color_Attachment : Render_Graph_Access_None);
+
+		const uint32_t Color{ this->m_Graph_Color }, Depth{ this->m_Graph_Depth }, Swap_Chain{ this->m_Graph_Swap_Chain };
+
+		if (this->m_Occlusion_Culling) {
+			const uint32_t Draw_Commands{ this->m_Render_Graph.Import_Buffer("Draw Commands", false) };
+			const uint32_t Late_Draw_Commands{ this->m_Render_Graph.Import_Buffer("Late Draw Commands", false) };
+			const uint32_t Occlusion_States{ this->m_Render_Graph.Import_Buffer("Occlusion States", true) };
+			const uint32_t Occlusion_Statistics{ this->m_Render_Graph.Import_Buffer("Occlusion Statistics", false, Render_Graph_Access_Host_Read) };
+			this->m_Graph_Depth_Pyramid = this->m_Render_Graph.Import_Image("Depth Pyramid", VK_IMAGE_ASPECT_COLOR_BIT, Gpu_Culling::Get_Pyramid_Level_Count(this->m_Swap_Chain_Extent), true);
+
+			this->m_Render_Graph.Add_Pass("Reset Draw Counts", {
+				Render_Graph::Use(Draw_Commands, Render_Graph_Access_Transfer_Write),
+				Render_Graph::Use(Late_Draw_Commands, Render_Graph_Access_Transfer_Write),
+				Render_Graph::Use(Occlusion_Statistics, Render_Graph_Access_Transfer_Write) },
+				[this](VkCommandBuffer Command_Buffer) { this->Record_Draw_Count_Reset(Command_Buffer); });
+
+			this->m_Render_Graph.Add_Pass("Early Cull", {
+				Render_Graph::Use(Draw_Commands, Render_Graph_Access_Compute_Read_Write),
+				Render_Graph::Use(Occlusion_States, Render_Graph_Access_Compute_Read_Write),
+				Render_Graph::Use(Occlusion_Statistics, Render_Graph_Access_Compute_Read_Write),
+				Render_Graph::Use(this->m_Graph_Depth_Pyramid, Render_Graph_Access_Compute_Read) },
+				[this](VkCommandBuffer) { this->Record_Occlusion_Culling(Render_Pass_Early); });
+
+			//NOTE : The Early Pass Dependency Hands Depth To The Pyramid Build In DEPTH_STENCIL_READ_ONLY_OPTIMAL
+			//NOTE : Dynamic Rendering Skips The Resolve Here, So The Swap Chain Is First Touched By The Late Pass
+			vector<Render_Graph_Use> Early_Uses{ Render_Graph::Use(Draw_Commands, Render_Graph_Access_Indirect_Read) };
+			if (this->m_Dynamic_Rendering)
+				Early_Uses.insert(Early_Uses.end(), {
+					Render_Graph::Discard(Color, Render_Graph_Access_Color_Attachment),
+					Render_Graph::Discard(Depth, Render_Graph_Access_Depth_Attachment) });
+			else
+				Early_Uses.insert(Early_Uses.end(), {
+					Render_Graph::Attachment(Color, Render_Graph_Access_Color_Attachment, VK_IMAGE_LAYOUT_UNDEFINED, Render_Graph_Access_Color_Attachment),
+					Render_Graph::Attachment(Depth, Render_Graph_Access_Depth_Attachment, VK_IMAGE_LAYOUT_UNDEFINED, Render_Graph_Access_Compute_Depth_Read),
+					Render_Graph::Attachment(Swap_Chain, Render_Graph_Access_Color_Attachment, VK_IMAGE_LAYOUT_UNDEFINED, Render_Graph_Access_Color_Attachment) });
+
+			this->m_Render_Graph.Add_Pass("Early Scene", Early_Uses,
+				[this](VkCommandBuffer Command_Buffer) { this->Record_Scene_Pass(Command_Buffer, Render_Pass_Early, this->m_Draw_Buffers[this->m_Current_Frame].get()); });
+
+			this->m_Render_Graph.Add_Pass("Depth Pyramid", {
+				Render_Graph::Use(Depth, Render_Graph_Access_Compute_Depth_Read),
+				Render_Graph::Use(this->m_Graph_Depth_Pyramid, Render_Graph_Access_Compute_Read_Write) },
+				[this](VkCommandBuffer Command_Buffer) { this->Record_Depth_Pyramid(Command_Buffer); });
+
+			this->m_Render_Graph.Add_Pass("Late Cull", {
+				Render_Graph::Use(this->m_Graph_Depth_Pyramid, Render_Graph_Access_Compute_Read),
+				Render_Graph::Use(Occlusion_States, Render_Graph_Access_Compute_Read),
+				Render_Graph::Use(Occlusion_Statistics, Render_Graph_Access_Compute_Read_Write),
+				Render_Graph::Use(Late_Draw_Commands, Render_Graph_Access_Compute_Read_Write) },
+				[this](VkCommandBuffer) { this->Record_Occlusion_Culling(Render_Pass_Late); });
+
+			//NOTE : The Late Pass Dependency Also Waits For The Pyramid Build Still Sampling Depth
+			vector<Render_Graph_Use> Late_Uses{ Render_Graph::Use(Late_Draw_Commands, Render_Graph_Access_Indirect_Read) };
+			if (this->m_Dynamic_Rendering)
+				Late_Uses.insert(Late_Uses.end(), {
+					Render_Graph::Use(Color, Render_Graph_Access_Color_Attachment),
+					Render_Graph::Use(Depth, Render_Graph_Access_Depth_Attachment),
+					Render_Graph::Discard(Swap_Chain, Render_Graph_Access_Color_Attachment) });
+			else
+				Late_Uses.insert(Late_Uses.end(), {
+					Render_Graph::Attachment(Color, Render_Graph_Access_Color_Attachment, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, Render_Graph_Access_Color_Attachment),
+					Render_Graph::Attachment(Depth, Render_Graph_Access_Depth_Attachment, VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL, Render_Graph_Access_Depth_Attachment),
+					Render_Graph::Attachment(Swap_Chain, Render_Graph_Access_Color_Attachment, VK_IMAGE_LAYOUT_UNDEFINED, Render_Graph_Access_Present) });
+
+			this->m_Render_Graph.Add_Pass("Late Scene", Late_Uses,
+				[this](VkCommandBuffer Command_Buffer) { this->Record_Scene_Pass(Command_Buffer, Render_Pass_Late, this->m_Late_Draw_Buffers[this->m_Current_Frame].get()); });
+		}
+		else {
+			vector<Render_Graph_Use> Scene_Uses{};
+			if (this->m_Dynamic_Rendering)
+				Scene_Uses = {
+					Render_Graph::Discard(Color, Render_Graph_Access_Color_Attachment),
+					Render_Graph::Discard(Depth, Render_Graph_Access_Depth_Attachment),
+					Render_Graph::Discard(Swap_Chain, Render_Graph_Access_Color_Attachment) };
+			else
+				Scene_Uses = {
+					Render_Graph::Attachment(Color, Render_Graph_Access_Color_Attachment, VK_IMAGE_LAYOUT_UNDEFINED, Render_Graph_Access_Color_Attachment),
+					Render_Graph::Attachment(Depth, Render_Graph_Access_Depth_Attachment, VK_IMAGE_LAYOUT_UNDEFINED, Render_Graph_Access_Depth_Attachment),
+					Render_Graph::Attachment(Swap_Chain, Render_Graph_Access_Color_Attachment, VK_IMAGE_LAYOUT_UNDEFINED, Render_Graph_Access_Present) };
+
+			if (this->m_Gpu_Culling) {
+				const uint32_t Draw_Commands{ this->m_Render_Graph.Import_Buffer("Draw Commands", false) };
+
+				this->m_Render_Graph.Add_Pass("Reset Draw Count", { Render_Graph::Use(Draw_Commands, Render_Graph_Access_Transfer_Write) },
+					[this](VkCommandBuffer Command_Buffer) { this->Record_Draw_Count_Reset(Command_Buffer); });
+				this->m_Render_Graph.Add_Pass("Cull", { Render_Graph::Use(Draw_Commands, Render_Graph_Access_Compute_Read_Write) },
+					[this](VkCommandBuffer) { this->Record_Gpu_Culling(); });
+
+				//NOTE : Mesh Tasks Are Both The Indirect Grid And A Buffer The Mesh Shader Reads
+				Scene_Uses.push_back(Render_Graph::Use(Draw_Commands, this->m_Mesh_Shading ? Render_Graph_Access_Mesh_Task_Read : Render_Graph_Access_Indirect_Read));
+			}
+
+			this->m_Render_Graph.Add_Pass("Scene", Scene_Uses,
+				[this](VkCommandBuffer Command_Buffer) { this->Record_Scene_Pass(Command_Buffer, Render_Pass_Complete, this->m_Gpu_Culling ? this->m_Draw_Buffers[this->m_Current_Frame].get() : nullptr); });
+		}
+
+		this->m_Render_Graph.Compile([this](Render_Graph_Resource& Resource) {
+			VkImage Image{ nullptr };
+			THROW_IF_VK_FAILED(vkCreateImage(this->m_Logical_Device.get(), &Resource.Image_Info, nullptr, &Image));
+
+			Resource.Owned_Image.get_deleter() = [Device = this->m_Logical_Device.get()](VkImage Image) {if (nullptr != Image) vkDestroyImage(Device, Image, nullptr); };
+			Resource.Owned_Image.reset(Image);
+			Resource.Image = Image;
+
+			VkMemoryRequirements Memory_Requirements{};
+			vkGetImageMemoryRequirements(this->m_Logical_Device.get(), Image, &Memory_Requirements);
+			return Memory_Requirements;
+		});
+
+		this->m_Render_Graph.Allocate(this->m_Logical_Device.get(), [this](uint32_t Type_Filter, VkMemoryPropertyFlags Property_Flags) { return this->Find_Image_Memory_Type(Type_Filter, Property_Flags); });
+
+		const auto Delete_Image_View = [Device = this->m_Logical_Device.get()](VkImageView Image_View) {if (nullptr != Image_View) vkDestroyImageView(Device, Image_View, nullptr); };
+
+		this->m_Color_Image_View.get_deleter() = Delete_Image_View;
+		this->m_Color_Image_View.reset(this->Create_Image_View(this->m_Render_Graph.Get_Image(Color), 1, this->m_Swap_Chain_Image_Format, VK_IMAGE_ASPECT_COLOR_BIT));
+
+		this->m_Depth_Image_View.get_deleter() = Delete_Image_View;
+		this->m_Depth_Image_View.reset(this->Create_Image_View(this->m_Render_Graph.Get_Image(Depth), 1, this->Find_Depth_Format(), VK_IMAGE_ASPECT_DEPTH_BIT));
+	}
+
+	void Create_Frame_Buffers(void) {
+		this->m_Swap_Chain_Frame_buffers.resize(this->m_Swap_Chain_Image_Views.size());
+
+		for (size_t Index = 0; Index < this->m_Swap_Chain_Image_Views.size(); ++Index) {
+			array<VkImageView, 3> Attachments{ this->m_Color_Image_View.get(),this->m_Depth_Image_View.get(),this->m_Swap_Chain_Image_Views[Index].get()
+			};
+
+			VkFramebufferCreateInfo Framebuffer_Info{};
+			{
+				Framebuffer_Info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+				Framebuffer_Info.renderPass = this->m_Render_Pass.get();
+				Framebuffer_Info.attachmentCount = static_cast<uint32_t>(Attachments.size());
+				Framebuffer_Info.pAttachments = Attachments.data();
+				Framebuffer_Info.width = this->m_Swap_Chain_Extent.width;
+				Framebuffer_Info.height = this->m_Swap_Chain_Extent.height;
+				Framebuffer_Info.layers = 1;
+			}
+
+			VkFramebuffer Framebuffer{ nullptr };
+			THROW_IF_VK_FAILED(vkCreateFramebuffer(this->m_Logical_Device.get(), &Framebuffer_Info, nullptr, &Framebuffer));
+
+			this->m_Swap_Chain_Frame_buffers[Index].get_deleter() = [Device = this->m_Logical_Device.get()](VkFramebuffer Framebuffer) {if (nullptr != Framebuffer) vkDestroyFramebuffer(Device, Framebuffer, nullptr); };
+			this->m_Swap_Chain_Frame_buffers[Index].reset(Framebuffer);
+		}
+	}
+
+	//NOTE : Slot 0 Is The Model Texture, Materials Without A Texture Of Their Own, Whose Texture Fails To Load Or That Find No Free Slot Draw With It
+	void Create_Texture_Images(void) {
+		const Mesh_Material Default_Material{ Model_Data::Get_Default_Material() };
+		if (!this->Create_Texture_Image(Default_Material))
+			throw runtime_error("Failed to load texture image!");
+
+		//NOTE : Images Embedded In A GLB Are Keyed By The File And Their Index In It
+		const auto Get_Texture_Key = [](const Mesh_Material& Material) { return 0 <= Material.Embedded_Image ? Material.Texture_Path + "#" + to_string(Material.Embedded_Image) : Material.Texture_Path; };
+		unordered_map<string, uint32_t> Texture_Slots{ { Get_Texture_Key(Default_Material), 0 } };
+		uint32_t Fallback_Count{ 0 };
+
+		this->m_Material_Texture_Slots.assign(this->m_Materials.size(), 0);
+		for (size_t Material = 0; Material < this->m_Materials.size(); ++Material) {
+			if (this->m_Materials[Material].Texture_Path.empty())
+				continue;
+
+			const string Path{ Get_Texture_Key(this->m_Materials[Material]) };
+			if (const auto Slot{ Texture_Slots.find(Path) }; Texture_Slots.end() != Slot) {
+				this->m_Material_Texture_Slots[Material] = Slot->second;
+				continue;
+			}
+
+			const bool Loaded{ this->m_Texture_Images.size() < this->m_Texture_Slot_Count && this->Create_Texture_Image(this->m_Materials[Material]) };
+			Texture_Slots[Path] = Loaded ? static_cast<uint32_t>(this->m_Texture_Images.size() - 1) : 0;
+			this->m_Material_Texture_Slots[Material] = Texture_Slots[Path];
+			Fallback_Count += Loaded ? 0 : 1;
+		}
+
+		this->m_Barrier_Builder.Report("Texture upload");
+		cout << "Material textures: " << this->m_Materials.size() << " materials, " << this->m_Texture_Images.size() << " textures in " << this->m_Texture_Slot_Count << " slots";
+		if (0 != Fallback_Count)
+			cout << ", " << Fallback_Count << " missing or without a slot drawn with the model texture";
+		cout << endl;
+	}
+
+	//NOTE : Appends To The Texture Set, An Image That Does Not Load Is Left To The Caller
+	const bool Create_Texture_Image(const Mesh_Material& Material) {
+		int Width{ 0 }, Height{ 0 }, Channels{ 0 };
+		stbi_uc* Pixels = 0 <= Material.Embedded_Image ? Glb_Loader::Load_Image(Material.Texture_Path, static_cast<uint32_t>(Material.Embedded_Image), &Width, &Height) : stbi_load(
+			Material.Texture_Path.c_str(),
+			&Width,
+			&Height,
+			&Channels,
+			STBI_rgb_alpha
+		);
+		if (nullptr == Pixels)
+			return false;
+
+		const uint32_t Mip_Levels{ static_cast<uint32_t>(std::floor(std::log2(std::max(Width, Height)))) + 1 };
+
+		VkDeviceSize Image_Size = static_cast<VkDeviceSize>(Width) * static_cast<VkDeviceSize>(Height) * 4;
+
+		VkBuffer Staging_Buffer{ nullptr };
+		VkDeviceMemory Staging_Buffer_Memory{ nullptr };
+		this->Create_Buffer(
+			Image_Size,
+			VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+			VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			Staging_Buffer,
+			Staging_Buffer_Memory
+		);
+
+		void* Data{ nullptr };
+		THROW_IF_VK_FAILED(vkMapMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory, 0, Image_Size, 0, &Data));
+		memcpy(Data, Pixels, static_cast<size_t>(Image_Size));
+		vkUnmapMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory);
+
+		stbi_image_free(Pixels);
+
+		VkImage Texture_Image{ nullptr };
+		VkDeviceMemory Texture_Image_Memory{ nullptr };
+		this->Create_Image(
+			Width, Height,
+			Mip_Levels,
+			VK_FORMAT_R8G8B8A8_SRGB,
+			VK_SAMPLE_COUNT_1_BIT,
+			VK_IMAGE_TILING_OPTIMAL,
+			VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+			Texture_Image,
+			Texture_Image_Memory
+		);
+
+		this->m_Texture_Images.emplace_back(Texture_Image, [Device = this->m_Logical_Device.get()](VkImage Texture_Image) {if (nullptr != Texture_Image) vkDestroyImage(Device, Texture_Image, nullptr); });
+		this->m_Texture_Image_Memories.emplace_back(Texture_Image_Memory, [Device = this->m_Logical_Device.get()](VkDeviceMemory Texture_Image_Memory) {if (nullptr != Texture_Image_Memory) vkFreeMemory(Device, Texture_Image_Memory, nullptr); });
+		this->m_Texture_Mip_Levels.push_back(Mip_Levels);
+
+		//NOTE : Upload, Mip Chain And Final Transition Share One Command Buffer, Each Flush Is The Only Barrier Between Dependent Transfers
+		VkCommandBuffer Command_Buffer{ this->Begin_SingleTime_Commands() };
+
+		this->m_Barrier_Builder.Track_Image(Texture_Image, VK_IMAGE_ASPECT_COLOR_BIT, Mip_Levels, 1);
+		this->m_Barrier_Builder.Image(Texture_Image, 0, 1, VK_PIPELINE_STAGE_2_COPY_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+		if (1 < Mip_Levels)
+			this->m_Barrier_Builder.Image(Texture_Image, 1, Mip_Levels - 1, VK_PIPELINE_STAGE_2_BLIT_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+		this->m_Barrier_Builder.Flush(Command_Buffer);
+
+		this->Copy_Buffer_To_Image(Command_Buffer, Staging_Buffer, Texture_Image, static_cast<uint32_t>(Width), static_cast<uint32_t>(Height));
+
+		this->Generate_Mipmaps(Command_Buffer, Texture_Image, VK_FORMAT_R8G8B8A8_SRGB, Width, Height, Mip_Levels);
+
+		this->m_Barrier_Builder.Image(Texture_Image, 0, Mip_Levels, VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_ACCESS_2_SHADER_SAMPLED_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		this->m_Barrier_Builder.Flush(Command_Buffer);
+		this->m_Barrier_Builder.Forget_Image(Texture_Image);
+
+		this->End_SingleTime_Commands(Command_Buffer);
+
+		vkDestroyBuffer(this->m_Logical_Device.get(), Staging_Buffer, nullptr);
+		vkFreeMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory, nullptr);
+
+		return true;
+	}
+
+	//NOTE : Each Level Is Blitted From The One Above It, Which Only That Level's Barrier Has To Wait For
+	void Generate_Mipmaps(VkCommandBuffer Command_Buffer, VkImage Image, VkFormat Image_Format, int32_t Width, int32_t Height, uint32_t Mip_Levels) {
+		VkFormatProperties Format_Properties{};
+		vkGetPhysicalDeviceFormatProperties(this->m_Physical_Device, Image_Format, &Format_Properties);
+
+		if (!(Format_Properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT))
+			throw runtime_error("Texture image format does not support linear blitting!");
+
+		int32_t Mip_Width = Width, Mip_Height = Height;
+		for (uint32_t Mip_Level = 1; Mip_Level < Mip_Levels; ++Mip_Level) {
+			this->m_Barrier_Builder.Image(Image, Mip_Level - 1, 1, VK_PIPELINE_STAGE_2_BLIT_BIT, VK_ACCESS_2_TRANSFER_READ_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+			this->m_Barrier_Builder.Flush(Command_Buffer);
+
+			VkImageBlit Blit{};
+			{
+				{
+					Blit.srcOffsets[0] = { 0,0,0 };
+					Blit.srcOffsets[1] = { Mip_Width,Mip_Height,1 };
+					Blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+					Blit.srcSubresource.mipLevel = Mip_Level - 1;
+					Blit.srcSubresource.baseArrayLayer = 0;
+					Blit.srcSubresource.layerCount = 1;
+				}
+
+				{
+					Blit.dstOffsets[0] = { 0,0,0 };
+					Blit.dstOffsets[1] = {
+						Mip_Width > 1 ? Mip_Width / 2 : 1,
+						Mip_Height > 1 ? Mip_Height / 2 : 1,
+						1
+					};
+					Blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+					Blit.dstSubresource.mipLevel = Mip_Level;
+					Blit.dstSubresource.baseArrayLayer = 0;
+					Blit.dstSubresource.layerCount = 1;
+				}
+			}
+
+			vkCmdBlitImage(
+				Command_Buffer,
+				Image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+				Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+				1, &Blit,
+				VK_FILTER_LINEAR
+			);
+
+			if (Mip_Width > 1) Mip_Width /= 2;
+			if (Mip_Height > 1) Mip_Height /= 2;
+		}
+	}
+
+	void Create_Texture_Image_Views(void) {
+		for (size_t Index = 0; Index < this->m_Texture_Images.size(); ++Index) {
+			VkImageView Texture_Image_View{ this->Create_Image_View(
+				this->m_Texture_Images[Index].get(),
+				this->m_Texture_Mip_Levels[Index],
+				VK_FORMAT_R8G8B8A8_SRGB,
+				VK_IMAGE_ASPECT_COLOR_BIT)
+			};
+
+			this->m_Texture_Image_Views.emplace_back(Texture_Image_View, [Device = this->m_Logical_Device.get()](VkImageView Texture_Image_View) {if (nullptr != Texture_Image_View) vkDestroyImageView(Device, Texture_Image_View, nullptr); });
+		}
+	}
+
+	void Create_Texture_Sampler(void) {
+		VkPhysicalDeviceProperties Properties{};
+		vkGetPhysicalDeviceProperties(this->m_Physical_Device, &Properties);
+
+		VkSamplerCreateInfo Sampler_Info{};
+		{
+			Sampler_Info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+			Sampler_Info.magFilter = VK_FILTER_LINEAR;
+			Sampler_Info.minFilter = VK_FILTER_LINEAR;
+			Sampler_Info.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+			Sampler_Info.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+			Sampler_Info.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+			Sampler_Info.anisotropyEnable = VK_TRUE;
+			Sampler_Info.maxAnisotropy = Properties.limits.maxSamplerAnisotropy;
+			Sampler_Info.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
+			Sampler_Info.unnormalizedCoordinates = VK_FALSE;
+			Sampler_Info.compareEnable = VK_FALSE;
+			Sampler_Info.compareOp = VK_COMPARE_OP_ALWAYS;
+			Sampler_Info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+			Sampler_Info.mipLodBias = 0.0f;
+			Sampler_Info.minLod = 0.0f;
+			Sampler_Info.maxLod = VK_LOD_CLAMP_NONE;
+		}
+
+		VkSampler Sampler{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateSampler(this->m_Logical_Device.get(), &Sampler_Info, nullptr, &Sampler));
+
+		this->m_Texture_Sampler.get_deleter() = [Device = this->m_Logical_Device.get()](VkSampler Sampler) {if (nullptr != Sampler) vkDestroySampler(Device, Sampler, nullptr); };
+		this->m_Texture_Sampler.reset(Sampler);
+	}
+
+	void Create_Uniform_Buffers(void) {
+		this->m_Uniform_Buffers.resize(MAX_FRAMES_IN_FLIGHT);
+		this->m_Uniform_Buffers_Memory.resize(MAX_FRAMES_IN_FLIGHT);
+
+		this->Uniform_Buffers_Mapped.resize(MAX_FRAMES_IN_FLIGHT);
+
+		VkDeviceSize Buffer_Size{ sizeof(Uniform_Buffer_Object) };
+
+		VkBuffer Uniform_Buffer{ nullptr };
+		VkDeviceMemory Uniform_Buffer_Memory{ nullptr };
+
+		const auto Delete_Buffer = [Device = this->m_Logical_Device.get()](VkBuffer Buffer) {if (nullptr != Buffer) vkDestroyBuffer(Device, Buffer, nullptr); };
+		const auto Delete_Memory = [Device = this->m_Logical_Device.get()](VkDeviceMemory Memory) {if (nullptr != Memory) vkFreeMemory(Device, Memory, nullptr); };
+
+		for (size_t Index = 0; Index < MAX_FRAMES_IN_FLIGHT; ++Index) {
+			this->Create_Buffer(Buffer_Size, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, Uniform_Buffer, Uniform_Buffer_Memory);
+
+			this->m_Uniform_Buffers[Index].get_deleter() = Delete_Buffer;
+			this->m_Uniform_Buffers[Index].reset(Uniform_Buffer);
+
+			this->m_Uniform_Buffers_Memory[Index].get_deleter() = Delete_Memory;
+			this->m_Uniform_Buffers_Memory[Index].reset(Uniform_Buffer_Memory);
+
+			THROW_IF_VK_FAILED(vkMapMemory(this->m_Logical_Device.get(), this->m_Uniform_Buffers_Memory[Index].get(), 0, Buffer_Size, 0, &this->Uniform_Buffers_Mapped[Index]));
+		}
+	}
+
+	void Load_Model(void) {
+		if (!this->Read_Mesh_Cache()) {
+			this->Parse_Model_File();
+			this->Optimize_Mesh();
+			this->Write_Mesh_Cache();
+		}
+
+		for (const auto& Vertex : this->m_Vertices)
+			this->m_Mesh_Bounds.Expand(Vertex.Pos);
+		this->m_Mesh_Sphere = Bounding_Sphere::From_Points(this->m_Vertices);
+
+		//NOTE : The Scene Is The Loaded Mesh Placed Once, Placements Are Static And The Scene Matrix Animates Them All
+		this->m_Object_Transforms.assign(1, glm::mat4{ 1.0f });
+		this->m_Object_Volumes.Resize(this->m_Object_Transforms.size());
+
+		cout << "Mesh vertex cache: ACMR " << this->m_Mesh_Statistics_Before.ACMR << " -> " << this->m_Mesh_Statistics_After.ACMR
+			<< ", ATVR " << this->m_Mesh_Statistics_Before.ATVR << " -> " << this->m_Mesh_Statistics_After.ATVR << endl;
+		cout << "Mesh materials: " << this->m_Materials.size() << ", one submesh per material and LOD" << endl;
+		for (size_t Lod = 0; Lod < this->m_Mesh_Lods.size(); ++Lod)
+			cout << "Mesh LOD " << Lod << ": " << this->m_Mesh_Lods[Lod].Index_Count / 3 << " triangles in " << this->m_Mesh_Lods[Lod].Submeshes.size() << " submeshes, error " << this->m_Mesh_Lods[Lod].Error << endl;
+	}
+
+	//NOTE : The Loader Is Picked By Extension, Either Way LOD 0 Comes Out As One Submesh Per Material In Use
+	void Parse_Model_File(void) {
+		const std::filesystem::path Model_Path{ Model_File_Path, std::filesystem::path::generic_format };
+		Obj_Stream_Statistics Statistics{};
+		Model_Data Model{ Glb_Loader::Is_Glb(Model_Path) ? Glb_Loader::Load(Model_Path, this->m_Vertex_Layout) : Obj_Stream_Loader::Load(Model_Path, this->m_Vertex_Layout, &Statistics) };
+
+		this->m_Vertices = std::move(Model.Vertices);
+		this->m_Indices = std::move(Model.Indices);
+		this->m_Materials = std::move(Model.Materials);
+
+		Mesh_Lod Base_Lod{};
+		{
+			Base_Lod.Index_Count = static_cast<uint32_t>(this->m_Indices.size());
+			Base_Lod.Submeshes = std::move(Model.Submeshes);
+		}
+		this->m_Mesh_Lods.assign(1, Base_Lod);
+
+		cout << "Model: " << Model_Path.filename().generic_string() << ", " << this->m_Vertices.size() << " vertices, " << this->m_Indices.size() / 3 << " triangles, " << this->m_Materials.size() << " materials in use" << endl;
+		if (0 != Statistics.File_Bytes)
+			cout << "OBJ stream: " << Statistics.Chunk_Count << " chunks, " << Statistics.Text_Bytes / 1024 << " KiB text resident, " << Statistics.Attribute_Bytes / 1024 << " KiB attributes, "
+				<< Statistics.Table_Bytes / 1024 << " KiB dedup table, " << Statistics.Skipped_Faces << " faces skipped" << endl;
+	}
+
+	void Optimize_Mesh(void) {
+		this->m_Mesh_Statistics_Before = Mesh_Optimizer::Analyze_Vertex_Cache(this->m_Indices, this->m_Vertices.size());
+
+		//NOTE : Triangles Only Move Within Their Submesh, Vertices Are Shared So Fetch Order Is Optimized Over The Whole Mesh
+		for (const auto& Submesh : this->m_Mesh_Lods.front().Submeshes) {
+			vector<uint32_t> Indices{ this->m_Indices.begin() + Submesh.First_Index, this->m_Indices.begin() + Submesh.First_Index + Submesh.Index_Count };
+
+			const vector<uint32_t> Cluster_Starts{ Mesh_Optimizer::Optimize_Vertex_Cache(Indices, this->m_Vertices.size()) };
+			Mesh_Optimizer::Optimize_Overdraw(Indices, this->m_Vertices, Cluster_Starts);
+
+			std::copy(Indices.begin(), Indices.end(), this->m_Indices.begin() + Submesh.First_Index);
+		}
+		Mesh_Optimizer::Optimize_Vertex_Fetch(this->m_Indices, this->m_Vertices);
+
+		this->m_Mesh_Statistics_After = Mesh_Optimizer::Analyze_Vertex_Cache(this->m_Indices, this->m_Vertices.size());
+
+		this->Build_Mesh_Lods();
+	}
+
+	//NOTE : LOD Index Lists Are Appended To m_Indices, Each Submesh Simplified From Its Previous Level On Its Own So Material Borders Stay Put
+	void Build_Mesh_Lods(void) {
+		this->m_Mesh_Lods.resize(1);
+
+		vector<vector<uint32_t>> Previous{};
+		for (const auto& Submesh : this->m_Mesh_Lods.front().Submeshes)
+			Previous.emplace_back(this->m_Indices.begin() + Submesh.First_Index, this->m_Indices.begin() + Submesh.First_Index + Submesh.Index_Count);
+
+		while (this->m_Mesh_Lods.size() < Mesh_Simplifier::Max_Lod_Count) {
+			vector<vector<uint32_t>> Simplified(Previous.size());
+			size_t Previous_Index_Count{ 0 }, Simplified_Index_Count{ 0 };
+			float Error{ 0.0f };
+
+			for (size_t Submesh = 0; Submesh < Previous.size(); ++Submesh) {
+				const size_t Target_Index_Count{ static_cast<size_t>(Previous[Submesh].size() / 3 * Mesh_Simplifier::Lod_Reduction) * 3 };
+				const float Submesh_Error{ Mesh_Simplifier::Simplify(this->m_Vertices, Previous[Submesh], Target_Index_Count, Simplified[Submesh]) };
+
+				//NOTE : A Submesh That Cannot Shrink Further Is Carried Over As Is, So No Material Drops Out Of A Coarser Level
+				if (Simplified[Submesh].empty() || Simplified[Submesh].size() >= Previous[Submesh].size())
+					Simplified[Submesh] = Previous[Submesh];
+				else
+					Error = std::max(Error, Submesh_Error);
+
+				Previous_Index_Count += Previous[Submesh].size();
+				Simplified_Index_Count += Simplified[Submesh].size();
+			}
+
+			if (static_cast<float>(Simplified_Index_Count) > static_cast<float>(Previous_Index_Count) * (1.0f - Mesh_Simplifier::Min_Lod_Progress))
+				break;
+
+			Mesh_Lod Lod{};
+			{
+				Lod.First_Index = static_cast<uint32_t>(this->m_Indices.size());
+				Lod.Index_Count = static_cast<uint32_t>(Simplified_Index_Count);
+				//NOTE : Each Level Is Measured Against Its Parent, So Errors Accumulate Down The Chain
+				Lod.Error = this->m_Mesh_Lods.back().Error + Error;
+			}
+
+			for (size_t Submesh = 0; Submesh < Simplified.size(); ++Submesh) {
+				Mesh_Optimizer::Optimize_Vertex_Cache(Simplified[Submesh], this->m_Vertices.size());
+
+				Mesh_Submesh Lod_Submesh{};
+				{
+					Lod_Submesh.First_Index = static_cast<uint32_t>(this->m_Indices.size());
+					Lod_Submesh.Index_Count = static_cast<uint32_t>(Simplified[Submesh].size());
+					Lod_Submesh.Material = this->m_Mesh_Lods.front().Submeshes[Submesh].Material;
+				}
+				Lod.Submeshes.push_back(Lod_Submesh);
+
+				this->m_Indices.insert(this->m_Indices.end(), Simplified[Submesh].begin(), Simplified[Submesh].end());
+			}
+
+			this->m_Mesh_Lods.push_back(Lod);
+			Previous.swap(Simplified);
+		}
+	}
+
+	const std::filesystem::path Get_Mesh_Cache_Path(void) const {
+		return std::filesystem::path{ string{ Model_File_Path } + ".cache", std::filesystem::path::generic_format };
+	}
+
+	//NOTE : Cache Is Keyed On The Source File And The Attributes Dedup Looked At
+	const Mesh_Cache_Header Build_Mesh_Cache_Header(void) const {
+		const std::filesystem::path Source_Path{ Model_File_Path, std::filesystem::path::generic_format };
+
+		Mesh_Cache_Header Header{};
+		{
+			Header.Source_Size = static_cast<uint64_t>(std::filesystem::file_size(Source_Path));
+			Header.Source_Time = static_cast<int64_t>(std::filesystem::last_write_time(Source_Path).time_since_epoch().count());
+			Header.Attributes = this->m_Vertex_Layout.Attributes;
+		}
+
+		return Header;
+	}
+
+	//NOTE : Every Count And Range Comes From Disk, Each Is Checked Against The Bytes Left Or The Arrays Already Read Before It Is Used
+	bool Read_Mesh_Cache(void) {
+		ifstream File{ this->Get_Mesh_Cache_Path(), ios::binary };
+		if (!File.is_open())
+			return false;
+
+		const Mesh_Cache_Header Expected{ this->Build_Mesh_Cache_Header() };
+		std::error_code Error{};
+		const uint64_t File_Size{ static_cast<uint64_t>(std::filesystem::file_size(this->Get_Mesh_Cache_Path(), Error)) };
+
+		Mesh_Cache_Header Header{};
+		File.read(reinterpret_cast<char*>(&Header), sizeof(Header));
+		if (!File || Error ||
+			Expected.Magic != Header.Magic ||
+			Expected.Version != Header.Version ||
+			Expected.Source_Size != Header.Source_Size ||
+			Expected.Source_Time != Header.Source_Time ||
+			Expected.Attributes != Header.Attributes ||
+			0 == Header.Lod_Count ||
+			File_Size - sizeof(Header) < Header.Vertex_Bytes || File_Size - sizeof(Header) - Header.Vertex_Bytes < Header.Index_Bytes ||
+			!Mesh_Codec::Is_Vertex_Size_Valid(Header.Vertex_Count, Header.Vertex_Bytes) ||
+			!Mesh_Codec::Is_Index_Size_Valid(Header.Index_Count, Header.Index_Bytes))
+			return false;
+
+		//NOTE : Smallest LOD Is Its Range, Error And Submesh Count, Smallest Material Two Empty Strings And An Image Index
+		const uint64_t Tail_Bytes{ File_Size - sizeof(Header) - Header.Vertex_Bytes - Header.Index_Bytes };
+		if (Tail_Bytes / (4 * sizeof(uint32_t)) < Header.Lod_Count ||
+			(Tail_Bytes - Header.Lod_Count * 4 * sizeof(uint32_t)) / (3 * sizeof(uint32_t)) < Header.Material_Count)
+			return false;
+
+		//NOTE : Both Streams Are Read In One Go And Decoded In Place Of The Raw Arrays
+		vector<uint8_t> Encoded(static_cast<size_t>(Header.Vertex_Bytes + Header.Index_Bytes));
+		File.read(reinterpret_cast<char*>(Encoded.data()), Encoded.size());
+
+		vector<Vertex> Vertices(Header.Vertex_Count);
+		vector<uint32_t> Indices(Header.Index_Count);
+		vector<Mesh_Lod> Lods(Header.Lod_Count);
+		vector<Mesh_Material> Materials(Header.Material_Count);
+
+		const auto Decode_Start{ chrono::high_resolution_clock::now() };
+		if (!File ||
+			!Mesh_Codec::Decode_Vertices(Encoded.data(), static_cast<size_t>(Header.Vertex_Bytes), Vertices) ||
+			!Mesh_Codec::Decode_Indices(Encoded.data() + Header.Vertex_Bytes, static_cast<size_t>(Header.Index_Bytes), Indices))
+			return false;
+		const double Decode_Milliseconds{ chrono::duration<double, chrono::milliseconds::period>(chrono::high_resolution_clock::now() - Decode_Start).count() };
+
+		if (Indices.end() != std::find_if(Indices.begin(), Indices.end(), [&Vertices](uint32_t Index) { return Index >= Vertices.size(); }))
+			return false;
+
+		const auto Get_Bytes_Left = [&File, File_Size](void) {
+			const std::streamoff Position{ File.tellg() };
+			return 0 <= Position && static_cast<uint64_t>(Position) <= File_Size ? File_Size - static_cast<uint64_t>(Position) : 0;
+		};
+
+		for (auto& Lod : Lods) {
+			uint32_t Submesh_Count{ 0 };
+			File.read(reinterpret_cast<char*>(&Lod.First_Index), sizeof(Lod.First_Index));
+			File.read(reinterpret_cast<char*>(&Lod.Index_Count), sizeof(Lod.Index_Count));
+			File.read(reinterpret_cast<char*>(&Lod.Error), sizeof(Lod.Error));
+			File.read(reinterpret_cast<char*>(&Submesh_Count), sizeof(Submesh_Count));
+			if (!File || Get_Bytes_Left() / sizeof(Mesh_Submesh) < Submesh_Count ||
+				static_cast<uint64_t>(Lod.First_Index) + Lod.Index_Count > Indices.size())
+				return false;
+
+			Lod.Submeshes.resize(Submesh_Count);
+			File.read(reinterpret_cast<char*>(Lod.Submeshes.data()), sizeof(Mesh_Submesh) * Lod.Submeshes.size());
+
+			//NOTE : Submeshes Stay Inside Their LOD And Name A Material The Cache Holds
+			for (const auto& Submesh : Lod.Submeshes)
+				if (Submesh.First_Index < Lod.First_Index ||
+					static_cast<uint64_t>(Submesh.First_Index) + Submesh.Index_Count > static_cast<uint64_t>(Lod.First_Index) + Lod.Index_Count ||
+					Submesh.Material >= Materials.size())
+					return false;
+		}
+		for (auto& Material : Materials)
+			for (string* Text : { &Material.Name, &Material.Texture_Path }) {
+				uint32_t Length{ 0 };
+				File.read(reinterpret_cast<char*>(&Length), sizeof(Length));
+				if (!File || Get_Bytes_Left() < Length)
+					return false;
+
+				Text->resize(Length);
+				File.read(Text->data(), Text->size());
+			}
+		for (auto& Material : Materials)
+			File.read(reinterpret_cast<char*>(&Material.Embedded_Image), sizeof(Material.Embedded_Image));
+		if (!File)
+			return false;
+
+		//NOTE : Members Are Only Replaced Once The Whole Cache Checked Out
+		this->m_Vertices = std::move(Vertices);
+		this->m_Indices = std::move(Indices);
+		this->m_Mesh_Lods = std::move(Lods);
+		this->m_Materials = std::move(Materials);
+		this->m_Mesh_Statistics_Before = Header.Before;
+		this->m_Mesh_Statistics_After = Header.After;
+
+		cout << "Mesh cache: " << Encoded.size() / 1024 << " KiB encoded geometry decoded in " << Decode_Milliseconds << " ms" << endl;
+		return true;
+	}
+
+	void Write_Mesh_Cache(void) const {
+		const vector<uint8_t> Encoded_Vertices{ Mesh_Codec::Encode_Vertices(this->m_Vertices) };
+		const vector<uint8_t> Encoded_Indices{ Mesh_Codec::Encode_Indices(this->m_Indices) };
+
+		Mesh_Cache_Header Header{ this->Build_Mesh_Cache_Header() };
+		{
+			Header.Vertex_Bytes = Encoded_Vertices.size();
+			Header.Index_Bytes = Encoded_Indices.size();
+			Header.Vertex_Count = static_cast<uint32_t>(this->m_Vertices.size());
+			Header.Index_Count = static_cast<uint32_t>(this->m_Indices.size());
+			Header.Lod_Count = static_cast<uint32_t>(this->m_Mesh_Lods.size());
+			Header.Material_Count = static_cast<uint32_t>(this->m_Materials.size());
+			Header.Before = this->m_Mesh_Statistics_Before;
+			Header.After = this->m_Mesh_Statistics_After;
+		}
+
+		//NOTE : Cache Is Only An Accelerator, A Read Only Model Directory Is Not An Error
+		ofstream File{ this->Get_Mesh_Cache_Path(), ios::binary | ios::trunc };
+		if (!File.is_open())
+			return;
+
+		File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+		File.write(reinterpret_cast<const char*>(Encoded_Vertices.data()), Encoded_Vertices.size());
+		File.write(reinterpret_cast<const char*>(Encoded_Indices.data()), Encoded_Indices.size());
+		for (const auto& Lod : this->m_Mesh_Lods) {
+			File.write(reinterpret_cast<const char*>(&Lod.First_Index), sizeof(Lod.First_Index));
+			File.write(reinterpret_cast<const char*>(&Lod.Index_Count), sizeof(Lod.Index_Count));
+			File.write(reinterpret_cast<const char*>(&Lod.Error), sizeof(Lod.Error));
+
+			const uint32_t Submesh_Count{ static_cast<uint32_t>(Lod.Submeshes.size()) };
+			File.write(reinterpret_cast<const char*>(&Submesh_Count), sizeof(Submesh_Count));
+			File.write(reinterpret_cast<const char*>(Lod.Submeshes.data()), sizeof(Mesh_Submesh) * Lod.Submeshes.size());
+		}
+		for (const auto& Material : this->m_Materials)
+			for (const string* Text : { &Material.Name, &Material.Texture_Path }) {
+				const uint32_t Length{ static_cast<uint32_t>(Text->size()) };
+				File.write(reinterpret_cast<const char*>(&Length), sizeof(Length));
+				File.write(Text->data(), Text->size());
+			}
+		for (const auto& Material : this->m_Materials)
+			File.write(reinterpret_cast<const char*>(&Material.Embedded_Image), sizeof(Material.Embedded_Image));
+
+		cout << "Mesh cache: " << (sizeof(Vertex) * this->m_Vertices.size() + sizeof(uint32_t) * this->m_Indices.size()) / 1024 << " KiB geometry stored as "
+			<< (Encoded_Vertices.size() + Encoded_Indices.size()) / 1024 << " KiB" << endl;
+	}
+
+	//NOTE : LOD 0 Of The Scene Mesh Decides The Index Width Of The Whole Pool, Larger Meshes Still Fit 16 Bit Through Per Draw Rebasing
+	void Create_Geometry_Pool(void) {
+		const Mesh_Lod& Base_Lod{ this->m_Mesh_Lods.front() };
+		const vector<uint32_t> Base_Indices{ this->m_Indices.begin() + Base_Lod.First_Index, this->m_Indices.begin() + Base_Lod.First_Index + Base_Lod.Index_Count };
+
+		//NOTE : Coarse LODs Collapse Onto Vertices Further Apart Than LOD 0 Ever Reaches, One Such Triangle Rules Out 16 Bit For All Of Them
+		const VkIndexType Index_Type{ Packed_Indices::Has_Wide_Triangle(this->m_Indices) ? VK_INDEX_TYPE_UINT32 : Packed_Indices::Choose_Index_Type(Base_Indices, this->m_Vertices.size()) };
+
+		this->m_Geometry_Pool.Reset(
+			std::max(Geometry_Pool_Min_Vertices, static_cast<uint32_t>(this->m_Vertices.size())),
+			std::max(Geometry_Pool_Min_Indices, static_cast<uint32_t>(this->m_Indices.size())),
+			this->m_Vertex_Layout.Get_Stride(),
+			Index_Type);
+
+		this->Create_Geometry_Buffers(this->m_Vertex_Buffer, this->m_Vertex_Buffer_Memory, this->m_Index_Buffer, this->m_Index_Buffer_Memory);
+	}
+
+	//NOTE : Transfer Source Too, Defragmentation Copies Live Ranges Out Of Them, And Storage For The Vertex Pulling Shaders
+	void Create_Geometry_Buffers(unique_ptr<VkBuffer_T, function<void(VkBuffer)>>& Vertex_Buffer, unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>>& Vertex_Buffer_Memory, unique_ptr<VkBuffer_T, function<void(VkBuffer)>>& Index_Buffer, unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>>& Index_Buffer_Memory) {
+		const auto Delete_Buffer = [Device = this->m_Logical_Device.get()](VkBuffer Buffer) {if (nullptr != Buffer) vkDestroyBuffer(Device, Buffer, nullptr); };
+		const auto Delete_Memory = [Device = this->m_Logical_Device.get()](VkDeviceMemory Memory) {if (nullptr != Memory) vkFreeMemory(Device, Memory, nullptr); };
+
+		VkBuffer Buffer{ nullptr };
+		VkDeviceMemory Buffer_Memory{ nullptr };
+		this->Create_Buffer(this->m_Geometry_Pool.Get_Vertex_Buffer_Size(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, Buffer, Buffer_Memory);
+
+		Vertex_Buffer.get_deleter() = Delete_Buffer;
+		Vertex_Buffer.reset(Buffer);
+		Vertex_Buffer_Memory.get_deleter() = Delete_Memory;
+		Vertex_Buffer_Memory.reset(Buffer_Memory);
+
+		this->Create_Buffer(this->m_Geometry_Pool.Get_Index_Buffer_Size(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, Buffer, Buffer_Memory);
+
+		Index_Buffer.get_deleter() = Delete_Buffer;
+		Index_Buffer.reset(Buffer);
+		Index_Buffer_Memory.get_deleter() = Delete_Memory;
+		Index_Buffer_Memory.reset(Buffer_Memory);
+	}
+
+	//NOTE : Draw Ranges Come Out Of Packing Relative To The Mesh And Are Rebased Onto Its Allocation, Draws Then Index The Shared Buffers Directly
+	void Upload_Mesh_Geometry(void) {
+		vector<uint8_t> Encoded_Vertices{};
+		this->m_Vertex_Layout.Encode(this->m_Vertices, this->m_Mesh_Bounds, Encoded_Vertices);
+
+		const auto Get_Submesh_Indices = [this](const Mesh_Submesh& Submesh) {
+			return vector<uint32_t>{ this->m_Indices.begin() + Submesh.First_Index, this->m_Indices.begin() + Submesh.First_Index + Submesh.Index_Count };
+		};
+
+		//NOTE : Submeshes Are Packed In Order, So A LOD's Ranges Still Cover Its Indices Front To Back And Never Straddle Two Materials
+		this->m_Packed_Indices.Index_Type = this->m_Geometry_Pool.Get_Index_Type();
+		for (auto& Lod : this->m_Mesh_Lods) {
+			Lod.Draw_Ranges.clear();
+			for (const auto& Submesh : Lod.Submeshes)
+				for (auto Range : this->m_Packed_Indices.Append(Get_Submesh_Indices(Submesh))) {
+					Range.Material = Submesh.Material;
+					Lod.Draw_Ranges.push_back(Range);
+				}
+		}
+
+		this->m_Mesh_Geometry = this->Allocate_Geometry(static_cast<uint32_t>(this->m_Vertices.size()), this->m_Packed_Indices.Get_Index_Count());
+		const Geometry_Allocation& Allocation{ this->m_Geometry_Pool.Get(this->m_Mesh_Geometry.value()) };
+
+		for (auto& Lod : this->m_Mesh_Lods)
+			for (auto& Range : Lod.Draw_Ranges) {
+				Range.First_Index += Allocation.First_Index;
+				Range.Vertex_Offset += static_cast<int32_t>(Allocation.Base_Vertex);
+			}
+
+		this->Upload_Buffer_Range(Encoded_Vertices.data(), Encoded_Vertices.size(), this->m_Vertex_Buffer.get(), this->m_Geometry_Pool.Get_Vertex_Byte_Offset(this->m_Mesh_Geometry.value()));
+		this->Upload_Buffer_Range(this->m_Packed_Indices.Data.data(), this->m_Packed_Indices.Data.size(), this->m_Index_Buffer.get(), this->m_Geometry_Pool.Get_Index_Byte_Offset(this->m_Mesh_Geometry.value()));
+
+		cout << "Geometry pool: " << this->m_Geometry_Pool.Get_Used_Vertices() << " of " << this->m_Geometry_Pool.Get_Vertex_Capacity() << " vertices, "
+			<< this->m_Geometry_Pool.Get_Used_Indices() << " of " << this->m_Geometry_Pool.Get_Index_Capacity() << " indices, one vertex and index bind per frame" << endl;
+	}
+
+	//NOTE : A Full Or Fragmented Pool Is Compacted Into Buffers With Room For The Mesh, Then The Allocation Is Retried Once
+	const Geometry_Pool::Handle Allocate_Geometry(uint32_t Vertex_Count, uint32_t Index_Count) {
+		if (const auto Mesh{ this->m_Geometry_Pool.Allocate(Vertex_Count, Index_Count) }; Mesh.has_value())
+			return Mesh.value();
+
+		const uint32_t Needed_Vertices{ this->m_Geometry_Pool.Get_Used_Vertices() + Vertex_Count };
+		const uint32_t Needed_Indices{ this->m_Geometry_Pool.Get_Used_Indices() + Index_Count };
+		this->Defragment_Geometry_Pool(
+			std::max(this->m_Geometry_Pool.Get_Vertex_Capacity(), Needed_Vertices + Needed_Vertices / 2),
+			std::max(this->m_Geometry_Pool.Get_Index_Capacity(), Needed_Indices + Needed_Indices / 2));
+
+		if (const auto Mesh{ this->m_Geometry_Pool.Allocate(Vertex_Count, Index_Count) }; Mesh.has_value())
+			return Mesh.value();
+
+		throw runtime_error("Failed to allocate mesh geometry!");
+	}
+
+	//NOTE : Live Ranges Move Into New Buffers, So Draw Tables And Descriptor Sets Built From The Pool Before This Have To Be Built Again
+	void Defragment_Geometry_Pool(uint32_t Vertex_Capacity, uint32_t Index_Capacity) {
+		THROW_IF_VK_FAILED(vkDeviceWaitIdle(this->m_Logical_Device.get()));
+
+		//NOTE : Only The Mesh's Old Offsets Are Needed To Rebase Its Draw Ranges Once The Pool Moved It
+		uint32_t First_Index_Before{ 0 };
+		uint32_t Base_Vertex_Before{ 0 };
+		if (this->m_Mesh_Geometry.has_value()) {
+			const Geometry_Allocation& Mesh_Before{ this->m_Geometry_Pool.Get(this->m_Mesh_Geometry.value()) };
+			First_Index_Before = Mesh_Before.First_Index;
+			Base_Vertex_Before = Mesh_Before.Base_Vertex;
+		}
+		const Geometry_Defragment_Plan Plan{ this->m_Geometry_Pool.Defragment(Vertex_Capacity, Index_Capacity) };
+
+		unique_ptr<VkBuffer_T, function<void(VkBuffer)>> Vertex_Buffer{ nullptr };
+		unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> Vertex_Buffer_Memory{ nullptr };
+		unique_ptr<VkBuffer_T, function<void(VkBuffer)>> Index_Buffer{ nullptr };
+		unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> Index_Buffer_Memory{ nullptr };
+		this->Create_Geometry_Buffers(Vertex_Buffer, Vertex_Buffer_Memory, Index_Buffer, Index_Buffer_Memory);
+
+		{
+			VkCommandBuffer Command_Buffer{ this->Begin_SingleTime_Commands() };
+
+			if (!Plan.Vertex_Copies.empty())
+				vkCmdCopyBuffer(Command_Buffer, this->m_Vertex_Buffer.get(), Vertex_Buffer.get(), static_cast<uint32_t>(Plan.Vertex_Copies.size()), Plan.Vertex_Copies.data());
+			if (!Plan.Index_Copies.empty())
+				vkCmdCopyBuffer(Command_Buffer, this->m_Index_Buffer.get(), Index_Buffer.get(), static_cast<uint32_t>(Plan.Index_Copies.size()), Plan.Index_Copies.data());
+
+			this->End_SingleTime_Commands(Command_Buffer);
+		}
+
+		this->m_Vertex_Buffer = std::move(Vertex_Buffer);
+		this->m_Vertex_Buffer_Memory = std::move(Vertex_Buffer_Memory);
+		this->m_Index_Buffer = std::move(Index_Buffer);
+		this->m_Index_Buffer_Memory = std::move(Index_Buffer_Memory);
+
+		if (this->m_Mesh_Geometry.has_value()) {
+			const Geometry_Allocation& Mesh_After{ this->m_Geometry_Pool.Get(this->m_Mesh_Geometry.value()) };
+			for (auto& Lod : this->m_Mesh_Lods)
+				for (auto& Range : Lod.Draw_Ranges) {
+					Range.First_Index = Range.First_Index - First_Index_Before + Mesh_After.First_Index;
+					Range.Vertex_Offset += static_cast<int32_t>(Mesh_After.Base_Vertex) - static_cast<int32_t>(Base_Vertex_Before);
+				}
+		}
+
+		VkDeviceSize Moved_Bytes{ 0 };
+		for (const auto& Copies : { Plan.Vertex_Copies, Plan.Index_Copies })
+			for (const auto& Copy : Copies)
+				Moved_Bytes += Copy.size;
+
+		cout << "Geometry pool: defragmented into " << Vertex_Capacity << " vertices and " << Index_Capacity << " indices, "
+			<< Plan.Vertex_Copies.size() + Plan.Index_Copies.size() << " copies, " << Moved_Bytes << " bytes moved" << endl;
+	}
+
+	void Upload_Buffer_Range(const void* Source, VkDeviceSize Size, VkBuffer Destination_Buffer, VkDeviceSize Destination_Offset) {
+		VkBuffer Staging_Buffer{ nullptr };
+		VkDeviceMemory Staging_Buffer_Memory{ nullptr };
+		this->Create_Buffer(Size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, Staging_Buffer, Staging_Buffer_Memory);
+
+		void* Data{ nullptr };
+		THROW_IF_VK_FAILED(vkMapMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory, 0, Size, 0, &Data));
+		memcpy(Data, Source, static_cast<size_t>(Size));
+		vkUnmapMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory);
+
+		this->Copy_Buffer(Staging_Buffer, Destination_Buffer, Size, Destination_Offset);
+
+		vkDestroyBuffer(this->m_Logical_Device.get(), Staging_Buffer, nullptr);
+		vkFreeMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory, nullptr);
+	}
+
+	//NOTE : Staging Upload Into A Device Local Buffer, Shared By The Static Tables Of The Instanced And GPU Culling Paths
+	void Create_Device_Local_Buffer(const void* Source, VkDeviceSize Buffer_Size, VkBufferUsageFlags Usage, unique_ptr<VkBuffer_T, function<void(VkBuffer)>>& Buffer, unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>>& Buffer_Memory) {
+		VkBuffer Staging_Buffer{ nullptr };
+		VkDeviceMemory Staging_Buffer_Memory{ nullptr };
+		this->Create_Buffer(Buffer_Size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, Staging_Buffer, Staging_Buffer_Memory);
+
+		void* Data{ nullptr };
+		THROW_IF_VK_FAILED(vkMapMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory, 0, Buffer_Size, 0, &Data));
+		memcpy(Data, Source, static_cast<size_t>(Buffer_Size));
+		vkUnmapMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory);
+
+		VkBuffer Device_Buffer{ nullptr };
+		VkDeviceMemory Device_Buffer_Memory{ nullptr };
+		this->Create_Buffer(Buffer_Size, VK_BUFFER_USAGE_TRANSFER_DST_BIT | Usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, Device_Buffer, Device_Buffer_Memory);
+
+		Buffer.get_deleter() = [Device = this->m_Logical_Device.get()](VkBuffer Buffer) {if (nullptr != Buffer) vkDestroyBuffer(Device, Buffer, nullptr); };
+		Buffer.reset(Device_Buffer);
+
+		Buffer_Memory.get_deleter() = [Device = this->m_Logical_Device.get()](VkDeviceMemory Memory) {if (nullptr != Memory) vkFreeMemory(Device, Memory, nullptr); };
+		Buffer_Memory.reset(Device_Buffer_Memory);
+
+		this->Copy_Buffer(Staging_Buffer, Buffer.get(), Buffer_Size);
+
+		vkDestroyBuffer(this->m_Logical_Device.get(), Staging_Buffer, nullptr);
+		vkFreeMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory, nullptr);
+	}
+
+	//NOTE : Placements Are Static, So Instance Records Are Uploaded Once And CPU Cost Does Not Grow With Instance Count Per Frame
+	void Create_Instance_Buffer(void) {
+		if (this->m_Object_Transforms.size() > Draw_Instance::Max_Instances)
+			throw runtime_error("Too many instances to pack a texture slot above!");
+
+		const glm::mat4 Dequantize{ this->m_Vertex_Layout.Get_Position_Dequantize(this->m_Mesh_Bounds) };
+
+		vector<Gpu_Instance> Instances{};
+		Instances.reserve(this->m_Object_Transforms.size());
+		for (const auto& Placement : this->m_Object_Transforms)
+			Instances.push_back(Gpu_Culling::Build_Instance(Placement, Dequantize, this->m_Mesh_Sphere));
+
+		this->Create_Device_Local_Buffer(Instances.data(), sizeof(Gpu_Instance) * Instances.size(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, this->m_Instance_Buffer, this->m_Instance_Buffer_Memory);
+	}
+
+	//NOTE : Layouts And Pipelines Only Depend On The Culling Path, So Their Compiles Are Queued Before Any Scene Data Loads
+	void Create_Gpu_Culling_Pipelines(void) {
+		//NOTE : Bindings 4 To 7 Only Exist In cull_occlusion.spv, Binding 5 Is Written With The Depth Pyramid, The Cluster Variants Only Add Binding 4
+		vector<VkDescriptorSetLayoutBinding> Bindings(this->Get_Cull_Binding_Count());
+		for (uint32_t Binding = 0; Binding < Bindings.size(); ++Binding) {
+			Bindings[Binding].binding = Binding;
+			Bindings[Binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+			Bindings[Binding].descriptorCount = 1;
+			Bindings[Binding].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+			Bindings[Binding].pImmutableSamplers = nullptr;
+		}
+
+		if (this->m_Occlusion_Culling) {
+			Bindings[5].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+			Bindings[6].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+		}
+
+		VkDescriptorSetLayoutCreateInfo Layout_Info{};
+		{
+			Layout_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+			Layout_Info.bindingCount = static_cast<uint32_t>(Bindings.size());
+			Layout_Info.pBindings = Bindings.data();
+		}
+
+		VkDescriptorSetLayout Descriptor_Set_Layout{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateDescriptorSetLayout(this->m_Logical_Device.get(), &Layout_Info, nullptr, &Descriptor_Set_Layout));
+
+		this->m_Cull_Descriptor_Set_Layout.get_deleter() = [Device = this->m_Logical_Device.get()](VkDescriptorSetLayout Descriptor_Set_Layout) {if (nullptr != Descriptor_Set_Layout) vkDestroyDescriptorSetLayout(Device, Descriptor_Set_Layout, nullptr); };
+		this->m_Cull_Descriptor_Set_Layout.reset(Descriptor_Set_Layout);
+
+		VkPushConstantRange Push_Constant_Range{};
+		{
+			Push_Constant_Range.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+			Push_Constant_Range.offset = 0;
+			Push_Constant_Range.size = sizeof(Gpu_Cull_Constants);
+		}
+
+		VkDescriptorSetLayout Set_Layouts[] = { this->m_Cull_Descriptor_Set_Layout.get() };
+		VkPipelineLayoutCreateInfo Pipeline_Layout_Info{};
+		{
+			Pipeline_Layout_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+			Pipeline_Layout_Info.setLayoutCount = 1;
+			Pipeline_Layout_Info.pSetLayouts = Set_Layouts;
+			Pipeline_Layout_Info.pushConstantRangeCount = 1;
+			Pipeline_Layout_Info.pPushConstantRanges = &Push_Constant_Range;
+		}
+
+		VkPipelineLayout Pipeline_Layout{ nullptr };
+		THROW_IF_VK_FAILED(vkCreatePipelineLayout(this->m_Logical_Device.get(), &Pipeline_Layout_Info, nullptr, &Pipeline_Layout));
+
+		this->m_Cull_Pipeline_Layout.get_deleter() = [Device = this->m_Logical_Device.get()](VkPipelineLayout Pipeline_Layout) {if (nullptr != Pipeline_Layout) vkDestroyPipelineLayout(Device, Pipeline_Layout, nullptr); };
+		this->m_Cull_Pipeline_Layout.reset(Pipeline_Layout);
+
+		const VkPipelineLayout Cull_Pipeline_Layout{ this->m_Cull_Pipeline_Layout.get() };
+
+		if (this->m_Occlusion_Culling) {
+			//NOTE : One Module, The Phase Is A Specialization Constant So Each Pipeline Only Carries Its Own Branch
+			this->Compile_Pipeline(this->m_Cull_Pipeline, [this, Cull_Pipeline_Layout](VkPipelineCache Pipeline_Cache) {
+				return this->Create_Compute_Pipeline(Cull_Occlusion_Compute_Shader_File_Path, Cull_Pipeline_Layout, Pipeline_Cache, 0u);
+			});
+
+			this->Compile_Pipeline(this->m_Late_Cull_Pipeline, [this, Cull_Pipeline_Layout](VkPipelineCache Pipeline_Cache) {
+				return this->Create_Compute_Pipeline(Cull_Occlusion_Compute_Shader_File_Path, Cull_Pipeline_Layout, Pipeline_Cache, 1u);
+			});
+
+			this->Create_Depth_Pyramid_Pipelines();
+		}
+		else {
+			const char* Cull_Shader_Path{
+				this->m_Mesh_Shading ? Cull_Cluster_Mesh_Compute_Shader_File_Path :
+				this->m_Cluster_Culling ? Cull_Cluster_Compute_Shader_File_Path : Cull_Compute_Shader_File_Path };
+
+			this->Compile_Pipeline(this->m_Cull_Pipeline, [this, Cull_Pipeline_Layout, Cull_Shader_Path](VkPipelineCache Pipeline_Cache) {
+				return this->Create_Compute_Pipeline(Cull_Shader_Path, Cull_Pipeline_Layout, Pipeline_Cache);
+			});
+		}
+	}
+
+	const uint32_t Get_Cull_Binding_Count(void) const {
+		return this->m_Occlusion_Culling ? 8u : this->m_Cluster_Culling ? 5u : 4u;
+	}
+
+	void Create_Gpu_Culling(void) {
+		vector<Gpu_Lod> Lods{};
+		vector<Gpu_Draw_Range> Ranges{};
+		const uint32_t Max_Range_Count{ Gpu_Culling::Build_Tables(this->m_Mesh_Lods, this->m_Material_Texture_Slots, Lods, Ranges) };
+		this->m_Max_Draw_Count = Max_Range_Count * static_cast<uint32_t>(this->m_Object_Transforms.size());
+
+		//NOTE : An Instance At LOD 0 Emits One Draw Per Visible Cluster, Mesh Tasks Are Further Bounded By The Largest Grid The Device Launches
+		if (this->m_Cluster_Culling) {
+			this->Create_Cluster_Tables();
+			this->m_Max_Draw_Count = std::max(Max_Range_Count, this->m_Cluster_Count) * static_cast<uint32_t>(this->m_Object_Transforms.size());
+		}
+
+		if (this->m_Mesh_Shading)
+			this->m_Max_Draw_Count = std::min(this->m_Cluster_Count * static_cast<uint32_t>(this->m_Object_Transforms.size()), this->m_Device_Capabilities.Max_Mesh_Tasks);
+
+		this->Create_Device_Local_Buffer(Lods.data(), sizeof(Gpu_Lod) * Lods.size(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, this->m_Lod_Buffer, this->m_Lod_Buffer_Memory);
+		this->Create_Device_Local_Buffer(Ranges.data(), sizeof(Gpu_Draw_Range) * Ranges.size(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, this->m_Draw_Range_Buffer, this->m_Draw_Range_Buffer_Memory);
+
+		//NOTE : One Draw Buffer Per Frame In Flight, The Next Frame's Dispatch Must Not Overwrite Commands Still Being Consumed
+		const VkDeviceSize Draw_Buffer_Size{ Gpu_Culling::Get_Draw_Buffer_Size(this->m_Max_Draw_Count) };
+		const VkBufferUsageFlags Draw_Buffer_Usage{ VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT };
+		this->Create_Per_Frame_Buffers(Draw_Buffer_Size, Draw_Buffer_Usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, this->m_Draw_Buffers, this->m_Draw_Buffers_Memory);
+
+		if (this->m_Occlusion_Culling) {
+			this->Create_Per_Frame_Buffers(Draw_Buffer_Size, Draw_Buffer_Usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, this->m_Late_Draw_Buffers, this->m_Late_Draw_Buffers_Memory);
+
+			//NOTE : Written By The Early Phase And Read By The Late Phase Of The Same Frame, Frames Are Ordered By The Barrier At Frame Start
+			const vector<uint32_t> Occlusion_States(this->m_Object_Transforms.size(), 0);
+			this->Create_Device_Local_Buffer(Occlusion_States.data(), sizeof(uint32_t) * Occlusion_States.size(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, this->m_Occlusion_State_Buffer, this->m_Occlusion_State_Buffer_Memory);
+
+			this->Create_Per_Frame_Buffers(sizeof(Gpu_Occlusion_Uniforms), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, this->m_Occlusion_Uniform_Buffers, this->m_Occlusion_Uniform_Buffers_Memory);
+			this->Create_Per_Frame_Buffers(sizeof(Gpu_Occlusion_Statistics), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, this->m_Occlusion_Statistics_Buffers, this->m_Occlusion_Statistics_Buffers_Memory);
+
+			this->m_Occlusion_Uniforms_Mapped.resize(MAX_FRAMES_IN_FLIGHT);
+			this->m_Occlusion_Statistics_Mapped.resize(MAX_FRAMES_IN_FLIGHT);
+			for (size_t Index = 0; Index < MAX_FRAMES_IN_FLIGHT; ++Index) {
+				THROW_IF_VK_FAILED(vkMapMemory(this->m_Logical_Device.get(), this->m_Occlusion_Uniform_Buffers_Memory[Index].get(), 0, sizeof(Gpu_Occlusion_Uniforms), 0, &this->m_Occlusion_Uniforms_Mapped[Index]));
+				THROW_IF_VK_FAILED(vkMapMemory(this->m_Logical_Device.get(), this->m_Occlusion_Statistics_Buffers_Memory[Index].get(), 0, sizeof(Gpu_Occlusion_Statistics), 0, &this->m_Occlusion_Statistics_Mapped[Index]));
+
+				memset(this->m_Occlusion_Statistics_Mapped[Index], 0, sizeof(Gpu_Occlusion_Statistics));
+			}
+		}
+
+		//NOTE : Early And Late Sets Differ Only In The Draw Buffer They Append To
+		const uint32_t Set_Count{ static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT) * (this->m_Occlusion_Culling ? 2 : 1) };
+
+		array<VkDescriptorPoolSize, 3> Pool_Sizes{};
+		{
+			{
+				Pool_Sizes[0].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+				Pool_Sizes[0].descriptorCount = (this->m_Occlusion_Culling ? 6 : this->Get_Cull_Binding_Count()) * Set_Count;
+			}
+
+			{
+				Pool_Sizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+				Pool_Sizes[1].descriptorCount = Set_Count;
+			}
+
+			{
+				Pool_Sizes[2].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+				Pool_Sizes[2].descriptorCount = Set_Count;
+			}
+		}
+
+		VkDescriptorPoolCreateInfo Pool_Info{};
+		{
+			Pool_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+			Pool_Info.poolSizeCount = this->m_Occlusion_Culling ? static_cast<uint32_t>(Pool_Sizes.size()) : 1;
+			Pool_Info.pPoolSizes = Pool_Sizes.data();
+			Pool_Info.maxSets = Set_Count;
+		}
+
+		VkDescriptorPool Descriptor_Pool{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateDescriptorPool(this->m_Logical_Device.get(), &Pool_Info, nullptr, &Descriptor_Pool));
+
+		this->m_Cull_Descriptor_Pool.get_deleter() = [Device = this->m_Logical_Device.get()](VkDescriptorPool Descriptor_Pool) {if (nullptr != Descriptor_Pool) vkDestroyDescriptorPool(Device, Descriptor_Pool, nullptr); };
+		this->m_Cull_Descriptor_Pool.reset(Descriptor_Pool);
+
+		this->Allocate_Cull_Descriptor_Sets(this->m_Draw_Buffers, this->m_Cull_Descriptor_Sets);
+		if (this->m_Occlusion_Culling)
+			this->Allocate_Cull_Descriptor_Sets(this->m_Late_Draw_Buffers, this->m_Late_Cull_Descriptor_Sets);
+	}
+
+	//NOTE : Needs LOD 0 Placed In The Geometry Pool, Meshlet Vertices Are Rebased Onto The Pool Like Its Draw Ranges
+	void Create_Cluster_Tables(void) {
+		const Mesh_Lod& Lod{ this->m_Mesh_Lods.front() };
+		const vector<uint32_t> Indices{ this->m_Indices.begin() + Lod.First_Index, this->m_Indices.begin() + Lod.First_Index + Lod.Index_Count };
+
+		const auto Start_Time{ chrono::high_resolution_clock::now() };
+		const Meshlet_Data Meshlets{ Meshlet_Builder::Build(this->m_Vertices, Indices, Gpu_Culling::Get_Range_Boundaries(Lod)) };
+		const auto End_Time{ chrono::high_resolution_clock::now() };
+
+		const vector<Gpu_Cluster> Clusters{ Gpu_Culling::Build_Clusters(Meshlets, Lod, this->m_Vertex_Layout.Get_Position_Dequantize(this->m_Mesh_Bounds), this->m_Mesh_Sphere, this->m_Material_Texture_Slots) };
+		this->m_Cluster_Count = static_cast<uint32_t>(Clusters.size());
+
+		//NOTE : The Cone Test Assumes Counter Clockwise Front Faces With Back Faces Culled, Anything Else Would Lose Visible Triangles
+		Gpu_Cluster_Header Header{};
+		{
+			Header.Cluster_Count = this->m_Cluster_Count;
+			Header.Cone_Culling = VK_CULL_MODE_BACK_BIT == this->m_Scene_Material.Cull_Mode ? 1 : 0;
+		}
+
+		vector<uint8_t> Cluster_Data(sizeof(Gpu_Cluster_Header) + sizeof(Gpu_Cluster) * Clusters.size());
+		memcpy(Cluster_Data.data(), &Header, sizeof(Header));
+		memcpy(Cluster_Data.data() + sizeof(Header), Clusters.data(), sizeof(Gpu_Cluster) * Clusters.size());
+		this->Create_Device_Local_Buffer(Cluster_Data.data(), Cluster_Data.size(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, this->m_Cluster_Buffer, this->m_Cluster_Buffer_Memory);
+
+		if (this->m_Mesh_Shading) {
+			const uint32_t Base_Vertex{ this->m_Geometry_Pool.Get(this->m_Mesh_Geometry.value()).Base_Vertex };
+
+			vector<uint32_t> Meshlet_Vertices{ Meshlets.Vertices };
+			for (auto& Meshlet_Vertex : Meshlet_Vertices)
+				Meshlet_Vertex += Base_Vertex;
+
+			//NOTE : The Mesh Shader Reads Triangle Bytes Out Of 32 Bit Words
+			vector<uint8_t> Meshlet_Triangles{ Meshlets.Triangles };
+			Meshlet_Triangles.resize((Meshlet_Triangles.size() + 3) & ~static_cast<size_t>(3), 0);
+
+			this->Create_Device_Local_Buffer(Meshlet_Vertices.data(), sizeof(uint32_t) * Meshlet_Vertices.size(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, this->m_Meshlet_Vertex_Buffer, this->m_Meshlet_Vertex_Buffer_Memory);
+			this->Create_Device_Local_Buffer(Meshlet_Triangles.data(), Meshlet_Triangles.size(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, this->m_Meshlet_Triangle_Buffer, this->m_Meshlet_Triangle_Buffer_Memory);
+		}
+
+		cout << "Cluster culling: " << this->m_Cluster_Count << " meshlets in LOD 0, " << static_cast<float>(Meshlets.Vertices.size()) / std::max(1u, this->m_Cluster_Count) << " vertices and "
+			<< static_cast<float>(Lod.Index_Count / 3) / std::max(1u, this->m_Cluster_Count) << " triangles each, built in " << chrono::duration<double, milli>(End_Time - Start_Time).count() << " ms, "
+			<< (this->m_Mesh_Shading ? "drawn by the mesh shader" : "drawn through indirect commands") << endl;
+	}
+
+	void Create_Per_Frame_Buffers(VkDeviceSize Buffer_Size, VkBufferUsageFlags Usage, VkMemoryPropertyFlags Properties, vector<unique_ptr<VkBuffer_T, function<void(VkBuffer)>>>& Buffers, vector<unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>>>& Buffers_Memory) {
+		const auto Delete_Buffer = [Device = this->m_Logical_Device.get()](VkBuffer Buffer) {if (nullptr != Buffer) vkDestroyBuffer(Device, Buffer, nullptr); };
+		const auto Delete_Memory = [Device = this->m_Logical_Device.get()](VkDeviceMemory Memory) {if (nullptr != Memory) vkFreeMemory(Device, Memory, nullptr); };
+
+		Buffers.resize(MAX_FRAMES_IN_FLIGHT);
+		Buffers_Memory.resize(MAX_FRAMES_IN_FLIGHT);
+		for (size_t Index = 0; Index < MAX_FRAMES_IN_FLIGHT; ++Index) {
+			VkBuffer Buffer{ nullptr };
+			VkDeviceMemory Buffer_Memory{ nullptr };
+			this->Create_Buffer(Buffer_Size, Usage, Properties, Buffer, Buffer_Memory);
+
+			Buffers[Index].get_deleter() = Delete_Buffer;
+			Buffers[Index].reset(Buffer);
+
+			Buffers_Memory[Index].get_deleter() = Delete_Memory;
+			Buffers_Memory[Index].reset(Buffer_Memory);
+		}
+	}
+
+	void Allocate_Cull_Descriptor_Sets(const vector<unique_ptr<VkBuffer_T, function<void(VkBuffer)>>>& Draw_Buffers, vector<VkDescriptorSet>& Descriptor_Sets) {
+		vector<VkDescriptorSetLayout> Layouts(MAX_FRAMES_IN_FLIGHT, this->m_Cull_Descriptor_Set_Layout.get());
+
+		VkDescriptorSetAllocateInfo Allocate_Info{};
+		{
+			Allocate_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+			Allocate_Info.descriptorPool = this->m_Cull_Descriptor_Pool.get();
+			Allocate_Info.descriptorSetCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);
+			Allocate_Info.pSetLayouts = Layouts.data();
+		}
+
+		Descriptor_Sets.resize(MAX_FRAMES_IN_FLIGHT);
+		THROW_IF_VK_FAILED(vkAllocateDescriptorSets(this->m_Logical_Device.get(), &Allocate_Info, Descriptor_Sets.data()));
+
+		for (size_t Index = 0; Index < MAX_FRAMES_IN_FLIGHT; ++Index) {
+			const array<VkDescriptorBufferInfo, 8> Buffer_Infos{ {
+				{ this->m_Instance_Buffer.get(), 0, VK_WHOLE_SIZE },
+				{ this->m_Lod_Buffer.get(), 0, VK_WHOLE_SIZE },
+				{ this->m_Draw_Range_Buffer.get(), 0, VK_WHOLE_SIZE },
+				{ Draw_Buffers[Index].get(), 0, VK_WHOLE_SIZE },
+				{ this->m_Cluster_Culling ? this->m_Cluster_Buffer.get() : this->m_Occlusion_State_Buffer.get(), 0, VK_WHOLE_SIZE },
+				{ nullptr, 0, 0 },
+				{ this->m_Occlusion_Culling ? this->m_Occlusion_Uniform_Buffers[Index].get() : nullptr, 0, sizeof(Gpu_Occlusion_Uniforms) },
+				{ this->m_Occlusion_Culling ? this->m_Occlusion_Statistics_Buffers[Index].get() : nullptr, 0, VK_WHOLE_SIZE },
+			} };
+
+			vector<VkWriteDescriptorSet> Descriptor_Writes{};
+			for (uint32_t Binding = 0; Binding < this->Get_Cull_Binding_Count(); ++Binding) {
+				if (5 == Binding)
+					continue;
+
+				VkWriteDescriptorSet Descriptor_Write{};
+				{
+					Descriptor_Write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+					Descriptor_Write.dstSet = Descriptor_Sets[Index];
+					Descriptor_Write.dstBinding = Binding;
+					Descriptor_Write.dstArrayElement = 0;
+					Descriptor_Write.descriptorType = 6 == Binding ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+					Descriptor_Write.descriptorCount = 1;
+					Descriptor_Write.pBufferInfo = &Buffer_Infos[Binding];
+				}
+
+				Descriptor_Writes.push_back(Descriptor_Write);
+			}
+
+			vkUpdateDescriptorSets(this->m_Logical_Device.get(), static_cast<uint32_t>(Descriptor_Writes.size()), Descriptor_Writes.data(), 0, nullptr);
+		}
+	}
+
+	//NOTE : Phase Feeds constant_id 0, Shaders Without Specialization Constants Pass None
+	const VkPipeline Create_Compute_Pipeline(const char* Shader_File_Path, VkPipelineLayout Pipeline_Layout, VkPipelineCache Pipeline_Cache, optional<uint32_t> Phase = nullopt) {
+		const auto& Compute_Shader_Code = Read_File(std::filesystem::path(Shader_File_Path, std::filesystem::path::generic_format));
+		const VkShaderModule Compute_Shader_Module{ this->Create_Shader_Module(Compute_Shader_Code) };
+
+		const uint32_t Phase_Value{ Phase.value_or(0) };
+
+		VkSpecializationMapEntry Map_Entry{};
+		{
+			Map_Entry.constantID = 0;
+			Map_Entry.offset = 0;
+			Map_Entry.size = sizeof(uint32_t);
+		}
+
+		VkSpecializationInfo Specialization_Info{};
+		{
+			Specialization_Info.mapEntryCount = 1;
+			Specialization_Info.pMapEntries = &Map_Entry;
+			Specialization_Info.dataSize = sizeof(uint32_t);
+			Specialization_Info.pData = &Phase_Value;
+		}
+
+		VkComputePipelineCreateInfo Pipeline_Info{};
+		{
+			Pipeline_Info.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+			Pipeline_Info.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+			Pipeline_Info.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+			Pipeline_Info.stage.module = Compute_Shader_Module;
+			Pipeline_Info.stage.pName = "main";
+			Pipeline_Info.stage.pSpecializationInfo = Phase.has_value() ? &Specialization_Info : nullptr;
+			Pipeline_Info.layout = Pipeline_Layout;
+		}
+
+		VkPipeline Compute_Pipeline{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateComputePipelines(this->m_Logical_Device.get(), Pipeline_Cache, 1, &Pipeline_Info, nullptr, &Compute_Pipeline));
+
+		vkDestroyShaderModule(this->m_Logical_Device.get(), Compute_Shader_Module, nullptr);
+
+		return Compute_Pipeline;
+	}
+
+	//NOTE : Size Independent Part Of The Pyramid, The Image And Its Per Level Sets Follow The Swap Chain
+	void Create_Depth_Pyramid_Pipelines(void) {
+		array<VkDescriptorSetLayoutBinding, 2> Bindings{};
+		{
+			{
+				Bindings[0].binding = 0;
+				Bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+				Bindings[0].descriptorCount = 1;
+				Bindings[0].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+				Bindings[0].pImmutableSamplers = nullptr;
+			}
+
+			{
+				Bindings[1].binding = 1;
+				Bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+				Bindings[1].descriptorCount = 1;
+				Bindings[1].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+				Bindings[1].pImmutableSamplers = nullptr;
+			}
+		}
+
+		VkDescriptorSetLayoutCreateInfo Layout_Info{};
+		{
+			Layout_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+			Layout_Info.bindingCount = static_cast<uint32_t>(Bindings.size());
+			Layout_Info.pBindings = Bindings.data();
+		}
+
+		VkDescriptorSetLayout Descriptor_Set_Layout{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateDescriptorSetLayout(this->m_Logical_Device.get(), &Layout_Info, nullptr, &Descriptor_Set_Layout));
+
+		this->m_Pyramid_Descriptor_Set_Layout.get_deleter() = [Device = this->m_Logical_Device.get()](VkDescriptorSetLayout Descriptor_Set_Layout) {if (nullptr != Descriptor_Set_Layout) vkDestroyDescriptorSetLayout(Device, Descriptor_Set_Layout, nullptr); };
+		this->m_Pyramid_Descriptor_Set_Layout.reset(Descriptor_Set_Layout);
+
+		VkPushConstantRange Push_Constant_Range{};
+		{
+			Push_Constant_Range.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+			Push_Constant_Range.offset = 0;
+			Push_Constant_Range.size = sizeof(Gpu_Pyramid_Constants);
+		}
+
+		VkDescriptorSetLayout Set_Layouts[] = { this->m_Pyramid_Descriptor_Set_Layout.get() };
+		VkPipelineLayoutCreateInfo Pipeline_Layout_Info{};
+		{
+			Pipeline_Layout_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+			Pipeline_Layout_Info.setLayoutCount = 1;
+			Pipeline_Layout_Info.pSetLayouts = Set_Layouts;
+			Pipeline_Layout_Info.pushConstantRangeCount = 1;
+			Pipeline_Layout_Info.pPushConstantRanges = &Push_Constant_Range;
+		}
+
+		VkPipelineLayout Pipeline_Layout{ nullptr };
+		THROW_IF_VK_FAILED(vkCreatePipelineLayout(this->m_Logical_Device.get(), &Pipeline_Layout_Info, nullptr, &Pipeline_Layout));
+
+		this->m_Pyramid_Pipeline_Layout.get_deleter() = [Device = this->m_Logical_Device.get()](VkPipelineLayout Pipeline_Layout) {if (nullptr != Pipeline_Layout) vkDestroyPipelineLayout(Device, Pipeline_Layout, nullptr); };
+		this->m_Pyramid_Pipeline_Layout.reset(Pipeline_Layout);
+
+		this->Compile_Pipeline(this->m_Pyramid_Copy_Pipeline, [this, Pipeline_Layout](VkPipelineCache Pipeline_Cache) {
+			return this->Create_Compute_Pipeline(Depth_Pyramid_Copy_Shader_File_Path, Pipeline_Layout, Pipeline_Cache);
+		});
+
+		this->Compile_Pipeline(this->m_Pyramid_Reduce_Pipeline, [this, Pipeline_Layout](VkPipelineCache Pipeline_Cache) {
+			return this->Create_Compute_Pipeline(Depth_Pyramid_Reduce_Shader_File_Path, Pipeline_Layout, Pipeline_Cache);
+		});
+
+		//NOTE : Only texelFetch Reads The Pyramid, The Sampler Exists Because The Bindings Are Combined Image Samplers
+		VkSamplerCreateInfo Sampler_Info{};
+		{
+			Sampler_Info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+			Sampler_Info.magFilter = VK_FILTER_NEAREST;
+			Sampler_Info.minFilter = VK_FILTER_NEAREST;
+			Sampler_Info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+			Sampler_Info.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+			Sampler_Info.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+			Sampler_Info.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+			Sampler_Info.anisotropyEnable = VK_FALSE;
+			Sampler_Info.compareEnable = VK_FALSE;
+			Sampler_Info.minLod = 0.0f;
+			Sampler_Info.maxLod = VK_LOD_CLAMP_NONE;
+			Sampler_Info.borderColor = VK_BORDER_COLOR_FLOAT_OPAQUE_WHITE;
+			Sampler_Info.unnormalizedCoordinates = VK_FALSE;
+		}
+
+		VkSampler Sampler{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateSampler(this->m_Logical_Device.get(), &Sampler_Info, nullptr, &Sampler));
+
+		this->m_Pyramid_Sampler.get_deleter() = [Device = this->m_Logical_Device.get()](VkSampler Sampler) {if (nullptr != Sampler) vkDestroySampler(Device, Sampler, nullptr); };
+		this->m_Pyramid_Sampler.reset(Sampler);
+	}
+
+	//NOTE : Level 0 Is Copied From The Multisampled Depth, Every Further Level Keeps The Farthest Depth Of Its 2x2 Footprint
+	void Create_Depth_Pyramid(void) {
+		this->m_Pyramid_Level_Count = Gpu_Culling::Get_Pyramid_Level_Count(this->m_Swap_Chain_Extent);
+
+		VkImage Pyramid_Image{ nullptr };
+		VkDeviceMemory Pyramid_Image_Memory{ nullptr };
+		this->Create_Image(
+			this->m_Swap_Chain_Extent.width,
+			this->m_Swap_Chain_Extent.height,
+			this->m_Pyramid_Level_Count,
+			VK_FORMAT_R32_SFLOAT,
+			VK_SAMPLE_COUNT_1_BIT,
+			VK_IMAGE_TILING_OPTIMAL,
+			VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+			Pyramid_Image,
+			Pyramid_Image_Memory
+		);
+
+		this->m_Pyramid_Image.get_deleter() = [Device = this->m_Logical_Device.get()](VkImage Image) {if (nullptr != Image) vkDestroyImage(Device, Image, nullptr); };
+		this->m_Pyramid_Image.reset(Pyramid_Image);
+		this->m_Render_Graph.Set_Image(this->m_Graph_Depth_Pyramid, Pyramid_Image);
+
+		this->m_Pyramid_Image_Memory.get_deleter() = [Device = this->m_Logical_Device.get()](VkDeviceMemory Memory) {if (nullptr != Memory) vkFreeMemory(Device, Memory, nullptr); };
+		this->m_Pyramid_Image_Memory.reset(Pyramid_Image_Memory);
+
+		const auto Delete_Image_View = [Device = this->m_Logical_Device.get()](VkImageView Image_View) {if (nullptr != Image_View) vkDestroyImageView(Device, Image_View, nullptr); };
+
+		this->m_Pyramid_Image_View.get_deleter() = Delete_Image_View;
+		this->m_Pyramid_Image_View.reset(this->Create_Image_View(this->m_Pyramid_Image.get(), this->m_Pyramid_Level_Count, VK_FORMAT_R32_SFLOAT, VK_IMAGE_ASPECT_COLOR_BIT));
+
+		this->m_Pyramid_Level_Views.resize(this->m_Pyramid_Level_Count);
+		for (uint32_t Level = 0; Level < this->m_Pyramid_Level_Count; ++Level) {
+			this->m_Pyramid_Level_Views[Level].get_deleter() = Delete_Image_View;
+			this->m_Pyramid_Level_Views[Level].reset(this->Create_Image_View(this->m_Pyramid_Image.get(), 1, VK_FORMAT_R32_SFLOAT, VK_IMAGE_ASPECT_COLOR_BIT, Level));
+		}
+
+		//NOTE : The Pyramid Never Leaves GENERAL, It Is Written As Storage And Sampled In The Same Frame
+		{
+			VkCommandBuffer Command_Buffer{ this->Begin_SingleTime_Commands() };
+
+			this->m_Barrier_Builder.Image_Transition(this->m_Pyramid_Image.get(), { VK_IMAGE_ASPECT_COLOR_BIT, 0, this->m_Pyramid_Level_Count, 0, 1 },
+				VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_SAMPLED_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT,
+				VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL);
+			this->m_Barrier_Builder.Flush(Command_Buffer);
+
+			this->End_SingleTime_Commands(Command_Buffer);
+		}
+
+		array<VkDescriptorPoolSize, 2> Pool_Sizes{};
+		{
+			{
+				Pool_Sizes[0].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+				Pool_Sizes[0].descriptorCount = this->m_Pyramid_Level_Count;
+			}
+
+			{
+				Pool_Sizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+				Pool_Sizes[1].descriptorCount = this->m_Pyramid_Level_Count;
+			}
+		}
+
+		VkDescriptorPoolCreateInfo Pool_Info{};
+		{
+			Pool_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+			Pool_Info.poolSizeCount = static_cast<uint32_t>(Pool_Sizes.size());
+			Pool_Info.pPoolSizes = Pool_Sizes.data();
+			Pool_Info.maxSets = this->m_Pyramid_Level_Count;
+		}
+
+		VkDescriptorPool Descriptor_Pool{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateDescriptorPool(this->m_Logical_Device.get(), &Pool_Info, nullptr, &Descriptor_Pool));
+
+		this->m_Pyramid_Descriptor_Pool.get_deleter() = [Device = this->m_Logical_Device.get()](VkDescriptorPool Descriptor_Pool) {if (nullptr != Descriptor_Pool) vkDestroyDescriptorPool(Device, Descriptor_Pool, nullptr); };
+		this->m_Pyramid_Descriptor_Pool.reset(Descriptor_Pool);
+
+		vector<VkDescriptorSetLayout> Layouts(this->m_Pyramid_Level_Count, this->m_Pyramid_Descriptor_Set_Layout.get());
+
+		VkDescriptorSetAllocateInfo Allocate_Info{};
+		{
+			Allocate_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+			Allocate_Info.descriptorPool = this->m_Pyramid_Descriptor_Pool.get();
+			Allocate_Info.descriptorSetCount = this->m_Pyramid_Level_Count;
+			Allocate_Info.pSetLayouts = Layouts.data();
+		}
+
+		this->m_Pyramid_Descriptor_Sets.resize(this->m_Pyramid_Level_Count);
+		THROW_IF_VK_FAILED(vkAllocateDescriptorSets(this->m_Logical_Device.get(), &Allocate_Info, this->m_Pyramid_Descriptor_Sets.data()));
+
+		for (uint32_t Level = 0; Level < this->m_Pyramid_Level_Count; ++Level) {
+			VkDescriptorImageInfo Source_Info{};
+			{
+				Source_Info.sampler = this->m_Pyramid_Sampler.get();
+				Source_Info.imageView = 0 == Level ? this->m_Depth_Image_View.get() : this->m_Pyramid_Level_Views[Level - 1].get();
+				Source_Info.imageLayout = 0 == Level ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_GENERAL;
+			}
+
+			VkDescriptorImageInfo Destination_Info{};
+			{
+				Destination_Info.sampler = nullptr;
+				Destination_Info.imageView = this->m_Pyramid_Level_Views[Level].get();
+				Destination_Info.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+			}
+
+			array<VkWriteDescriptorSet, 2> Descriptor_Writes{};
+			{
+				{
+					Descriptor_Writes[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+					Descriptor_Writes[0].dstSet = this->m_Pyramid_Descriptor_Sets[Level];
+					Descriptor_Writes[0].dstBinding = 0;
+					Descriptor_Writes[0].dstArrayElement = 0;
+					Descriptor_Writes[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+					Descriptor_Writes[0].descriptorCount = 1;
+					Descriptor_Writes[0].pImageInfo = &Source_Info;
+				}
+
+				{
+					Descriptor_Writes[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+					Descriptor_Writes[1].dstSet = this->m_Pyramid_Descriptor_Sets[Level];
+					Descriptor_Writes[1].dstBinding = 1;
+					Descriptor_Writes[1].dstArrayElement = 0;
+					Descriptor_Writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+					Descriptor_Writes[1].descriptorCount = 1;
+					Descriptor_Writes[1].pImageInfo = &Destination_Info;
+				}
+			}
+
+			vkUpdateDescriptorSets(this->m_Logical_Device.get(), static_cast<uint32_t>(Descriptor_Writes.size()), Descriptor_Writes.data(), 0, nullptr);
+		}
+
+		VkDescriptorImageInfo Pyramid_Info{};
+		{
+			Pyramid_Info.sampler = this->m_Pyramid_Sampler.get();
+			Pyramid_Info.imageView = this->m_Pyramid_Image_View.get();
+			Pyramid_Info.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+		}
+
+		vector<VkWriteDescriptorSet> Descriptor_Writes{};
+		for (const auto* Descriptor_Sets : { &this->m_Cull_Descriptor_Sets, &this->m_Late_Cull_Descriptor_Sets })
+			for (const VkDescriptorSet Descriptor_Set : *Descriptor_Sets) {
+				VkWriteDescriptorSet Descriptor_Write{};
+				{
+					Descriptor_Write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+					Descriptor_Write.dstSet = Descriptor_Set;
+					Descriptor_Write.dstBinding = 5;
+					Descriptor_Write.dstArrayElement = 0;
+					Descriptor_Write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+					Descriptor_Write.descriptorCount = 1;
+					Descriptor_Write.pImageInfo = &Pyramid_Info;
+				}
+
+				Descriptor_Writes.push_back(Descriptor_Write);
+			}
+
+		vkUpdateDescriptorSets(this->m_Logical_Device.get(), static_cast<uint32_t>(Descriptor_Writes.size()), Descriptor_Writes.data(), 0, nullptr);
+
+		//NOTE : A New Pyramid Holds Nothing Yet, The First Early Phase Must Not Reject Against It
+		this->m_Depth_Pyramid_Valid = false;
+	}
+
+	void Create_Descriptor_Pool(void) {
+		array<VkDescriptorPoolSize, 3> Pool_Sizes{};
+		{
+			{
+				Pool_Sizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+				Pool_Sizes[0].descriptorCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);
+			}
+
+			{
+				Pool_Sizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+				Pool_Sizes[1].descriptorCount = static_cast<uint32_t>(this->m_Texture_Slot_Count * MAX_FRAMES_IN_FLIGHT);
+			}
+
+			{
+				Pool_Sizes[2].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+				Pool_Sizes[2].descriptorCount = static_cast<uint32_t>((this->m_Mesh_Shading ? 6 : 2) * MAX_FRAMES_IN_FLIGHT);
+			}
+		}
+
+		VkDescriptorPoolCreateInfo Pool_Info{};
+		{
+			Pool_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+			Pool_Info.poolSizeCount = static_cast<uint32_t>(Pool_Sizes.size());
+			Pool_Info.pPoolSizes = Pool_Sizes.data();
+			Pool_Info.maxSets = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);
+		}
+
+		VkDescriptorPool Descriptor_Pool{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateDescriptorPool(this->m_Logical_Device.get(), &Pool_Info, nullptr, &Descriptor_Pool));
+
+		this->m_Descriptor_Pool.get_deleter() = [Device = this->m_Logical_Device.get()](VkDescriptorPool Descriptor_Pool) {if (nullptr != Descriptor_Pool) vkDestroyDescriptorPool(Device, Descriptor_Pool, nullptr); };
+		this->m_Descriptor_Pool.reset(Descriptor_Pool);
+	}
+
+	void Create_Descriptor_Sets(void) {
+		vector<VkDescriptorSetLayout> Layouts(MAX_FRAMES_IN_FLIGHT, this->m_Descriptor_Set_Layout.get());
+
+		VkDescriptorSetAllocateInfo Allocate_Info{};
+		{
+			Allocate_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+			Allocate_Info.descriptorPool = this->m_Descriptor_Pool.get();
+			Allocate_Info.descriptorSetCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);
+			Allocate_Info.pSetLayouts = Layouts.data();
+		}
+
+		this->m_Descriptor_Sets.resize(MAX_FRAMES_IN_FLIGHT);
+		THROW_IF_VK_FAILED(vkAllocateDescriptorSets(this->m_Logical_Device.get(), &Allocate_Info, this->m_Descriptor_Sets.data()));
+
+		for (size_t Index = 0; Index < MAX_FRAMES_IN_FLIGHT; ++Index) {
+			VkDescriptorBufferInfo Buffer_Info{};
+			{
+				Buffer_Info.buffer = this->m_Uniform_Buffers[Index].get();
+				Buffer_Info.offset = 0;
+				Buffer_Info.range = sizeof(Uniform_Buffer_Object);
+			}
+
+			//NOTE : Every Slot Has To Hold A Valid Descriptor, Those No Texture Was Loaded Into Repeat Slot 0
+			vector<VkDescriptorImageInfo> Image_Infos(this->m_Texture_Slot_Count);
+			for (uint32_t Slot = 0; Slot < this->m_Texture_Slot_Count; ++Slot) {
+				Image_Infos[Slot].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+				Image_Infos[Slot].imageView = this->m_Texture_Image_Views[Slot < this->m_Texture_Image_Views.size() ? Slot : 0].get();
+				Image_Infos[Slot].sampler = this->m_Texture_Sampler.get();
+			}
+
+			VkDescriptorBufferInfo Instance_Buffer_Info{};
+			{
+				Instance_Buffer_Info.buffer = this->m_Instance_Buffer.get();
+				Instance_Buffer_Info.offset = 0;
+				Instance_Buffer_Info.range = VK_WHOLE_SIZE;
+			}
+
+			VkDescriptorBufferInfo Vertex_Buffer_Info{};
+			{
+				Vertex_Buffer_Info.buffer = this->m_Vertex_Buffer.get();
+				Vertex_Buffer_Info.offset = 0;
+				Vertex_Buffer_Info.range = VK_WHOLE_SIZE;
+			}
+
+			array<VkWriteDescriptorSet, 4> Descriptor_Writes{};
+			{
+				{
+					Descriptor_Writes[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+					Descriptor_Writes[0].dstSet = this->m_Descriptor_Sets[Index];
+					Descriptor_Writes[0].dstBinding = 0;
+					Descriptor_Writes[0].dstArrayElement = 0;
+					Descriptor_Writes[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+					Descriptor_Writes[0].descriptorCount = 1;
+					Descriptor_Writes[0].pBufferInfo = &Buffer_Info;
+				}
+
+				{
+					Descriptor_Writes[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+					Descriptor_Writes[1].dstSet = this->m_Descriptor_Sets[Index];
+					Descriptor_Writes[1].dstBinding = 1;
+					Descriptor_Writes[1].dstArrayElement = 0;
+					Descriptor_Writes[1].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+					Descriptor_Writes[1].descriptorCount = this->m_Texture_Slot_Count;
+					Descriptor_Writes[1].pImageInfo = Image_Infos.data();
+				}
+
+				{
+					Descriptor_Writes[2].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+					Descriptor_Writes[2].dstSet = this->m_Descriptor_Sets[Index];
+					Descriptor_Writes[2].dstBinding = 2;
+					Descriptor_Writes[2].dstArrayElement = 0;
+					Descriptor_Writes[2].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+					Descriptor_Writes[2].descriptorCount = 1;
+					Descriptor_Writes[2].pBufferInfo = &Instance_Buffer_Info;
+				}
+
+				{
+					Descriptor_Writes[3].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+					Descriptor_Writes[3].dstSet = this->m_Descriptor_Sets[Index];
+					Descriptor_Writes[3].dstBinding = 3;
+					Descriptor_Writes[3].dstArrayElement = 0;
+					Descriptor_Writes[3].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+					Descriptor_Writes[3].descriptorCount = 1;
+					Descriptor_Writes[3].pBufferInfo = &Vertex_Buffer_Info;
+				}
+			}
+
+			vkUpdateDescriptorSets(this->m_Logical_Device.get(), static_cast<uint32_t>(Descriptor_Writes.size()), Descriptor_Writes.data(), 0, nullptr);
+
+			if (!this->m_Mesh_Shading)
+				continue;
+
+			const array<VkDescriptorBufferInfo, 4> Mesh_Buffer_Infos{ {
+				{ this->m_Cluster_Buffer.get(), 0, VK_WHOLE_SIZE },
+				{ this->m_Meshlet_Vertex_Buffer.get(), 0, VK_WHOLE_SIZE },
+				{ this->m_Meshlet_Triangle_Buffer.get(), 0, VK_WHOLE_SIZE },
+				{ this->m_Draw_Buffers[Index].get(), 0, VK_WHOLE_SIZE },
+			} };
+
+			array<VkWriteDescriptorSet, 4> Mesh_Descriptor_Writes{};
+			for (uint32_t Binding = 0; Binding < Mesh_Descriptor_Writes.size(); ++Binding) {
+				Mesh_Descriptor_Writes[Binding].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+				Mesh_Descriptor_Writes[Binding].dstSet = this->m_Descriptor_Sets[Index];
+				Mesh_Descriptor_Writes[Binding].dstBinding = 4 + Binding;
+				Mesh_Descriptor_Writes[Binding].dstArrayElement = 0;
+				Mesh_Descriptor_Writes[Binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+				Mesh_Descriptor_Writes[Binding].descriptorCount = 1;
+				Mesh_Descriptor_Writes[Binding].pBufferInfo = &Mesh_Buffer_Infos[Binding];
+			}
+
+			vkUpdateDescriptorSets(this->m_Logical_Device.get(), static_cast<uint32_t>(Mesh_Descriptor_Writes.size()), Mesh_Descriptor_Writes.data(), 0, nullptr);
+		}
+
+	}
+
+	void Create_Command_Buffers(void) {
+		this->m_Command_Buffers.resize(MAX_FRAMES_IN_FLIGHT);
+
+		VkCommandBufferAllocateInfo Command_Buffer_Allocate_Info{};
+		{
+			Command_Buffer_Allocate_Info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			Command_Buffer_Allocate_Info.commandPool = this->m_Command_Pool.get();
+			Command_Buffer_Allocate_Info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+			Command_Buffer_Allocate_Info.commandBufferCount = static_cast<uint32_t>(m_Command_Buffers.size());
+		}
+
+		THROW_IF_VK_FAILED(vkAllocateCommandBuffers(this->m_Logical_Device.get(), &Command_Buffer_Allocate_Info, this->m_Command_Buffers.data()));
+	}
+
+	void Record_Command_Buffer(VkCommandBuffer Command_Buffer, uint32_t Image_Index) {
+
+		VkCommandBufferBeginInfo Command_Buffer_Begin_Info{};
+		{
+			Command_Buffer_Begin_Info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+			Command_Buffer_Begin_Info.pInheritanceInfo = nullptr;
+		}
+
+		if (VK_SUCCESS != vkBeginCommandBuffer(this->m_Command_Buffers[this->m_Current_Frame], &Command_Buffer_Begin_Info))
+			throw runtime_error("Failed to begin recording command buffer!");
+
+		this->m_Image_Index = Image_Index;
+		this->m_Render_Graph.Set_Image(this->m_Graph_Swap_Chain, this->m_Swap_Chain_Images[Image_Index]);
+
+		//NOTE : Passes Record Only Their Own Work, Every Barrier Between Them Comes From The Graph
+		this->m_Draw_State.Begin(Command_Buffer, this->m_Barrier_Builder);
+		this->m_Render_Graph.Execute(Command_Buffer, this->m_Barrier_Builder);
+		this->m_Draw_State.End(this->m_Barrier_Builder);
+
+		if (VK_SUCCESS != vkEndCommandBuffer(Command_Buffer))
+			throw runtime_error("Failed to record command buffer!");
+	}
+
+	void Record_Scene_Pass(VkCommandBuffer Command_Buffer, Render_Pass_Phase Phase, VkBuffer Draw_Buffer) {
+		VkRect2D Render_Area{};
+		{
+			Render_Area.offset = { 0, 0 };
+			Render_Area.extent = this->m_Swap_Chain_Extent;
+		}
+
+		array<VkClearValue, 2> Clear_Values{};
+		{
+			Clear_Values[0].color = { 0.0f, 0.0f, 0.0f, 1.0f };
+			Clear_Values[1].depthStencil = { 1.0f, 0 };
+		}
+
+		VkViewport Viewport{};
+		{
+			Viewport.x = 0.0f;
+			Viewport.y = 0.0f;
+			Viewport.width = static_cast<float>(this->m_Swap_Chain_Extent.width);
+			Viewport.height = static_cast<float>(this->m_Swap_Chain_Extent.height);
+			Viewport.minDepth = 0.0f;
+			Viewport.maxDepth = 1.0f;
+		}
+
+		VkRect2D Scissor{};
+		{
+			Scissor.offset = { 0, 0 };
+			Scissor.extent = this->m_Swap_Chain_Extent;
+		}
+
+		//NOTE : Same Load, Store And Resolve As The Render Pass Objects, Only Declared At Record Time
+		if (this->m_Dynamic_Rendering) {
+			VkRenderingAttachmentInfoKHR Color_Attachment{};
+			{
+				Color_Attachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+				Color_Attachment.imageView = this->m_Color_Image_View.get();
+				Color_Attachment.imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+				Color_Attachment.resolveMode = Scene_Pass::Get_Resolve_Mode(Phase);
+				Color_Attachment.resolveImageView = VK_RESOLVE_MODE_NONE == Color_Attachment.resolveMode ? VK_NULL_HANDLE : this->m_Swap_Chain_Image_Views[this->m_Image_Index].get();
+				Color_Attachment.resolveImageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+				Color_Attachment.loadOp = Scene_Pass::Get_Load_Op(Phase);
+				Color_Attachment.storeOp = Scene_Pass::Get_Store_Op(Phase);
+				Color_Attachment.clearValue = Clear_Values[0];
+			}
+
+			VkRenderingAttachmentInfoKHR Depth_Attachment{};
+			{
+				Depth_Attachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+				Depth_Attachment.imageView = this->m_Depth_Image_View.get();
+				Depth_Attachment.imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+				Depth_Attachment.resolveMode = VK_RESOLVE_MODE_NONE;
+				Depth_Attachment.loadOp = Scene_Pass::Get_Load_Op(Phase);
+				Depth_Attachment.storeOp = Scene_Pass::Get_Store_Op(Phase);
+				Depth_Attachment.clearValue = Clear_Values[1];
+			}
+
+			VkRenderingInfoKHR Rendering_Info{};
+			{
+				Rendering_Info.sType = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+				Rendering_Info.renderArea = Render_Area;
+				Rendering_Info.layerCount = 1;
+				Rendering_Info.colorAttachmentCount = 1;
+				Rendering_Info.pColorAttachments = &Color_Attachment;
+				Rendering_Info.pDepthAttachment = &Depth_Attachment;
+				Rendering_Info.pStencilAttachment = nullptr;
+			}
+
+			this->m_Cmd_Begin_Rendering(Command_Buffer, &Rendering_Info);
+			this->Record_Scene_Draws(Viewport, Scissor, Draw_Buffer);
+			this->m_Cmd_End_Rendering(Command_Buffer);
+			return;
+		}
+
+		const VkRenderPass Render_Pass{ Render_Pass_Early == Phase ? this->m_Early_Render_Pass.get() : Render_Pass_Late == Phase ? this->m_Late_Render_Pass.get() : this->m_Render_Pass.get() };
+
+		VkRenderPassBeginInfo Render_Pass_Begin_Info{};
+		{
+			Render_Pass_Begin_Info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+			Render_Pass_Begin_Info.renderPass = Render_Pass;
+			Render_Pass_Begin_Info.framebuffer = this->m_Swap_Chain_Frame_buffers[this->m_Image_Index].get();
+			Render_Pass_Begin_Info.renderArea = Render_Area;
+			Render_Pass_Begin_Info.clearValueCount = static_cast<uint32_t>(Clear_Values.size());
+			Render_Pass_Begin_Info.pClearValues = Clear_Values.data();
+		}
+
+		vkCmdBeginRenderPass(Command_Buffer, &Render_Pass_Begin_Info, VK_SUBPASS_CONTENTS_INLINE);
+		this->Record_Scene_Draws(Viewport, Scissor, Draw_Buffer);
+		vkCmdEndRenderPass(Command_Buffer);
+	}
+
+	//NOTE : Null Draw Buffer Means The CPU Culled Visible List Is Drawn Directly, Commands Go Through The Draw State Begun On The Frame's Buffer
+	void Record_Scene_Draws(const VkViewport& Viewport, const VkRect2D& Scissor, VkBuffer Draw_Buffer) {
+		//NOTE : Both Phases Of Occlusion Culling Draw With The Same State, The Late Pass Records Only Its Draw
+		this->m_Draw_State.Bind_Pipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, this->m_Graphics_Pipeline.get());
+		this->m_Draw_State.Set_Material(this->m_Extended_Dynamic_State, this->m_Scene_Material, this->m_Msaa_Samples);
+
+		this->m_Draw_State.Set_Viewport(Viewport);
+		this->m_Draw_State.Set_Scissor(Scissor);
+
+		//NOTE : Pulled Vertices Come Through The Descriptor Set, Only The Layout Of The Mesh Is Pushed
+		if (this->m_Vertex_Pulling || this->m_Mesh_Shading)
+			this->m_Draw_State.Push_Constants(VK_PIPELINE_BIND_POINT_GRAPHICS, this->m_Pipeline_Layout.get(), this->Get_Geometry_Stage(), this->m_Vertex_Layout.Get_Pull_Constants());
+		else
+			this->m_Draw_State.Bind_Vertex_Buffer(this->m_Vertex_Buffer.get(), 0);
+
+		this->m_Draw_State.Bind_Index_Buffer(this->m_Index_Buffer.get(), 0, this->m_Geometry_Pool.Get_Index_Type());
+		this->m_Draw_State.Bind_Descriptor_Set(VK_PIPELINE_BIND_POINT_GRAPHICS, this->m_Pipeline_Layout.get(), this->m_Descriptor_Sets[this->m_Current_Frame]);
+
+		//NOTE : The Cluster Pass Grew The Grid In Front Of The Tasks To Cover Them, So One Indirect Launch Draws Everything
+		if (this->m_Mesh_Shading)
+			this->m_Draw_State.Draw_Mesh_Tasks_Indirect(this->m_Cmd_Draw_Mesh_Tasks_Indirect, Draw_Buffer, 0, 1, sizeof(VkDrawMeshTasksIndirectCommandEXT));
+		else if (nullptr != Draw_Buffer)
+			this->m_Draw_State.Draw_Indexed_Indirect_Count(
+				Draw_Buffer, Gpu_Culling::Draw_Commands_Offset,
+				Draw_Buffer, 0,
+				this->m_Max_Draw_Count, sizeof(VkDrawIndexedIndirectCommand));
+		else
+			this->m_Draw_Queue.Record(this->m_Draw_State);
+	}
+
+	//NOTE : Occlusion Culling Also Restarts The Late Count And The Statistics, Mesh Tasks Also Restart Their Grid
+	void Record_Draw_Count_Reset(VkCommandBuffer Command_Buffer) {
+		vkCmdFillBuffer(Command_Buffer, this->m_Draw_Buffers[this->m_Current_Frame].get(), 0, this->m_Mesh_Shading ? Gpu_Culling::Draw_Commands_Offset : sizeof(uint32_t), 0);
+
+		if (this->m_Occlusion_Culling) {
+			vkCmdFillBuffer(Command_Buffer, this->m_Late_Draw_Buffers[this->m_Current_Frame].get(), 0, sizeof(uint32_t), 0);
+			vkCmdFillBuffer(Command_Buffer, this->m_Occlusion_Statistics_Buffers[this->m_Current_Frame].get(), 0, VK_WHOLE_SIZE, 0);
+		}
+	}
+
+	//NOTE : Cull And Compact On The GPU Into Commands For The Indirect Stage, Cost Is Independent Of Instance Count
+	void Record_Gpu_Culling(void) {
+		const uint32_t Instance_Count{ static_cast<uint32_t>(this->m_Object_Transforms.size()) };
+		const Gpu_Cull_Constants Constants{ Gpu_Culling::Build_Constants(this->m_Scene_Matrix, this->m_View_Matrix, this->m_Proj_Matrix,
+			static_cast<float>(this->m_Swap_Chain_Extent.height), Instance_Count, static_cast<uint32_t>(this->m_Mesh_Lods.size()), this->m_Max_Draw_Count) };
+
+		this->m_Draw_State.Bind_Pipeline(VK_PIPELINE_BIND_POINT_COMPUTE, this->m_Cull_Pipeline.get());
+		this->m_Draw_State.Bind_Descriptor_Set(VK_PIPELINE_BIND_POINT_COMPUTE, this->m_Cull_Pipeline_Layout.get(), this->m_Cull_Descriptor_Sets[this->m_Current_Frame]);
+		this->m_Draw_State.Push_Constants(VK_PIPELINE_BIND_POINT_COMPUTE, this->m_Cull_Pipeline_Layout.get(), VK_SHADER_STAGE_COMPUTE_BIT, Constants);
+
+		//NOTE : One Row Of Workgroups Per Instance, Each Thread Owns One Cluster
+		if (this->m_Cluster_Culling)
+			this->m_Draw_State.Dispatch(Gpu_Culling::Get_Group_Count(this->m_Cluster_Count), Instance_Count, 1);
+		else
+			this->m_Draw_State.Dispatch(Gpu_Culling::Get_Group_Count(Instance_Count), 1, 1);
+	}
+
+	//NOTE : Early Tests Against Last Frame's Pyramid, Late Re-Tests Only What Early Rejected Against The Pyramid Just Built
+	void Record_Occlusion_Culling(Render_Pass_Phase Phase) {
+		const bool Early{ Render_Pass_Early == Phase };
+		const glm::mat4 View_Proj{ this->m_Proj_Matrix * this->m_View_Matrix * this->m_Scene_Matrix };
+
+		if (Early) {
+			Gpu_Occlusion_Uniforms Uniforms{};
+			{
+				Uniforms.View_Proj = View_Proj;
+				Uniforms.Previous_View_Proj = this->m_Previous_View_Proj;
+				Uniforms.Pyramid = glm::vec4(
+					static_cast<float>(this->m_Swap_Chain_Extent.width),
+					static_cast<float>(this->m_Swap_Chain_Extent.height),
+					static_cast<float>(this->m_Pyramid_Level_Count),
+					this->m_Depth_Pyramid_Valid ? 1.0f : 0.0f);
+			}
+
+			memcpy(this->m_Occlusion_Uniforms_Mapped[this->m_Current_Frame], &Uniforms, sizeof(Uniforms));
+		}
+
+		const uint32_t Instance_Count{ static_cast<uint32_t>(this->m_Object_Transforms.size()) };
+		const Gpu_Cull_Constants Constants{ Gpu_Culling::Build_Constants(this->m_Scene_Matrix, this->m_View_Matrix, this->m_Proj_Matrix,
+			static_cast<float>(this->m_Swap_Chain_Extent.height), Instance_Count, static_cast<uint32_t>(this->m_Mesh_Lods.size()), this->m_Max_Draw_Count) };
+
+		//NOTE : Constants Match Between The Phases, The Late Pass Only Rebinds Its Pipeline And Set
+		this->m_Draw_State.Bind_Pipeline(VK_PIPELINE_BIND_POINT_COMPUTE, (Early ? this->m_Cull_Pipeline : this->m_Late_Cull_Pipeline).get());
+		this->m_Draw_State.Bind_Descriptor_Set(VK_PIPELINE_BIND_POINT_COMPUTE, this->m_Cull_Pipeline_Layout.get(), (Early ? this->m_Cull_Descriptor_Sets : this->m_Late_Cull_Descriptor_Sets)[this->m_Current_Frame]);
+		this->m_Draw_State.Push_Constants(VK_PIPELINE_BIND_POINT_COMPUTE, this->m_Cull_Pipeline_Layout.get(), VK_SHADER_STAGE_COMPUTE_BIT, Constants);
+		this->m_Draw_State.Dispatch(Gpu_Culling::Get_Group_Count(Instance_Count), 1, 1);
+
+		if (!Early) {
+			this->m_Previous_View_Proj = View_Proj;
+			this->m_Depth_Pyramid_Valid = true;
+		}
+	}
+
+	//NOTE : Runs Between The Two Passes, Only The Barriers Between Its Own Levels Are Recorded Here, The Graph Orders It Against Everything Else
+	void Record_Depth_Pyramid(VkCommandBuffer Command_Buffer) {
+		VkExtent2D Source_Extent{ this->m_Swap_Chain_Extent };
+		for (uint32_t Level = 0; Level < this->m_Pyramid_Level_Count; ++Level) {
+			const VkExtent2D Destination_Extent{ Gpu_Culling::Get_Pyramid_Level_Extent(this->m_Swap_Chain_Extent, Level) };
+
+			Gpu_Pyramid_Constants Constants{};
+			{
+				Constants.Source_Size = glm::ivec2(Source_Extent.width, Source_Extent.height);
+				Constants.Destination_Size = glm::ivec2(Destination_Extent.width, Destination_Extent.height);
+				Constants.Sample_Count = static_cast<int32_t>(this->m_Msaa_Samples);
+			}
+
+			this->m_Draw_State.Bind_Pipeline(VK_PIPELINE_BIND_POINT_COMPUTE, (0 == Level ? this->m_Pyramid_Copy_Pipeline : this->m_Pyramid_Reduce_Pipeline).get());
+			this->m_Draw_State.Bind_Descriptor_Set(VK_PIPELINE_BIND_POINT_COMPUTE, this->m_Pyramid_Pipeline_Layout.get(), this->m_Pyramid_Descriptor_Sets[Level]);
+			this->m_Draw_State.Push_Constants(VK_PIPELINE_BIND_POINT_COMPUTE, this->m_Pyramid_Pipeline_Layout.get(), VK_SHADER_STAGE_COMPUTE_BIT, Constants);
+			this->m_Draw_State.Dispatch((Destination_Extent.width + 7) / 8, (Destination_Extent.height + 7) / 8, 1);
+
+			//NOTE : The Next Level Only Samples This One, The Rest Of The Pyramid Stays Free To Overlap
+			if (Level + 1 < this->m_Pyramid_Level_Count) {
+				this->m_Barrier_Builder.Image_Transition(this->m_Pyramid_Image.get(), { VK_IMAGE_ASPECT_COLOR_BIT, Level, 1, 0, 1 },
+					VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_SAMPLED_READ_BIT,
+					VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_GENERAL);
+				this->m_Barrier_Builder.Flush(Command_Buffer);
+			}
+
+			Source_Extent = Destination_Extent;
+		}
+	}
+
+	void Report_Occlusion_Statistics(void) {
+		const auto Current_Time{ chrono::high_resolution_clock::now() };
+		if (Current_Time - this->m_Occlusion_Report_Time < chrono::seconds(1))
+			return;
+
+		this->m_Occlusion_Report_Time = Current_Time;
+
+		Gpu_Occlusion_Statistics Statistics{};
+		memcpy(&Statistics, this->m_Occlusion_Statistics_Mapped[this->m_Current_Frame], sizeof(Statistics));
+
+		cout << "Occlusion culling : " << Statistics.Early_Visible + Statistics.Late_Visible << " visible ("
+			<< Statistics.Early_Visible << " early, " << Statistics.Late_Visible << " late), "
+			<< Statistics.Frustum_Culled << " frustum culled, " << Statistics.Occluded << " occluded" << endl;
+	}
+
+	//NOTE : Counts Of The Last Recorded Frame, Whose Command Buffer Is Not Necessarily Done Yet
+	void Report_Draw_State_Statistics(void) {
+		const auto Current_Time{ chrono::high_resolution_clock::now() };
+		if (Current_Time - this->m_Draw_State_Report_Time < chrono::seconds(1))
+			return;
+
+		this->m_Draw_State_Report_Time = Current_Time;
+		this->m_Draw_State.Report("Frame");
+	}
+
+	const size_t Select_Mesh_Lod(const glm::mat4& Model_Matrix) const {
+		const glm::vec3 Camera_Position{ glm::inverse(this->m_View_Matrix)[3] };
+		const Bounding_Sphere Sphere{ this->m_Mesh_Sphere.Transform(Model_Matrix) };
+
+		//NOTE : Nearest Point Of The Bounding Sphere, Camera Inside Means Full Detail
+		const float Distance{ glm::length(Sphere.Center - Camera_Position) - Sphere.Radius };
+		if (0.0f >= Distance)
+			return 0;
+
+		const float Pixels_Per_Unit{ 0.5f * static_cast<float>(this->m_Swap_Chain_Extent.height) * glm::abs(this->m_Proj_Matrix[1][1]) / Distance };
+
+		for (size_t Lod = this->m_Mesh_Lods.size(); Lod > 0; --Lod)
+			if (this->m_Mesh_Lods[Lod - 1].Error * Pixels_Per_Unit <= Lod_Pixel_Threshold)
+				return Lod - 1;
+
+		return 0;
+	}
+
+	void Cull_Scene(void) {
+		for (size_t Object = 0; Object < this->m_Object_Transforms.size(); ++Object)
+			this->m_Object_Volumes.Set(Object, this->m_Mesh_Sphere, this->m_Mesh_Bounds, this->m_Scene_Matrix * this->m_Object_Transforms[Object]);
+
+		Frustum_Culler::Cull(Frustum::From_Matrix(this->m_Proj_Matrix * this->m_View_Matrix), this->m_Object_Volumes, this->m_Visible_Objects);
+
+		if (Software_Occlusion_Enable)
+			this->Cull_Occluded_Objects();
+	}
+
+	//NOTE : One Packet Per Draw Range Of Every Survivor, The Scene Has One Pipeline So Draws Are Batched By Texture Slot, Then LOD And Depth
+	void Build_Draw_Queue(void) {
+		const glm::vec3 Camera_Position{ glm::inverse(this->m_View_Matrix)[3] };
+
+		this->m_Draw_Queue.Clear();
+		for (const uint32_t Object : this->m_Visible_Objects) {
+			const size_t Lod{ this->Select_Mesh_Lod(this->m_Scene_Matrix * this->m_Object_Transforms[Object]) };
+			const float Depth{ glm::length(glm::vec3(this->m_Object_Volumes.Center_X[Object], this->m_Object_Volumes.Center_Y[Object], this->m_Object_Volumes.Center_Z[Object]) - Camera_Position) };
+
+			for (const auto& Range : this->m_Mesh_Lods[Lod].Draw_Ranges) {
+				const uint32_t Texture_Slot{ Draw_Instance::Get_Texture_Slot(this->m_Material_Texture_Slots, Range.Material) };
+				const uint64_t Key{ Draw_Sort_Key::Build(0, 0, Texture_Slot, static_cast<uint32_t>(Lod), Depth) };
+
+				this->m_Draw_Queue.Push(Key, { Range.Index_Count, Range.First_Index, Range.Vertex_Offset, Draw_Instance::Pack(Object, Texture_Slot) });
+			}
+		}
+
+		this->m_Draw_Queue.Sort(std::max(1u, thread::hardware_concurrency()));
+	}
+
+	//NOTE : Occluders Are The Nearest Frustum Survivors Drawn With LOD 0, Every Survivor Is Then Tested Against Them
+	void Cull_Occluded_Objects(void) {
+		if (this->m_Visible_Objects.size() < 2)
+			return;
+
+		const glm::mat4 View_Proj{ this->m_Proj_Matrix * this->m_View_Matrix * this->m_Scene_Matrix };
+		const glm::vec3 Camera_Position{ glm::inverse(this->m_View_Matrix)[3] };
+		const auto Distance = [this, &Camera_Position](uint32_t Object) {
+			return glm::length(glm::vec3(this->m_Object_Volumes.Center_X[Object], this->m_Object_Volumes.Center_Y[Object], this->m_Object_Volumes.Center_Z[Object]) - Camera_Position);
+		};
+
+		vector<uint32_t> Occluders{ this->m_Visible_Objects };
+		const size_t Occluder_Count{ std::min<size_t>(Software_Occluder_Count, Occluders.size()) };
+		std::partial_sort(Occluders.begin(), Occluders.begin() + Occluder_Count, Occluders.end(), [&Distance](uint32_t Left, uint32_t Right) { return Distance(Left) < Distance(Right); });
+
+		const Mesh_Lod& Lod{ this->m_Mesh_Lods.front() };
+		this->m_Occlusion_Culler.Clear();
+		for (size_t Occluder = 0; Occluder < Occluder_Count; ++Occluder)
+			this->m_Occlusion_Culler.Add_Occluder(this->m_Vertices, this->m_Indices.data() + Lod.First_Index, Lod.Index_Count, View_Proj * this->m_Object_Transforms[Occluders[Occluder]]);
+
+		this->m_Occlusion_Culler.Rasterize(std::max(1u, thread::hardware_concurrency()));
+
+		this->m_Visible_Objects.erase(std::remove_if(this->m_Visible_Objects.begin(), this->m_Visible_Objects.end(), [this, &View_Proj](uint32_t Object) {
+			return !this->m_Occlusion_Culler.Is_Visible(this->m_Mesh_Bounds, View_Proj * this->m_Object_Transforms[Object]);
+		}), this->m_Visible_Objects.end());
+	}
+
+	void Create_Sync_Objects(void) {
+		VkSemaphoreCreateInfo Semaphore_Info{};
+		{
+			Semaphore_Info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+		}
+
+		VkSemaphoreTypeCreateInfo Timeline_Type_Info{};
+		{
+			Timeline_Type_Info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+			Timeline_Type_Info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+			Timeline_Type_Info.initialValue = 0;
+		}
+
+		VkSemaphoreCreateInfo Timeline_Info{};
+		{
+			Timeline_Info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+			Timeline_Info.pNext = &Timeline_Type_Info;
+		}
+
+		VkSemaphore Semaphore{ nullptr };
+		const auto  Deleter_Semaphore = [Device = this->m_Logical_Device.get()](VkSemaphore Semaphore) {if (nullptr != Semaphore) vkDestroySemaphore(Device, Semaphore, nullptr); };
+
+		THROW_IF_VK_FAILED(vkCreateSemaphore(this->m_Logical_Device.get(), &Timeline_Info, nullptr, &Semaphore));
+
+		this->m_Timeline_Semaphore.get_deleter() = Deleter_Semaphore;
+		this->m_Timeline_Semaphore.reset(Semaphore);
+		this->m_Timeline_Value = 0;
+		this->m_Frame_Timeline_Values.assign(MAX_FRAMES_IN_FLIGHT, 0);
+
+		//NOTE : Acquire And Present Only Take Binary Semaphores, The Timeline Replaces The Per Frame Fences
+		this->m_Image_Available_Semaphores.resize(MAX_FRAMES_IN_FLIGHT);
+		this->m_Render_Finished_Semaphores.resize(MAX_FRAMES_IN_FLIGHT);
+
+		for (size_t Index = 0; Index < MAX_FRAMES_IN_FLIGHT; ++Index) {
+			THROW_IF_VK_FAILED(vkCreateSemaphore(this->m_Logical_Device.get(), &Semaphore_Info, nullptr, &Semaphore));
+
+			this->m_Image_Available_Semaphores[Index].get_deleter() = Deleter_Semaphore;
+			this->m_Image_Available_Semaphores[Index].reset(Semaphore);
+
+			THROW_IF_VK_FAILED(vkCreateSemaphore(this->m_Logical_Device.get(), &Semaphore_Info, nullptr, &Semaphore));
+
+			this->m_Render_Finished_Semaphores[Index].get_deleter() = Deleter_Semaphore;
+			this->m_Render_Finished_Semaphores[Index].reset(Semaphore);
+		}
+	}
+
+	//NOTE : Every Submission Signals The Next Value, Waiting For One Value Also Covers Everything Submitted Before It
+	const uint64_t Submit_Timeline(VkCommandBuffer Command_Buffer, VkSemaphore Wait_Semaphore, VkPipelineStageFlags Wait_Stage, VkSemaphore Signal_Semaphore) {
+		const uint64_t Value{ ++this->m_Timeline_Value };
+
+		//NOTE : Values For Binary Semaphores Are Ignored
+		const uint64_t Wait_Values[] = { 0 };
+		const uint64_t Signal_Values[] = { Value, 0 };
+		const VkSemaphore Signal_Semaphores[] = { this->m_Timeline_Semaphore.get(), Signal_Semaphore };
+
+		VkTimelineSemaphoreSubmitInfo Timeline_Info{};
+		{
+			Timeline_Info.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+			Timeline_Info.waitSemaphoreValueCount = nullptr != Wait_Semaphore ? 1 : 0;
+			Timeline_Info.pWaitSemaphoreValues = Wait_Values;
+			Timeline_Info.signalSemaphoreValueCount = nullptr != Signal_Semaphore ? 2 : 1;
+			Timeline_Info.pSignalSemaphoreValues = Signal_Values;
+		}
+
+		VkSubmitInfo Submit_Info{};
+		{
+			Submit_Info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+			Submit_Info.pNext = &Timeline_Info;
+			Submit_Info.waitSemaphoreCount = nullptr != Wait_Semaphore ? 1 : 0;
+			Submit_Info.pWaitSemaphores = &Wait_Semaphore;
+			Submit_Info.pWaitDstStageMask = &Wait_Stage;
+			Submit_Info.commandBufferCount = 1;
+			Submit_Info.pCommandBuffers = &Command_Buffer;
+			Submit_Info.signalSemaphoreCount = nullptr != Signal_Semaphore ? 2 : 1;
+			Submit_Info.pSignalSemaphores = Signal_Semaphores;
+		}
+
+		THROW_IF_VK_FAILED(vkQueueSubmit(this->m_Graphics_Queue, 1, &Submit_Info, VK_NULL_HANDLE));
+
+		return Value;
+	}
+
+	void Wait_Timeline(uint64_t Value) const {
+		const VkSemaphore Timeline_Semaphore{ this->m_Timeline_Semaphore.get() };
+
+		VkSemaphoreWaitInfo Wait_Info{};
+		{
+			Wait_Info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+			Wait_Info.semaphoreCount = 1;
+			Wait_Info.pSemaphores = &Timeline_Semaphore;
+			Wait_Info.pValues = &Value;
+		}
+
+		THROW_IF_VK_FAILED(vkWaitSemaphores(this->m_Logical_Device.get(), &Wait_Info, numeric_limits<uint64_t>::max()));
+	}
+
+	void UpData_Uniform_Buffer(uint32_t Current_Image) {
+		static auto Start_Time{ chrono::high_resolution_clock::now() };
+
+		auto Current_Time{ chrono::high_resolution_clock::now() };
+		float Time{ chrono::duration<float, chrono::seconds::period>(Current_Time - Start_Time).count() };
+
+		Uniform_Buffer_Object Ubo{};
+		{
+			this->m_Scene_Matrix = glm::rotate(glm::mat4(1.0f), Time * glm::radians(90.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+
+			//NOTE : Instanced Shader Gets Dequantize From The Instance Record, The Plain One Draws The Single Object Here
+			Ubo.Model = this->m_Instanced_Drawing ? this->m_Scene_Matrix : this->m_Scene_Matrix * this->m_Object_Transforms.front() * this->m_Vertex_Layout.Get_Position_Dequantize(this->m_Mesh_Bounds);
+			Ubo.View = glm::lookAt(glm::vec3(2.0f, 2.0f, 2.0f), glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+			Ubo.Proj = glm::perspective(glm::radians(45.0f), this->m_Swap_Chain_Extent.width / static_cast<float>(this->m_Swap_Chain_Extent.height), 0.1f, 10.0f);
+			Ubo.Proj[1][1] *= -1;
+		}
+
+		this->m_View_Matrix = Ubo.View;
+		this->m_Proj_Matrix = Ubo.Proj;
+
+		memcpy(this->Uniform_Buffers_Mapped[this->m_Current_Frame], &Ubo, sizeof(Ubo));
+	}
+
+	void Draw_Frame(void) {
+		//NOTE : Only The Submission That Last Used This Frame's Resources Has To Finish, Nothing Is Reset Afterwards
+		this->Wait_Timeline(this->m_Frame_Timeline_Values[this->m_Current_Frame]);
+
+		if (this->m_Occlusion_Culling)
+			this->Report_Occlusion_Statistics();
+		this->Report_Draw_State_Statistics();
+
+		this->Adopt_Pipelines();
+
+		uint32_t Image_Index{};
+		const VkResult Acquire_Flag{ vkAcquireNextImageKHR(this->m_Logical_Device.get(), this->m_Swap_Chain.get(), std::numeric_limits<uint64_t>::max(), this->m_Image_Available_Semaphores[this->m_Current_Frame].get(), VK_NULL_HANDLE, &Image_Index) };
+
+		this->UpData_Uniform_Buffer(Image_Index);
+		if (!this->m_Gpu_Culling) {
+			this->Cull_Scene();
+			this->Build_Draw_Queue();
+		}
+
+		if (VK_ERROR_OUT_OF_DATE_KHR == Acquire_Flag)
+			this->Re_Create_SwapChain();
+		else if (VK_SUCCESS != Acquire_Flag && VK_SUBOPTIMAL_KHR != Acquire_Flag)
+			throw runtime_error("Failed to acquire swap chain image!");
+
+		THROW_IF_VK_FAILED(vkResetCommandBuffer(this->m_Command_Buffers[this->m_Current_Frame], 0));
+		this->Record_Command_Buffer(this->m_Command_Buffers[this->m_Current_Frame], Image_Index);
+
+		VkSemaphore Signal_Semaphores[] = { this->m_Render_Finished_Semaphores[this->m_Current_Frame].get() };
+
+		this->m_Frame_Timeline_Values[this->m_Current_Frame] = this->Submit_Timeline(
+			this->m_Command_Buffers[this->m_Current_Frame],
+			this->m_Image_Available_Semaphores[this->m_Current_Frame].get(),
+			VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+			Signal_Semaphores[0]
+		);
+
+		VkSwapchainKHR Swap_Chains[] = { this->m_Swap_Chain.get() };
+
+		VkPresentInfoKHR Present_Info{};
+		{
+			Present_Info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+			Present_Info.waitSemaphoreCount = 1;
+			Present_Info.pWaitSemaphores = Signal_Semaphores;
+			Present_Info.swapchainCount = 1;
+			Present_Info.pSwapchains = Swap_Chains;
+			Present_Info.pImageIndices = &Image_Index;
+			Present_Info.pResults = nullptr;
+		}
+
+		const VkResult Present_Flag{ vkQueuePresentKHR(this->m_Present_Queue, &Present_Info) };
+
+		if (VK_ERROR_OUT_OF_DATE_KHR == Present_Flag ||
+			VK_SUBOPTIMAL_KHR == Present_Flag ||
+			this->m_Frame_Buffer_Resized) {
+			this->m_Frame_Buffer_Resized = false;
+			this->Re_Create_SwapChain();
+		}
+		else if (VK_SUCCESS != Present_Flag && VK_SUBOPTIMAL_KHR != Present_Flag)
+			throw runtime_error("Failed to present swap chain image!");
+
+		this->m_Current_Frame = (this->m_Current_Frame + 1) % MAX_FRAMES_IN_FLIGHT;
+	}
+
+private:
+	uint32_t Find_Queue_Families(VkQueueFlagBits Vk_Queue_FlagBit) const {
+		uint32_t Queue_Family_Count;
+		vkGetPhysicalDeviceQueueFamilyProperties(this->m_Physical_Device, &Queue_Family_Count, nullptr);
+
+		vector<VkQueueFamilyProperties> Queue_Families;
+		Queue_Families.resize(Queue_Family_Count);
+		vkGetPhysicalDeviceQueueFamilyProperties(this->m_Physical_Device, &Queue_Family_Count, Queue_Families.data());
+
+		for (auto CIt = Queue_Families.cbegin(); CIt != Queue_Families.cend(); ++CIt)
+			if (CIt->queueFlags & Vk_Queue_FlagBit)
+				return  static_cast<uint32_t>(CIt - Queue_Families.cbegin());
+
+		throw runtime_error("Failed to find a suitable GPU!");
+
+		return numeric_limits<uint32_t>::max();
+	}
+
+	uint32_t Get_Physical_Device_Queue_Present_Family(void) const {
+		uint32_t Queue_Family_Count;
+		vkGetPhysicalDeviceQueueFamilyProperties(this->m_Physical_Device, &Queue_Family_Count, nullptr);
+
+		vector<VkQueueFamilyProperties> Queue_Families;
+		Queue_Families.resize(Queue_Family_Count);
+		vkGetPhysicalDeviceQueueFamilyProperties(this->m_Physical_Device, &Queue_Family_Count, Queue_Families.data());
+
+		uint32_t Queue_Family_Index{ numeric_limits<uint32_t>::max() };
+		for (auto CIt = Queue_Families.cbegin(); CIt != Queue_Families.cend(); ++CIt) {
+			VkBool32 Present_Support{ false };
+			THROW_IF_VK_FAILED(vkGetPhysicalDeviceSurfaceSupportKHR(this->m_Physical_Device, static_cast<uint32_t>(CIt - Queue_Families.cbegin()), this->m_Surface.get(), &Present_Support));
+
+			if (Present_Support) {
+				Queue_Family_Index = static_cast<uint32_t>(CIt - Queue_Families.cbegin());
+
+				//NOTE : First Chose Queue Family With Graphics Bit
+				if (Queue_Family_Index == this->m_Queue_Family_Indices.Graphics_Family)
+					return Queue_Family_Index;
+			}
+		}
+
+		return Queue_Family_Index;
+	}
+
+	void Query_Swap_Chain_Support_Details(void) {
+		THROW_IF_VK_FAILED(vkGetPhysicalDeviceSurfaceCapabilitiesKHR(this->m_Physical_Device, this->m_Surface.get(), &this->m_Swap_Chain_Support_Details.Capabilities));
+
+		uint32_t Format_Count{};
+		THROW_IF_VK_FAILED(vkGetPhysicalDeviceSurfaceFormatsKHR(this->m_Physical_Device, this->m_Surface.get(), &Format_Count, nullptr));
+
+		if (0 != Format_Count) {
+			this->m_Swap_Chain_Support_Details.Formats.resize(Format_Count);
+			THROW_IF_VK_FAILED(vkGetPhysicalDeviceSurfaceFormatsKHR(this->m_Physical_Device, this->m_Surface.get(), &Format_Count, this->m_Swap_Chain_Support_Details.Formats.data()));
+		}
+		else
+			throw runtime_error("Failed to find a suitable GPU!");
+
+		uint32_t Present_Mode_Count{};
+		(vkGetPhysicalDeviceSurfacePresentModesKHR(this->m_Physical_Device, this->m_Surface.get(), &Present_Mode_Count, nullptr));
+		if (0 != Present_Mode_Count) {
+			this->m_Swap_Chain_Support_Details.Present_Modes.resize(Present_Mode_Count);
+			THROW_IF_VK_FAILED(vkGetPhysicalDeviceSurfacePresentModesKHR(this->m_Physical_Device, this->m_Surface.get(), &Present_Mode_Count, this->m_Swap_Chain_Support_Details.Present_Modes.data()));
+		}
+		else
+			throw runtime_error("Failed to find a suitable GPU!");
+	}
+
+	const VkExtent2D Choose_SwapChain_Extent(const VkSurfaceCapabilitiesKHR& Capabilities) {
+		if (numeric_limits<uint32_t>::max() != Capabilities.currentExtent.width)
+			return Capabilities.currentExtent;
+		else {
+			int Width, Height;
+			glfwGetFramebufferSize(this->m_Window.get(), &Width, &Height);
+			VkExtent2D Actual_Extent{ static_cast<uint32_t>(Width),static_cast<uint32_t>(Height) };
+
+			Actual_Extent.width = std::clamp(Actual_Extent.width, Capabilities.minImageExtent.width, Capabilities.maxImageExtent.width);
+			Actual_Extent.height = std::clamp(Actual_Extent.height, Capabilities.minImageExtent.height, Capabilities.maxImageExtent.height);
+
+			return Actual_Extent;
+		}
+	}
+
+	const VkShaderModule Create_Shader_Module(const vector<char>& Code) {
+		VkShaderModuleCreateInfo Create_Info{};
+		{
+			Create_Info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+			Create_Info.codeSize = Code.size();
+			Create_Info.pCode = reinterpret_cast<const uint32_t*>(Code.data());
+		}
+
+		VkShaderModule Shader_Module{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateShaderModule(this->m_Logical_Device.get(), &Create_Info, nullptr, &Shader_Module));
+		return Shader_Module;
+	}
+
+	const bool Has_Memory_Type(uint32_t Type_Filter, VkMemoryPropertyFlags Property_Flags) const {
+		VkPhysicalDeviceMemoryProperties Memory_Properties{};
+		vkGetPhysicalDeviceMemoryProperties(this->m_Physical_Device, &Memory_Properties);
+
+		for (uint32_t Index = 0; Index < Memory_Properties.memoryTypeCount; ++Index)
+			if (Type_Filter & (1 << Index) && (Memory_Properties.memoryTypes[Index].propertyFlags & Property_Flags) == Property_Flags)
+				return true;
+
+		return false;
+	}
+
+	uint32_t Find_Memory_Type(uint32_t Type_Filter, VkMemoryPropertyFlags Property_Flags) const {
+		VkPhysicalDeviceMemoryProperties Memory_Properties{};
+		vkGetPhysicalDeviceMemoryProperties(this->m_Physical_Device, &Memory_Properties);
+
+		for (uint32_t Index = 0; Index < Memory_Properties.memoryTypeCount; ++Index)
+			if (Type_Filter & (1 << Index) && (Memory_Properties.memoryTypes[Index].propertyFlags & Property_Flags) == Property_Flags)
+				return Index;
+
+		throw runtime_error("Failed to find suitable memory type!");
+
+		return numeric_limits<uint32_t>::max();
+	}
+
+	//NOTE : Lazily Allocated Is Only A Preference, Desktop Parts Without Such A Type Back Transient Attachments With Plain Device Memory
+	uint32_t Find_Image_Memory_Type(uint32_t Type_Filter, VkMemoryPropertyFlags Property_Flags) const {
+		return this->Find_Memory_Type(Type_Filter, this->Has_Memory_Type(Type_Filter, Property_Flags) ? Property_Flags : Property_Flags & ~VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT);
+	}
+
+	void Create_Buffer(VkDeviceSize Size, VkBufferUsageFlags Usage, VkMemoryPropertyFlags Properties, VkBuffer& Buffer, VkDeviceMemory& Buffer_Memory) {
+		VkBufferCreateInfo Buffer_Info{};
+		{
+			Buffer_Info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+			Buffer_Info.size = Size;
+			Buffer_Info.usage = Usage;
+			Buffer_Info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		}
+
+		THROW_IF_VK_FAILED(vkCreateBuffer(this->m_Logical_Device.get(), &Buffer_Info, nullptr, &Buffer));
+
+		VkMemoryRequirements Memory_Requirements{};
+		vkGetBufferMemoryRequirements(this->m_Logical_Device.get(), Buffer, &Memory_Requirements);
+
+		VkMemoryAllocateInfo Memory_Allocate_Info{};
+		{
+			Memory_Allocate_Info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+			Memory_Allocate_Info.allocationSize = Memory_Requirements.size;
+			Memory_Allocate_Info.memoryTypeIndex = this->Find_Memory_Type(Memory_Requirements.memoryTypeBits, Properties);
+		}
+
+		THROW_IF_VK_FAILED(vkAllocateMemory(this->m_Logical_Device.get(), &Memory_Allocate_Info, nullptr, &Buffer_Memory));
+
+		THROW_IF_VK_FAILED(vkBindBufferMemory(this->m_Logical_Device.get(), Buffer, Buffer_Memory, 0));
+	}
+
+	const VkCommandBuffer Begin_SingleTime_Commands(void) {
+		VkCommandBufferAllocateInfo Allocate_Info{};
+		{
+			Allocate_Info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			Allocate_Info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+			Allocate_Info.commandPool = this->m_Command_Pool.get();
+			Allocate_Info.commandBufferCount = 1;
+		}
+
+		VkCommandBuffer Command_Buffer{ nullptr };
+		THROW_IF_VK_FAILED(vkAllocateCommandBuffers(this->m_Logical_Device.get(), &Allocate_Info, &Command_Buffer));
+
+		VkCommandBufferBeginInfo Begin_Info{};
+		{
+			Begin_Info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+			Begin_Info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		}
+
+		THROW_IF_VK_FAILED(vkBeginCommandBuffer(Command_Buffer, &Begin_Info));
+
+		return Command_Buffer;
+	}
+
+	//NOTE : Waits For This Upload's Own Timeline Value, Frames Queued Behind It Keep Running
+	void End_SingleTime_Commands(VkCommandBuffer Command_Buffer) {
+		THROW_IF_VK_FAILED(vkEndCommandBuffer(Command_Buffer));
+
+		this->Wait_Timeline(this->Submit_Timeline(Command_Buffer, nullptr, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, nullptr));
+
+		vkFreeCommandBuffers(this->m_Logical_Device.get(), this->m_Command_Pool.get(), 1, &Command_Buffer);
+	}
+
+	void Copy_Buffer(VkBuffer Source_Buffer, VkBuffer Destination_Buffer, VkDeviceSize Size, VkDeviceSize Destination_Offset = 0) {
+		VkCommandBuffer Command_Buffer{ this->Begin_SingleTime_Commands() };
+
+		VkBufferCopy Copy_Region{};
+		{
+			Copy_Region.dstOffset = Destination_Offset;
+			Copy_Region.size = Size;
+		}
+
+		vkCmdCopyBuffer(Command_Buffer, Source_Buffer, Destination_Buffer, 1, &Copy_Region);
+
+		this->End_SingleTime_Commands(Command_Buffer);
+	}
+
+	const VkImageCreateInfo Build_Image_Info(uint32_t Width, uint32_t Height, uint32_t Mip_Levels, VkFormat Format, VkSampleCountFlagBits Num_Samples, VkImageTiling Tiling, VkImageUsageFlags Usage) const {
+		VkImageCreateInfo Image_Info{};
+		{
+			Image_Info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+			Image_Info.imageType = VK_IMAGE_TYPE_2D;
+			Image_Info.extent.width = Width;
+			Image_Info.extent.height = Height;
+			Image_Info.extent.depth = 1;
+			Image_Info.mipLevels = Mip_Levels;
+			Image_Info.arrayLayers = 1;
+			Image_Info.format = Format;
+			Image_Info.tiling = Tiling;
+			Image_Info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+			Image_Info.usage = Usage;
+			Image_Info.samples = Num_Samples;
+			Image_Info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		}
+
+		return Image_Info;
+	}
+
+	void Create_Image(uint32_t Width, uint32_t Height, uint32_t Mip_Levels, VkFormat Format, VkSampleCountFlagBits Num_Samples, VkImageTiling Tiling, VkImageUsageFlags Usage, VkMemoryPropertyFlags Properties, VkImage& Image, VkDeviceMemory& Image_Memory) {
+		const VkImageCreateInfo Image_Info{ this->Build_Image_Info(Width, Height, Mip_Levels, Format, Num_Samples, Tiling, Usage) };
+
+		THROW_IF_VK_FAILED(vkCreateImage(this->m_Logical_Device.get(), &Image_Info, nullptr, &Image));
+
+		VkMemoryRequirements Memory_Requirements{};
+		vkGetImageMemoryRequirements(this->m_Logical_Device.get(), Image, &Memory_Requirements);
+
+		VkMemoryAllocateInfo Memory_Allocate_Info{};
+		{
+			Memory_Allocate_Info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+			Memory_Allocate_Info.allocationSize = Memory_Requirements.size;
+			Memory_Allocate_Info.memoryTypeIndex = this->Find_Image_Memory_Type(Memory_Requirements.memoryTypeBits, Properties);
+		}
+
+		THROW_IF_VK_FAILED(vkAllocateMemory(this->m_Logical_Device.get(), &Memory_Allocate_Info, nullptr, &Image_Memory));
+
+		THROW_IF_VK_FAILED(vkBindImageMemory(this->m_Logical_Device.get(), Image, Image_Memory, 0));
+	}
+
+	void Copy_Buffer_To_Image(VkCommandBuffer Command_Buffer, VkBuffer Buffer, VkImage Image, uint32_t Width, uint32_t Height) {
+		VkBufferImageCopy Region{};
+		{
+			Region.bufferOffset = 0;
+			Region.bufferRowLength = 0;
+			Region.bufferImageHeight = 0;
+			Region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			Region.imageSubresource.mipLevel = 0;
+			Region.imageSubresource.baseArrayLayer = 0;
+			Region.imageSubresource.layerCount = 1;
+			Region.imageOffset = { 0, 0, 0 };
+			Region.imageExtent = { Width, Height, 1 };
+		}
+
+		vkCmdCopyBufferToImage(Command_Buffer, Buffer, Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &Region);
+	}
+
+	VkImageView Create_Image_View(VkImage Image, uint32_t Mip_Levels, VkFormat Format, VkImageAspectFlags Aspect_Flags, uint32_t Base_Mip_Level = 0) {
+		VkComponentMapping Component_Mapping{};
+		{
+			Component_Mapping.r = VK_COMPONENT_SWIZZLE_IDENTITY;
+			Component_Mapping.g = VK_COMPONENT_SWIZZLE_IDENTITY;
+			Component_Mapping.b = VK_COMPONENT_SWIZZLE_IDENTITY;
+			Component_Mapping.a = VK_COMPONENT_SWIZZLE_IDENTITY;
+		}
+
+		VkImageSubresourceRange Subresource_Range{};
+		{
+			Subresource_Range.aspectMask = Aspect_Flags;
+			Subresource_Range.baseMipLevel = Base_Mip_Level;
+			Subresource_Range.levelCount = Mip_Levels;
+			Subresource_Range.baseArrayLayer = 0;
+			Subresource_Range.layerCount = 1;
+		}
+
+		VkImageViewCreateInfo View_Info{};
+		{
+			View_Info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+			View_Info.image = Image;
+			View_Info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+			View_Info.format = Format;
+			View_Info.components = Component_Mapping;
+			View_Info.subresourceRange = Subresource_Range;
+		}
+
+		VkImageView Texture_Image_View{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateImageView(this->m_Logical_Device.get(), &View_Info, nullptr, &Texture_Image_View));
+
+		return Texture_Image_View;
+	}
+
+	const VkFormat Find_Supported_Format(const vector<VkFormat>& Candidates, VkImageTiling Tiling, VkFormatFeatureFlags Features) const {
+		for (const auto& Candidate : Candidates) {
+			VkFormatProperties Properties{};
+			vkGetPhysicalDeviceFormatProperties(this->m_Physical_Device, Candidate, &Properties);
+
+			if (VK_IMAGE_TILING_LINEAR == Tiling && (Properties.linearTilingFeatures & Features) == Features)
+				return Candidate;
+			else if (VK_IMAGE_TILING_OPTIMAL == Tiling && (Properties.optimalTilingFeatures & Features) == Features)
+				return Candidate;
+		}
+		throw runtime_error("Failed to find supported format!");
+
+		return VK_FORMAT_UNDEFINED;
+	}
+
+private:
+	static void Initialize_GLWF(void) {
+		if (GLFW_FALSE == glfwInit())
+			throw runtime_error("Failed to initialize GLFW");
+
+		glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+		//glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
+	}
+
+	static vector<const char*> Get_Require_Extensions(void) {
+		uint32_t GLFW_Extension_Count;
+		const char** GLFW_Extensions;
+		GLFW_Extensions = glfwGetRequiredInstanceExtensions(&GLFW_Extension_Count);
+
+		vector<const char*> Extensions{ GLFW_Extensions, GLFW_Extensions + GLFW_Extension_Count };
+
+#ifdef _DEBUG
+		Extensions.emplace_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+#endif // _DEBUG
+
+		return Extensions;
+	}
+
+	static bool Check_Device_Extension_Support(VkPhysicalDevice Device, unordered_set<string> Required_Extensions = { Device_EXT_SwapChain }) {
+		uint32_t Extension_Count;
+		THROW_IF_VK_FAILED(vkEnumerateDeviceExtensionProperties(Device, nullptr, &Extension_Count, nullptr));
+		vector<VkExtensionProperties> Available_Extensions;
+		Available_Extensions.resize(Extension_Count);
+		THROW_IF_VK_FAILED(vkEnumerateDeviceExtensionProperties(Device, nullptr, &Extension_Count, Available_Extensions.data()));
+
+		for (const auto& Available_Extension : Available_Extensions)
+			Required_Extensions.erase(Available_Extension.extensionName);
+
+		return Required_Extensions.empty();
+	}
+
+	static bool Is_Device_Suitable(VkPhysicalDevice Device) {
+		if (!VK_Application::Check_Device_Extension_Support(Device))
+			return false;
+
+		VkPhysicalDeviceProperties Device_Properties{};
+		vkGetPhysicalDeviceProperties(Device, &Device_Properties);
+
+		VkPhysicalDeviceFeatures Device_Features{};
+		vkGetPhysicalDeviceFeatures(Device, &Device_Features);
+
+		//NOTE : Use This For Check Device Type, Frames And Uploads Are All Paced By One Timeline Semaphore
+		return
+			Device_Properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU &&
+			Device_Features.geometryShader &&
+			VK_Application::Query_Device_Capabilities(Device).Timeline_Semaphore;
+	}
+
+	static const Device_Capabilities Query_Device_Capabilities(VkPhysicalDevice Device) {
+		Device_Capabilities Capabilities{};
+
+		VkPhysicalDeviceProperties Device_Properties{};
+		vkGetPhysicalDeviceProperties(Device, &Device_Properties);
+
+		//NOTE : Feature Query Through Features2 Is Core Since 1.1, drawIndirectCount Since 1.2
+		if (VK_API_VERSION_1_2 > Device_Properties.apiVersion)
+			return Capabilities;
+
+		VkPhysicalDeviceVulkan12Features Vulkan12_Features{};
+		{
+			Vulkan12_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+		}
+
+		//NOTE : A Feature Struct Of An Extension The Device Lacks Must Stay Out Of The Chain
+		void* Feature_Chain{ &Vulkan12_Features };
+
+		const bool Synchronization2_Extension{ VK_Application::Check_Device_Extension_Support(Device, { Device_EXT_Synchronization2 }) };
+		VkPhysicalDeviceSynchronization2FeaturesKHR Synchronization2_Features{};
+		{
+			Synchronization2_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+		}
+
+		if (Synchronization2_Extension) {
+			Synchronization2_Features.pNext = Feature_Chain;
+			Feature_Chain = &Synchronization2_Features;
+		}
+
+		const bool Dynamic_Rendering_Extension{ VK_Application::Check_Device_Extension_Support(Device, { Device_EXT_Dynamic_Rendering }) };
+		VkPhysicalDeviceDynamicRenderingFeaturesKHR Dynamic_Rendering_Features{};
+		{
+			Dynamic_Rendering_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+		}
+
+		if (Dynamic_Rendering_Extension) {
+			Dynamic_Rendering_Features.pNext = Feature_Chain;
+			Feature_Chain = &Dynamic_Rendering_Features;
+		}
+
+		const bool Graphics_Pipeline_Library_Extension{ VK_Application::Check_Device_Extension_Support(Device, { Device_EXT_Pipeline_Library, Device_EXT_Graphics_Pipeline_Library }) };
+		VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT Graphics_Pipeline_Library_Features{};
+		{
+			Graphics_Pipeline_Library_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+		}
+
+		if (Graphics_Pipeline_Library_Extension) {
+			Graphics_Pipeline_Library_Features.pNext = Feature_Chain;
+			Feature_Chain = &Graphics_Pipeline_Library_Features;
+		}
+
+		const bool Extended_Dynamic_State_Extension{ VK_Application::Check_Device_Extension_Support(Device, { Device_EXT_Extended_Dynamic_State }) };
+		VkPhysicalDeviceExtendedDynamicStateFeaturesEXT Extended_Dynamic_State_Features{};
+		{
+			Extended_Dynamic_State_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+		}
+
+		if (Extended_Dynamic_State_Extension) {
+			Extended_Dynamic_State_Features.pNext = Feature_Chain;
+			Feature_Chain = &Extended_Dynamic_State_Features;
+		}
+
+		const bool Extended_Dynamic_State2_Extension{ VK_Application::Check_Device_Extension_Support(Device, { Device_EXT_Extended_Dynamic_State2 }) };
+		VkPhysicalDeviceExtendedDynamicState2FeaturesEXT Extended_Dynamic_State2_Features{};
+		{
+			Extended_Dynamic_State2_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT;
+		}
+
+		if (Extended_Dynamic_State2_Extension) {
+			Extended_Dynamic_State2_Features.pNext = Feature_Chain;
+			Feature_Chain = &Extended_Dynamic_State2_Features;
+		}
+
+		const bool Extended_Dynamic_State3_Extension{ VK_Application::Check_Device_Extension_Support(Device, { Device_EXT_Extended_Dynamic_State3 }) };
+		VkPhysicalDeviceExtendedDynamicState3FeaturesEXT Extended_Dynamic_State3_Features{};
+		{
+			Extended_Dynamic_State3_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+		}
+
+		if (Extended_Dynamic_State3_Extension) {
+			Extended_Dynamic_State3_Features.pNext = Feature_Chain;
+			Feature_Chain = &Extended_Dynamic_State3_Features;
+		}
+
+		const bool Mesh_Shader_Extension{ VK_Application::Check_Device_Extension_Support(Device, { Device_EXT_Mesh_Shader }) };
+		VkPhysicalDeviceMeshShaderFeaturesEXT Mesh_Shader_Features{};
+		{
+			Mesh_Shader_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT;
+		}
+
+		if (Mesh_Shader_Extension) {
+			Mesh_Shader_Features.pNext = Feature_Chain;
+			Feature_Chain = &Mesh_Shader_Features;
+		}
+
+		VkPhysicalDeviceFeatures2 Features{};
+		{
+			Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+			Features.pNext = Feature_Chain;
+		}
+		vkGetPhysicalDeviceFeatures2(Device, &Features);
+
+		//NOTE : Linking Without Fast Linking Support May Cost As Much As A Full Compile, Then The Libraries Buy Nothing
+		VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT Graphics_Pipeline_Library_Properties{};
+		{
+			Graphics_Pipeline_Library_Properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+		}
+
+		void* Property_Chain{ nullptr };
+		if (Graphics_Pipeline_Library_Extension) {
+			Graphics_Pipeline_Library_Properties.pNext = Property_Chain;
+			Property_Chain = &Graphics_Pipeline_Library_Properties;
+		}
+
+		VkPhysicalDeviceExtendedDynamicState3PropertiesEXT Extended_Dynamic_State3_Properties{};
+		{
+			Extended_Dynamic_State3_Properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_PROPERTIES_EXT;
+		}
+
+		if (Extended_Dynamic_State3_Extension) {
+			Extended_Dynamic_State3_Properties.pNext = Property_Chain;
+			Property_Chain = &Extended_Dynamic_State3_Properties;
+		}
+
+		VkPhysicalDeviceMeshShaderPropertiesEXT Mesh_Shader_Properties{};
+		{
+			Mesh_Shader_Properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_EXT;
+		}
+
+		if (Mesh_Shader_Extension) {
+			Mesh_Shader_Properties.pNext = Property_Chain;
+			Property_Chain = &Mesh_Shader_Properties;
+		}
+
+		VkPhysicalDeviceProperties2 Properties{};
+		{
+			Properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+			Properties.pNext = Property_Chain;
+		}
+		vkGetPhysicalDeviceProperties2(Device, &Properties);
+
+		uint32_t Queue_Family_Count{ 0 };
+		vkGetPhysicalDeviceQueueFamilyProperties(Device, &Queue_Family_Count, nullptr);
+		vector<VkQueueFamilyProperties> Queue_Families(Queue_Family_Count);
+		vkGetPhysicalDeviceQueueFamilyProperties(Device, &Queue_Family_Count, Queue_Families.data());
+
+		Capabilities.Draw_Indirect_Count = VK_TRUE == Vulkan12_Features.drawIndirectCount;
+		Capabilities.Multi_Draw_Indirect = VK_TRUE == Features.features.multiDrawIndirect;
+		Capabilities.Draw_Indirect_First_Instance = VK_TRUE == Features.features.drawIndirectFirstInstance;
+		Capabilities.Synchronization2 = Synchronization2_Extension && VK_TRUE == Synchronization2_Features.synchronization2;
+		Capabilities.Timeline_Semaphore = VK_TRUE == Vulkan12_Features.timelineSemaphore;
+		Capabilities.Dynamic_Rendering = Dynamic_Rendering_Extension && VK_TRUE == Dynamic_Rendering_Features.dynamicRendering;
+		Capabilities.Graphics_Pipeline_Library =
+			Graphics_Pipeline_Library_Extension &&
+			VK_TRUE == Graphics_Pipeline_Library_Features.graphicsPipelineLibrary &&
+			VK_TRUE == Graphics_Pipeline_Library_Properties.graphicsPipelineLibraryFastLinking;
+		Capabilities.Extended_Dynamic_State = Extended_Dynamic_State_Extension && VK_TRUE == Extended_Dynamic_State_Features.extendedDynamicState;
+		Capabilities.Extended_Dynamic_State2 = Extended_Dynamic_State2_Extension && VK_TRUE == Extended_Dynamic_State2_Features.extendedDynamicState2;
+		//NOTE : Every Extended Dynamic State 3 State Is Its Own Feature, Only The Two Materials Vary Here Are Needed
+		Capabilities.Extended_Dynamic_State3 =
+			Extended_Dynamic_State3_Extension &&
+			VK_TRUE == Extended_Dynamic_State3_Features.extendedDynamicState3ColorBlendEnable &&
+			VK_TRUE == Extended_Dynamic_State3_Features.extendedDynamicState3RasterizationSamples;
+		Capabilities.Dynamic_Primitive_Topology_Unrestricted = Extended_Dynamic_State3_Extension && VK_TRUE == Extended_Dynamic_State3_Properties.dynamicPrimitiveTopologyUnrestricted;
+		//NOTE : meshlet.mesh Writes Up To A Full Meshlet From 32 Invocations, Its Grid Is Mesh_Task_Row_Width Wide And As Tall As The Tasks Need
+		Capabilities.Mesh_Shader =
+			Mesh_Shader_Extension &&
+			VK_TRUE == Mesh_Shader_Features.meshShader &&
+			Meshlet_Builder::Max_Vertices <= Mesh_Shader_Properties.maxMeshOutputVertices &&
+			Meshlet_Builder::Max_Triangles <= Mesh_Shader_Properties.maxMeshOutputPrimitives &&
+			32 <= Mesh_Shader_Properties.maxMeshWorkGroupInvocations &&
+			Gpu_Culling::Mesh_Task_Row_Width <= Mesh_Shader_Properties.maxMeshWorkGroupCount[0] &&
+			Gpu_Culling::Mesh_Task_Row_Width <= Mesh_Shader_Properties.maxMeshWorkGroupTotalCount;
+		//NOTE : cull.comp Launches Whole Rows Once The Tasks Pass One Row, So The Cap Is Whole Rows Under The Total, Counted In 64 Bit Since The Row Product Outgrows 32
+		Capabilities.Max_Mesh_Tasks = static_cast<uint32_t>(std::min(
+			static_cast<uint64_t>(Mesh_Shader_Properties.maxMeshWorkGroupTotalCount) / Gpu_Culling::Mesh_Task_Row_Width * Gpu_Culling::Mesh_Task_Row_Width,
+			static_cast<uint64_t>(Gpu_Culling::Mesh_Task_Row_Width) * Mesh_Shader_Properties.maxMeshWorkGroupCount[1]));
+		Capabilities.Sampler_Dynamic_Indexing = VK_TRUE == Features.features.shaderSampledImageArrayDynamicIndexing;
+		Capabilities.Sampler_Non_Uniform_Indexing = VK_TRUE == Vulkan12_Features.shaderSampledImageArrayNonUniformIndexing;
+		//NOTE : A Combined Image Sampler Counts Against Both The Sampler And The Sampled Image Limits
+		Capabilities.Max_Fragment_Samplers = std::min({
+			Device_Properties.limits.maxPerStageDescriptorSamplers,
+			Device_Properties.limits.maxPerStageDescriptorSampledImages,
+			Device_Properties.limits.maxDescriptorSetSamplers,
+			Device_Properties.limits.maxDescriptorSetSampledImages });
+
+		//NOTE : Culling Dispatch Is Recorded Into The Graphics Command Buffer, So The First Graphics Family Must Also Compute
+		for (const auto& Queue_Family : Queue_Families)
+			if (0 != (Queue_Family.queueFlags & VK_QUEUE_GRAPHICS_BIT)) {
+				Capabilities.Compute_On_Graphics_Queue = 0 != (Queue_Family.queueFlags & VK_QUEUE_COMPUTE_BIT);
+				break;
+			}
+
+		return Capabilities;
+	}
+
+	static VkSampleCountFlagBits Get_Max_Usable_Sample_Count(const VkPhysicalDevice& Physical_Device) {
+		VkPhysicalDeviceProperties Physical_Device_Properties{};
+		vkGetPhysicalDeviceProperties(Physical_Device, &Physical_Device_Properties);
+		VkSampleCountFlags Counts{ Physical_Device_Properties.limits.framebufferColorSampleCounts & Physical_Device_Properties.limits.framebufferDepthSampleCounts };
+
+		if (0 != (Counts & VK_SAMPLE_COUNT_64_BIT)) return VK_SAMPLE_COUNT_64_BIT;
+		if (0 != (Counts & VK_SAMPLE_COUNT_32_BIT)) return VK_SAMPLE_COUNT_32_BIT;
+		if (0 != (Counts & VK_SAMPLE_COUNT_16_BIT)) return VK_SAMPLE_COUNT_16_BIT;
+		if (0 != (Counts & VK_SAMPLE_COUNT_8_BIT)) return VK_SAMPLE_COUNT_8_BIT;
+		if (0 != (Counts & VK_SAMPLE_COUNT_4_BIT)) return VK_SAMPLE_COUNT_4_BIT;
+		if (0 != (Counts & VK_SAMPLE_COUNT_2_BIT)) return VK_SAMPLE_COUNT_2_BIT;
+		return VK_SAMPLE_COUNT_1_BIT;
+	}
+
+	static const VkSurfaceFormatKHR Choose_SwapChain_Surface_Format(const vector<VkSurfaceFormatKHR>& Available_Formats) {
+		for (const auto& Available_Format : Available_Formats)
+			if (VK_FORMAT_B8G8R8A8_SRGB == Available_Format.format && VK_COLOR_SPACE_SRGB_NONLINEAR_KHR == Available_Format.colorSpace)
+				return Available_Format;
+
+		//NOTE : Default Return First Format
+		return Available_Formats.front();
+	}
+
+	static const VkPresentModeKHR Choose_SwapChain_Present_Mode(const vector<VkPresentModeKHR>& Available_Present_Modes) {
+		for (const auto& Available_Present_Mode : Available_Present_Modes)
+			if (VK_PRESENT_MODE_MAILBOX_KHR == Available_Present_Mode)
+				return Available_Present_Mode;
+
+		//NOTE : Default Return FIFO ,If Device Suppert Present Queue ,IT Must Support FIFO
+		return VK_PRESENT_MODE_FIFO_KHR;
+	}
+
+	static void Frame_Buffer_Resize_CallBack(GLFWwindow* Window, int Width, int Height) {
+		auto App = reinterpret_cast<VK_Application*>(glfwGetWindowUserPointer(Window));
+		App->m_Frame_Buffer_Resized = true;
+	}
+
+private:
+	unique_ptr<GLFWwindow, decltype(&glfwDestroyWindow)> m_Window{ nullptr, glfwDestroyWindow };
+
+	static constexpr auto Delete_VK_Instance = [](VkInstance Instance) {if (nullptr != Instance)vkDestroyInstance(Instance, nullptr); };
+	unique_ptr<VkInstance_T, decltype(Delete_VK_Instance)> m_VK_Instance{ nullptr ,Delete_VK_Instance };
+
+	unique_ptr<VkSurfaceKHR_T, function<void(VkSurfaceKHR)>> m_Surface{ nullptr };
+
+	VkPhysicalDevice m_Physical_Device{ nullptr };
+	VkSampleCountFlagBits m_Msaa_Samples{ VK_SAMPLE_COUNT_1_BIT };
+	Device_Capabilities m_Device_Capabilities{};
+
+	static constexpr auto Delete_VK_Device = [](VkDevice Device) {if (nullptr != Device)vkDestroyDevice(Device, nullptr); };
+	unique_ptr<VkDevice_T, decltype(Delete_VK_Device)> m_Logical_Device{ nullptr, Delete_VK_Device };
+
+	Queue_Family_Indices m_Queue_Family_Indices{};
+
+	VkQueue m_Graphics_Queue{ nullptr };
+	VkQueue m_Present_Queue{ nullptr };
+
+	unique_ptr<VkSwapchainKHR_T, function<void(VkSwapchainKHR)>> m_Swap_Chain{ nullptr };
+
+	Swap_Chain_Support_Details m_Swap_Chain_Support_Details{};
+
+	vector<VkImage> m_Swap_Chain_Images{};
+	VkFormat m_Swap_Chain_Image_Format{};
+	VkExtent2D m_Swap_Chain_Extent{};
+
+	vector<unique_ptr<VkImageView_T, function<void(VkImageView)>>> m_Swap_Chain_Image_Views{};
+
+	unique_ptr<VkRenderPass_T, function<void(VkRenderPass)>> m_Render_Pass{ nullptr };
+
+	unique_ptr<VkDescriptorSetLayout_T, function<void(VkDescriptorSetLayout)>> m_Descriptor_Set_Layout{ nullptr };
+
+	unique_ptr<VkPipelineLayout_T, function<void(VkPipelineLayout)>> m_Pipeline_Layout{ nullptr };
+
+	unique_ptr<VkPipeline_T, function<void(VkPipeline)>> m_Graphics_Pipeline{ nullptr };
+
+	//NOTE : Library Parts Outlive The Linked Pipelines, A Variant Then Only Recompiles The Part It Changes
+	bool m_Pipeline_Library{ false };
+	vector<unique_ptr<VkPipeline_T, function<void(VkPipeline)>>> m_Pipeline_Libraries{};
+
+	//NOTE : Compiles Still Running With The Member They Land In, Plus Replaced Pipelines Older Frames May Still Use
+	Pipeline_Manager m_Pipeline_Manager{};
+	vector<pair<unique_ptr<VkPipeline_T, function<void(VkPipeline)>>*, shared_future<VkPipeline>>> m_Pending_Pipelines{};
+	vector<unique_ptr<VkPipeline_T, function<void(VkPipeline)>>> m_Retired_Pipelines{};
+
+	vector<unique_ptr<VkFramebuffer_T, function<void(VkFramebuffer)>>> m_Swap_Chain_Frame_buffers{};
+
+	unique_ptr<VkCommandPool_T, function<void(VkCommandPool)>> m_Command_Pool{ nullptr };
+
+	Barrier_Builder m_Barrier_Builder{};
+	Draw_State_Cache m_Draw_State{};
+	chrono::high_resolution_clock::time_point m_Draw_State_Report_Time{};
+	Render_Graph m_Render_Graph{};
+	uint32_t m_Graph_Color{ 0 };
+	uint32_t m_Graph_Depth{ 0 };
+	uint32_t m_Graph_Swap_Chain{ 0 };
+	uint32_t m_Graph_Depth_Pyramid{ 0 };
+	uint32_t m_Image_Index{ 0 };
+
+	unique_ptr<VkImageView_T, function<void(VkImageView)>> m_Color_Image_View{ nullptr };
+	unique_ptr<VkImageView_T, function<void(VkImageView)>> m_Depth_Image_View{ nullptr };
+
+	//NOTE : One Entry Per Loaded Texture, Indexed By Texture Slot
+	vector<uint32_t> m_Texture_Mip_Levels{};
+	vector<unique_ptr<VkImage_T, function<void(VkImage)>>> m_Texture_Images{};
+	vector<unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>>> m_Texture_Image_Memories{};
+	vector<unique_ptr<VkImageView_T, function<void(VkImageView)>>> m_Texture_Image_Views{};
+	unique_ptr<VkSampler_T, function<void(VkSampler)>> m_Texture_Sampler{ nullptr };
+	uint32_t m_Texture_Slot_Count{ 1 };
+	const char* m_Fragment_Shader_Path{ Fragment_Shader_File_Path };
+	//NOTE : Texture Slot Of Each Material
+	vector<uint32_t> m_Material_Texture_Slots{};
+
+	vector<unique_ptr<VkBuffer_T, function<void(VkBuffer)>>> m_Uniform_Buffers{};
+	vector<unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>>> m_Uniform_Buffers_Memory{};
+	vector<void*> Uniform_Buffers_Mapped{};
+
+	unique_ptr<VkDescriptorPool_T, function<void(VkDescriptorPool)>> m_Descriptor_Pool{ nullptr };
+	vector<VkDescriptorSet> m_Descriptor_Sets{};
+
+	unique_ptr<VkBuffer_T, function<void(VkBuffer)>> m_Vertex_Buffer{ nullptr };
+	unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> m_Vertex_Buffer_Memory{ nullptr };
+	std::vector<Vertex> m_Vertices{};
+	Vertex_Layout m_Vertex_Layout{};
+	Mesh_Bounds m_Mesh_Bounds{};
+	Vertex_Cache_Statistics m_Mesh_Statistics_Before{};
+	Vertex_Cache_Statistics m_Mesh_Statistics_After{};
+
+	unique_ptr<VkBuffer_T, function<void(VkBuffer)>> m_Index_Buffer{ nullptr };
+	unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> m_Index_Buffer_Memory{ nullptr };
+	vector<uint32_t> m_Indices{};
+	Packed_Indices m_Packed_Indices{};
+
+	//NOTE : m_Vertex_Buffer And m_Index_Buffer Are The Pool's Shared Buffers, The Scene Mesh Is One Allocation In Them
+	Geometry_Pool m_Geometry_Pool{};
+	optional<Geometry_Pool::Handle> m_Mesh_Geometry{};
+	vector<Mesh_Lod> m_Mesh_Lods{};
+	vector<Mesh_Material> m_Materials{};
+
+	Bounding_Sphere m_Mesh_Sphere{};
+
+	vector<glm::mat4> m_Object_Transforms{};
+	Bounding_Volumes m_Object_Volumes{};
+	vector<uint32_t> m_Visible_Objects{};
+	Draw_Queue m_Draw_Queue{};
+	Masked_Occlusion_Culler m_Occlusion_Culler{};
+
+	bool m_Instanced_Drawing{ false };
+	bool m_Vertex_Pulling{ false };
+	unique_ptr<VkBuffer_T, function<void(VkBuffer)>> m_Instance_Buffer{ nullptr };
+	unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> m_Instance_Buffer_Memory{ nullptr };
+
+	bool m_Gpu_Culling{ false };
+	uint32_t m_Max_Draw_Count{ 0 };
+	unique_ptr<VkBuffer_T, function<void(VkBuffer)>> m_Lod_Buffer{ nullptr };
+	unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> m_Lod_Buffer_Memory{ nullptr };
+	unique_ptr<VkBuffer_T, function<void(VkBuffer)>> m_Draw_Range_Buffer{ nullptr };
+	unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> m_Draw_Range_Buffer_Memory{ nullptr };
+	vector<unique_ptr<VkBuffer_T, function<void(VkBuffer)>>> m_Draw_Buffers{};
+	vector<unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>>> m_Draw_Buffers_Memory{};
+	unique_ptr<VkDescriptorSetLayout_T, function<void(VkDescriptorSetLayout)>> m_Cull_Descriptor_Set_Layout{ nullptr };
+	unique_ptr<VkDescriptorPool_T, function<void(VkDescriptorPool)>> m_Cull_Descriptor_Pool{ nullptr };
+	vector<VkDescriptorSet> m_Cull_Descriptor_Sets{};
+	unique_ptr<VkPipelineLayout_T, function<void(VkPipelineLayout)>> m_Cull_Pipeline_Layout{ nullptr };
+	unique_ptr<VkPipeline_T, function<void(VkPipeline)>> m_Cull_Pipeline{ nullptr };
+
+	//NOTE : Clusters Are The Meshlets Of LOD 0, Each Thread Of The Cluster Pass Tests One Against One Instance
+	bool m_Cluster_Culling{ false };
+	uint32_t m_Cluster_Count{ 0 };
+	unique_ptr<VkBuffer_T, function<void(VkBuffer)>> m_Cluster_Buffer{ nullptr };
+	unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> m_Cluster_Buffer_Memory{ nullptr };
+
+	//NOTE : Draw Buffers Then Hold Mesh Tasks, The Mesh Shader Reads Meshlets Straight From These Buffers
+	bool m_Mesh_Shading{ false };
+	unique_ptr<VkBuffer_T, function<void(VkBuffer)>> m_Meshlet_Vertex_Buffer{ nullptr };
+	unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> m_Meshlet_Vertex_Buffer_Memory{ nullptr };
+	unique_ptr<VkBuffer_T, function<void(VkBuffer)>> m_Meshlet_Triangle_Buffer{ nullptr };
+	unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> m_Meshlet_Triangle_Buffer_Memory{ nullptr };
+
+	bool m_Occlusion_Culling{ false };
+	bool m_Depth_Pyramid_Valid{ false };
+	glm::mat4 m_Previous_View_Proj{ 1.0f };
+	unique_ptr<VkRenderPass_T, function<void(VkRenderPass)>> m_Early_Render_Pass{ nullptr };
+	unique_ptr<VkRenderPass_T, function<void(VkRenderPass)>> m_Late_Render_Pass{ nullptr };
+
+	//NOTE : No Render Pass Or Framebuffer Objects At All On This Path, The Graph Transitions Every Attachment
+	bool m_Dynamic_Rendering{ false };
+	PFN_vkCmdBeginRenderingKHR m_Cmd_Begin_Rendering{ nullptr };
+	PFN_vkCmdEndRenderingKHR m_Cmd_End_Rendering{ nullptr };
+	PFN_vkCmdDrawMeshTasksIndirectEXT m_Cmd_Draw_Mesh_Tasks_Indirect{ nullptr };
+
+	//NOTE : The Scene Has One Material, It Is Set While Recording As Far As The Dynamic State Level Reaches
+	Extended_Dynamic_State m_Extended_Dynamic_State{};
+	Material_State m_Scene_Material{};
+	vector<unique_ptr<VkBuffer_T, function<void(VkBuffer)>>> m_Late_Draw_Buffers{};
+	vector<unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>>> m_Late_Draw_Buffers_Memory{};
+	unique_ptr<VkBuffer_T, function<void(VkBuffer)>> m_Occlusion_State_Buffer{ nullptr };
+	unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> m_Occlusion_State_Buffer_Memory{ nullptr };
+	vector<unique_ptr<VkBuffer_T, function<void(VkBuffer)>>> m_Occlusion_Uniform_Buffers{};
+	vector<unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>>> m_Occlusion_Uniform_Buffers_Memory{};
+	vector<void*> m_Occlusion_Uniforms_Mapped{};
+	vector<unique_ptr<VkBuffer_T, function<void(VkBuffer)>>> m_Occlusion_Statistics_Buffers{};
+	vector<unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>>> m_Occlusion_Statistics_Buffers_Memory{};
+	vector<void*> m_Occlusion_Statistics_Mapped{};
+	chrono::high_resolution_clock::time_point m_Occlusion_Report_Time{};
+	vector<VkDescriptorSet> m_Late_Cull_Descriptor_Sets{};
+	unique_ptr<VkPipeline_T, function<void(VkPipeline)>> m_Late_Cull_Pipeline{ nullptr };
+
+	uint32_t m_Pyramid_Level_Count{ 0 };
+	unique_ptr<VkImage_T, function<void(VkImage)>> m_Pyramid_Image{ nullptr };
+	unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> m_Pyramid_Image_Memory{ nullptr };
+	unique_ptr<VkImageView_T, function<void(VkImageView)>> m_Pyramid_Image_View{ nullptr };
+	vector<unique_ptr<VkImageView_T, function<void(VkImageView)>>> m_Pyramid_Level_Views{};
+	unique_ptr<VkSampler_T, function<void(VkSampler)>> m_Pyramid_Sampler{ nullptr };
+	unique_ptr<VkDescriptorSetLayout_T, function<void(VkDescriptorSetLayout)>> m_Pyramid_Descriptor_Set_Layout{ nullptr };
+	unique_ptr<VkDescriptorPool_T, function<void(VkDescriptorPool)>> m_Pyramid_Descriptor_Pool{ nullptr };
+	vector<VkDescriptorSet> m_Pyramid_Descriptor_Sets{};
+	unique_ptr<VkPipelineLayout_T, function<void(VkPipelineLayout)>> m_Pyramid_Pipeline_Layout{ nullptr };
+	unique_ptr<VkPipeline_T, function<void(VkPipeline)>> m_Pyramid_Copy_Pipeline{ nullptr };
+	unique_ptr<VkPipeline_T, function<void(VkPipeline)>> m_Pyramid_Reduce_Pipeline{ nullptr };
+
+	glm::mat4 m_Scene_Matrix{ 1.0f };
+	glm::mat4 m_View_Matrix{ 1.0f };
+	glm::mat4 m_Proj_Matrix{ 1.0f };
+
+	vector<VkCommandBuffer> m_Command_Buffers{};
+
+	vector<unique_ptr<VkSemaphore_T, function<void(VkSemaphore)>>> m_Image_Available_Semaphores{};
+	vector<unique_ptr<VkSemaphore_T, function<void(VkSemaphore)>>> m_Render_Finished_Semaphores{};
+
+	//NOTE : One Monotonic Counter For Every Submission, Each Frame Slot Remembers The Value Its Last Submission Signals
+	unique_ptr<VkSemaphore_T, function<void(VkSemaphore)>> m_Timeline_Semaphore{ nullptr };
+	uint64_t m_Timeline_Value{ 0 };
+	vector<uint64_t> m_Frame_Timeline_Values{};
+
+	uint32_t m_Current_Frame{ 0 };
+
+	bool m_Frame_Buffer_Resized{ false };
+
+};
+
+struct Benchmark final {
+	static void Run(const string& Filter) {
+		const pair<const char*, void(*)(void)> Benchmarks[]{
+			{ "index_width", Benchmark::Index_Width },
+			{ "frustum_cull", Benchmark::Frustum_Cull },
+			{ "occlusion_cull", Benchmark::Occlusion_Cull },
+			{ "attachment_memory", Benchmark::Attachment_Memory },
+			{ "render_graph", Benchmark::Render_Graph_Compile },
+			{ "gpu_cull", Benchmark::Gpu_Cull },
+			{ "swapchain_recreate", Benchmark::Swap_Chain_Recreate },
+			{ "pipeline_library", Benchmark::Pipeline_Library },
+			{ "extended_dynamic_state", Benchmark::Extended_Dynamic_State_Binds },
+			{ "geometry_pool", Benchmark::Geometry_Pool_Churn },
+			{ "vertex_pulling", Benchmark::Vertex_Pulling },
+			{ "cluster_cull", Benchmark::Cluster_Cull },
+			{ "draw_sort", Benchmark::Draw_Sort },
+			{ "model_load", Benchmark::Model_Load },
+			{ "obj_stream", Benchmark::Obj_Stream },
+			{ "mesh_codec", Benchmark::Mesh_Codec_Throughput },
+		};
+
+		for (const auto& [Name, Function] : Benchmarks)
+			if (Filter.empty() || Filter == Name) {
+				cout << "[" << Name << "]" << endl;
+				Function();
+			}
+	}
+
+private:
+	//NOTE : Minimal Compute Only Vulkan Context, No Surface, So It Runs On Lavapipe In CI
+	struct Headless_Context final {
+		VkInstance Instance{ nullptr };
+		VkPhysicalDevice Physical_Device{ nullptr };
+		VkDevice Device{ nullptr };
+		VkQueue Queue{ nullptr };
+		uint32_t Queue_Family{ numeric_limits<uint32_t>::max() };
+		float Timestamp_Period{ 1.0f };
+		string Device_Name{};
+		vector<pair<VkBuffer, VkDeviceMemory>> Buffers{};
+		vector<tuple<VkImage, VkDeviceMemory, VkImageView>> Images{};
+		vector<VkShaderModule> Shader_Modules{};
+		vector<pair<VkDescriptorSetLayout, VkPipelineLayout>> Pipeline_Layouts{};
+
+		Headless_Context(void) = default;
+		Headless_Context(const Headless_Context&) = delete;
+		Headless_Context& operator=(const Headless_Context&) = delete;
+
+		~Headless_Context(void) {
+			for (const auto& [Buffer, Memory] : this->Buffers) {
+				vkDestroyBuffer(this->Device, Buffer, nullptr);
+				vkFreeMemory(this->Device, Memory, nullptr);
+			}
+
+			for (const auto& [Image, Memory, Image_View] : this->Images) {
+				vkDestroyImageView(this->Device, Image_View, nullptr);
+				vkDestroyImage(this->Device, Image, nullptr);
+				vkFreeMemory(this->Device, Memory, nullptr);
+			}
+
+			for (const VkShaderModule Shader_Module : this->Shader_Modules)
+				vkDestroyShaderModule(this->Device, Shader_Module, nullptr);
+
+			for (const auto& [Set_Layout, Pipeline_Layout] : this->Pipeline_Layouts) {
+				vkDestroyPipelineLayout(this->Device, Pipeline_Layout, nullptr);
+				vkDestroyDescriptorSetLayout(this->Device, Set_Layout, nullptr);
+			}
+
+			if (nullptr != this->Device)
+				vkDestroyDevice(this->Device, nullptr);
+			if (nullptr != this->Instance)
+				vkDestroyInstance(this->Instance, nullptr);
+		}
+
+		//NOTE : Prefers A CPU Device Such As Lavapipe, Falls Back To Any Vulkan 1.2 Device With drawIndirectCount
+		//NOTE : Devices Missing One Of The Requested Extensions Are Skipped, Features Chain Straight Into Device Creation
+		const bool Create(const vector<const char*>& Device_Extensions = {}, const void* Device_Features = nullptr) {
+			VkApplicationInfo Application_Info{};
+			{
+				Application_Info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+				Application_Info.pApplicationName = "Benchmark";
+				Application_Info.apiVersion = VK_API_VERSION_1_2;
+			}
+
+			VkInstanceCreateInfo Instance_Create_Info{};
+			{
+				Instance_Create_Info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+				Instance_Create_Info.pApplicationInfo = &Application_Info;
+			}
+
+			if (VK_SUCCESS != vkCreateInstance(&Instance_Create_Info, nullptr, &this->Instance))
+				return false;
+
+			uint32_t Device_Count{ 0 };
+			THROW_IF_VK_FAILED(vkEnumeratePhysicalDevices(this->Instance, &Device_Count, nullptr));
+			vector<VkPhysicalDevice> Devices(Device_Count);
+			THROW_IF_VK_FAILED(vkEnumeratePhysicalDevices(this->Instance, &Device_Count, Devices.data()));
+
+			for (const auto& Device : Devices) {
+				VkPhysicalDeviceProperties Properties{};
+				vkGetPhysicalDeviceProperties(Device, &Properties);
+
+				uint32_t Queue_Family_Count{ 0 };
+				vkGetPhysicalDeviceQueueFamilyProperties(Device, &Queue_Family_Count, nullptr);
+				vector<VkQueueFamilyProperties> Queue_Families(Queue_Family_Count);
+				vkGetPhysicalDeviceQueueFamilyProperties(Device, &Queue_Family_Count, Queue_Families.data());
+
+				uint32_t Queue_Family{ numeric_limits<uint32_t>::max() };
+				for (uint32_t Index = 0; Index < Queue_Family_Count; ++Index)
+					if (0 != (Queue_Families[Index].queueFlags & VK_QUEUE_COMPUTE_BIT) && 0 != Queue_Families[Index].timestampValidBits) {
+						Queue_Family = Index;
+						break;
+					}
+
+				if (VK_API_VERSION_1_2 > Properties.apiVersion || numeric_limits<uint32_t>::max() == Queue_Family)
+					continue;
+
+				uint32_t Extension_Count{ 0 };
+				THROW_IF_VK_FAILED(vkEnumerateDeviceExtensionProperties(Device, nullptr, &Extension_Count, nullptr));
+				vector<VkExtensionProperties> Available_Extensions(Extension_Count);
+				THROW_IF_VK_FAILED(vkEnumerateDeviceExtensionProperties(Device, nullptr, &Extension_Count, Available_Extensions.data()));
+
+				const auto Is_Available = [&Available_Extensions](const char* Extension) {
+					return any_of(Available_Extensions.begin(), Available_Extensions.end(), [Extension](const VkExtensionProperties& Available) { return 0 == strcmp(Available.extensionName, Extension); });
+				};
+
+				if (!all_of(Device_Extensions.begin(), Device_Extensions.end(), Is_Available))
+					continue;
+
+				const bool Is_Cpu{ VK_PHYSICAL_DEVICE_TYPE_CPU == Properties.deviceType };
+				if (nullptr == this->Physical_Device || Is_Cpu) {
+					this->Physical_Device = Device;
+					this->Queue_Family = Queue_Family;
+					this->Timestamp_Period = Properties.limits.timestampPeriod;
+					this->Device_Name = Properties.deviceName;
+				}
+
+				if (Is_Cpu)
+					break;
+			}
+
+			if (nullptr == this->Physical_Device)
+				return false;
+
+			constexpr float Queue_Priority{ 1.0f };
+			VkDeviceQueueCreateInfo Queue_Create_Info{};
+			{
+				Queue_Create_Info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+				Queue_Create_Info.queueFamilyIndex = this->Queue_Family;
+				Queue_Create_Info.queueCount = 1;
+				Queue_Create_Info.pQueuePriorities = &Queue_Priority;
+			}
+
+			VkDeviceCreateInfo Device_Create_Info{};
+			{
+				Device_Create_Info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+				Device_Create_Info.pNext = Device_Features;
+				Device_Create_Info.queueCreateInfoCount = 1;
+				Device_Create_Info.pQueueCreateInfos = &Queue_Create_Info;
+				Device_Create_Info.enabledExtensionCount = static_cast<uint32_t>(Device_Extensions.size());
+				Device_Create_Info.ppEnabledExtensionNames = Device_Extensions.data();
+			}
+
+			THROW_IF_VK_FAILED(vkCreateDevice(this->Physical_Device, &Device_Create_Info, nullptr, &this->Device));
+			vkGetDeviceQueue(this->Device, this->Queue_Family, 0, &this->Queue);
+
+			return true;
+		}
+
+		//NOTE : Host Visible And Persistently Mapped, Software Devices Have No Faster Memory Anyway
+		void* Create_Buffer(VkDeviceSize Size, VkBufferUsageFlags Usage, VkBuffer& Buffer) {
+			VkBufferCreateInfo Buffer_Info{};
+			{
+				Buffer_Info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+				Buffer_Info.size = Size;
+				Buffer_Info.usage = Usage;
+				Buffer_Info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+			}
+			THROW_IF_VK_FAILED(vkCreateBuffer(this->Device, &Buffer_Info, nullptr, &Buffer));
+
+			VkMemoryRequirements Memory_Requirements{};
+			vkGetBufferMemoryRequirements(this->Device, Buffer, &Memory_Requirements);
+
+			VkPhysicalDeviceMemoryProperties Memory_Properties{};
+			vkGetPhysicalDeviceMemoryProperties(this->Physical_Device, &Memory_Properties);
+
+			constexpr VkMemoryPropertyFlags Property_Flags{ VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT };
+			uint32_t Memory_Type{ numeric_limits<uint32_t>::max() };
+			for (uint32_t Index = 0; Index < Memory_Properties.memoryTypeCount; ++Index)
+				if (0 != (Memory_Requirements.memoryTypeBits & (1 << Index)) && (Memory_Properties.memoryTypes[Index].propertyFlags & Property_Flags) == Property_Flags) {
+					Memory_Type = Index;
+					break;
+				}
+
+			if (numeric_limits<uint32_t>::max() == Memory_Type)
+				throw runtime_error("Failed to find suitable memory type!");
+
+			VkMemoryAllocateInfo Allocate_Info{};
+			{
+				Allocate_Info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+				Allocate_Info.allocationSize = Memory_Requirements.size;
+				Allocate_Info.memoryTypeIndex = Memory_Type;
+			}
+
+			VkDeviceMemory Memory{ nullptr };
+			THROW_IF_VK_FAILED(vkAllocateMemory(this->Device, &Allocate_Info, nullptr, &Memory));
+			THROW_IF_VK_FAILED(vkBindBufferMemory(this->Device, Buffer, Memory, 0));
+			this->Buffers.emplace_back(Buffer, Memory);
+
+			void* Mapped{ nullptr };
+			THROW_IF_VK_FAILED(vkMapMemory(this->Device, Memory, 0, Size, 0, &Mapped));
+			return Mapped;
+		}
+
+		const VkImageView Create_Attachment(VkExtent2D Extent, VkFormat Format, VkSampleCountFlagBits Samples, VkImageUsageFlags Usage, VkImageAspectFlags Aspect) {
+			VkImageCreateInfo Image_Info{};
+			{
+				Image_Info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+				Image_Info.imageType = VK_IMAGE_TYPE_2D;
+				Image_Info.format = Format;
+				Image_Info.extent = { Extent.width, Extent.height, 1 };
+				Image_Info.mipLevels = 1;
+				Image_Info.arrayLayers = 1;
+				Image_Info.samples = Samples;
+				Image_Info.tiling = VK_IMAGE_TILING_OPTIMAL;
+				Image_Info.usage = Usage;
+				Image_Info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+				Image_Info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+			}
+
+			VkImage Image{ nullptr };
+			THROW_IF_VK_FAILED(vkCreateImage(this->Device, &Image_Info, nullptr, &Image));
+
+			VkMemoryRequirements Memory_Requirements{};
+			vkGetImageMemoryRequirements(this->Device, Image, &Memory_Requirements);
+
+			VkPhysicalDeviceMemoryProperties Memory_Properties{};
+			vkGetPhysicalDeviceMemoryProperties(this->Physical_Device, &Memory_Properties);
+
+			uint32_t Memory_Type{ numeric_limits<uint32_t>::max() };
+			for (uint32_t Index = 0; Index < Memory_Properties.memoryTypeCount; ++Index)
+				if (0 != (Memory_Requirements.memoryTypeBits & (1 << Index))) {
+					Memory_Type = Index;
+					break;
+				}
+
+			VkMemoryAllocateInfo Allocate_Info{};
+			{
+				Allocate_Info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+				Allocate_Info.allocationSize = Memory_Requirements.size;
+				Allocate_Info.memoryTypeIndex = Memory_Type;
+			}
+
+			VkDeviceMemory Memory{ nullptr };
+			THROW_IF_VK_FAILED(vkAllocateMemory(this->Device, &Allocate_Info, nullptr, &Memory));
+			THROW_IF_VK_FAILED(vkBindImageMemory(this->Device, Image, Memory, 0));
+
+			VkImageViewCreateInfo View_Info{};
+			{
+				View_Info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+				View_Info.image = Image;
+				View_Info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+				View_Info.format = Format;
+				View_Info.subresourceRange = { Aspect, 0, 1, 0, 1 };
+			}
+
+			VkImageView Image_View{ nullptr };
+			THROW_IF_VK_FAILED(vkCreateImageView(this->Device, &View_Info, nullptr, &Image_View));
+			this->Images.emplace_back(Image, Memory, Image_View);
+
+			return Image_View;
+		}
+
+		const VkShaderModule Load_Shader(const char* Path) {
+			const auto& Code{ Read_File(std::filesystem::path(Path, std::filesystem::path::generic_format)) };
+
+			VkShaderModuleCreateInfo Module_Info{};
+			{
+				Module_Info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+				Module_Info.codeSize = Code.size();
+				Module_Info.pCode = reinterpret_cast<const uint32_t*>(Code.data());
+			}
+
+			VkShaderModule Shader_Module{ nullptr };
+			THROW_IF_VK_FAILED(vkCreateShaderModule(this->Device, &Module_Info, nullptr, &Shader_Module));
+			this->Shader_Modules.push_back(Shader_Module);
+
+			return Shader_Module;
+		}
+
+		//NOTE : Same Bindings As The Scene Descriptor Set, The Pipelines Are Built But Never Drawn With Real Resources
+		const VkPipelineLayout Create_Scene_Pipeline_Layout(void) {
+			array<VkDescriptorSetLayoutBinding, 4> Bindings{};
+			{
+				Bindings[0] = { 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr };
+				Bindings[1] = { 1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr };
+				Bindings[2] = { 2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr };
+				Bindings[3] = { 3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr };
+			}
+
+			VkDescriptorSetLayoutCreateInfo Set_Layout_Info{};
+			{
+				Set_Layout_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+				Set_Layout_Info.bindingCount = static_cast<uint32_t>(Bindings.size());
+				Set_Layout_Info.pBindings = Bindings.data();
+			}
+			VkDescriptorSetLayout Set_Layout{ nullptr };
+			THROW_IF_VK_FAILED(vkCreateDescriptorSetLayout(this->Device, &Set_Layout_Info, nullptr, &Set_Layout));
+
+			const VkPushConstantRange Pull_Constant_Range{ VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(Vertex_Pull_Constants) };
+			VkPipelineLayoutCreateInfo Pipeline_Layout_Info{};
+			{
+				Pipeline_Layout_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+				Pipeline_Layout_Info.setLayoutCount = 1;
+				Pipeline_Layout_Info.pSetLayouts = &Set_Layout;
+				Pipeline_Layout_Info.pushConstantRangeCount = 1;
+				Pipeline_Layout_Info.pPushConstantRanges = &Pull_Constant_Range;
+			}
+			VkPipelineLayout Pipeline_Layout{ nullptr };
+			THROW_IF_VK_FAILED(vkCreatePipelineLayout(this->Device, &Pipeline_Layout_Info, nullptr, &Pipeline_Layout));
+			this->Pipeline_Layouts.emplace_back(Set_Layout, Pipeline_Layout);
 
-		if (!tinyobj::LoadObj(&Attrib, &Shapes, &Materials, &Warning, &Error, Model_File_Path))
-			throw runtime_error(Warning + Error);
+			return Pipeline_Layout;
+		}
+	};
 
-		unordered_map<Vertex, uint32_t> Unique_Vertices{};
+	template<typename Function_Type>
+	static const double Time_Milliseconds(uint32_t Repeat, Function_Type&& Function) {
+		const auto Start_Time{ chrono::high_resolution_clock::now() };
+		for (uint32_t Index = 0; Index < Repeat; ++Index)
+			Function();
+		const auto End_Time{ chrono::high_resolution_clock::now() };
 
-		for (const auto& Shape : Shapes) {
-			for (const auto& Index : Shape.mesh.indices) {
+		return chrono::duration<double, chrono::milliseconds::period>(End_Time - Start_Time).count() / Repeat;
+	}
+
+	static void Make_Grid_Mesh(uint32_t Side, vector<Vertex>& Vertices, vector<uint32_t>& Indices) {
+		Vertices.clear();
+		Indices.clear();
+
+		for (uint32_t Y = 0; Y < Side; ++Y)
+			for (uint32_t X = 0; X < Side; ++X) {
 				Vertex Vertex{};
+				{
+					Vertex.Pos = { static_cast<float>(X) / Side, static_cast<float>(Y) / Side, 0.1f * std::sin(0.1f * X) * std::cos(0.1f * Y) };
+					Vertex.Color = { 1.0f, 1.0f, 1.0f };
+					Vertex.TexCoord = { static_cast<float>(X) / Side, static_cast<float>(Y) / Side };
+				}
+				Vertices.push_back(Vertex);
+			}
 
-				Vertex.Pos = {
-					Attrib.vertices[3 * Index.vertex_index + 0],
-					Attrib.vertices[3 * Index.vertex_index + 1],
-					Attrib.vertices[3 * Index.vertex_index + 2]
-				};
+		for (uint32_t Y = 0; Y + 1 < Side; ++Y)
+			for (uint32_t X = 0; X + 1 < Side; ++X) {
+				const uint32_t Corner{ Y * Side + X };
+				Indices.insert(Indices.end(), { Corner, Corner + 1, Corner + Side, Corner + 1, Corner + Side + 1, Corner + Side });
+			}
 
-				Vertex.TexCoord = {
-					Attrib.texcoords[2 * Index.texcoord_index + 0],
-					1.0f - Attrib.texcoords[2 * Index.texcoord_index + 1]
-				};
+		//NOTE : Same Pipeline As Load_Model So Index Ranges Are Representative
+		Mesh_Optimizer::Optimize_Vertex_Cache(Indices, Vertices.size());
+		Mesh_Optimizer::Optimize_Vertex_Fetch(Indices, Vertices);
+	}
 
-				Vertex.Color = { 1.0f, 1.0f, 1.0f };
-				if (Unique_Vertices.count(Vertex) == 0) {
-					Unique_Vertices[Vertex] = static_cast<uint32_t>(this->m_Vertices.size());
+	//NOTE : Unit UV Sphere With Outward Counter Clockwise Faces, Unlike The Grid Its Meshlets Face Every Way
+	static void Make_Sphere_Mesh(uint32_t Rings, uint32_t Segments, vector<Vertex>& Vertices, vector<uint32_t>& Indices) {
+		Vertices.clear();
+		Indices.clear();
+
+		for (uint32_t Ring = 0; Ring <= Rings; ++Ring)
+			for (uint32_t Segment = 0; Segment <= Segments; ++Segment) {
+				const float Theta{ glm::pi<float>() * Ring / Rings };
+				const float Phi{ 2.0f * glm::pi<float>() * Segment / Segments };
 
-					this->m_Vertices.push_back(Vertex);
+				Vertex Vertex{};
+				{
+					Vertex.Pos = { std::sin(Theta) * std::cos(Phi), std::sin(Theta) * std::sin(Phi), std::cos(Theta) };
+					Vertex.Color = { 1.0f, 1.0f, 1.0f };
+					Vertex.TexCoord = { static_cast<float>(Segment) / Segments, static_cast<float>(Ring) / Rings };
 				}
+				Vertices.push_back(Vertex);
+			}
 
-				this->m_Indices.push_back(Unique_Vertices[Vertex]);
+		for (uint32_t Ring = 0; Ring < Rings; ++Ring)
+			for (uint32_t Segment = 0; Segment < Segments; ++Segment) {
+				const uint32_t Corner{ Ring * (Segments + 1) + Segment };
+				const uint32_t Below{ Corner + Segments + 1 };
+				Indices.insert(Indices.end(), { Corner, Below, Corner + 1, Corner + 1, Below, Below + 1 });
 			}
+
+		Mesh_Optimizer::Optimize_Vertex_Cache(Indices, Vertices.size());
+		Mesh_Optimizer::Optimize_Vertex_Fetch(Indices, Vertices);
+	}
+
+	static void Index_Width(void) {
+		for (const uint32_t Side : { 128u, 256u, 512u, 1024u, 2048u }) {
+			vector<Vertex> Vertices{};
+			vector<uint32_t> Indices{};
+			Benchmark::Make_Grid_Mesh(Side, Vertices, Indices);
+
+			Packed_Indices Wide{};
+			const auto Wide_Ranges{ Wide.Append(Indices) };
+
+			Packed_Indices Packed{};
+			vector<Mesh_Draw_Range> Packed_Ranges{};
+			const double Pack_Milliseconds{ Benchmark::Time_Milliseconds(8, [&](void) {
+				Packed = Packed_Indices{};
+				Packed.Index_Type = Packed_Indices::Choose_Index_Type(Indices, Vertices.size());
+				Packed_Ranges = Packed.Append(Indices);
+			}) };
+
+			//NOTE : Input Assembler Reads Every Index Of Every Draw Once, So Index Traffic Per Frame Equals Buffer Size At One Instance
+			cout << "vertices " << Vertices.size()
+				<< ", indices " << Indices.size()
+				<< ", type " << (VK_INDEX_TYPE_UINT16 == Packed.Index_Type ? "uint16" : "uint32")
+				<< ", index bytes per frame " << Wide.Data.size() << " -> " << Packed.Data.size()
+				<< " (saved " << 100.0 * (1.0 - static_cast<double>(Packed.Data.size()) / Wide.Data.size()) << "%)"
+				<< ", draws " << Wide_Ranges.size() << " -> " << Packed_Ranges.size()
+				<< ", pack " << Pack_Milliseconds << " ms" << endl;
 		}
 	}
 
-	void Create_Vertex_Buffer(void) {
-		VkDeviceSize Buffer_Size = sizeof(Vertex) * this->m_Vertices.size();
+	static void Frustum_Cull(void) {
+		constexpr size_t Object_Count{ 1 << 20 };
 
-		VkBuffer Staging_Buffer{ nullptr };
-		VkDeviceMemory Staging_Buffer_Memory{ nullptr };
-		this->Create_Buffer(Buffer_Size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, Staging_Buffer, Staging_Buffer_Memory);
+		Mesh_Bounds Local_Bounds{};
+		{
+			Local_Bounds.Min = glm::vec3{ -0.5f };
+			Local_Bounds.Max = glm::vec3{ 0.5f };
+		}
 
-		void* Data{ nullptr };
-		THROW_IF_VK_FAILED(vkMapMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory, 0, Buffer_Size, 0, &Data));
-		memcpy(Data, this->m_Vertices.data(), static_cast<size_t>(Buffer_Size));
-		vkUnmapMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory);
+		Bounding_Sphere Local_Sphere{};
+		{
+			Local_Sphere.Center = glm::vec3{ 0.0f };
+			Local_Sphere.Radius = glm::length(glm::vec3{ 0.5f });
+		}
 
-		VkBuffer Vertex_Buffer{ nullptr };
-		VkDeviceMemory Vertex_Buffer_Memory{ nullptr };
+		Bounding_Volumes Volumes{};
+		Volumes.Resize(Object_Count);
+
+		uint32_t Seed{ 1 };
+		const auto Random = [&Seed](void) {
+			Seed = Seed * 1664525u + 1013904223u;
+			return static_cast<float>(Seed >> 8) / static_cast<float>(1 << 24);
+		};
 
-		this->Create_Buffer(Buffer_Size, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, Vertex_Buffer, Vertex_Buffer_Memory);
+		for (size_t Object = 0; Object < Object_Count; ++Object) {
+			const glm::vec3 Position{ Random() * 200.0f - 100.0f, Random() * 200.0f - 100.0f, Random() * 200.0f - 100.0f };
+			const glm::mat4 Transform{ glm::rotate(glm::translate(glm::mat4{ 1.0f }, Position), Random() * 6.2831853f, glm::vec3{ 0.0f, 0.0f, 1.0f }) };
+			Volumes.Set(Object, Local_Sphere, Local_Bounds, Transform);
+		}
 
-		this->m_Vertex_Buffer.get_deleter() = [Device = this->m_Logical_Device.get()](VkBuffer Vertex_Buffer) {if (nullptr != Vertex_Buffer) vkDestroyBuffer(Device, Vertex_Buffer, nullptr); };
-		this->m_Vertex_Buffer.reset(Vertex_Buffer);
+		const glm::mat4 View{ glm::lookAt(glm::vec3{ 0.0f }, glm::vec3{ 1.0f, 0.0f, 0.0f }, glm::vec3{ 0.0f, 0.0f, 1.0f }) };
+		const glm::mat4 Proj{ glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 150.0f) };
+		const Frustum Frustum{ Frustum::From_Matrix(Proj * View) };
+
+		vector<uint32_t> Visible{};
+		vector<uint32_t> Reference{};
+		//NOTE : Every Vectorized Path Must Keep Exactly The Objects The Scalar Path Keeps, In The Same Order
+		const auto Report = [&Visible, &Reference](const char* Name, double Milliseconds) {
+			const auto Mismatch{ std::mismatch(Visible.begin(), Visible.end(), Reference.begin(), Reference.end()) };
+			const bool Identical{ Visible.end() == Mismatch.first && Reference.end() == Mismatch.second };
+			cout << Name << ": " << Milliseconds << " ms, " << Object_Count / Milliseconds / 1000.0 << " M objects/s, visible " << Visible.size() << " / " << Object_Count << ", " << (Identical ? "matches scalar" : "mismatch") << endl;
+			if (!Identical)
+				throw runtime_error(string{ Name } + " frustum culling differs from scalar at visible entry " + std::to_string(Mismatch.first - Visible.begin()) + "!");
+		};
 
-		this->m_Vertex_Buffer_Memory.get_deleter() = [Device = this->m_Logical_Device.get()](VkDeviceMemory Vertex_Buffer_Memory) {if (nullptr != Vertex_Buffer_Memory) vkFreeMemory(Device, Vertex_Buffer_Memory, nullptr); };
-		this->m_Vertex_Buffer_Memory.reset(Vertex_Buffer_Memory);
+		const double Scalar_Milliseconds{ Benchmark::Time_Milliseconds(16, [&](void) { Frustum_Culler::Cull_Scalar(Frustum, Volumes, Reference); }) };
+		Visible = Reference;
+		Report("scalar", Scalar_Milliseconds);
+#if defined(SIMD_SSE_ENABLE)
+		Report("sse", Benchmark::Time_Milliseconds(16, [&](void) { Frustum_Culler::Cull_SSE(Frustum, Volumes, Visible); }));
+#endif
+#if defined(SIMD_AVX_ENABLE)
+		Report("avx", Benchmark::Time_Milliseconds(16, [&](void) { Frustum_Culler::Cull_AVX(Frustum, Volumes, Visible); }));
+#endif
+	}
 
-		this->Copy_Buffer(Staging_Buffer, this->m_Vertex_Buffer.get(), Buffer_Size);
+	//NOTE : Device Independent Version Of The Startup Report, Assumes A Tiler That Exposes Lazily Allocated Memory
+	static void Attachment_Memory(void) {
+		const VkSampleCountFlags Sample_Counts{ VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_2_BIT | VK_SAMPLE_COUNT_4_BIT | VK_SAMPLE_COUNT_8_BIT };
 
-		vkDestroyBuffer(this->m_Logical_Device.get(), Staging_Buffer, nullptr);
-		vkFreeMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory, nullptr);
+		Attachment_Policy::Report({ 1920, 1080 }, VK_FORMAT_B8G8R8A8_SRGB, VK_FORMAT_D32_SFLOAT, Sample_Counts, true, true);
+		Attachment_Policy::Report({ 3840, 2160 }, VK_FORMAT_B8G8R8A8_SRGB, VK_FORMAT_D32_SFLOAT, Sample_Counts, true, true);
 	}
 
-	void Create_Index_Buffer(void) {
-		VkDeviceSize Buffer_Size{ sizeof(uint32_t) * this->m_Indices.size() };
+	//NOTE : Deferred Frame With Shadows, Bloom And A Debug View Nothing Reads, Sizes Are Estimated So No Device Is Needed
+	static void Render_Graph_Compile(void) {
+		const VkExtent2D Extent{ 1920, 1080 };
 
-		VkBuffer Staging_Buffer{ nullptr };
-		VkDeviceMemory Staging_Buffer_Memory{ nullptr };
-		this->Create_Buffer(Buffer_Size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, Staging_Buffer, Staging_Buffer_Memory);
+		const auto Build = [&](Render_Graph& Graph) {
+			const auto Image = [&](const string& Name, VkExtent2D Image_Extent, VkFormat Format, VkImageAspectFlags Aspect) {
+				VkImageCreateInfo Image_Info{};
+				{
+					Image_Info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+					Image_Info.imageType = VK_IMAGE_TYPE_2D;
+					Image_Info.extent = { Image_Extent.width, Image_Extent.height, 1 };
+					Image_Info.mipLevels = 1;
+					Image_Info.arrayLayers = 1;
+					Image_Info.format = Format;
+					Image_Info.samples = VK_SAMPLE_COUNT_1_BIT;
+				}
 
-		void* Data{ nullptr };
-		THROW_IF_VK_FAILED(vkMapMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory, 0, Buffer_Size, 0, &Data));
-		memcpy(Data, this->m_Indices.data(), static_cast<size_t>(Buffer_Size));
-		vkUnmapMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory);
+				return Graph.Create_Image(Name, Image_Info, Aspect, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+			};
 
-		VkBuffer Index_Buffer{ nullptr };
-		VkDeviceMemory Index_Buffer_Memory{ nullptr };
-		this->Create_Buffer(Buffer_Size, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, Index_Buffer, Index_Buffer_Memory);
+			const VkExtent2D Half{ Extent.width / 2, Extent.height / 2 }, Quarter{ Extent.width / 4, Extent.height / 4 };
+			const uint32_t Shadow_Map{ Image("Shadow Map", { 2048, 2048 }, VK_FORMAT_D32_SFLOAT, VK_IMAGE_ASPECT_DEPTH_BIT) };
+			const uint32_t Albedo{ Image("Albedo", Extent, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_ASPECT_COLOR_BIT) };
+			const uint32_t Normal{ Image("Normal", Extent, VK_FORMAT_R16G16B16A16_SFLOAT, VK_IMAGE_ASPECT_COLOR_BIT) };
+			const uint32_t Depth{ Image("Depth", Extent, VK_FORMAT_D32_SFLOAT, VK_IMAGE_ASPECT_DEPTH_BIT) };
+			const uint32_t Hdr{ Image("Hdr", Extent, VK_FORMAT_R16G16B16A16_SFLOAT, VK_IMAGE_ASPECT_COLOR_BIT) };
+			const uint32_t Debug_View{ Image("Debug View", Extent, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_ASPECT_COLOR_BIT) };
+			const uint32_t Bloom_Half{ Image("Bloom Half", Half, VK_FORMAT_R16G16B16A16_SFLOAT, VK_IMAGE_ASPECT_COLOR_BIT) };
+			const uint32_t Bloom_Quarter{ Image("Bloom Quarter", Quarter, VK_FORMAT_R16G16B16A16_SFLOAT, VK_IMAGE_ASPECT_COLOR_BIT) };
+			const uint32_t Ldr{ Image("Ldr", Extent, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_ASPECT_COLOR_BIT) };
+			const uint32_t Swap_Chain{ Graph.Import_Image("Swap Chain", VK_IMAGE_ASPECT_COLOR_BIT, 1, false, Render_Graph_Access_Present) };
+
+			const auto Target = [](uint32_t Resource, Render_Graph_Access Access) { return Render_Graph::Attachment(Resource, Access, VK_IMAGE_LAYOUT_UNDEFINED, Render_Graph_Access_Fragment_Read); };
+			const auto Sample = [](uint32_t Resource) { return Render_Graph::Use(Resource, Render_Graph_Access_Fragment_Read); };
+			const auto Nothing = [](VkCommandBuffer) {};
+
+			Graph.Add_Pass("Shadow", { Target(Shadow_Map, Render_Graph_Access_Depth_Attachment) }, Nothing);
+			Graph.Add_Pass("Geometry", { Target(Albedo, Render_Graph_Access_Color_Attachment), Target(Normal, Render_Graph_Access_Color_Attachment), Target(Depth, Render_Graph_Access_Depth_Attachment) }, Nothing);
+			Graph.Add_Pass("Lighting", { Sample(Albedo), Sample(Normal), Sample(Depth), Sample(Shadow_Map), Target(Hdr, Render_Graph_Access_Color_Attachment) }, Nothing);
+			Graph.Add_Pass("Debug View", { Sample(Normal), Target(Debug_View, Render_Graph_Access_Color_Attachment) }, Nothing);
+			Graph.Add_Pass("Bloom Half", { Sample(Hdr), Target(Bloom_Half, Render_Graph_Access_Color_Attachment) }, Nothing);
+			Graph.Add_Pass("Bloom Quarter", { Sample(Bloom_Half), Target(Bloom_Quarter, Render_Graph_Access_Color_Attachment) }, Nothing);
+			Graph.Add_Pass("Tone Map", { Sample(Hdr), Sample(Bloom_Quarter), Target(Ldr, Render_Graph_Access_Color_Attachment) }, Nothing);
+			Graph.Add_Pass("Antialias", { Sample(Ldr),
+				Render_Graph::Attachment(Swap_Chain, Render_Graph_Access_Color_Attachment, VK_IMAGE_LAYOUT_UNDEFINED, Render_Graph_Access_Present) }, Nothing);
+
+			Graph.Compile([](Render_Graph_Resource& Resource) {
+				VkMemoryRequirements Memory_Requirements{};
+				{
+					Memory_Requirements.alignment = 64 * 1024;
+					Memory_Requirements.size = (Attachment_Policy::Get_Attachment_Size({ Resource.Image_Info.extent.width, Resource.Image_Info.extent.height }, Resource.Image_Info.format, Resource.Image_Info.samples)
+						+ Memory_Requirements.alignment - 1) / Memory_Requirements.alignment * Memory_Requirements.alignment;
+					Memory_Requirements.memoryTypeBits = 1;
+				}
 
-		this->m_Index_Buffer.get_deleter() = [Device = this->m_Logical_Device.get()](VkBuffer Index_Buffer) {if (nullptr != Index_Buffer) vkDestroyBuffer(Device, Index_Buffer, nullptr); };
-		this->m_Index_Buffer.reset(Index_Buffer);
+				return Memory_Requirements;
+			});
+		};
 
-		this->m_Index_Buffer_Memory.get_deleter() = [Device = this->m_Logical_Device.get()](VkDeviceMemory Index_Buffer_Memory) {if (nullptr != Index_Buffer_Memory) vkFreeMemory(Device, Index_Buffer_Memory, nullptr); };
-		this->m_Index_Buffer_Memory.reset(Index_Buffer_Memory);
+		Render_Graph Graph{};
+		Build(Graph);
+		Graph.Report();
 
-		this->Copy_Buffer(Staging_Buffer, this->m_Index_Buffer.get(), Buffer_Size);
+		for (const auto& Pass : Graph.Passes)
+			cout << "  " << Pass.Name << (Pass.Culled ? " culled" : "") << (!Pass.Barriers.Empty() ? ", waits on an earlier pass's memory" : "") << endl;
 
-		vkDestroyBuffer(this->m_Logical_Device.get(), Staging_Buffer, nullptr);
-		vkFreeMemory(this->m_Logical_Device.get(), Staging_Buffer_Memory, nullptr);
+		const double Compile_Milliseconds{ Benchmark::Time_Milliseconds(1000, [&](void) {
+			Render_Graph Rebuilt{};
+			Build(Rebuilt);
+		}) };
+		cout << "Declare and compile: " << Compile_Milliseconds * 1000.0 << " us" << endl;
 	}
 
-	void Create_Descriptor_Pool(void) {
-		array<VkDescriptorPoolSize, 2> Pool_Sizes{};
-		{
-			{
-				Pool_Sizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-				Pool_Sizes[0].descriptorCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);
-			}
-
-			{
-				Pool_Sizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-				Pool_Sizes[1].descriptorCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);
-			}
-		}
+	//NOTE : A Wall Of Grid Mesh In Front Of The Camera Hides Most Of A Random Field, No Culling Submits Every Frustum Survivor
+	static void Occlusion_Cull(void) {
+		constexpr size_t Object_Count{ 1 << 16 };
 
-		VkDescriptorPoolCreateInfo Pool_Info{};
-		{
-			Pool_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-			Pool_Info.poolSizeCount = static_cast<uint32_t>(Pool_Sizes.size());
-			Pool_Info.pPoolSizes = Pool_Sizes.data();
-			Pool_Info.maxSets = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);
-		}
+		vector<Vertex> Vertices{};
+		vector<uint32_t> Indices{};
+		Benchmark::Make_Grid_Mesh(64, Vertices, Indices);
 
-		VkDescriptorPool Descriptor_Pool{ nullptr };
-		THROW_IF_VK_FAILED(vkCreateDescriptorPool(this->m_Logical_Device.get(), &Pool_Info, nullptr, &Descriptor_Pool));
+		Mesh_Bounds Local_Bounds{};
+		for (const auto& Vertex : Vertices)
+			Local_Bounds.Expand(Vertex.Pos);
+		const Bounding_Sphere Local_Sphere{ Bounding_Sphere::From_Points(Vertices) };
 
-		this->m_Descriptor_Pool.get_deleter() = [Device = this->m_Logical_Device.get()](VkDescriptorPool Descriptor_Pool) {if (nullptr != Descriptor_Pool) vkDestroyDescriptorPool(Device, Descriptor_Pool, nullptr); };
-		this->m_Descriptor_Pool.reset(Descriptor_Pool);
-	}
+		//NOTE : Grid u, v Span The Wall, Its Height Bump Points Back Along The View Axis
+		const glm::mat4 Wall{ glm::vec4{ 0.0f, 6.0f, 0.0f, 0.0f }, glm::vec4{ 0.0f, 0.0f, 4.0f, 0.0f }, glm::vec4{ 1.0f, 0.0f, 0.0f, 0.0f }, glm::vec4{ 4.0f, -3.0f, -2.0f, 1.0f } };
 
-	void Create_Descriptor_Sets(void) {
-		vector<VkDescriptorSetLayout> Layouts(MAX_FRAMES_IN_FLIGHT, this->m_Descriptor_Set_Layout.get());
+		uint32_t Seed{ 1 };
+		const auto Random = [&Seed](void) {
+			Seed = Seed * 1664525u + 1013904223u;
+			return static_cast<float>(Seed >> 8) / static_cast<float>(1 << 24);
+		};
 
-		VkDescriptorSetAllocateInfo Allocate_Info{};
-		{
-			Allocate_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-			Allocate_Info.descriptorPool = this->m_Descriptor_Pool.get();
-			Allocate_Info.descriptorSetCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);
-			Allocate_Info.pSetLayouts = Layouts.data();
+		vector<glm::mat4> Transforms(Object_Count);
+		Bounding_Volumes Volumes{};
+		Volumes.Resize(Object_Count);
+		for (size_t Object = 0; Object < Object_Count; ++Object) {
+			const glm::vec3 Position{ 1.0f + Random() * 59.0f, Random() * 40.0f - 20.0f, Random() * 24.0f - 12.0f };
+			Transforms[Object] = glm::rotate(glm::translate(glm::mat4{ 1.0f }, Position), Random() * 6.2831853f, glm::vec3{ 0.0f, 0.0f, 1.0f });
+			Volumes.Set(Object, Local_Sphere, Local_Bounds, Transforms[Object]);
 		}
 
-		this->m_Descriptor_Sets.resize(MAX_FRAMES_IN_FLIGHT);
-		THROW_IF_VK_FAILED(vkAllocateDescriptorSets(this->m_Logical_Device.get(), &Allocate_Info, this->m_Descriptor_Sets.data()));
+		const glm::mat4 View{ glm::lookAt(glm::vec3{ 0.0f }, glm::vec3{ 1.0f, 0.0f, 0.0f }, glm::vec3{ 0.0f, 0.0f, 1.0f }) };
+		const glm::mat4 Proj{ glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 150.0f) };
+		const glm::mat4 View_Proj{ Proj * View };
 
-		for (size_t Index = 0; Index < MAX_FRAMES_IN_FLIGHT; ++Index) {
-			VkDescriptorBufferInfo Buffer_Info{};
-			{
-				Buffer_Info.buffer = this->m_Uniform_Buffers[Index].get();
-				Buffer_Info.offset = 0;
-				Buffer_Info.range = sizeof(Uniform_Buffer_Object);
-			}
+		vector<uint32_t> Frustum_Visible{};
+		Frustum_Culler::Cull(Frustum::From_Matrix(View_Proj), Volumes, Frustum_Visible);
 
-			VkDescriptorImageInfo Image_Info{};
-			{
-				Image_Info.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-				Image_Info.imageView = this->m_Texture_Image_View.get();
-				Image_Info.sampler = this->m_Texture_Sampler.get();
-			}
+		Masked_Occlusion_Culler Culler{};
+		const auto Render_Occluders = [&](uint32_t Thread_Count) {
+			Culler.Clear();
+			Culler.Add_Occluder(Vertices, Indices.data(), Indices.size(), View_Proj * Wall);
+			Culler.Rasterize(Thread_Count);
+		};
 
-			array<VkWriteDescriptorSet, 2> Descriptor_Writes{};
-			{
-				{
-					Descriptor_Writes[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-					Descriptor_Writes[0].dstSet = this->m_Descriptor_Sets[Index];
-					Descriptor_Writes[0].dstBinding = 0;
-					Descriptor_Writes[0].dstArrayElement = 0;
-					Descriptor_Writes[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-					Descriptor_Writes[0].descriptorCount = 1;
-					Descriptor_Writes[0].pBufferInfo = &Buffer_Info;
-				}
+		vector<uint32_t> Occlusion_Visible{};
+		const auto Test_Objects = [&](void) {
+			Occlusion_Visible.clear();
+			for (const uint32_t Object : Frustum_Visible)
+				if (Culler.Is_Visible(Local_Bounds, View_Proj * Transforms[Object]))
+					Occlusion_Visible.push_back(Object);
+		};
 
-				{
-					Descriptor_Writes[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-					Descriptor_Writes[1].dstSet = this->m_Descriptor_Sets[Index];
-					Descriptor_Writes[1].dstBinding = 1;
-					Descriptor_Writes[1].dstArrayElement = 0;
-					Descriptor_Writes[1].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-					Descriptor_Writes[1].descriptorCount = 1;
-					Descriptor_Writes[1].pImageInfo = &Image_Info;
-				}
-			}
+		const uint32_t Thread_Count{ std::max(1u, thread::hardware_concurrency()) };
+		const double Single_Milliseconds{ Benchmark::Time_Milliseconds(32, [&](void) { Render_Occluders(1); }) };
+		const double Threaded_Milliseconds{ Benchmark::Time_Milliseconds(32, [&](void) { Render_Occluders(Thread_Count); }) };
+		const double Test_Milliseconds{ Benchmark::Time_Milliseconds(32, Test_Objects) };
 
-			vkUpdateDescriptorSets(this->m_Logical_Device.get(), static_cast<uint32_t>(Descriptor_Writes.size()), Descriptor_Writes.data(), 0, nullptr);
-		}
+		//NOTE : Anything Nearer Than The Wall Must Survive, Otherwise The Buffer Is Not Conservative
+		size_t Wrongly_Culled{ 0 };
+		for (const uint32_t Object : Frustum_Visible)
+			if (Volumes.Max_X[Object] < 4.0f && Occlusion_Visible.end() == std::find(Occlusion_Visible.begin(), Occlusion_Visible.end(), Object))
+				++Wrongly_Culled;
 
+		const size_t Triangle_Count{ Indices.size() / 3 };
+#if defined(SIMD_AVX2_ENABLE)
+		cout << "rasterizer: avx2, " << Masked_Occlusion_Culler::Width << "x" << Masked_Occlusion_Culler::Height << ", " << Triangle_Count << " occluder triangles" << endl;
+#else
+		cout << "rasterizer: scalar, " << Masked_Occlusion_Culler::Width << "x" << Masked_Occlusion_Culler::Height << ", " << Triangle_Count << " occluder triangles" << endl;
+#endif
+		cout << "no culling: " << Frustum_Visible.size() << " objects, " << Frustum_Visible.size() * Triangle_Count << " triangles submitted" << endl;
+		cout << "occlusion culling: " << Occlusion_Visible.size() << " objects, " << Occlusion_Visible.size() * Triangle_Count << " triangles submitted, "
+			<< Wrongly_Culled << " nearer than the occluder culled" << endl;
+		cout << "occluders 1 thread: " << Single_Milliseconds << " ms, " << Thread_Count << " threads: " << Threaded_Milliseconds << " ms" << endl;
+		cout << "tests: " << Test_Milliseconds << " ms, " << Frustum_Visible.size() / Test_Milliseconds / 1000.0 << " M objects/s" << endl;
 	}
 
-	void Create_Command_Buffers(void) {
-		this->m_Command_Buffers.resize(MAX_FRAMES_IN_FLIGHT);
+	//NOTE : CPU Loop Is Volume Update, SIMD Cull, LOD Pick And One Draw Record Per Survivor, GPU Side Is One Dispatch Whatever The Count
+	static void Gpu_Cull(void) {
+		if (!std::filesystem::exists(std::filesystem::path(Cull_Compute_Shader_File_Path, std::filesystem::path::generic_format))) {
+			cout << "skipped, " << Cull_Compute_Shader_File_Path << " has not been compiled" << endl;
+			return;
+		}
 
-		VkCommandBufferAllocateInfo Command_Buffer_Allocate_Info{};
-		{
-			Command_Buffer_Allocate_Info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-			Command_Buffer_Allocate_Info.commandPool = this->m_Command_Pool.get();
-			Command_Buffer_Allocate_Info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-			Command_Buffer_Allocate_Info.commandBufferCount = static_cast<uint32_t>(m_Command_Buffers.size());
+		Headless_Context Context{};
+		if (!Context.Create()) {
+			cout << "skipped, no Vulkan 1.2 device with timestamps" << endl;
+			return;
+		}
+		cout << "device " << Context.Device_Name << endl;
+
+		//NOTE : Synthetic LOD Chain, One Range Per Level So Command Count Equals Visible Instance Count
+		vector<Mesh_Lod> Lods(4);
+		for (size_t Level = 0; Level < Lods.size(); ++Level) {
+			Lods[Level].Index_Count = 3 * (4096u >> Level);
+			Lods[Level].Error = 0.002f * static_cast<float>((1u << (2 * Level)) - 1);
+			Lods[Level].Draw_Ranges.push_back(Mesh_Draw_Range{ 0, Lods[Level].Index_Count, 0 });
 		}
 
-		THROW_IF_VK_FAILED(vkAllocateCommandBuffers(this->m_Logical_Device.get(), &Command_Buffer_Allocate_Info, this->m_Command_Buffers.data()));
-	}
+		vector<Gpu_Lod> Gpu_Lods{};
+		vector<Gpu_Draw_Range> Gpu_Ranges{};
+		const uint32_t Max_Range_Count{ Gpu_Culling::Build_Tables(Lods, {}, Gpu_Lods, Gpu_Ranges) };
 
-	void Record_Command_Buffer(VkCommandBuffer Command_Buffer, uint32_t Image_Index) {
+		Mesh_Bounds Local_Bounds{};
+		{
+			Local_Bounds.Min = glm::vec3{ -0.5f };
+			Local_Bounds.Max = glm::vec3{ 0.5f };
+		}
 
-		VkCommandBufferBeginInfo Command_Buffer_Begin_Info{};
+		Bounding_Sphere Local_Sphere{};
 		{
-			Command_Buffer_Begin_Info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-			Command_Buffer_Begin_Info.pInheritanceInfo = nullptr;
+			Local_Sphere.Radius = glm::length(glm::vec3{ 0.5f });
 		}
 
-		if (VK_SUCCESS != vkBeginCommandBuffer(this->m_Command_Buffers[this->m_Current_Frame], &Command_Buffer_Begin_Info))
-			throw runtime_error("Failed to begin recording command buffer!");
+		const glm::mat4 Scene{ glm::rotate(glm::mat4{ 1.0f }, glm::radians(30.0f), glm::vec3{ 0.0f, 0.0f, 1.0f }) };
+		const glm::mat4 View{ glm::lookAt(glm::vec3{ 0.0f }, glm::vec3{ 1.0f, 0.0f, 0.0f }, glm::vec3{ 0.0f, 0.0f, 1.0f }) };
+		const glm::mat4 Proj{ glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 150.0f) };
+		constexpr float Viewport_Height{ 1080.0f };
 
-		VkRect2D Render_Area{};
+		const auto& Shader_Code{ Read_File(std::filesystem::path(Cull_Compute_Shader_File_Path, std::filesystem::path::generic_format)) };
+		VkShaderModuleCreateInfo Module_Info{};
 		{
-			Render_Area.offset = { 0, 0 };
-			Render_Area.extent = this->m_Swap_Chain_Extent;
+			Module_Info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+			Module_Info.codeSize = Shader_Code.size();
+			Module_Info.pCode = reinterpret_cast<const uint32_t*>(Shader_Code.data());
+		}
+		VkShaderModule Shader_Module{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateShaderModule(Context.Device, &Module_Info, nullptr, &Shader_Module));
+
+		array<VkDescriptorSetLayoutBinding, 4> Bindings{};
+		for (uint32_t Binding = 0; Binding < Bindings.size(); ++Binding) {
+			Bindings[Binding].binding = Binding;
+			Bindings[Binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+			Bindings[Binding].descriptorCount = 1;
+			Bindings[Binding].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
 		}
 
-		array<VkClearValue, 2> Clear_Values{};
+		VkDescriptorSetLayoutCreateInfo Set_Layout_Info{};
 		{
-			Clear_Values[0].color = { 0.0f, 0.0f, 0.0f, 1.0f };
-			Clear_Values[1].depthStencil = { 1.0f, 0 };
+			Set_Layout_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+			Set_Layout_Info.bindingCount = static_cast<uint32_t>(Bindings.size());
+			Set_Layout_Info.pBindings = Bindings.data();
 		}
+		VkDescriptorSetLayout Set_Layout{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateDescriptorSetLayout(Context.Device, &Set_Layout_Info, nullptr, &Set_Layout));
 
-		VkViewport Viewport{};
+		VkPushConstantRange Push_Constant_Range{ VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(Gpu_Cull_Constants) };
+		VkPipelineLayoutCreateInfo Pipeline_Layout_Info{};
 		{
-			Viewport.x = 0.0f;
-			Viewport.y = 0.0f;
-			Viewport.width = static_cast<float>(this->m_Swap_Chain_Extent.width);
-			Viewport.height = static_cast<float>(this->m_Swap_Chain_Extent.height);
-			Viewport.minDepth = 0.0f;
-			Viewport.maxDepth = 1.0f;
+			Pipeline_Layout_Info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+			Pipeline_Layout_Info.setLayoutCount = 1;
+			Pipeline_Layout_Info.pSetLayouts = &Set_Layout;
+			Pipeline_Layout_Info.pushConstantRangeCount = 1;
+			Pipeline_Layout_Info.pPushConstantRanges = &Push_Constant_Range;
 		}
+		VkPipelineLayout Pipeline_Layout{ nullptr };
+		THROW_IF_VK_FAILED(vkCreatePipelineLayout(Context.Device, &Pipeline_Layout_Info, nullptr, &Pipeline_Layout));
 
-		VkRect2D Scissor{};
+		VkComputePipelineCreateInfo Pipeline_Info{};
 		{
-			Scissor.offset = { 0, 0 };
-			Scissor.extent = this->m_Swap_Chain_Extent;
+			Pipeline_Info.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+			Pipeline_Info.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+			Pipeline_Info.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+			Pipeline_Info.stage.module = Shader_Module;
+			Pipeline_Info.stage.pName = "main";
+			Pipeline_Info.layout = Pipeline_Layout;
 		}
+		VkPipeline Pipeline{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateComputePipelines(Context.Device, VK_NULL_HANDLE, 1, &Pipeline_Info, nullptr, &Pipeline));
+		vkDestroyShaderModule(Context.Device, Shader_Module, nullptr);
 
-		VkRenderPassBeginInfo Render_Pass_Begin_Info{};
+		VkDescriptorPoolSize Pool_Size{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, static_cast<uint32_t>(Bindings.size()) };
+		VkDescriptorPoolCreateInfo Pool_Info{};
 		{
-			Render_Pass_Begin_Info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-			Render_Pass_Begin_Info.renderPass = this->m_Render_Pass.get();
-			Render_Pass_Begin_Info.framebuffer = this->m_Swap_Chain_Frame_buffers[Image_Index].get();
-			Render_Pass_Begin_Info.renderArea = Render_Area;
-			Render_Pass_Begin_Info.clearValueCount = static_cast<uint32_t>(Clear_Values.size());
-			Render_Pass_Begin_Info.pClearValues = Clear_Values.data();
+			Pool_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+			Pool_Info.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+			Pool_Info.maxSets = 1;
+			Pool_Info.poolSizeCount = 1;
+			Pool_Info.pPoolSizes = &Pool_Size;
 		}
+		VkDescriptorPool Descriptor_Pool{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateDescriptorPool(Context.Device, &Pool_Info, nullptr, &Descriptor_Pool));
 
-		vkCmdBeginRenderPass(Command_Buffer, &Render_Pass_Begin_Info, VK_SUBPASS_CONTENTS_INLINE);
-
-		vkCmdBindPipeline(Command_Buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, this->m_Graphics_Pipeline.get());
-
-		vkCmdSetViewport(Command_Buffer, 0, 1, &Viewport);
-		vkCmdSetScissor(Command_Buffer, 0, 1, &Scissor);
-
-		VkBuffer Vertex_Buffers[] = { this->m_Vertex_Buffer.get() };
-		VkDeviceSize Offsets[] = { 0 };
-		vkCmdBindVertexBuffers(Command_Buffer, 0, 1, Vertex_Buffers, Offsets);
-
-		vkCmdBindIndexBuffer(Command_Buffer, this->m_Index_Buffer.get(), 0, VK_INDEX_TYPE_UINT32);
-
-		//TODO Add Descripation Set 
-		//vkCmdBindDescriptorSets(Command_Buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, this->m_Pipeline_Layout.get(), 0, 1, &this->m_Descriptor_Sets[this->m_Current_Frame].get(), 0, nullptr);
-
-		vkCmdBindDescriptorSets(Command_Buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, this->m_Pipeline_Layout.get(), 0, 1, &this->m_Descriptor_Sets[this->m_Current_Frame], 0, nullptr);
-
-		vkCmdDrawIndexed(Command_Buffer, static_cast<uint32_t>(this->m_Indices.size()), 1, 0, 0, 0);
-
-		vkCmdEndRenderPass(Command_Buffer);
-
-		if (VK_SUCCESS != vkEndCommandBuffer(Command_Buffer))
-			throw runtime_error("Failed to record command buffer!");
-	}
+		VkCommandPoolCreateInfo Command_Pool_Info{};
+		{
+			Command_Pool_Info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+			Command_Pool_Info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+			Command_Pool_Info.queueFamilyIndex = Context.Queue_Family;
+		}
+		VkCommandPool Command_Pool{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateCommandPool(Context.Device, &Command_Pool_Info, nullptr, &Command_Pool));
 
-	void Create_Sync_Objects(void) {
-		VkSemaphoreCreateInfo Semaphore_Info{};
+		VkCommandBufferAllocateInfo Command_Buffer_Info{};
 		{
-			Semaphore_Info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+			Command_Buffer_Info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			Command_Buffer_Info.commandPool = Command_Pool;
+			Command_Buffer_Info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+			Command_Buffer_Info.commandBufferCount = 1;
 		}
+		VkCommandBuffer Command_Buffer{ nullptr };
+		THROW_IF_VK_FAILED(vkAllocateCommandBuffers(Context.Device, &Command_Buffer_Info, &Command_Buffer));
 
 		VkFenceCreateInfo Fence_Info{};
 		{
 			Fence_Info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-			Fence_Info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
 		}
+		VkFence Fence{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateFence(Context.Device, &Fence_Info, nullptr, &Fence));
 
-		VkSemaphore Semaphore{ nullptr };
-		const auto  Deleter_Semaphore = [Device = this->m_Logical_Device.get()](VkSemaphore Semaphore) {if (nullptr != Semaphore) vkDestroySemaphore(Device, Semaphore, nullptr); };
+		VkQueryPoolCreateInfo Query_Pool_Info{};
+		{
+			Query_Pool_Info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+			Query_Pool_Info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+			Query_Pool_Info.queryCount = 2;
+		}
+		VkQueryPool Query_Pool{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateQueryPool(Context.Device, &Query_Pool_Info, nullptr, &Query_Pool));
+
+		VkBuffer Lod_Buffer{ nullptr };
+		memcpy(Context.Create_Buffer(sizeof(Gpu_Lod) * Gpu_Lods.size(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, Lod_Buffer), Gpu_Lods.data(), sizeof(Gpu_Lod) * Gpu_Lods.size());
+		VkBuffer Range_Buffer{ nullptr };
+		memcpy(Context.Create_Buffer(sizeof(Gpu_Draw_Range) * Gpu_Ranges.size(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, Range_Buffer), Gpu_Ranges.data(), sizeof(Gpu_Draw_Range) * Gpu_Ranges.size());
+
+		for (const uint32_t Instance_Count : { 1u << 14, 1u << 16, 1u << 18, 1u << 20, 1u << 21 }) {
+			uint32_t Seed{ 1 };
+			const auto Random = [&Seed](void) {
+				Seed = Seed * 1664525u + 1013904223u;
+				return static_cast<float>(Seed >> 8) / static_cast<float>(1 << 24);
+			};
 
-		VkFence InFlight_Fence{ nullptr };
-		const auto Delete_Fence = [Device = this->m_Logical_Device.get()](VkFence Fence) {if (nullptr != Fence) vkDestroyFence(Device, Fence, nullptr); };
+			vector<glm::mat4> Placements(Instance_Count);
+			for (auto& Placement : Placements)
+				Placement = glm::translate(glm::mat4{ 1.0f }, glm::vec3{ Random() * 200.0f - 100.0f, Random() * 200.0f - 100.0f, Random() * 200.0f - 100.0f });
+
+			//NOTE : CPU Reference, Everything The Direct Draw Path Does Per Frame
+			Bounding_Volumes Volumes{};
+			Volumes.Resize(Instance_Count);
+			vector<uint32_t> Visible{};
+			vector<VkDrawIndexedIndirectCommand> Cpu_Commands{};
+			const glm::vec3 Camera_Position{ glm::inverse(View)[3] };
+			const double Cpu_Milliseconds{ Benchmark::Time_Milliseconds(8, [&](void) {
+				for (uint32_t Instance = 0; Instance < Instance_Count; ++Instance)
+					Volumes.Set(Instance, Local_Sphere, Local_Bounds, Scene * Placements[Instance]);
+				Frustum_Culler::Cull(Frustum::From_Matrix(Proj * View), Volumes, Visible);
+
+				Cpu_Commands.clear();
+				for (const uint32_t Instance : Visible) {
+					const float Distance{ glm::length(glm::vec3{ Volumes.Center_X[Instance], Volumes.Center_Y[Instance], Volumes.Center_Z[Instance] } - Camera_Position) - Volumes.Radius[Instance] };
+					const float Pixels_Per_Unit{ 0.5f * Viewport_Height * glm::abs(Proj[1][1]) / std::max(Distance, numeric_limits<float>::epsilon()) };
+
+					size_t Level{ Lods.size() };
+					while (1 < Level && Lods[Level - 1].Error * Pixels_Per_Unit > Lod_Pixel_Threshold)
+						--Level;
+
+					for (const auto& Range : Lods[Level - 1].Draw_Ranges)
+						Cpu_Commands.push_back(VkDrawIndexedIndirectCommand{ Range.Index_Count, 1, Range.First_Index, Range.Vertex_Offset, Instance });
+				}
+			}) };
 
-		this->m_Image_Available_Semaphores.resize(MAX_FRAMES_IN_FLIGHT);
-		this->m_Render_Finished_Semaphores.resize(MAX_FRAMES_IN_FLIGHT);
+			vector<Gpu_Instance> Instances(Instance_Count);
+			for (uint32_t Instance = 0; Instance < Instance_Count; ++Instance)
+				Instances[Instance] = Gpu_Culling::Build_Instance(Placements[Instance], glm::mat4{ 1.0f }, Local_Sphere);
 
-		this->m_InFlight_Fences.resize(MAX_FRAMES_IN_FLIGHT);
+			const uint32_t Max_Draw_Count{ Max_Range_Count * Instance_Count };
+			VkBuffer Instance_Buffer{ nullptr };
+			memcpy(Context.Create_Buffer(sizeof(Gpu_Instance) * Instances.size(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, Instance_Buffer), Instances.data(), sizeof(Gpu_Instance) * Instances.size());
+			VkBuffer Draw_Buffer{ nullptr };
+			const uint32_t* Draw_Count{ static_cast<const uint32_t*>(Context.Create_Buffer(Gpu_Culling::Get_Draw_Buffer_Size(Max_Draw_Count), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, Draw_Buffer)) };
 
-		for (size_t Index = 0; Index < MAX_FRAMES_IN_FLIGHT; ++Index) {
-			THROW_IF_VK_FAILED(vkCreateSemaphore(this->m_Logical_Device.get(), &Semaphore_Info, nullptr, &Semaphore));
+			VkDescriptorSetAllocateInfo Set_Info{};
+			{
+				Set_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+				Set_Info.descriptorPool = Descriptor_Pool;
+				Set_Info.descriptorSetCount = 1;
+				Set_Info.pSetLayouts = &Set_Layout;
+			}
+			VkDescriptorSet Descriptor_Set{ nullptr };
+			THROW_IF_VK_FAILED(vkAllocateDescriptorSets(Context.Device, &Set_Info, &Descriptor_Set));
+
+			const array<VkDescriptorBufferInfo, 4> Buffer_Infos{ {
+				{ Instance_Buffer, 0, VK_WHOLE_SIZE },
+				{ Lod_Buffer, 0, VK_WHOLE_SIZE },
+				{ Range_Buffer, 0, VK_WHOLE_SIZE },
+				{ Draw_Buffer, 0, VK_WHOLE_SIZE },
+			} };
+			array<VkWriteDescriptorSet, 4> Writes{};
+			for (uint32_t Binding = 0; Binding < Writes.size(); ++Binding) {
+				Writes[Binding].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+				Writes[Binding].dstSet = Descriptor_Set;
+				Writes[Binding].dstBinding = Binding;
+				Writes[Binding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+				Writes[Binding].descriptorCount = 1;
+				Writes[Binding].pBufferInfo = &Buffer_Infos[Binding];
+			}
+			vkUpdateDescriptorSets(Context.Device, static_cast<uint32_t>(Writes.size()), Writes.data(), 0, nullptr);
 
-			this->m_Image_Available_Semaphores[Index].get_deleter() = Deleter_Semaphore;
-			this->m_Image_Available_Semaphores[Index].reset(Semaphore);
+			double Record_Milliseconds{ 0.0 };
+			double Gpu_Milliseconds{ 0.0 };
+			constexpr uint32_t Frame_Count{ 8 };
+			for (uint32_t Frame = 0; Frame < Frame_Count; ++Frame) {
+				const auto Record_Start{ chrono::high_resolution_clock::now() };
 
-			THROW_IF_VK_FAILED(vkCreateSemaphore(this->m_Logical_Device.get(), &Semaphore_Info, nullptr, &Semaphore));
+				THROW_IF_VK_FAILED(vkResetCommandBuffer(Command_Buffer, 0));
+				VkCommandBufferBeginInfo Begin_Info{};
+				{
+					Begin_Info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+					Begin_Info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+				}
+				THROW_IF_VK_FAILED(vkBeginCommandBuffer(Command_Buffer, &Begin_Info));
 
-			this->m_Render_Finished_Semaphores[Index].get_deleter() = Deleter_Semaphore;
-			this->m_Render_Finished_Semaphores[Index].reset(Semaphore);
+				vkCmdResetQueryPool(Command_Buffer, Query_Pool, 0, 2);
+				vkCmdWriteTimestamp(Command_Buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, Query_Pool, 0);
+				vkCmdFillBuffer(Command_Buffer, Draw_Buffer, 0, sizeof(uint32_t), 0);
 
-			THROW_IF_VK_FAILED(vkCreateFence(this->m_Logical_Device.get(), &Fence_Info, nullptr, &InFlight_Fence));
+				VkMemoryBarrier Fill_Barrier{ VK_STRUCTURE_TYPE_MEMORY_BARRIER, nullptr, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT };
+				vkCmdPipelineBarrier(Command_Buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &Fill_Barrier, 0, nullptr, 0, nullptr);
 
-			this->m_InFlight_Fences[Index].get_deleter() = Delete_Fence;
-			this->m_InFlight_Fences[Index].reset(InFlight_Fence);
-		}
-	}
+				const Gpu_Cull_Constants Constants{ Gpu_Culling::Build_Constants(Scene, View, Proj, Viewport_Height, Instance_Count, static_cast<uint32_t>(Gpu_Lods.size()), Max_Draw_Count) };
+				vkCmdBindPipeline(Command_Buffer, VK_PIPELINE_BIND_POINT_COMPUTE, Pipeline);
+				vkCmdBindDescriptorSets(Command_Buffer, VK_PIPELINE_BIND_POINT_COMPUTE, Pipeline_Layout, 0, 1, &Descriptor_Set, 0, nullptr);
+				vkCmdPushConstants(Command_Buffer, Pipeline_Layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(Constants), &Constants);
+				vkCmdDispatch(Command_Buffer, Gpu_Culling::Get_Group_Count(Instance_Count), 1, 1);
 
-	void UpData_Uniform_Buffer(uint32_t Current_Image) {
-		static auto Start_Time{ chrono::high_resolution_clock::now() };
+				VkMemoryBarrier Host_Barrier{ VK_STRUCTURE_TYPE_MEMORY_BARRIER, nullptr, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_HOST_READ_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT };
+				vkCmdPipelineBarrier(Command_Buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_HOST_BIT | VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, 0, 1, &Host_Barrier, 0, nullptr, 0, nullptr);
+				vkCmdWriteTimestamp(Command_Buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, Query_Pool, 1);
+				THROW_IF_VK_FAILED(vkEndCommandBuffer(Command_Buffer));
 
-		auto Current_Time{ chrono::high_resolution_clock::now() };
-		float Time{ chrono::duration<float, chrono::seconds::period>(Current_Time - Start_Time).count() };
+				VkSubmitInfo Submit_Info{};
+				{
+					Submit_Info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+					Submit_Info.commandBufferCount = 1;
+					Submit_Info.pCommandBuffers = &Command_Buffer;
+				}
+				THROW_IF_VK_FAILED(vkQueueSubmit(Context.Queue, 1, &Submit_Info, Fence));
+				Record_Milliseconds += chrono::duration<double, chrono::milliseconds::period>(chrono::high_resolution_clock::now() - Record_Start).count();
 
-		Uniform_Buffer_Object Ubo{};
-		{
-			Ubo.Model = glm::rotate(glm::mat4(1.0f), Time * glm::radians(90.0f), glm::vec3(0.0f, 0.0f, 1.0f));
-			Ubo.View = glm::lookAt(glm::vec3(2.0f, 2.0f, 2.0f), glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f));
-			Ubo.Proj = glm::perspective(glm::radians(45.0f), this->m_Swap_Chain_Extent.width / static_cast<float>(this->m_Swap_Chain_Extent.height), 0.1f, 10.0f);
-			Ubo.Proj[1][1] *= -1;
+				THROW_IF_VK_FAILED(vkWaitForFences(Context.Device, 1, &Fence, VK_TRUE, numeric_limits<uint64_t>::max()));
+				THROW_IF_VK_FAILED(vkResetFences(Context.Device, 1, &Fence));
+
+				array<uint64_t, 2> Timestamps{};
+				THROW_IF_VK_FAILED(vkGetQueryPoolResults(Context.Device, Query_Pool, 0, 2, sizeof(Timestamps), Timestamps.data(), sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT));
+				Gpu_Milliseconds += static_cast<double>(Timestamps[1] - Timestamps[0]) * Context.Timestamp_Period / 1.0e6;
+			}
+
+			cout << "instances " << Instance_Count
+				<< ", cpu loop " << Cpu_Milliseconds << " ms (" << Cpu_Commands.size() << " draws)"
+				<< ", gpu record+submit " << Record_Milliseconds / Frame_Count << " ms"
+				<< ", gpu cull " << Gpu_Milliseconds / Frame_Count << " ms (" << *Draw_Count << " draws)" << endl;
+
+			THROW_IF_VK_FAILED(vkFreeDescriptorSets(Context.Device, Descriptor_Pool, 1, &Descriptor_Set));
 		}
 
-		memcpy(this->Uniform_Buffers_Mapped[this->m_Current_Frame], &Ubo, sizeof(Ubo));
+		vkDestroyQueryPool(Context.Device, Query_Pool, nullptr);
+		vkDestroyFence(Context.Device, Fence, nullptr);
+		vkDestroyCommandPool(Context.Device, Command_Pool, nullptr);
+		vkDestroyDescriptorPool(Context.Device, Descriptor_Pool, nullptr);
+		vkDestroyPipeline(Context.Device, Pipeline, nullptr);
+		vkDestroyPipelineLayout(Context.Device, Pipeline_Layout, nullptr);
+		vkDestroyDescriptorSetLayout(Context.Device, Set_Layout, nullptr);
 	}
 
-	void Draw_Frame(void) {
+	//NOTE : A Headless Device Has No Surface, So Stand In Images Take The Swap Chain's Place And Only The Per Resize Objects Are Timed
+	static void Swap_Chain_Recreate(void) {
+		Headless_Context Context{};
+		if (!Context.Create()) {
+			cout << "skipped, no Vulkan 1.2 device" << endl;
+			return;
+		}
 
-		const VkFence Wait_Fences[] = { this->m_InFlight_Fences[this->m_Current_Frame].get() };
+		constexpr VkExtent2D Extent{ 1920, 1080 };
+		constexpr uint32_t Image_Count{ 3 };
+		constexpr VkFormat Color_Format{ VK_FORMAT_B8G8R8A8_UNORM };
+		constexpr VkFormat Depth_Format{ VK_FORMAT_D32_SFLOAT };
 
-		THROW_IF_VK_FAILED(vkWaitForFences(this->m_Logical_Device.get(), 1, Wait_Fences, VK_TRUE, std::numeric_limits<uint64_t>::max()));
-		THROW_IF_VK_FAILED(vkResetFences(this->m_Logical_Device.get(), 1, Wait_Fences));
+		VkPhysicalDeviceProperties Device_Properties{};
+		vkGetPhysicalDeviceProperties(Context.Physical_Device, &Device_Properties);
+		const VkSampleCountFlags Sample_Counts{ Device_Properties.limits.framebufferColorSampleCounts & Device_Properties.limits.framebufferDepthSampleCounts };
+		const VkSampleCountFlagBits Samples{ 0 != (Sample_Counts & VK_SAMPLE_COUNT_4_BIT) ? VK_SAMPLE_COUNT_4_BIT : VK_SAMPLE_COUNT_1_BIT };
 
-		uint32_t Image_Index{};
-		const VkResult Acquire_Flag{ vkAcquireNextImageKHR(this->m_Logical_Device.get(), this->m_Swap_Chain.get(), std::numeric_limits<uint64_t>::max(), this->m_Image_Available_Semaphores[this->m_Current_Frame].get(), VK_NULL_HANDLE, &Image_Index) };
+		VkPhysicalDeviceMemoryProperties Memory_Properties{};
+		vkGetPhysicalDeviceMemoryProperties(Context.Physical_Device, &Memory_Properties);
 
-		this->UpData_Uniform_Buffer(Image_Index);
+		vector<VkImage> Images{};
+		vector<VkDeviceMemory> Memories{};
+		vector<VkImageView> Image_Views{};
+		vector<VkRenderPass> Render_Passes{};
+		vector<VkFramebuffer> Framebuffers{};
 
-		if (VK_ERROR_OUT_OF_DATE_KHR == Acquire_Flag)
-			this->Re_Create_SwapChain();
-		else if (VK_SUCCESS != Acquire_Flag && VK_SUBOPTIMAL_KHR != Acquire_Flag)
-			throw runtime_error("Failed to acquire swap chain image!");
+		const auto Create_Image = [&](VkFormat Format, VkSampleCountFlagBits Image_Samples, VkImageUsageFlags Usage, VkImageAspectFlags Aspect) {
+			VkImageCreateInfo Image_Info{};
+			{
+				Image_Info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+				Image_Info.imageType = VK_IMAGE_TYPE_2D;
+				Image_Info.format = Format;
+				Image_Info.extent = { Extent.width, Extent.height, 1 };
+				Image_Info.mipLevels = 1;
+				Image_Info.arrayLayers = 1;
+				Image_Info.samples = Image_Samples;
+				Image_Info.tiling = VK_IMAGE_TILING_OPTIMAL;
+				Image_Info.usage = Usage;
+				Image_Info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+				Image_Info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+			}
 
-		THROW_IF_VK_FAILED(vkResetCommandBuffer(this->m_Command_Buffers[this->m_Current_Frame], 0));
-		this->Record_Command_Buffer(this->m_Command_Buffers[this->m_Current_Frame], Image_Index);
+			VkImage Image{ nullptr };
+			THROW_IF_VK_FAILED(vkCreateImage(Context.Device, &Image_Info, nullptr, &Image));
 
-		VkSemaphore Wait_Semaphores[] = { this->m_Image_Available_Semaphores[this->m_Current_Frame].get() };
-		VkPipelineStageFlags Wait_Stages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
-		VkSemaphore Signal_Semaphores[] = { this->m_Render_Finished_Semaphores[this->m_Current_Frame].get() };
+			VkMemoryRequirements Memory_Requirements{};
+			vkGetImageMemoryRequirements(Context.Device, Image, &Memory_Requirements);
 
-		VkSubmitInfo Submit_Info{};
-		{
-			Submit_Info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-			Submit_Info.waitSemaphoreCount = 1;
-			Submit_Info.pWaitSemaphores = Wait_Semaphores;
-			Submit_Info.pWaitDstStageMask = Wait_Stages;
-			Submit_Info.pCommandBuffers = &this->m_Command_Buffers[this->m_Current_Frame];
-			Submit_Info.commandBufferCount = 1;
-			Submit_Info.signalSemaphoreCount = 1;
-			Submit_Info.pSignalSemaphores = Signal_Semaphores;
-		}
+			uint32_t Memory_Type{ numeric_limits<uint32_t>::max() };
+			for (uint32_t Index = 0; Index < Memory_Properties.memoryTypeCount; ++Index)
+				if (0 != (Memory_Requirements.memoryTypeBits & (1 << Index)) && 0 != (Memory_Properties.memoryTypes[Index].propertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)) {
+					Memory_Type = Index;
+					break;
+				}
 
-		THROW_IF_VK_FAILED(vkQueueSubmit(this->m_Graphics_Queue, 1, &Submit_Info, this->m_InFlight_Fences[this->m_Current_Frame].get()));
+			if (numeric_limits<uint32_t>::max() == Memory_Type)
+				throw runtime_error("Failed to find suitable memory type!");
 
-		VkSwapchainKHR Swap_Chains[] = { this->m_Swap_Chain.get() };
+			VkMemoryAllocateInfo Allocate_Info{};
+			{
+				Allocate_Info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+				Allocate_Info.allocationSize = Memory_Requirements.size;
+				Allocate_Info.memoryTypeIndex = Memory_Type;
+			}
 
-		VkPresentInfoKHR Present_Info{};
-		{
-			Present_Info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
-			Present_Info.waitSemaphoreCount = 1;
-			Present_Info.pWaitSemaphores = Signal_Semaphores;
-			Present_Info.swapchainCount = 1;
-			Present_Info.pSwapchains = Swap_Chains;
-			Present_Info.pImageIndices = &Image_Index;
-			Present_Info.pResults = nullptr;
-		}
+			VkDeviceMemory Memory{ nullptr };
+			THROW_IF_VK_FAILED(vkAllocateMemory(Context.Device, &Allocate_Info, nullptr, &Memory));
+			THROW_IF_VK_FAILED(vkBindImageMemory(Context.Device, Image, Memory, 0));
 
-		const VkResult Present_Flag{ vkQueuePresentKHR(this->m_Present_Queue, &Present_Info) };
+			VkImageViewCreateInfo View_Info{};
+			{
+				View_Info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+				View_Info.image = Image;
+				View_Info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+				View_Info.format = Format;
+				View_Info.subresourceRange = { Aspect, 0, 1, 0, 1 };
+			}
 
-		if (VK_ERROR_OUT_OF_DATE_KHR == Present_Flag ||
-			VK_SUBOPTIMAL_KHR == Present_Flag ||
-			this->m_Frame_Buffer_Resized) {
-			this->m_Frame_Buffer_Resized = false;
-			this->Re_Create_SwapChain();
-		}
-		else if (VK_SUCCESS != Present_Flag && VK_SUBOPTIMAL_KHR != Present_Flag)
-			throw runtime_error("Failed to present swap chain image!");
+			VkImageView Image_View{ nullptr };
+			THROW_IF_VK_FAILED(vkCreateImageView(Context.Device, &View_Info, nullptr, &Image_View));
 
-		this->m_Current_Frame = (this->m_Current_Frame + 1) % MAX_FRAMES_IN_FLIGHT;
-	}
+			Images.push_back(Image);
+			Memories.push_back(Memory);
+			Image_Views.push_back(Image_View);
+			return Image_View;
+		};
 
-private:
-	uint32_t Find_Queue_Families(VkQueueFlagBits Vk_Queue_FlagBit) const {
-		uint32_t Queue_Family_Count;
-		vkGetPhysicalDeviceQueueFamilyProperties(this->m_Physical_Device, &Queue_Family_Count, nullptr);
+		const auto Recreate = [&](bool Dynamic_Rendering) {
+			const VkImageView Color_View{ Create_Image(Color_Format, Samples, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, VK_IMAGE_ASPECT_COLOR_BIT) };
+			const VkImageView Depth_View{ Create_Image(Depth_Format, Samples, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_IMAGE_ASPECT_DEPTH_BIT) };
+
+			array<VkImageView, Image_Count> Swap_Chain_Views{};
+			for (auto& Swap_Chain_View : Swap_Chain_Views)
+				Swap_Chain_View = Create_Image(Color_Format, VK_SAMPLE_COUNT_1_BIT, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, VK_IMAGE_ASPECT_COLOR_BIT);
+
+			if (!Dynamic_Rendering) {
+				for (const Render_Pass_Phase Phase : { Render_Pass_Complete, Render_Pass_Early, Render_Pass_Late })
+					Render_Passes.push_back(Scene_Pass::Build_Render_Pass(Context.Device, Color_Format, Depth_Format, Samples, Phase));
+
+				for (const VkImageView Swap_Chain_View : Swap_Chain_Views) {
+					array<VkImageView, 3> Attachments{ Color_View, Depth_View, Swap_Chain_View };
+
+					VkFramebufferCreateInfo Framebuffer_Info{};
+					{
+						Framebuffer_Info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+						Framebuffer_Info.renderPass = Render_Passes.front();
+						Framebuffer_Info.attachmentCount = static_cast<uint32_t>(Attachments.size());
+						Framebuffer_Info.pAttachments = Attachments.data();
+						Framebuffer_Info.width = Extent.width;
+						Framebuffer_Info.height = Extent.height;
+						Framebuffer_Info.layers = 1;
+					}
+
+					VkFramebuffer Framebuffer{ nullptr };
+					THROW_IF_VK_FAILED(vkCreateFramebuffer(Context.Device, &Framebuffer_Info, nullptr, &Framebuffer));
+					Framebuffers.push_back(Framebuffer);
+				}
+			}
 
-		vector<VkQueueFamilyProperties> Queue_Families;
-		Queue_Families.resize(Queue_Family_Count);
-		vkGetPhysicalDeviceQueueFamilyProperties(this->m_Physical_Device, &Queue_Family_Count, Queue_Families.data());
+			for (const VkFramebuffer Framebuffer : Framebuffers)
+				vkDestroyFramebuffer(Context.Device, Framebuffer, nullptr);
+			for (const VkRenderPass Render_Pass : Render_Passes)
+				vkDestroyRenderPass(Context.Device, Render_Pass, nullptr);
+			for (const VkImageView Image_View : Image_Views)
+				vkDestroyImageView(Context.Device, Image_View, nullptr);
+			for (const VkImage Image : Images)
+				vkDestroyImage(Context.Device, Image, nullptr);
+			for (const VkDeviceMemory Memory : Memories)
+				vkFreeMemory(Context.Device, Memory, nullptr);
+
+			Framebuffers.clear();
+			Render_Passes.clear();
+			Image_Views.clear();
+			Images.clear();
+			Memories.clear();
+		};
 
-		for (auto CIt = Queue_Families.cbegin(); CIt != Queue_Families.cend(); ++CIt)
-			if (CIt->queueFlags & Vk_Queue_FlagBit)
-				return  static_cast<uint32_t>(CIt - Queue_Families.cbegin());
+		cout << Context.Device_Name << ", " << Extent.width << "x" << Extent.height << ", " << Samples << "x MSAA, " << Image_Count << " swap chain images" << endl;
 
-		throw runtime_error("Failed to find a suitable GPU!");
+		const double Render_Pass_Milliseconds{ Benchmark::Time_Milliseconds(64, [&](void) { Recreate(false); }) };
+		const double Dynamic_Milliseconds{ Benchmark::Time_Milliseconds(64, [&](void) { Recreate(true); }) };
 
-		return numeric_limits<uint32_t>::max();
+		cout << "render pass and framebuffers " << Render_Pass_Milliseconds << " ms, "
+			<< "dynamic rendering " << Dynamic_Milliseconds << " ms per recreation" << endl;
 	}
 
-	uint32_t Get_Physical_Device_Queue_Present_Family(void) const {
-		uint32_t Queue_Family_Count;
-		vkGetPhysicalDeviceQueueFamilyProperties(this->m_Physical_Device, &Queue_Family_Count, nullptr);
+	//NOTE : Every Vertex Layout With A Compiled Shader Times Every Sample Count, Built Whole Versus From Shared Library Parts
+	static void Pipeline_Library(void) {
+		VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT Graphics_Pipeline_Library_Features{};
+		{
+			Graphics_Pipeline_Library_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+			Graphics_Pipeline_Library_Features.graphicsPipelineLibrary = VK_TRUE;
+		}
 
-		vector<VkQueueFamilyProperties> Queue_Families;
-		Queue_Families.resize(Queue_Family_Count);
-		vkGetPhysicalDeviceQueueFamilyProperties(this->m_Physical_Device, &Queue_Family_Count, Queue_Families.data());
+		Headless_Context Context{};
+		if (!Context.Create({ Device_EXT_Pipeline_Library, Device_EXT_Graphics_Pipeline_Library }, &Graphics_Pipeline_Library_Features)) {
+			cout << "skipped, no Vulkan 1.2 device with VK_EXT_graphics_pipeline_library" << endl;
+			return;
+		}
 
-		uint32_t Queue_Family_Index{ numeric_limits<uint32_t>::max() };
-		for (auto CIt = Queue_Families.cbegin(); CIt != Queue_Families.cend(); ++CIt) {
-			VkBool32 Present_Support{ false };
-			THROW_IF_VK_FAILED(vkGetPhysicalDeviceSurfaceSupportKHR(this->m_Physical_Device, static_cast<uint32_t>(CIt - Queue_Families.cbegin()), this->m_Surface.get(), &Present_Support));
+		const auto Shader_Exists = [](const char* Path) { return std::filesystem::exists(std::filesystem::path(Path, std::filesystem::path::generic_format)); };
+		if (!Shader_Exists(Fragment_Shader_File_Path)) {
+			cout << "skipped, shaders not compiled" << endl;
+			return;
+		}
 
-			if (Present_Support) {
-				Queue_Family_Index = static_cast<uint32_t>(CIt - Queue_Families.cbegin());
+		vector<Vertex_Layout> Layouts{};
+		for (const uint32_t Attributes : { Vertex_Attribute_Position | Vertex_Attribute_Color | Vertex_Attribute_TexCoord, Vertex_Attribute_Position | Vertex_Attribute_TexCoord, Vertex_Attribute_Position | Vertex_Attribute_TexCoord | Vertex_Attribute_Normal })
+			for (const bool Quantized : { false, true }) {
+				Vertex_Layout Layout{};
+				{
+					Layout.Attributes = Attributes;
+					Layout.Quantized = Quantized;
+				}
 
-				//NOTE : First Chose Queue Family With Graphics Bit
-				if (Queue_Family_Index == this->m_Queue_Family_Indices.Graphics_Family)
-					return Queue_Family_Index;
+				if (Shader_Exists(Layout.Get_Vertex_Shader_File_Path()))
+					Layouts.push_back(Layout);
 			}
-		}
 
-		return Queue_Family_Index;
-	}
+		VkPhysicalDeviceProperties Device_Properties{};
+		vkGetPhysicalDeviceProperties(Context.Physical_Device, &Device_Properties);
+		const VkSampleCountFlags Sample_Counts{ Device_Properties.limits.framebufferColorSampleCounts & Device_Properties.limits.framebufferDepthSampleCounts };
+
+		vector<VkSampleCountFlagBits> Samples{};
+		for (const VkSampleCountFlagBits Count : { VK_SAMPLE_COUNT_1_BIT, VK_SAMPLE_COUNT_2_BIT, VK_SAMPLE_COUNT_4_BIT, VK_SAMPLE_COUNT_8_BIT })
+			if (0 != (Sample_Counts & Count))
+				Samples.push_back(Count);
+
+		const VkPipelineLayout Pipeline_Layout{ Context.Create_Scene_Pipeline_Layout() };
+
+		const VkShaderModule Fragment_Shader{ Context.Load_Shader(Fragment_Shader_File_Path) };
+		unordered_map<string, VkShaderModule> Vertex_Shaders{};
+		for (const auto& Layout : Layouts)
+			if (0 == Vertex_Shaders.count(Layout.Get_Vertex_Shader_File_Path()))
+				Vertex_Shaders[Layout.Get_Vertex_Shader_File_Path()] = Context.Load_Shader(Layout.Get_Vertex_Shader_File_Path());
+
+		vector<VkRenderPass> Render_Passes{};
+		for (const VkSampleCountFlagBits Count : Samples)
+			Render_Passes.push_back(Scene_Pass::Build_Render_Pass(Context.Device, VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_D32_SFLOAT, Count, Render_Pass_Complete));
+
+		vector<Graphics_Pipeline_Desc> Variants{};
+		for (const auto& Layout : Layouts)
+			for (size_t Index = 0; Index < Samples.size(); ++Index) {
+				Graphics_Pipeline_Desc Desc{};
+				{
+					Desc.Vertex_Shader = Vertex_Shaders[Layout.Get_Vertex_Shader_File_Path()];
+					Desc.Fragment_Shader = Fragment_Shader;
+					Desc.Layout = Pipeline_Layout;
+					Desc.Vertices = Layout;
+					Desc.Samples = Samples[Index];
+					Desc.Color_Format = VK_FORMAT_B8G8R8A8_UNORM;
+					Desc.Depth_Format = VK_FORMAT_D32_SFLOAT;
+					Desc.Render_Pass = Render_Passes[Index];
+				}
+				Variants.push_back(Desc);
+			}
 
-	void Query_Swap_Chain_Support_Details(void) {
-		THROW_IF_VK_FAILED(vkGetPhysicalDeviceSurfaceCapabilitiesKHR(this->m_Physical_Device, this->m_Surface.get(), &this->m_Swap_Chain_Support_Details.Capabilities));
+		vector<VkPipeline> Pipelines{};
+		const auto Destroy_Pipelines = [&](void) {
+			for (const VkPipeline Pipeline : Pipelines)
+				vkDestroyPipeline(Context.Device, Pipeline, nullptr);
+			Pipelines.clear();
+		};
 
-		uint32_t Format_Count{};
-		THROW_IF_VK_FAILED(vkGetPhysicalDeviceSurfaceFormatsKHR(this->m_Physical_Device, this->m_Surface.get(), &Format_Count, nullptr));
+		const double Monolithic_Milliseconds{ Benchmark::Time_Milliseconds(1, [&](void) {
+			for (const auto& Desc : Variants)
+				Pipelines.push_back(Graphics_Pipeline_Builder{ Desc }.Create(Context.Device, VK_NULL_HANDLE));
+		}) };
+		Destroy_Pipelines();
+
+		//NOTE : A Part Is Keyed By The Variant State It Owns, So Variants Sharing That State Share The Part
+		const auto Get_Part_Key = [](const Graphics_Pipeline_Desc& Desc, VkGraphicsPipelineLibraryFlagBitsEXT Part) {
+			switch (Part) {
+			case VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT: return "vertex input " + to_string(Desc.Vertices.Attributes) + (Desc.Vertices.Quantized ? " quantized" : "");
+			case VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT: return "pre rasterization " + string{ Desc.Vertices.Get_Vertex_Shader_File_Path() } + " " + to_string(Desc.Samples);
+			case VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT: return "fragment shader " + to_string(Desc.Samples);
+			default: return "fragment output " + to_string(Desc.Samples);
+			}
+		};
 
-		if (0 != Format_Count) {
-			this->m_Swap_Chain_Support_Details.Formats.resize(Format_Count);
-			THROW_IF_VK_FAILED(vkGetPhysicalDeviceSurfaceFormatsKHR(this->m_Physical_Device, this->m_Surface.get(), &Format_Count, this->m_Swap_Chain_Support_Details.Formats.data()));
-		}
-		else
-			throw runtime_error("Failed to find a suitable GPU!");
+		unordered_map<string, VkPipeline> Parts{};
+		vector<vector<VkPipeline>> Variant_Libraries(Variants.size());
+
+		const double Library_Milliseconds{ Benchmark::Time_Milliseconds(1, [&](void) {
+			for (size_t Index = 0; Index < Variants.size(); ++Index) {
+				const Graphics_Pipeline_Builder Builder{ Variants[Index] };
+				for (const auto Part : Graphics_Pipeline_Builder::Library_Parts) {
+					VkPipeline& Library{ Parts[Get_Part_Key(Variants[Index], Part)] };
+					if (nullptr == Library)
+						Library = Builder.Create_Library(Context.Device, VK_NULL_HANDLE, Part);
+					Variant_Libraries[Index].push_back(Library);
+				}
+			}
+		}) };
+
+		const double Fast_Link_Milliseconds{ Benchmark::Time_Milliseconds(1, [&](void) {
+			for (const auto& Libraries : Variant_Libraries)
+				Pipelines.push_back(Graphics_Pipeline_Builder::Link(Context.Device, VK_NULL_HANDLE, Pipeline_Layout, Libraries, false));
+		}) };
+		Destroy_Pipelines();
+
+		const double Optimized_Link_Milliseconds{ Benchmark::Time_Milliseconds(1, [&](void) {
+			for (const auto& Libraries : Variant_Libraries)
+				Pipelines.push_back(Graphics_Pipeline_Builder::Link(Context.Device, VK_NULL_HANDLE, Pipeline_Layout, Libraries, true));
+		}) };
+		Destroy_Pipelines();
+
+		cout << Context.Device_Name << ", " << Variants.size() << " variants (" << Layouts.size() << " vertex layouts x " << Samples.size() << " sample counts)" << endl;
+		cout << "monolithic " << Monolithic_Milliseconds << " ms, libraries " << Library_Milliseconds << " ms (" << Parts.size() << " parts)"
+			<< ", fast link " << Fast_Link_Milliseconds << " ms (" << Fast_Link_Milliseconds / max<size_t>(1, Variants.size()) << " ms per variant)"
+			<< ", optimized link " << Optimized_Link_Milliseconds << " ms" << endl;
+
+		for (const auto& [Key, Library] : Parts)
+			vkDestroyPipeline(Context.Device, Library, nullptr);
+		for (const VkRenderPass Render_Pass : Render_Passes)
+			vkDestroyRenderPass(Context.Device, Render_Pass, nullptr);
+	}
 
-		uint32_t Present_Mode_Count{};
-		(vkGetPhysicalDeviceSurfacePresentModesKHR(this->m_Physical_Device, this->m_Surface.get(), &Present_Mode_Count, nullptr));
-		if (0 != Present_Mode_Count) {
-			this->m_Swap_Chain_Support_Details.Present_Modes.resize(Present_Mode_Count);
-			THROW_IF_VK_FAILED(vkGetPhysicalDeviceSurfacePresentModesKHR(this->m_Physical_Device, this->m_Surface.get(), &Present_Mode_Count, this->m_Swap_Chain_Support_Details.Present_Modes.data()));
-		}
-		else
-			throw runtime_error("Failed to find a suitable GPU!");
+	//NOTE : Every Combination Of The Material State Below, So Each Dynamic State Level Collapses A Known Share Of Them
+	static const vector<Material_State> Make_Materials(void) {
+		vector<Material_State> Materials{};
+		for (const VkCullModeFlags Cull_Mode : { VK_CULL_MODE_BACK_BIT, VK_CULL_MODE_NONE })
+			for (const bool Strip : { false, true })
+				for (const bool Depth_Write : { true, false })
+					for (const bool Depth_Bias : { false, true })
+						for (const bool Blend : { false, true }) {
+							Material_State Material{};
+							{
+								Material.Cull_Mode = Cull_Mode;
+								Material.Topology = Strip ? VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP : VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+								Material.Primitive_Restart = Strip;
+								Material.Depth_Write = Depth_Write;
+								Material.Depth_Compare = Depth_Write ? VK_COMPARE_OP_LESS : VK_COMPARE_OP_LESS_OR_EQUAL;
+								Material.Depth_Bias = Depth_Bias;
+								Material.Blend = Blend;
+							}
+							Materials.push_back(Material);
+						}
+
+		return Materials;
 	}
 
-	const VkExtent2D Choose_SwapChain_Extent(const VkSurfaceCapabilitiesKHR& Capabilities) {
-		if (numeric_limits<uint32_t>::max() != Capabilities.currentExtent.width)
-			return Capabilities.currentExtent;
-		else {
-			int Width, Height;
-			glfwGetFramebufferSize(this->m_Window.get(), &Width, &Height);
-			VkExtent2D Actual_Extent{ static_cast<uint32_t>(Width),static_cast<uint32_t>(Height) };
+	//NOTE : Draws Are Sorted By Pipeline Then Material, Recorded Into A Real Render Pass But Never Submitted
+	static void Extended_Dynamic_State_Binds(void) {
+		const vector<Material_State> Materials{ Benchmark::Make_Materials() };
 
-			Actual_Extent.width = std::clamp(Actual_Extent.width, Capabilities.minImageExtent.width, Capabilities.maxImageExtent.width);
-			Actual_Extent.height = std::clamp(Actual_Extent.height, Capabilities.minImageExtent.height, Capabilities.maxImageExtent.height);
+		//NOTE : Pipeline Counts Need No Device, Sample Counts Only Collapse Under Dynamic Rendering
+		cout << Materials.size() << " materials x 2 sample counts" << endl;
+		for (const Dynamic_State_Level Level : { Dynamic_State_Level_None, Dynamic_State_Level_1, Dynamic_State_Level_2, Dynamic_State_Level_3 }) {
+			Extended_Dynamic_State State{};
+			{
+				State.Level = Level;
+				State.Dynamic_Samples = Dynamic_State_Level_3 <= Level;
+			}
 
-			return Actual_Extent;
+			unordered_set<uint64_t> Pipelines{};
+			for (const auto& Material : Materials)
+				for (const VkSampleCountFlagBits Samples : { VK_SAMPLE_COUNT_1_BIT, VK_SAMPLE_COUNT_4_BIT }) {
+					Graphics_Pipeline_Desc Desc{};
+					{
+						Desc.Samples = Samples;
+						Desc.Material = Material;
+					}
+
+					const Graphics_Pipeline_Desc Baked{ State.Get_Baked_Desc(Desc) };
+					Pipelines.insert(Baked.Material.Get_Key() << 8 | Baked.Samples);
+				}
+
+			cout << "level " << Level << ": " << Pipelines.size() << " pipelines" << endl;
 		}
-	}
 
-	const VkShaderModule Create_Shader_Module(const vector<char>& Code) {
-		VkShaderModuleCreateInfo Create_Info{};
+		//NOTE : Highest Level The Device Has, Each Level Enables Its Extension On Top Of The Ones Below
+		VkPhysicalDeviceExtendedDynamicStateFeaturesEXT Extended_Dynamic_State_Features{};
 		{
-			Create_Info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-			Create_Info.codeSize = Code.size();
-			Create_Info.pCode = reinterpret_cast<const uint32_t*>(Code.data());
+			Extended_Dynamic_State_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+			Extended_Dynamic_State_Features.extendedDynamicState = VK_TRUE;
 		}
 
-		VkShaderModule Shader_Module{ nullptr };
-		THROW_IF_VK_FAILED(vkCreateShaderModule(this->m_Logical_Device.get(), &Create_Info, nullptr, &Shader_Module));
-		return Shader_Module;
-	}
+		VkPhysicalDeviceExtendedDynamicState2FeaturesEXT Extended_Dynamic_State2_Features{};
+		{
+			Extended_Dynamic_State2_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT;
+			Extended_Dynamic_State2_Features.pNext = &Extended_Dynamic_State_Features;
+			Extended_Dynamic_State2_Features.extendedDynamicState2 = VK_TRUE;
+		}
 
-	uint32_t Find_Memory_Type(uint32_t Type_Filter, VkMemoryPropertyFlags Property_Flags) const {
-		VkPhysicalDeviceMemoryProperties Memory_Properties{};
-		vkGetPhysicalDeviceMemoryProperties(this->m_Physical_Device, &Memory_Properties);
+		VkPhysicalDeviceExtendedDynamicState3FeaturesEXT Extended_Dynamic_State3_Features{};
+		{
+			Extended_Dynamic_State3_Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+			Extended_Dynamic_State3_Features.pNext = &Extended_Dynamic_State2_Features;
+			Extended_Dynamic_State3_Features.extendedDynamicState3ColorBlendEnable = VK_TRUE;
+			Extended_Dynamic_State3_Features.extendedDynamicState3RasterizationSamples = VK_TRUE;
+		}
 
-		for (uint32_t Index = 0; Index < Memory_Properties.memoryTypeCount; ++Index)
-			if (Type_Filter & (1 << Index) && (Memory_Properties.memoryTypes[Index].propertyFlags & Property_Flags) == Property_Flags)
-				return Index;
+		const array<const void*, 3> Level_Features{ &Extended_Dynamic_State_Features, &Extended_Dynamic_State2_Features, &Extended_Dynamic_State3_Features };
+		const vector<const char*> Level_Extensions{ Device_EXT_Extended_Dynamic_State, Device_EXT_Extended_Dynamic_State2, Device_EXT_Extended_Dynamic_State3 };
 
-		throw runtime_error("Failed to find suitable memory type!");
+		unique_ptr<Headless_Context> Context{};
+		Dynamic_State_Level Max_Level{ Dynamic_State_Level_3 };
+		for (; Dynamic_State_Level_None != Max_Level; Max_Level = static_cast<Dynamic_State_Level>(Max_Level - 1)) {
+			Context = make_unique<Headless_Context>();
+			if (Context->Create({ Level_Extensions.begin(), Level_Extensions.begin() + Max_Level }, Level_Features[Max_Level - 1]))
+				break;
+		}
 
-		return numeric_limits<uint32_t>::max();
-	}
+		if (Dynamic_State_Level_None == Max_Level) {
+			cout << "skipped bind cost, no Vulkan 1.2 device with VK_EXT_extended_dynamic_state" << endl;
+			return;
+		}
 
-	void Create_Buffer(VkDeviceSize Size, VkBufferUsageFlags Usage, VkMemoryPropertyFlags Properties, VkBuffer& Buffer, VkDeviceMemory& Buffer_Memory) {
-		VkBufferCreateInfo Buffer_Info{};
-		{
-			Buffer_Info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-			Buffer_Info.size = Size;
-			Buffer_Info.usage = Usage;
-			Buffer_Info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		if (!std::filesystem::exists(std::filesystem::path(Fragment_Shader_File_Path, std::filesystem::path::generic_format)) ||
+			!std::filesystem::exists(std::filesystem::path(Vertex_Shader_File_Path, std::filesystem::path::generic_format))) {
+			cout << "skipped bind cost, shaders not compiled" << endl;
+			return;
 		}
 
-		THROW_IF_VK_FAILED(vkCreateBuffer(this->m_Logical_Device.get(), &Buffer_Info, nullptr, &Buffer));
+		uint32_t Queue_Family_Count{ 0 };
+		vkGetPhysicalDeviceQueueFamilyProperties(Context->Physical_Device, &Queue_Family_Count, nullptr);
+		vector<VkQueueFamilyProperties> Queue_Families(Queue_Family_Count);
+		vkGetPhysicalDeviceQueueFamilyProperties(Context->Physical_Device, &Queue_Family_Count, Queue_Families.data());
 
-		VkMemoryRequirements Memory_Requirements{};
-		vkGetBufferMemoryRequirements(this->m_Logical_Device.get(), Buffer, &Memory_Requirements);
+		VkPhysicalDeviceProperties Device_Properties{};
+		vkGetPhysicalDeviceProperties(Context->Physical_Device, &Device_Properties);
+		const VkSampleCountFlags Sample_Counts{ Device_Properties.limits.framebufferColorSampleCounts & Device_Properties.limits.framebufferDepthSampleCounts };
 
-		VkMemoryAllocateInfo Memory_Allocate_Info{};
-		{
-			Memory_Allocate_Info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-			Memory_Allocate_Info.allocationSize = Memory_Requirements.size;
-			Memory_Allocate_Info.memoryTypeIndex = this->Find_Memory_Type(Memory_Requirements.memoryTypeBits, Properties);
+		if (0 == (Queue_Families[Context->Queue_Family].queueFlags & VK_QUEUE_GRAPHICS_BIT) || 0 == (Sample_Counts & VK_SAMPLE_COUNT_4_BIT)) {
+			cout << "skipped bind cost, no graphics queue with 4x MSAA" << endl;
+			return;
 		}
 
-		THROW_IF_VK_FAILED(vkAllocateMemory(this->m_Logical_Device.get(), &Memory_Allocate_Info, nullptr, &Buffer_Memory));
+		constexpr VkExtent2D Extent{ 64, 64 };
+		constexpr VkFormat Color_Format{ VK_FORMAT_B8G8R8A8_UNORM };
+		constexpr VkFormat Depth_Format{ VK_FORMAT_D32_SFLOAT };
+		constexpr VkSampleCountFlagBits Samples{ VK_SAMPLE_COUNT_4_BIT };
+		constexpr uint32_t Draw_Count{ 16384 };
+
+		const VkRenderPass Render_Pass{ Scene_Pass::Build_Render_Pass(Context->Device, Color_Format, Depth_Format, Samples, Render_Pass_Complete) };
+		array<VkImageView, 3> Attachments{
+			Context->Create_Attachment(Extent, Color_Format, Samples, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, VK_IMAGE_ASPECT_COLOR_BIT),
+			Context->Create_Attachment(Extent, Depth_Format, Samples, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_IMAGE_ASPECT_DEPTH_BIT),
+			Context->Create_Attachment(Extent, Color_Format, VK_SAMPLE_COUNT_1_BIT, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, VK_IMAGE_ASPECT_COLOR_BIT),
+		};
 
-		THROW_IF_VK_FAILED(vkBindBufferMemory(this->m_Logical_Device.get(), Buffer, Buffer_Memory, 0));
-	}
+		VkFramebufferCreateInfo Framebuffer_Info{};
+		{
+			Framebuffer_Info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+			Framebuffer_Info.renderPass = Render_Pass;
+			Framebuffer_Info.attachmentCount = static_cast<uint32_t>(Attachments.size());
+			Framebuffer_Info.pAttachments = Attachments.data();
+			Framebuffer_Info.width = Extent.width;
+			Framebuffer_Info.height = Extent.height;
+			Framebuffer_Info.layers = 1;
+		}
+		VkFramebuffer Framebuffer{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateFramebuffer(Context->Device, &Framebuffer_Info, nullptr, &Framebuffer));
 
-	const VkCommandBuffer Begin_SingleTime_Commands(void) {
-		VkCommandBufferAllocateInfo Allocate_Info{};
+		VkCommandPoolCreateInfo Command_Pool_Info{};
 		{
-			Allocate_Info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-			Allocate_Info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-			Allocate_Info.commandPool = this->m_Command_Pool.get();
-			Allocate_Info.commandBufferCount = 1;
+			Command_Pool_Info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+			Command_Pool_Info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+			Command_Pool_Info.queueFamilyIndex = Context->Queue_Family;
 		}
+		VkCommandPool Command_Pool{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateCommandPool(Context->Device, &Command_Pool_Info, nullptr, &Command_Pool));
 
+		VkCommandBufferAllocateInfo Command_Buffer_Info{};
+		{
+			Command_Buffer_Info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			Command_Buffer_Info.commandPool = Command_Pool;
+			Command_Buffer_Info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+			Command_Buffer_Info.commandBufferCount = 1;
+		}
 		VkCommandBuffer Command_Buffer{ nullptr };
-		THROW_IF_VK_FAILED(vkAllocateCommandBuffers(this->m_Logical_Device.get(), &Allocate_Info, &Command_Buffer));
+		THROW_IF_VK_FAILED(vkAllocateCommandBuffers(Context->Device, &Command_Buffer_Info, &Command_Buffer));
 
-		VkCommandBufferBeginInfo Begin_Info{};
+		Graphics_Pipeline_Desc Scene_Desc{};
 		{
-			Begin_Info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-			Begin_Info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+			Scene_Desc.Vertex_Shader = Context->Load_Shader(Vertex_Shader_File_Path);
+			Scene_Desc.Fragment_Shader = Context->Load_Shader(Fragment_Shader_File_Path);
+			Scene_Desc.Layout = Context->Create_Scene_Pipeline_Layout();
+			Scene_Desc.Samples = Samples;
+			Scene_Desc.Color_Format = Color_Format;
+			Scene_Desc.Depth_Format = Depth_Format;
+			Scene_Desc.Render_Pass = Render_Pass;
 		}
 
-		THROW_IF_VK_FAILED(vkBeginCommandBuffer(Command_Buffer, &Begin_Info));
-
-		return Command_Buffer;
-	}
+		uint32_t Seed{ 1 };
+		vector<size_t> Draw_Materials(Draw_Count);
+		for (auto& Material : Draw_Materials) {
+			Seed = Seed * 1664525u + 1013904223u;
+			Material = (Seed >> 8) % Materials.size();
+		}
 
-	void End_SingleTime_Commands(VkCommandBuffer Command_Buffer) {
-		THROW_IF_VK_FAILED(vkEndCommandBuffer(Command_Buffer));
+		cout << Context->Device_Name << ", " << Draw_Count << " draws, " << Samples << "x MSAA render pass" << endl;
 
-		VkSubmitInfo Submit_Info{};
-		{
-			Submit_Info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-			Submit_Info.commandBufferCount = 1;
-			Submit_Info.pCommandBuffers = &Command_Buffer;
-		}
+		for (uint32_t Level = Dynamic_State_Level_None; Level <= Max_Level; ++Level) {
+			Extended_Dynamic_State State{};
+			State.Load(Context->Device, static_cast<Dynamic_State_Level>(Level), false, false);
 
-		THROW_IF_VK_FAILED(vkQueueSubmit(this->m_Graphics_Queue, 1, &Submit_Info, VK_NULL_HANDLE));
+			unordered_map<uint64_t, VkPipeline> Pipelines{};
+			vector<uint64_t> Pipeline_Keys(Materials.size());
+			const double Compile_Milliseconds{ Benchmark::Time_Milliseconds(1, [&](void) {
+				for (size_t Index = 0; Index < Materials.size(); ++Index) {
+					Graphics_Pipeline_Desc Desc{ Scene_Desc };
+					Desc.Material = Materials[Index];
 
-		THROW_IF_VK_FAILED(vkQueueWaitIdle(this->m_Graphics_Queue));
+					const Graphics_Pipeline_Desc Baked{ State.Get_Baked_Desc(Desc) };
+					Pipeline_Keys[Index] = Baked.Material.Get_Key();
 
-		vkFreeCommandBuffers(this->m_Logical_Device.get(), this->m_Command_Pool.get(), 1, &Command_Buffer);
-	}
+					VkPipeline& Pipeline{ Pipelines[Pipeline_Keys[Index]] };
+					if (nullptr == Pipeline)
+						Pipeline = Graphics_Pipeline_Builder{ Baked }.Create(Context->Device, VK_NULL_HANDLE);
+				}
+			}) };
 
-	void Copy_Buffer(VkBuffer Source_Buffer, VkBuffer Destination_Buffer, VkDeviceSize Size) {
-		VkCommandBuffer Command_Buffer{ this->Begin_SingleTime_Commands() };
+			vector<size_t> Draws{ Draw_Materials };
+			sort(Draws.begin(), Draws.end(), [&Pipeline_Keys](size_t Left, size_t Right) { return make_pair(Pipeline_Keys[Left], Left) < make_pair(Pipeline_Keys[Right], Right); });
 
-		VkBufferCopy Copy_Region{};
-		{
-			Copy_Region.size = Size;
-		}
+			Barrier_Builder Barriers{};
+			Draw_State_Cache Draw_State{};
+			const double Record_Milliseconds{ Benchmark::Time_Milliseconds(16, [&](void) {
+				THROW_IF_VK_FAILED(vkResetCommandBuffer(Command_Buffer, 0));
+				VkCommandBufferBeginInfo Begin_Info{};
+				{
+					Begin_Info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+					Begin_Info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+				}
+				THROW_IF_VK_FAILED(vkBeginCommandBuffer(Command_Buffer, &Begin_Info));
 
-		vkCmdCopyBuffer(Command_Buffer, Source_Buffer, Destination_Buffer, 1, &Copy_Region);
+				VkRenderPassBeginInfo Render_Pass_Begin_Info{};
+				{
+					Render_Pass_Begin_Info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+					Render_Pass_Begin_Info.renderPass = Render_Pass;
+					Render_Pass_Begin_Info.framebuffer = Framebuffer;
+					Render_Pass_Begin_Info.renderArea = { { 0, 0 }, Extent };
+				}
+				vkCmdBeginRenderPass(Command_Buffer, &Render_Pass_Begin_Info, VK_SUBPASS_CONTENTS_INLINE);
 
-		this->End_SingleTime_Commands(Command_Buffer);
-	}
+				//NOTE : Sorted Draws Already Keep Equal Pipelines Together, The Cache Drops Every Repeated Bind And Material
+				Draw_State.Begin(Command_Buffer, Barriers);
+				Draw_State.Set_Viewport({ 0.0f, 0.0f, static_cast<float>(Extent.width), static_cast<float>(Extent.height), 0.0f, 1.0f });
+				Draw_State.Set_Scissor({ { 0, 0 }, Extent });
 
-	void Create_Image(uint32_t Width, uint32_t Height, uint32_t Mip_Levels, VkFormat Format, VkSampleCountFlagBits Num_Samples, VkImageTiling Tiling, VkImageUsageFlags Usage, VkMemoryPropertyFlags Properties, VkImage& Image, VkDeviceMemory& Image_Memory) {
-		VkImageCreateInfo Image_Info{};
-		{
-			Image_Info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-			Image_Info.imageType = VK_IMAGE_TYPE_2D;
-			Image_Info.extent.width = Width;
-			Image_Info.extent.height = Height;
-			Image_Info.extent.depth = 1;
-			Image_Info.mipLevels = Mip_Levels;
-			Image_Info.arrayLayers = 1;
-			Image_Info.format = Format;
-			Image_Info.tiling = Tiling;
-			Image_Info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-			Image_Info.usage = Usage;
-			Image_Info.samples = Num_Samples;
-			Image_Info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-		}
+				for (const size_t Material : Draws) {
+					Draw_State.Bind_Pipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, Pipelines[Pipeline_Keys[Material]]);
+					Draw_State.Set_Material(State, Materials[Material], Samples);
+					Draw_State.Draw(3, 1, 0, 0);
+				}
 
-		THROW_IF_VK_FAILED(vkCreateImage(this->m_Logical_Device.get(), &Image_Info, nullptr, &Image));
+				Draw_State.End(Barriers);
+				vkCmdEndRenderPass(Command_Buffer);
+				THROW_IF_VK_FAILED(vkEndCommandBuffer(Command_Buffer));
+			}) };
 
-		VkMemoryRequirements Memory_Requirements{};
-		vkGetImageMemoryRequirements(this->m_Logical_Device.get(), Image, &Memory_Requirements);
+			cout << "level " << Level << ": " << Pipelines.size() << " pipelines compiled in " << Compile_Milliseconds << " ms, "
+				<< Draw_State.Statistics.Bind_Count << " binds (" << Draw_State.Statistics.Elided_Bind_Count << " elided), "
+				<< Draw_State.Statistics.Dynamic_State_Count << " dynamic state changes (" << Draw_State.Statistics.Elided_Dynamic_State_Count << " elided), "
+				<< Record_Milliseconds << " ms to record" << endl;
 
-		VkMemoryAllocateInfo Memory_Allocate_Info{};
-		{
-			Memory_Allocate_Info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-			Memory_Allocate_Info.allocationSize = Memory_Requirements.size;
-			Memory_Allocate_Info.memoryTypeIndex = this->Find_Memory_Type(Memory_Requirements.memoryTypeBits, Properties);
+			for (const auto& [Key, Pipeline] : Pipelines)
+				vkDestroyPipeline(Context->Device, Pipeline, nullptr);
 		}
 
-		THROW_IF_VK_FAILED(vkAllocateMemory(this->m_Logical_Device.get(), &Memory_Allocate_Info, nullptr, &Image_Memory));
-
-		THROW_IF_VK_FAILED(vkBindImageMemory(this->m_Logical_Device.get(), Image, Image_Memory, 0));
+		vkDestroyCommandPool(Context->Device, Command_Pool, nullptr);
+		vkDestroyFramebuffer(Context->Device, Framebuffer, nullptr);
+		vkDestroyRenderPass(Context->Device, Render_Pass, nullptr);
 	}
 
-	void Transition_Image_Layout(VkImage Image, uint32_t Mip_Levels, VkFormat Format, VkImageLayout Old_Layout, VkImageLayout New_Layout) {
-		VkCommandBuffer Command_Buffer{ this->Begin_SingleTime_Commands() };
-
-		VkAccessFlags Source_Access_Mask{}, Destination_Access_Mask{};
+	//NOTE : Streaming Style Churn, Meshes Load And Unload In Random Order Until The Free Lists Are Fragmented
+	static void Geometry_Pool_Churn(void) {
+		constexpr uint32_t Mesh_Count{ 4096 };
+		constexpr uint32_t Vertex_Capacity{ 1 << 22 };
+		constexpr uint32_t Index_Capacity{ 1 << 24 };
 
-		VkPipelineStageFlags Source_Stage{}, Destination_Stage{};
-		{
-			if (VK_IMAGE_LAYOUT_UNDEFINED == Old_Layout && VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL == New_Layout) {
-				Source_Access_Mask = VK_ACCESS_NONE;
-				Destination_Access_Mask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		uint32_t Seed{ 1 };
+		const auto Next = [&Seed](uint32_t Range) {
+			Seed = Seed * 1664525u + 1013904223u;
+			return (Seed >> 8) % Range;
+		};
 
-				Source_Stage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-				Destination_Stage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-			}
-			else if (VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL == Old_Layout && VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL == New_Layout) {
-				Source_Access_Mask = VK_ACCESS_TRANSFER_WRITE_BIT;
-				Destination_Access_Mask = VK_ACCESS_SHADER_READ_BIT;
+		vector<pair<uint32_t, uint32_t>> Sizes(Mesh_Count);
+		for (auto& [Vertex_Count, Index_Count] : Sizes) {
+			Vertex_Count = 64 + Next(1024);
+			Index_Count = Vertex_Count * 3 + Next(Vertex_Count * 3);
+		}
 
-				Source_Stage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-				Destination_Stage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+		Geometry_Pool Pool{};
+		Pool.Reset(Vertex_Capacity, Index_Capacity, sizeof(Vertex), VK_INDEX_TYPE_UINT32);
+
+		vector<Geometry_Pool::Handle> Live{};
+		const double Allocate_Milliseconds{ Benchmark::Time_Milliseconds(1, [&](void) {
+			for (const auto& [Vertex_Count, Index_Count] : Sizes)
+				if (const auto Mesh{ Pool.Allocate(Vertex_Count, Index_Count) }; Mesh.has_value())
+					Live.push_back(Mesh.value());
+		}) };
+
+		const double Free_Milliseconds{ Benchmark::Time_Milliseconds(1, [&](void) {
+			for (size_t Index = Live.size(); 1 < Index; --Index)
+				std::swap(Live[Index - 1], Live[Next(static_cast<uint32_t>(Index))]);
+
+			for (size_t Index = Live.size() / 2; Index < Live.size(); ++Index)
+				Pool.Free(Live[Index]);
+			Live.resize(Live.size() / 2);
+		}) };
+
+		uint32_t Refilled{ 0 };
+		uint32_t Failed{ 0 };
+		for (uint32_t Index = 0; Index < Mesh_Count / 2; ++Index) {
+			const uint32_t Vertex_Count{ 256 + Next(1536) };
+			if (const auto Mesh{ Pool.Allocate(Vertex_Count, Vertex_Count * 4) }; Mesh.has_value()) {
+				Live.push_back(Mesh.value());
+				++Refilled;
 			}
 			else
-				throw invalid_argument("Unsupported layout transition!");
+				++Failed;
 		}
 
-		VkImageMemoryBarrier Barrier{};
-		{
-			Barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-			Barrier.oldLayout = Old_Layout;
-			Barrier.newLayout = New_Layout;
-			Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-			Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-			Barrier.image = Image;
-			Barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-			Barrier.subresourceRange.baseMipLevel = 0;
-			Barrier.subresourceRange.levelCount = Mip_Levels;
-			Barrier.subresourceRange.baseArrayLayer = 0;
-			Barrier.subresourceRange.layerCount = 1;
-			Barrier.srcAccessMask = Source_Access_Mask;
-			Barrier.dstAccessMask = Destination_Access_Mask;
-		}
-
-		vkCmdPipelineBarrier(
-			Command_Buffer,
-			Source_Stage, Destination_Stage,
-			0,
-			0, nullptr,
-			0, nullptr,
-			1, &Barrier
-		);
+		cout << Mesh_Count << " meshes allocated in " << Allocate_Milliseconds << " ms, half freed in " << Free_Milliseconds << " ms, "
+			<< Refilled << " larger meshes refilled, " << Failed << " did not fit" << endl;
+		cout << "before defragment: " << Pool.Get_Used_Vertices() << " vertices, " << Pool.Get_Used_Indices() << " indices live, fragmentation " << Pool.Get_Fragmentation() << endl;
+
+		Geometry_Defragment_Plan Plan{};
+		const double Defragment_Milliseconds{ Benchmark::Time_Milliseconds(1, [&](void) { Plan = Pool.Defragment(Vertex_Capacity, Index_Capacity); }) };
 
-		this->End_SingleTime_Commands(Command_Buffer);
+		VkDeviceSize Moved_Bytes{ 0 };
+		for (const auto& Copies : { Plan.Vertex_Copies, Plan.Index_Copies })
+			for (const auto& Copy : Copies)
+				Moved_Bytes += Copy.size;
+
+		cout << "defragment: " << Defragment_Milliseconds << " ms, " << Plan.Vertex_Copies.size() + Plan.Index_Copies.size() << " copy regions, "
+			<< Moved_Bytes / (1024 * 1024) << " MiB moved, fragmentation " << Pool.Get_Fragmentation() << endl;
+		cout << "binds per frame for " << Live.size() << " meshes: " << Live.size() * 2 << " with dedicated buffers, 2 from the pool" << endl;
 	}
 
-	void Copy_Buffer_To_Image(VkBuffer Buffer, VkImage Image, uint32_t Width, uint32_t Height) {
-		VkCommandBuffer Command_Buffer{ this->Begin_SingleTime_Commands() };
+	//NOTE : CPU Mirror Of cull_cluster.spv Over The Records It Reads, Triangles Left When Instances Or Their Meshlets Are Culled For A Few Cameras
+	static void Cluster_Cull(void) {
+		vector<Vertex> Vertices{};
+		vector<uint32_t> Indices{};
+		Benchmark::Make_Sphere_Mesh(256, 512, Vertices, Indices);
 
-		VkBufferImageCopy Region{};
+		Mesh_Bounds Bounds{};
+		for (const auto& Vertex : Vertices)
+			Bounds.Expand(Vertex.Pos);
+		const Bounding_Sphere Mesh_Sphere{ Bounding_Sphere::From_Points(Vertices) };
+
+		Packed_Indices Packed{};
+		Packed.Index_Type = Packed_Indices::Choose_Index_Type(Indices, Vertices.size());
+
+		Mesh_Lod Lod{};
 		{
-			Region.bufferOffset = 0;
-			Region.bufferRowLength = 0;
-			Region.bufferImageHeight = 0;
-			Region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-			Region.imageSubresource.mipLevel = 0;
-			Region.imageSubresource.baseArrayLayer = 0;
-			Region.imageSubresource.layerCount = 1;
-			Region.imageOffset = { 0, 0, 0 };
-			Region.imageExtent = { Width, Height, 1 };
+			Lod.Index_Count = static_cast<uint32_t>(Indices.size());
+			Lod.Draw_Ranges = Packed.Append(Indices);
 		}
 
-		vkCmdCopyBufferToImage(Command_Buffer, Buffer, Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &Region);
+		Meshlet_Data Meshlets{};
+		const double Build_Milliseconds{ Benchmark::Time_Milliseconds(4, [&](void) {
+			Meshlets = Meshlet_Builder::Build(Vertices, Indices, Gpu_Culling::Get_Range_Boundaries(Lod));
+		}) };
 
-		this->End_SingleTime_Commands(Command_Buffer);
-	}
+		uint32_t Cone_Count{ 0 };
+		for (const auto& Meshlet_Bounds : Meshlets.Bounds)
+			Cone_Count += Meshlet_Bounds.Cone_Cutoff < 1.0f ? 1 : 0;
 
-	VkImageView Create_Image_View(VkImage Image, uint32_t Mip_Levels, VkFormat Format, VkImageAspectFlags Aspect_Flags) {
-		VkComponentMapping Component_Mapping{};
+		const uint32_t Triangle_Count{ static_cast<uint32_t>(Indices.size() / 3) };
+		cout << Triangle_Count << " triangles in " << Lod.Draw_Ranges.size() << " draw ranges -> " << Meshlets.Meshlets.size() << " meshlets, "
+			<< static_cast<float>(Meshlets.Vertices.size()) / Meshlets.Meshlets.size() << " vertices and " << static_cast<float>(Triangle_Count) / Meshlets.Meshlets.size()
+			<< " triangles each, " << Cone_Count << " with a usable cone, built in " << Build_Milliseconds << " ms" << endl;
+
+		Vertex_Layout Layout{};
 		{
-			Component_Mapping.r = VK_COMPONENT_SWIZZLE_IDENTITY;
-			Component_Mapping.g = VK_COMPONENT_SWIZZLE_IDENTITY;
-			Component_Mapping.b = VK_COMPONENT_SWIZZLE_IDENTITY;
-			Component_Mapping.a = VK_COMPONENT_SWIZZLE_IDENTITY;
+			Layout.Quantized = true;
 		}
 
-		VkImageSubresourceRange Subresource_Range{};
-		{
-			Subresource_Range.aspectMask = Aspect_Flags;
-			Subresource_Range.baseMipLevel = 0;
-			Subresource_Range.levelCount = Mip_Levels;
-			Subresource_Range.baseArrayLayer = 0;
-			Subresource_Range.layerCount = 1;
+		const glm::mat4 Placement{ glm::scale(glm::rotate(glm::translate(glm::mat4{ 1.0f }, glm::vec3{ 2.0f, 0.0f, 0.0f }), 0.7f, glm::vec3{ 0.3f, 0.2f, 1.0f }), glm::vec3{ 1.5f }) };
+		const Gpu_Instance Instance{ Gpu_Culling::Build_Instance(Placement, Layout.Get_Position_Dequantize(Bounds), Mesh_Sphere) };
+		const vector<Gpu_Cluster> Clusters{ Gpu_Culling::Build_Clusters(Meshlets, Lod, Layout.Get_Position_Dequantize(Bounds), Mesh_Sphere, {}) };
+
+		const glm::mat4 Proj{ glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f) };
+		const pair<const char*, glm::vec3> Cameras[]{
+			{ "orbit", glm::vec3{ 2.0f, -8.0f, 1.0f } },
+			{ "close", glm::vec3{ 2.5f, -2.2f, 0.5f } },
+			{ "grazing", glm::vec3{ 4.0f, -1.6f, 0.0f } },
+		};
+
+		for (const auto& [Name, Eye] : Cameras) {
+			const glm::mat4 View{ glm::lookAt(Eye, glm::vec3{ 2.0f, 0.0f, 0.0f }, glm::vec3{ 0.0f, 0.0f, 1.0f }) };
+			const Gpu_Cull_Constants Constants{ Gpu_Culling::Build_Constants(glm::mat4{ 1.0f }, View, Proj, 1080.0f, 1, 1, 0) };
+
+			const auto Outside = [&Constants](const glm::vec4& Sphere) {
+				for (const auto& Plane : Constants.Planes)
+					if (glm::dot(glm::vec3{ Plane }, glm::vec3{ Sphere }) + Plane.w < -Sphere.w)
+						return true;
+				return false;
+			};
+
+			uint32_t Visible_Clusters{ 0 }, Visible_Triangles{ 0 }, Backfacing_Clusters{ 0 }, Mismatches{ 0 };
+			const double Cull_Milliseconds{ Benchmark::Time_Milliseconds(16, [&](void) {
+				Visible_Clusters = Visible_Triangles = Backfacing_Clusters = Mismatches = 0;
+				for (size_t Index = 0; Index < Clusters.size(); ++Index) {
+					const Gpu_Cluster& Cluster{ Clusters[Index] };
+					const glm::vec4 Sphere{ glm::vec3{ Instance.Model * glm::vec4{ glm::vec3{ Cluster.Sphere }, 1.0f } }, Cluster.Sphere.w * Instance.Sphere.w };
+					if (Outside(Sphere))
+						continue;
+
+					const glm::vec3 Axis{ glm::normalize(glm::mat3{ Instance.Model } * glm::vec3{ Cluster.Cone }) };
+					const glm::vec3 Direction{ glm::vec3{ Sphere } - glm::vec3{ Constants.Camera } };
+					const bool Backfacing{ Cluster.Cone.w < 1.0f && glm::dot(Direction, Axis) >= Cluster.Cone.w * glm::length(Direction) + Sphere.w };
+
+					//NOTE : The Same Test On The Unpacked Bounds In Model Space, Camera Moved Into It Instead
+					const Meshlet_Bounds& Local{ Meshlets.Bounds[Index] };
+					Mismatches += Backfacing != Local.Is_Backfacing(glm::vec3{ glm::inverse(Placement) * glm::vec4{ glm::vec3{ Constants.Camera }, 1.0f } }) ? 1 : 0;
+
+					if (Backfacing) {
+						++Backfacing_Clusters;
+						continue;
+					}
+
+					++Visible_Clusters;
+					Visible_Triangles += Cluster.Index_Count / 3;
+				}
+			}) };
+
+			const bool Instance_Visible{ !Outside(Instance.Sphere) };
+			cout << Name << ": instance culling keeps " << (Instance_Visible ? Triangle_Count : 0) << " triangles, cluster culling keeps " << Visible_Triangles
+				<< " in " << Visible_Clusters << " meshlets (" << 100.0 * Visible_Triangles / Triangle_Count << "%), " << Backfacing_Clusters << " rejected by their cone, "
+				<< Mismatches << " cone disagreements with model space, " << Cull_Milliseconds << " ms" << endl;
 		}
+	}
 
-		VkImageViewCreateInfo View_Info{};
-		{
-			View_Info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
-			View_Info.image = Image;
-			View_Info.viewType = VK_IMAGE_VIEW_TYPE_2D;
-			View_Info.format = Format;
-			View_Info.components = Component_Mapping;
-			View_Info.subresourceRange = Subresource_Range;
+	//NOTE : Keys Spread Like A Scene With Two Passes, 16 Pipelines, 256 Materials And 1024 Meshes, Every Sort Starts From The Same Push Order
+	static void Draw_Sort(void) {
+		constexpr size_t Draw_Count{ 100000 };
+
+		uint32_t Seed{ 1 };
+		const auto Random = [&Seed](uint32_t Range) {
+			Seed = Seed * 1664525u + 1013904223u;
+			return static_cast<uint32_t>((static_cast<uint64_t>(Seed >> 8) * Range) >> 24);
+		};
+
+		Draw_Queue Queue{};
+		for (size_t Draw = 0; Draw < Draw_Count; ++Draw) {
+			const uint64_t Key{ Draw_Sort_Key::Build(Random(2), Random(16), Random(256), Random(1024), 0.1f + Random(1 << 20) / 4096.0f) };
+			Queue.Push(Key, { 36, 0, 0, static_cast<uint32_t>(Draw) });
 		}
 
-		VkImageView Texture_Image_View{ nullptr };
-		THROW_IF_VK_FAILED(vkCreateImageView(this->m_Logical_Device.get(), &View_Info, nullptr, &Texture_Image_View));
+		const auto Count_State_Changes = [](const vector<Draw_Queue_Entry>& Entries) {
+			uint32_t Changes{ 0 };
+			for (size_t Index = 1; Index < Entries.size(); ++Index)
+				Changes += (Entries[Index].Key >> Draw_Sort_Key::Material_Shift) != (Entries[Index - 1].Key >> Draw_Sort_Key::Material_Shift) ? 1 : 0;
+			return Changes;
+		};
 
-		return Texture_Image_View;
-	}
+		const vector<Draw_Queue_Entry> Unsorted{ Queue.Entries };
+		vector<Draw_Queue_Entry> Expected{ Unsorted };
+		std::stable_sort(Expected.begin(), Expected.end(), [](const Draw_Queue_Entry& Left, const Draw_Queue_Entry& Right) { return Left.Key < Right.Key; });
 
-	const VkFormat Find_Supported_Format(const vector<VkFormat>& Candidates, VkImageTiling Tiling, VkFormatFeatureFlags Features) const {
-		for (const auto& Candidate : Candidates) {
-			VkFormatProperties Properties{};
-			vkGetPhysicalDeviceFormatProperties(this->m_Physical_Device, Candidate, &Properties);
+		cout << Draw_Count << " draws, pipeline or material changes: " << Count_State_Changes(Unsorted) << " in push order, " << Count_State_Changes(Expected) << " sorted" << endl;
 
-			if (VK_IMAGE_TILING_LINEAR == Tiling && (Properties.linearTilingFeatures & Features) == Features)
-				return Candidate;
-			else if (VK_IMAGE_TILING_OPTIMAL == Tiling && (Properties.optimalTilingFeatures & Features) == Features)
-				return Candidate;
+		vector<Draw_Queue_Entry> Entries{};
+		const double Std_Milliseconds{ Benchmark::Time_Milliseconds(16, [&](void) {
+			Entries = Unsorted;
+			std::sort(Entries.begin(), Entries.end(), [](const Draw_Queue_Entry& Left, const Draw_Queue_Entry& Right) { return Left.Key < Right.Key; });
+		}) };
+		cout << "std::sort: " << Std_Milliseconds << " ms" << endl;
+
+		vector<uint32_t> Thread_Counts{ 1 };
+		if (1 < thread::hardware_concurrency())
+			Thread_Counts.push_back(thread::hardware_concurrency());
+
+		for (const uint32_t Threads : Thread_Counts) {
+			const double Radix_Milliseconds{ Benchmark::Time_Milliseconds(16, [&](void) {
+				Queue.Entries = Unsorted;
+				Queue.Sort(Threads);
+			}) };
+
+			const bool Matches{ std::equal(Queue.Entries.begin(), Queue.Entries.end(), Expected.begin(), [](const Draw_Queue_Entry& Left, const Draw_Queue_Entry& Right) {
+				return Left.Key == Right.Key && Left.Packet == Right.Packet;
+			}) };
+
+			cout << "radix sort " << Threads << (1 == Threads ? " thread: " : " threads: ") << Radix_Milliseconds << " ms, " << Std_Milliseconds / Radix_Milliseconds << "x std::sort, "
+				<< (Matches ? "matches" : "differs from") << " std::stable_sort" << endl;
 		}
-		throw runtime_error("Failed to find supported format!");
+	}
 
-		return VK_FORMAT_UNDEFINED;
+	//NOTE : Nine Significant Digits Round Trip Every Float, OBJ Stores V Bottom Up
+	static void Write_Obj_File(const std::filesystem::path& Path, const vector<Vertex>& Vertices, const vector<uint32_t>& Indices) {
+		ofstream File{ Path, ios::binary | ios::trunc };
+		char Line[128]{};
+		for (const auto& Vertex : Vertices)
+			File.write(Line, snprintf(Line, sizeof(Line), "v %.9g %.9g %.9g\n", Vertex.Pos.x, Vertex.Pos.y, Vertex.Pos.z));
+		for (const auto& Vertex : Vertices)
+			File.write(Line, snprintf(Line, sizeof(Line), "vt %.9g %.9g\n", Vertex.TexCoord.x, 1.0f - Vertex.TexCoord.y));
+		for (const auto& Vertex : Vertices)
+			File.write(Line, snprintf(Line, sizeof(Line), "vn %.9g %.9g %.9g\n", Vertex.Normal.x, Vertex.Normal.y, Vertex.Normal.z));
+		for (size_t Index = 0; Index < Indices.size(); Index += 3)
+			File.write(Line, snprintf(Line, sizeof(Line), "f %u/%u/%u %u/%u/%u %u/%u/%u\n",
+				Indices[Index] + 1, Indices[Index] + 1, Indices[Index] + 1,
+				Indices[Index + 1] + 1, Indices[Index + 1] + 1, Indices[Index + 1] + 1,
+				Indices[Index + 2] + 1, Indices[Index + 2] + 1, Indices[Index + 2] + 1));
 	}
 
-private:
-	static void Initialize_GLWF(void) {
-		if (GLFW_FALSE == glfwInit())
-			throw runtime_error("Failed to initialize GLFW");
+	//NOTE : Corners Of Two Loads Of The Same Geometry, Within The Rounding Of A Text Round Trip
+	static const bool Compare_Corners(const Model_Data& Left, const Model_Data& Right) {
+		if (Left.Indices.size() != Right.Indices.size())
+			return false;
 
-		glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
-		//glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
+		for (size_t Corner = 0; Corner < Left.Indices.size(); ++Corner) {
+			const Vertex& Left_Vertex{ Left.Vertices[Left.Indices[Corner]] };
+			const Vertex& Right_Vertex{ Right.Vertices[Right.Indices[Corner]] };
+			if (!glm::all(glm::lessThanEqual(glm::abs(Left_Vertex.Pos - Right_Vertex.Pos), glm::vec3{ 1e-6f })) ||
+				!glm::all(glm::lessThanEqual(glm::abs(Left_Vertex.TexCoord - Right_Vertex.TexCoord), glm::vec2{ 1e-6f })) ||
+				!glm::all(glm::lessThanEqual(glm::abs(Left_Vertex.Normal - Right_Vertex.Normal), glm::vec3{ 1e-6f })))
+				return false;
+		}
+
+		return true;
 	}
 
-	static vector<const char*> Get_Require_Extensions(void) {
-		uint32_t GLFW_Extension_Count;
-		const char** GLFW_Extensions;
-		GLFW_Extensions = glfwGetRequiredInstanceExtensions(&GLFW_Extension_Count);
+	//NOTE : One Grid Written As OBJ Text And As GLB, Both Loaders Have To Produce The Same Corners
+	static void Model_Load(void) {
+		vector<Vertex> Vertices{};
+		vector<uint32_t> Indices{};
+		Benchmark::Make_Grid_Mesh(512, Vertices, Indices);
+		for (auto& Vertex : Vertices)
+			Vertex.Normal = glm::normalize(Vertex.Pos - glm::vec3{ 0.5f, 0.5f, -1.0f });
 
-		vector<const char*> Extensions{ GLFW_Extensions, GLFW_Extensions + GLFW_Extension_Count };
+		const std::filesystem::path Directory{ std::filesystem::temp_directory_path() };
+		const std::filesystem::path Obj_Path{ Directory / "model_load_benchmark.obj" };
+		const std::filesystem::path Glb_Path{ Directory / "model_load_benchmark.glb" };
 
-#ifdef _DEBUG
-		Extensions.emplace_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
-#endif // _DEBUG
+		Benchmark::Write_Obj_File(Obj_Path, Vertices, Indices);
 
-		return Extensions;
-	}
+		//NOTE : Attributes In Separate Tightly Packed Views, The Layout Exporters Usually Write
+		{
+			vector<uint8_t> Binary{};
+			const auto Append = [&Binary](const void* Data, size_t Size) {
+				const size_t Offset{ Binary.size() };
+				Binary.insert(Binary.end(), static_cast<const uint8_t*>(Data), static_cast<const uint8_t*>(Data) + Size);
+				Binary.resize((Binary.size() + 3) & ~size_t{ 3 });
+				return Offset;
+			};
 
-	static bool Check_Device_Extension_Support(VkPhysicalDevice Device) {
-		uint32_t Extension_Count;
-		THROW_IF_VK_FAILED(vkEnumerateDeviceExtensionProperties(Device, nullptr, &Extension_Count, nullptr));
-		vector<VkExtensionProperties> Available_Extensions;
-		Available_Extensions.resize(Extension_Count);
-		THROW_IF_VK_FAILED(vkEnumerateDeviceExtensionProperties(Device, nullptr, &Extension_Count, Available_Extensions.data()));
+			vector<glm::vec3> Positions{}, Normals{};
+			vector<glm::vec2> TexCoords{};
+			glm::vec3 Min{ numeric_limits<float>::max() }, Max{ numeric_limits<float>::lowest() };
+			for (const auto& Vertex : Vertices) {
+				Positions.push_back(Vertex.Pos);
+				Normals.push_back(Vertex.Normal);
+				TexCoords.push_back(Vertex.TexCoord);
+				Min = glm::min(Min, Vertex.Pos);
+				Max = glm::max(Max, Vertex.Pos);
+			}
 
-		unordered_set<string> Required_Extensions{ Device_EXT_SwapChain };
-		for (const auto& Available_Extension : Available_Extensions)
-			Required_Extensions.erase(Available_Extension.extensionName);
+			const size_t Offsets[]{
+				Append(Positions.data(), Positions.size() * sizeof(glm::vec3)),
+				Append(Normals.data(), Normals.size() * sizeof(glm::vec3)),
+				Append(TexCoords.data(), TexCoords.size() * sizeof(glm::vec2)),
+				Append(Indices.data(), Indices.size() * sizeof(uint32_t)),
+			};
+			const size_t Lengths[]{ Positions.size() * sizeof(glm::vec3), Normals.size() * sizeof(glm::vec3), TexCoords.size() * sizeof(glm::vec2), Indices.size() * sizeof(uint32_t) };
+
+			ostringstream Json{};
+			Json << "{\"asset\":{\"version\":\"2.0\"},\"scene\":0,\"scenes\":[{\"nodes\":[0]}],\"nodes\":[{\"mesh\":0}],"
+				<< "\"meshes\":[{\"primitives\":[{\"attributes\":{\"POSITION\":0,\"NORMAL\":1,\"TEXCOORD_0\":2},\"indices\":3}]}],"
+				<< "\"buffers\":[{\"byteLength\":" << Binary.size() << "}],\"bufferViews\":[";
+			for (size_t View = 0; View < 4; ++View)
+				Json << (0 == View ? "" : ",") << "{\"buffer\":0,\"byteOffset\":" << Offsets[View] << ",\"byteLength\":" << Lengths[View] << "}";
+			Json << "],\"accessors\":["
+				<< "{\"bufferView\":0,\"componentType\":5126,\"count\":" << Vertices.size() << ",\"type\":\"VEC3\",\"min\":[" << Min.x << "," << Min.y << "," << Min.z << "],\"max\":[" << Max.x << "," << Max.y << "," << Max.z << "]},"
+				<< "{\"bufferView\":1,\"componentType\":5126,\"count\":" << Vertices.size() << ",\"type\":\"VEC3\"},"
+				<< "{\"bufferView\":2,\"componentType\":5126,\"count\":" << Vertices.size() << ",\"type\":\"VEC2\"},"
+				<< "{\"bufferView\":3,\"componentType\":5125,\"count\":" << Indices.size() << ",\"type\":\"SCALAR\"}]}";
+
+			string Json_Chunk{ Json.str() };
+			Json_Chunk.resize((Json_Chunk.size() + 3) & ~size_t{ 3 }, ' ');
+
+			const uint32_t Header[]{
+				Glb_File::Magic, 2, static_cast<uint32_t>(12 + 8 + Json_Chunk.size() + 8 + Binary.size()),
+				static_cast<uint32_t>(Json_Chunk.size()), Glb_File::Json_Chunk,
+			};
+			const uint32_t Binary_Header[]{ static_cast<uint32_t>(Binary.size()), Glb_File::Binary_Chunk };
 
-		return Required_Extensions.empty();
-	}
+			ofstream File{ Glb_Path, ios::binary | ios::trunc };
+			File.write(reinterpret_cast<const char*>(Header), sizeof(Header));
+			File.write(Json_Chunk.data(), Json_Chunk.size());
+			File.write(reinterpret_cast<const char*>(Binary_Header), sizeof(Binary_Header));
+			File.write(reinterpret_cast<const char*>(Binary.data()), Binary.size());
+		}
 
-	static bool Is_Device_Suitable(VkPhysicalDevice Device) {
-		if (!VK_Application::Check_Device_Extension_Support(Device))
-			return false;
+		Vertex_Layout Layout{};
+		Layout.Attributes = Vertex_Attribute_Position | Vertex_Attribute_Color | Vertex_Attribute_TexCoord | Vertex_Attribute_Normal;
 
-		VkPhysicalDeviceProperties Device_Properties{};
-		vkGetPhysicalDeviceProperties(Device, &Device_Properties);
+		Model_Data Obj_Model{}, Glb_Model{};
+		const double Obj_Milliseconds{ Benchmark::Time_Milliseconds(2, [&](void) { Obj_Model = Obj_Loader::Load(Obj_Path, Layout); }) };
+		const double Glb_Milliseconds{ Benchmark::Time_Milliseconds(8, [&](void) { Glb_Model = Glb_Loader::Load(Glb_Path, Layout); }) };
 
-		VkPhysicalDeviceFeatures Device_Features{};
-		vkGetPhysicalDeviceFeatures(Device, &Device_Features);
+		const bool Matches{ Benchmark::Compare_Corners(Obj_Model, Glb_Model) };
 
-		//NOTE : Use This For Check Device Type
-		return
-			Device_Properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU &&
-			Device_Features.geometryShader;
+		cout << Vertices.size() << " vertices, " << Indices.size() / 3 << " triangles" << endl;
+		cout << "obj: " << std::filesystem::file_size(Obj_Path) / 1024 << " KiB, " << Obj_Milliseconds << " ms" << endl;
+		cout << "glb: " << std::filesystem::file_size(Glb_Path) / 1024 << " KiB, " << Glb_Milliseconds << " ms, " << Obj_Milliseconds / Glb_Milliseconds << "x obj, "
+			<< (Matches ? "same" : "different") << " corners" << endl;
+
+		std::error_code Error{};
+		std::filesystem::remove(Obj_Path, Error);
+		std::filesystem::remove(Glb_Path, Error);
 	}
 
-	static VkSampleCountFlagBits Get_Max_Usable_Sample_Count(const VkPhysicalDevice& Physical_Device) {
-		VkPhysicalDeviceProperties Physical_Device_Properties{};
-		vkGetPhysicalDeviceProperties(Physical_Device, &Physical_Device_Properties);
-		VkSampleCountFlags Counts{ Physical_Device_Properties.limits.framebufferColorSampleCounts & Physical_Device_Properties.limits.framebufferDepthSampleCounts };
+	//NOTE : tinyobjloader Against The Streaming Loader On The Same File, Plus The Float Parser Alone Against from_chars
+	static void Obj_Stream(void) {
+		vector<Vertex> Vertices{};
+		vector<uint32_t> Indices{};
+		Benchmark::Make_Grid_Mesh(512, Vertices, Indices);
+		for (auto& Vertex : Vertices)
+			Vertex.Normal = glm::normalize(Vertex.Pos - glm::vec3{ 0.5f, 0.5f, -1.0f });
+
+		const std::filesystem::path Obj_Path{ std::filesystem::temp_directory_path() / "obj_stream_benchmark.obj" };
+		Benchmark::Write_Obj_File(Obj_Path, Vertices, Indices);
+
+		Vertex_Layout Layout{};
+		Layout.Attributes = Vertex_Attribute_Position | Vertex_Attribute_Color | Vertex_Attribute_TexCoord | Vertex_Attribute_Normal;
+
+		Model_Data Reference_Model{}, Stream_Model{};
+		Obj_Stream_Statistics Statistics{};
+		const double Reference_Milliseconds{ Benchmark::Time_Milliseconds(2, [&](void) { Reference_Model = Obj_Loader::Load(Obj_Path, Layout); }) };
+		const double Stream_Milliseconds{ Benchmark::Time_Milliseconds(2, [&](void) { Stream_Model = Obj_Stream_Loader::Load(Obj_Path, Layout, &Statistics); }) };
+
+		const bool Same_Vertices{ Reference_Model.Vertices == Stream_Model.Vertices && Reference_Model.Indices == Stream_Model.Indices };
+		const size_t Output_Bytes{ Stream_Model.Vertices.size() * sizeof(Vertex) + Stream_Model.Indices.size() * sizeof(uint32_t) };
+
+		cout << Statistics.File_Bytes / 1024 << " KiB obj, " << Stream_Model.Vertices.size() << " vertices, " << Stream_Model.Indices.size() / 3 << " triangles, " << Output_Bytes / 1024 << " KiB model" << endl;
+		cout << "tinyobjloader: " << Reference_Milliseconds << " ms" << endl;
+		cout << "stream: " << Stream_Milliseconds << " ms, " << Reference_Milliseconds / Stream_Milliseconds << "x tinyobjloader, " << Statistics.File_Bytes / (Stream_Milliseconds * 1024.0) << " MiB/s, "
+			<< (Same_Vertices ? "identical" : (Benchmark::Compare_Corners(Reference_Model, Stream_Model) ? "equivalent" : "different")) << " output" << endl;
+		cout << "stream working set: " << Statistics.Chunk_Count << " chunks, " << Statistics.Text_Bytes / 1024 << " KiB text resident, " << Statistics.Attribute_Bytes / 1024 << " KiB attributes, "
+			<< Statistics.Table_Bytes / 1024 << " KiB dedup table" << endl;
+
+		std::error_code Error{};
+		std::filesystem::remove(Obj_Path, Error);
+
+		//NOTE : Mixed Lengths, Signs And Exponents As Exporters Write Them
+		uint32_t Seed{ 7 };
+		const auto Random = [&Seed](uint32_t Range) { Seed = Seed * 1664525u + 1013904223u; return (Seed >> 8) % Range; };
+
+		string Numbers{};
+		vector<float> Expected{};
+		char Number[64]{};
+		for (uint32_t Index = 0; Index < 1u << 20; ++Index) {
+			const float Value{ (static_cast<float>(Random(1u << 24)) / (1u << 23) - 1.0f) * std::pow(10.0f, static_cast<float>(Random(9)) - 4.0f) };
+			const int Length{ 0 == Index % 3 ? snprintf(Number, sizeof(Number), "%.9g ", Value) : (1 == Index % 3 ? snprintf(Number, sizeof(Number), "%f ", Value) : snprintf(Number, sizeof(Number), "%.6e ", Value)) };
+			Numbers.append(Number, static_cast<size_t>(Length));
+
+			float Parsed{ 0.0f };
+			std::from_chars(Number, Number + Length, Parsed);
+			Expected.push_back(Parsed);
+		}
 
-		if (0 != (Counts & VK_SAMPLE_COUNT_64_BIT)) return VK_SAMPLE_COUNT_64_BIT;
-		if (0 != (Counts & VK_SAMPLE_COUNT_32_BIT)) return VK_SAMPLE_COUNT_32_BIT;
-		if (0 != (Counts & VK_SAMPLE_COUNT_16_BIT)) return VK_SAMPLE_COUNT_16_BIT;
-		if (0 != (Counts & VK_SAMPLE_COUNT_8_BIT)) return VK_SAMPLE_COUNT_8_BIT;
-		if (0 != (Counts & VK_SAMPLE_COUNT_4_BIT)) return VK_SAMPLE_COUNT_4_BIT;
-		if (0 != (Counts & VK_SAMPLE_COUNT_2_BIT)) return VK_SAMPLE_COUNT_2_BIT;
-		return VK_SAMPLE_COUNT_1_BIT;
-	}
+		vector<float> Values(Expected.size());
+		const auto Parse_All = [&](auto&& Parse) {
+			const char* At{ Numbers.data() };
+			const char* const End{ Numbers.data() + Numbers.size() };
+			for (auto& Value : Values) {
+				Parse(At, End, Value);
+				++At;
+			}
+		};
 
-	static const VkSurfaceFormatKHR Choose_SwapChain_Surface_Format(const vector<VkSurfaceFormatKHR>& Available_Formats) {
-		for (const auto& Available_Format : Available_Formats)
-			if (VK_FORMAT_B8G8R8A8_SRGB == Available_Format.format && VK_COLOR_SPACE_SRGB_NONLINEAR_KHR == Available_Format.colorSpace)
-				return Available_Format;
+		const double From_Chars_Milliseconds{ Benchmark::Time_Milliseconds(4, [&](void) {
+			Parse_All([](const char*& At, const char* End, float& Value) { At = std::from_chars(At, End, Value).ptr; });
+		}) };
+		const double Tinyobj_Milliseconds{ Benchmark::Time_Milliseconds(4, [&](void) {
+			Parse_All([](const char*& At, const char* End, float& Value) {
+				const char* const Token_End{ static_cast<const char*>(memchr(At, ' ', static_cast<size_t>(End - At))) };
+				double Wide_Value{ 0.0 };
+				tinyobj::tryParseDouble(At, Token_End, &Wide_Value);
+				Value = static_cast<float>(Wide_Value);
+				At = Token_End;
+			});
+		}) };
+		const double Fast_Milliseconds{ Benchmark::Time_Milliseconds(4, [&](void) {
+			Parse_All([](const char*& At, const char* End, float& Value) { Obj_Stream_Loader::Parse_Float(At, End, Value); });
+		}) };
+
+		size_t Exact{ 0 }, Within_Ulp{ 0 };
+		for (size_t Index = 0; Index < Values.size(); ++Index) {
+			Exact += Values[Index] == Expected[Index] ? 1 : 0;
+			Within_Ulp += std::abs(Values[Index] - Expected[Index]) <= std::abs(Expected[Index]) * numeric_limits<float>::epsilon() ? 1 : 0;
+		}
 
-		//NOTE : Default Return First Format
-		return Available_Formats.front();
+		cout << "float parse " << Values.size() << " numbers, tinyobjloader: " << Tinyobj_Milliseconds << " ms, from_chars: " << From_Chars_Milliseconds << " ms, stream: " << Fast_Milliseconds << " ms, "
+			<< Tinyobj_Milliseconds / Fast_Milliseconds << "x tinyobjloader, " << From_Chars_Milliseconds / Fast_Milliseconds << "x from_chars, " << Exact << " exact, " << Within_Ulp << " within one ulp" << endl;
 	}
 
-	static const VkPresentModeKHR Choose_SwapChain_Present_Mode(const vector<VkPresentModeKHR>& Available_Present_Modes) {
-		for (const auto& Available_Present_Mode : Available_Present_Modes)
-			if (VK_PRESENT_MODE_MAILBOX_KHR == Available_Present_Mode)
-				return Available_Present_Mode;
+	//NOTE : Compression And Decode Speed On Meshes As Load_Model Leaves Them, Throughput Counts Decoded Bytes
+	static void Mesh_Codec_Throughput(void) {
+		const auto Run = [](const char* Name, const vector<Vertex>& Vertices, const vector<uint32_t>& Indices) {
+			const vector<uint8_t> Encoded_Vertices{ Mesh_Codec::Encode_Vertices(Vertices) };
+			const vector<uint8_t> Encoded_Indices{ Mesh_Codec::Encode_Indices(Indices) };
+			const size_t Vertex_Bytes{ Vertices.size() * sizeof(Vertex) };
+			const size_t Index_Bytes{ Indices.size() * sizeof(uint32_t) };
+
+			cout << Name << ": " << Vertices.size() << " vertices " << Vertex_Bytes / 1024 << " -> " << Encoded_Vertices.size() / 1024 << " KiB ("
+				<< static_cast<double>(Vertex_Bytes) / Encoded_Vertices.size() << "x), " << Indices.size() << " indices " << Index_Bytes / 1024 << " -> "
+				<< Encoded_Indices.size() / 1024 << " KiB (" << static_cast<double>(Index_Bytes) / Encoded_Indices.size() << "x)" << endl;
+
+			vector<uint32_t> Vertex_Words(Vertex_Bytes / sizeof(uint32_t));
+			vector<uint32_t> Index_Words(Indices.size());
+			const auto Report = [&](const char* Decoder, auto&& Decode) {
+				bool Decoded{ true };
+				const double Milliseconds{ Benchmark::Time_Milliseconds(16, [&](void) {
+					Decoded &= Decode(Encoded_Vertices.data(), Encoded_Vertices.size(), Vertex_Words.data(), Vertices.size(), sizeof(Vertex) / sizeof(uint32_t));
+					Decoded &= Decode(Encoded_Indices.data(), Encoded_Indices.size(), Index_Words.data(), Indices.size() / 3, size_t{ 3 });
+				}) };
+
+				const bool Lossless{ Decoded && Index_Words == Indices && 0 == memcmp(Vertex_Words.data(), Vertices.data(), Vertex_Bytes) };
+				cout << "  " << Decoder << ": " << Milliseconds << " ms, " << (Vertex_Bytes + Index_Bytes) / (Milliseconds * 1e6) << " GB/s, " << (Lossless ? "lossless" : "mismatch") << endl;
+				std::fill(Vertex_Words.begin(), Vertex_Words.end(), 0);
+				std::fill(Index_Words.begin(), Index_Words.end(), 0);
+			};
 
-		//NOTE : Default Return FIFO ,If Device Suppert Present Queue ,IT Must Support FIFO
-		return VK_PRESENT_MODE_FIFO_KHR;
-	}
+			const double Encode_Milliseconds{ Benchmark::Time_Milliseconds(4, [&](void) { Mesh_Codec::Encode_Vertices(Vertices); Mesh_Codec::Encode_Indices(Indices); }) };
+			cout << "  encode: " << Encode_Milliseconds << " ms" << endl;
+			Report("scalar decode", Mesh_Codec::Decode_Scalar);
+#if defined(SIMD_SSE_ENABLE)
+			Report("sse decode", Mesh_Codec::Decode_SSE);
+#endif
+		};
 
-	static void Frame_Buffer_Resize_CallBack(GLFWwindow* Window, int Width, int Height) {
-		auto App = reinterpret_cast<VK_Application*>(glfwGetWindowUserPointer(Window));
-		App->m_Frame_Buffer_Resized = true;
+		vector<Vertex> Vertices{};
+		vector<uint32_t> Indices{};
+
+		Benchmark::Make_Grid_Mesh(1024, Vertices, Indices);
+		Run("grid", Vertices, Indices);
+
+		//NOTE : With Normals Every Word Of The Vertex Carries Data
+		Benchmark::Make_Sphere_Mesh(512, 1024, Vertices, Indices);
+		for (auto& Vertex : Vertices)
+			Vertex.Normal = Vertex.Pos;
+		Run("sphere", Vertices, Indices);
 	}
 
-private:
-	unique_ptr<GLFWwindow, decltype(&glfwDestroyWindow)> m_Window{ nullptr, glfwDestroyWindow };
+	//NOTE : Same Mesh Drawn Through The Input Assembler And Through The Pulling Shader, Per Layout, Timed On The GPU
+	static void Vertex_Pulling(void) {
+		vector<Vertex_Layout> Layouts(3);
+		{
+			Layouts[1].Attributes = Vertex_Attribute_Position | Vertex_Attribute_TexCoord;
+			Layouts[1].Quantized = true;
+			Layouts[2].Attributes = Vertex_Attribute_Position | Vertex_Attribute_TexCoord | Vertex_Attribute_Normal;
+			Layouts[2].Quantized = true;
+		}
 
-	static constexpr auto Delete_VK_Instance = [](VkInstance Instance) {if (nullptr != Instance)vkDestroyInstance(Instance, nullptr); };
-	unique_ptr<VkInstance_T, decltype(Delete_VK_Instance)> m_VK_Instance{ nullptr ,Delete_VK_Instance };
+		//NOTE : Fixed Function Fetch Needs One Pipeline Per Layout, Pulling Needs One For All Of Them
+		for (const auto& Layout : Layouts) {
+			const Vertex_Pull_Constants Constants{ Layout.Get_Pull_Constants() };
+			cout << "layout " << Layout.Attributes << (Layout.Quantized ? " quantized" : "") << ": stride " << Layout.Get_Stride() << " bytes, "
+				<< Layout.Get_Attribute_Descriptions().size() << " input attributes or " << sizeof(Constants) << " bytes of push constants" << endl;
+		}
+		cout << "pipelines for " << Layouts.size() << " layouts: " << Layouts.size() << " with fixed function fetch, 1 with pulling" << endl;
 
-	unique_ptr<VkSurfaceKHR_T, function<void(VkSurfaceKHR)>> m_Surface{ nullptr };
+		if (!std::filesystem::exists(std::filesystem::path(Pull_Vertex_Shader_File_Path, std::filesystem::path::generic_format)) ||
+			!std::filesystem::exists(std::filesystem::path(Fragment_Shader_File_Path, std::filesystem::path::generic_format))) {
+			cout << "skipped draw timing, " << Pull_Vertex_Shader_File_Path << " has not been compiled" << endl;
+			return;
+		}
 
-	VkPhysicalDevice m_Physical_Device{ nullptr };
-	VkSampleCountFlagBits m_Msaa_Samples{ VK_SAMPLE_COUNT_1_BIT };
+		Headless_Context Context{};
+		if (!Context.Create()) {
+			cout << "skipped draw timing, no Vulkan 1.2 device with timestamps" << endl;
+			return;
+		}
 
-	static constexpr auto Delete_VK_Device = [](VkDevice Device) {if (nullptr != Device)vkDestroyDevice(Device, nullptr); };
-	unique_ptr<VkDevice_T, decltype(Delete_VK_Device)> m_Logical_Device{ nullptr, Delete_VK_Device };
+		uint32_t Queue_Family_Count{ 0 };
+		vkGetPhysicalDeviceQueueFamilyProperties(Context.Physical_Device, &Queue_Family_Count, nullptr);
+		vector<VkQueueFamilyProperties> Queue_Families(Queue_Family_Count);
+		vkGetPhysicalDeviceQueueFamilyProperties(Context.Physical_Device, &Queue_Family_Count, Queue_Families.data());
 
-	Queue_Family_Indices m_Queue_Family_Indices{};
+		VkPhysicalDeviceProperties Device_Properties{};
+		vkGetPhysicalDeviceProperties(Context.Physical_Device, &Device_Properties);
+		const VkSampleCountFlags Sample_Counts{ Device_Properties.limits.framebufferColorSampleCounts & Device_Properties.limits.framebufferDepthSampleCounts };
 
-	VkQueue m_Graphics_Queue{ nullptr };
-	VkQueue m_Present_Queue{ nullptr };
+		if (0 == (Queue_Families[Context.Queue_Family].queueFlags & VK_QUEUE_GRAPHICS_BIT) || 0 == (Sample_Counts & VK_SAMPLE_COUNT_4_BIT)) {
+			cout << "skipped draw timing, no graphics queue with 4x MSAA" << endl;
+			return;
+		}
 
-	unique_ptr<VkSwapchainKHR_T, function<void(VkSwapchainKHR)>> m_Swap_Chain{ nullptr };
+		constexpr VkExtent2D Extent{ 256, 256 };
+		constexpr VkFormat Color_Format{ VK_FORMAT_B8G8R8A8_UNORM };
+		constexpr VkFormat Depth_Format{ VK_FORMAT_D32_SFLOAT };
+		constexpr VkSampleCountFlagBits Samples{ VK_SAMPLE_COUNT_4_BIT };
+		constexpr uint32_t Draw_Count{ 8 };
+		constexpr uint32_t Frame_Count{ 8 };
+
+		vector<Vertex> Vertices{};
+		vector<uint32_t> Indices{};
+		Benchmark::Make_Grid_Mesh(512, Vertices, Indices);
+
+		Mesh_Bounds Bounds{};
+		for (const auto& Vertex : Vertices)
+			Bounds.Expand(Vertex.Pos);
+
+		const VkRenderPass Render_Pass{ Scene_Pass::Build_Render_Pass(Context.Device, Color_Format, Depth_Format, Samples, Render_Pass_Complete) };
+		array<VkImageView, 3> Attachments{
+			Context.Create_Attachment(Extent, Color_Format, Samples, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, VK_IMAGE_ASPECT_COLOR_BIT),
+			Context.Create_Attachment(Extent, Depth_Format, Samples, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_IMAGE_ASPECT_DEPTH_BIT),
+			Context.Create_Attachment(Extent, Color_Format, VK_SAMPLE_COUNT_1_BIT, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, VK_IMAGE_ASPECT_COLOR_BIT),
+		};
 
-	Swap_Chain_Support_Details m_Swap_Chain_Support_Details{};
+		VkFramebufferCreateInfo Framebuffer_Info{};
+		{
+			Framebuffer_Info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+			Framebuffer_Info.renderPass = Render_Pass;
+			Framebuffer_Info.attachmentCount = static_cast<uint32_t>(Attachments.size());
+			Framebuffer_Info.pAttachments = Attachments.data();
+			Framebuffer_Info.width = Extent.width;
+			Framebuffer_Info.height = Extent.height;
+			Framebuffer_Info.layers = 1;
+		}
+		VkFramebuffer Framebuffer{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateFramebuffer(Context.Device, &Framebuffer_Info, nullptr, &Framebuffer));
 
-	vector<VkImage> m_Swap_Chain_Images{};
-	VkFormat m_Swap_Chain_Image_Format{};
-	VkExtent2D m_Swap_Chain_Extent{};
+		//NOTE : Texture Contents Do Not Matter, The Fragment Shader Only Needs Something Valid To Sample
+		const VkImageView Texture_View{ Context.Create_Attachment(VkExtent2D{ 1, 1 }, VK_FORMAT_R8G8B8A8_UNORM, VK_SAMPLE_COUNT_1_BIT, VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_ASPECT_COLOR_BIT) };
+		const VkImage Texture_Image{ get<0>(Context.Images.back()) };
 
-	vector<unique_ptr<VkImageView_T, function<void(VkImageView)>>> m_Swap_Chain_Image_Views{};
+		VkSamplerCreateInfo Sampler_Info{};
+		{
+			Sampler_Info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+			Sampler_Info.magFilter = VK_FILTER_NEAREST;
+			Sampler_Info.minFilter = VK_FILTER_NEAREST;
+			Sampler_Info.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+			Sampler_Info.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+			Sampler_Info.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+			Sampler_Info.maxLod = 0.0f;
+		}
+		VkSampler Sampler{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateSampler(Context.Device, &Sampler_Info, nullptr, &Sampler));
 
-	unique_ptr<VkRenderPass_T, function<void(VkRenderPass)>> m_Render_Pass{ nullptr };
+		VkCommandPoolCreateInfo Command_Pool_Info{};
+		{
+			Command_Pool_Info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+			Command_Pool_Info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+			Command_Pool_Info.queueFamilyIndex = Context.Queue_Family;
+		}
+		VkCommandPool Command_Pool{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateCommandPool(Context.Device, &Command_Pool_Info, nullptr, &Command_Pool));
 
-	unique_ptr<VkDescriptorSetLayout_T, function<void(VkDescriptorSetLayout)>> m_Descriptor_Set_Layout{ nullptr };
+		VkCommandBufferAllocateInfo Command_Buffer_Info{};
+		{
+			Command_Buffer_Info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			Command_Buffer_Info.commandPool = Command_Pool;
+			Command_Buffer_Info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+			Command_Buffer_Info.commandBufferCount = 1;
+		}
+		VkCommandBuffer Command_Buffer{ nullptr };
+		THROW_IF_VK_FAILED(vkAllocateCommandBuffers(Context.Device, &Command_Buffer_Info, &Command_Buffer));
 
-	unique_ptr<VkPipelineLayout_T, function<void(VkPipelineLayout)>> m_Pipeline_Layout{ nullptr };
+		VkFenceCreateInfo Fence_Info{};
+		{
+			Fence_Info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		}
+		VkFence Fence{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateFence(Context.Device, &Fence_Info, nullptr, &Fence));
 
-	unique_ptr<VkPipeline_T, function<void(VkPipeline)>> m_Graphics_Pipeline{ nullptr };
+		VkQueryPoolCreateInfo Query_Pool_Info{};
+		{
+			Query_Pool_Info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+			Query_Pool_Info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+			Query_Pool_Info.queryCount = 2;
+		}
+		VkQueryPool Query_Pool{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateQueryPool(Context.Device, &Query_Pool_Info, nullptr, &Query_Pool));
 
-	vector<unique_ptr<VkFramebuffer_T, function<void(VkFramebuffer)>>> m_Swap_Chain_Frame_buffers{};
+		const auto Submit = [&](const auto& Record) {
+			THROW_IF_VK_FAILED(vkResetCommandBuffer(Command_Buffer, 0));
+			VkCommandBufferBeginInfo Begin_Info{};
+			{
+				Begin_Info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+				Begin_Info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+			}
+			THROW_IF_VK_FAILED(vkBeginCommandBuffer(Command_Buffer, &Begin_Info));
+			Record();
+			THROW_IF_VK_FAILED(vkEndCommandBuffer(Command_Buffer));
 
-	unique_ptr<VkCommandPool_T, function<void(VkCommandPool)>> m_Command_Pool{ nullptr };
+			VkSubmitInfo Submit_Info{};
+			{
+				Submit_Info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+				Submit_Info.commandBufferCount = 1;
+				Submit_Info.pCommandBuffers = &Command_Buffer;
+			}
+			THROW_IF_VK_FAILED(vkQueueSubmit(Context.Queue, 1, &Submit_Info, Fence));
+			THROW_IF_VK_FAILED(vkWaitForFences(Context.Device, 1, &Fence, VK_TRUE, numeric_limits<uint64_t>::max()));
+			THROW_IF_VK_FAILED(vkResetFences(Context.Device, 1, &Fence));
+		};
 
-	unique_ptr<VkImage_T, function<void(VkImage)>> m_Color_Image{ nullptr };
-	unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> m_Color_Image_Memory{ nullptr };
-	unique_ptr<VkImageView_T, function<void(VkImageView)>> m_Color_Image_View{ nullptr };
+		Submit([&](void) {
+			VkImageMemoryBarrier Texture_Barrier{};
+			{
+				Texture_Barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+				Texture_Barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+				Texture_Barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+				Texture_Barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+				Texture_Barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+				Texture_Barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+				Texture_Barrier.image = Texture_Image;
+				Texture_Barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+			}
+			vkCmdPipelineBarrier(Command_Buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &Texture_Barrier);
+		});
+
+		const VkPipelineLayout Pipeline_Layout{ Context.Create_Scene_Pipeline_Layout() };
+		const VkDescriptorSetLayout Set_Layout{ Context.Pipeline_Layouts.back().first };
+
+		const array<VkDescriptorPoolSize, 3> Pool_Sizes{ {
+			{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1 },
+			{ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1 },
+			{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1 },
+		} };
+		VkDescriptorPoolCreateInfo Descriptor_Pool_Info{};
+		{
+			Descriptor_Pool_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+			Descriptor_Pool_Info.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+			Descriptor_Pool_Info.maxSets = 1;
+			Descriptor_Pool_Info.poolSizeCount = static_cast<uint32_t>(Pool_Sizes.size());
+			Descriptor_Pool_Info.pPoolSizes = Pool_Sizes.data();
+		}
+		VkDescriptorPool Descriptor_Pool{ nullptr };
+		THROW_IF_VK_FAILED(vkCreateDescriptorPool(Context.Device, &Descriptor_Pool_Info, nullptr, &Descriptor_Pool));
 
-	unique_ptr<VkImage_T, function<void(VkImage)>> m_Depth_Image{ nullptr };
-	unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> m_Depth_Image_Memory{ nullptr };
-	unique_ptr<VkImageView_T, function<void(VkImageView)>> m_Depth_Image_View{ nullptr };
+		VkBuffer Index_Buffer{ nullptr };
+		memcpy(Context.Create_Buffer(sizeof(uint32_t) * Indices.size(), VK_BUFFER_USAGE_INDEX_BUFFER_BIT, Index_Buffer), Indices.data(), sizeof(uint32_t) * Indices.size());
 
-	uint32_t m_Mip_Levels{ numeric_limits<uint32_t>::max() };
-	unique_ptr<VkImage_T, function<void(VkImage)>> m_Texture_Image{ nullptr };
-	unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> m_Texture_Image_Memory{ nullptr };
-	unique_ptr<VkImageView_T, function<void(VkImageView)>> m_Texture_Image_View{ nullptr };
-	unique_ptr<VkSampler_T, function<void(VkSampler)>> m_Texture_Sampler{ nullptr };
+		//NOTE : The Grid Spans [0,1] In X And Y, Flattened Onto The Middle Of The Depth Range
+		const glm::mat4 Proj{ glm::scale(glm::translate(glm::mat4{ 1.0f }, glm::vec3{ -1.0f, -1.0f, 0.5f }), glm::vec3{ 2.0f, 2.0f, 0.0f }) };
 
-	vector<unique_ptr<VkBuffer_T, function<void(VkBuffer)>>> m_Uniform_Buffers{};
-	vector<unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>>> m_Uniform_Buffers_Memory{};
-	vector<void*> Uniform_Buffers_Mapped{};
+		cout << Context.Device_Name << ", " << Vertices.size() << " vertices, " << Indices.size() / 3 << " triangles x " << Draw_Count << " draws" << endl;
 
-	unique_ptr<VkDescriptorPool_T, function<void(VkDescriptorPool)>> m_Descriptor_Pool{ nullptr };
-	vector<VkDescriptorSet> m_Descriptor_Sets{};
+		for (const auto& Layout : Layouts) {
+			if (!std::filesystem::exists(std::filesystem::path(Layout.Get_Vertex_Shader_File_Path(), std::filesystem::path::generic_format))) {
+				cout << "layout " << Layout.Attributes << ": skipped, " << Layout.Get_Vertex_Shader_File_Path() << " has not been compiled" << endl;
+				continue;
+			}
 
-	unique_ptr<VkBuffer_T, function<void(VkBuffer)>> m_Vertex_Buffer{ nullptr };
-	unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> m_Vertex_Buffer_Memory{ nullptr };
-	std::vector<Vertex> m_Vertices{};
+			vector<uint8_t> Encoded{};
+			Layout.Encode(Vertices, Bounds, Encoded);
+			VkBuffer Vertex_Buffer{ nullptr };
+			memcpy(Context.Create_Buffer(Encoded.size(), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, Vertex_Buffer), Encoded.data(), Encoded.size());
 
-	unique_ptr<VkBuffer_T, function<void(VkBuffer)>> m_Index_Buffer{ nullptr };
-	unique_ptr<VkDeviceMemory_T, function<void(VkDeviceMemory)>> m_Index_Buffer_Memory{ nullptr };
-	vector<uint32_t> m_Indices{};
+			Uniform_Buffer_Object Ubo{};
+			{
+				Ubo.Model = Layout.Get_Position_Dequantize(Bounds);
+				Ubo.View = glm::mat4{ 1.0f };
+				Ubo.Proj = Proj;
+			}
+			VkBuffer Uniform_Buffer{ nullptr };
+			memcpy(Context.Create_Buffer(sizeof(Ubo), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, Uniform_Buffer), &Ubo, sizeof(Ubo));
 
-	vector<VkCommandBuffer> m_Command_Buffers{};
+			VkDescriptorSetAllocateInfo Set_Info{};
+			{
+				Set_Info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+				Set_Info.descriptorPool = Descriptor_Pool;
+				Set_Info.descriptorSetCount = 1;
+				Set_Info.pSetLayouts = &Set_Layout;
+			}
+			VkDescriptorSet Descriptor_Set{ nullptr };
+			THROW_IF_VK_FAILED(vkAllocateDescriptorSets(Context.Device, &Set_Info, &Descriptor_Set));
 
-	vector<unique_ptr<VkSemaphore_T, function<void(VkSemaphore)>>> m_Image_Available_Semaphores{};
-	vector<unique_ptr<VkSemaphore_T, function<void(VkSemaphore)>>> m_Render_Finished_Semaphores{};
+			const VkDescriptorBufferInfo Uniform_Info{ Uniform_Buffer, 0, sizeof(Ubo) };
+			const VkDescriptorImageInfo Texture_Info{ Sampler, Texture_View, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
+			const VkDescriptorBufferInfo Vertex_Info{ Vertex_Buffer, 0, VK_WHOLE_SIZE };
+			array<VkWriteDescriptorSet, 3> Writes{};
+			{
+				Writes[0] = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, nullptr, Descriptor_Set, 0, 0, 1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, nullptr, &Uniform_Info, nullptr };
+				Writes[1] = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, nullptr, Descriptor_Set, 1, 0, 1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, &Texture_Info, nullptr, nullptr };
+				Writes[2] = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, nullptr, Descriptor_Set, 3, 0, 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, nullptr, &Vertex_Info, nullptr };
+			}
+			vkUpdateDescriptorSets(Context.Device, static_cast<uint32_t>(Writes.size()), Writes.data(), 0, nullptr);
+
+			for (const bool Pulling : { false, true }) {
+				Graphics_Pipeline_Desc Desc{};
+				{
+					Desc.Vertex_Shader = Context.Load_Shader(Pulling ? Pull_Vertex_Shader_File_Path : Layout.Get_Vertex_Shader_File_Path());
+					Desc.Fragment_Shader = Context.Load_Shader(Fragment_Shader_File_Path);
+					Desc.Layout = Pipeline_Layout;
+					Desc.Vertices = Layout;
+					Desc.Vertex_Pulling = Pulling;
+					Desc.Samples = Samples;
+					Desc.Color_Format = Color_Format;
+					Desc.Depth_Format = Depth_Format;
+					Desc.Render_Pass = Render_Pass;
+				}
+				const VkPipeline Pipeline{ Graphics_Pipeline_Builder{ Desc }.Create(Context.Device, VK_NULL_HANDLE) };
+
+				double Gpu_Milliseconds{ 0.0 };
+				for (uint32_t Frame = 0; Frame < Frame_Count; ++Frame) {
+					Submit([&](void) {
+						vkCmdResetQueryPool(Command_Buffer, Query_Pool, 0, 2);
+
+						VkRenderPassBeginInfo Render_Pass_Begin_Info{};
+						{
+							Render_Pass_Begin_Info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+							Render_Pass_Begin_Info.renderPass = Render_Pass;
+							Render_Pass_Begin_Info.framebuffer = Framebuffer;
+							Render_Pass_Begin_Info.renderArea = { { 0, 0 }, Extent };
+						}
+						vkCmdBeginRenderPass(Command_Buffer, &Render_Pass_Begin_Info, VK_SUBPASS_CONTENTS_INLINE);
+
+						const VkViewport Viewport{ 0.0f, 0.0f, static_cast<float>(Extent.width), static_cast<float>(Extent.height), 0.0f, 1.0f };
+						const VkRect2D Scissor{ { 0, 0 }, Extent };
+						vkCmdSetViewport(Command_Buffer, 0, 1, &Viewport);
+						vkCmdSetScissor(Command_Buffer, 0, 1, &Scissor);
+
+						vkCmdBindPipeline(Command_Buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, Pipeline);
+						vkCmdBindDescriptorSets(Command_Buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, Pipeline_Layout, 0, 1, &Descriptor_Set, 0, nullptr);
+						if (Pulling) {
+							const Vertex_Pull_Constants Constants{ Layout.Get_Pull_Constants() };
+							vkCmdPushConstants(Command_Buffer, Pipeline_Layout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(Constants), &Constants);
+						}
+						else {
+							const VkDeviceSize Offset{ 0 };
+							vkCmdBindVertexBuffers(Command_Buffer, 0, 1, &Vertex_Buffer, &Offset);
+						}
+						vkCmdBindIndexBuffer(Command_Buffer, Index_Buffer, 0, VK_INDEX_TYPE_UINT32);
+
+						vkCmdWriteTimestamp(Command_Buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, Query_Pool, 0);
+						for (uint32_t Draw = 0; Draw < Draw_Count; ++Draw)
+							vkCmdDrawIndexed(Command_Buffer, static_cast<uint32_t>(Indices.size()), 1, 0, 0, 0);
+						vkCmdWriteTimestamp(Command_Buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, Query_Pool, 1);
+
+						vkCmdEndRenderPass(Command_Buffer);
+					});
+
+					array<uint64_t, 2> Timestamps{};
+					THROW_IF_VK_FAILED(vkGetQueryPoolResults(Context.Device, Query_Pool, 0, 2, sizeof(Timestamps), Timestamps.data(), sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT));
+					Gpu_Milliseconds += static_cast<double>(Timestamps[1] - Timestamps[0]) * Context.Timestamp_Period / 1.0e6;
+				}
 
-	vector<unique_ptr<VkFence_T, function<void(VkFence)>>> m_InFlight_Fences{};
+				cout << "layout " << Layout.Attributes << (Layout.Quantized ? " quantized" : "") << ", " << (Pulling ? "pulled" : "fixed function") << ": "
+					<< Gpu_Milliseconds / Frame_Count << " ms per frame" << endl;
 
-	uint32_t m_Current_Frame{ 0 };
+				vkDestroyPipeline(Context.Device, Pipeline, nullptr);
+			}
 
-	bool m_Frame_Buffer_Resized{ false };
+			THROW_IF_VK_FAILED(vkFreeDescriptorSets(Context.Device, Descriptor_Pool, 1, &Descriptor_Set));
+		}
 
+		vkDestroyDescriptorPool(Context.Device, Descriptor_Pool, nullptr);
+		vkDestroyQueryPool(Context.Device, Query_Pool, nullptr);
+		vkDestroyFence(Context.Device, Fence, nullptr);
+		vkDestroyCommandPool(Context.Device, Command_Pool, nullptr);
+		vkDestroySampler(Context.Device, Sampler, nullptr);
+		vkDestroyFramebuffer(Context.Device, Framebuffer, nullptr);
+		vkDestroyRenderPass(Context.Device, Render_Pass, nullptr);
+	}
 };
 
-int main() {
+int main(int argc, char* argv[]) {
 
 	try {
+		if (1 < argc && string{ "--benchmark" } == argv[1]) {
+			Benchmark::Run(2 < argc ? argv[2] : "");
+			return EXIT_SUCCESS;
+		}
+
 		VK_Application App{};
 
 #ifdef _DEBUG
@@ -1,12 +1,26 @@
 #version 450
 
-layout(binding = 1) uniform sampler2D texSampler;
+// Built twice: fshader.spv indexes the texture array with a dynamically uniform slot, which holds per draw,
+// fshader_nonuniform.spv with -DNONUNIFORM for meshlet.mesh, whose workgroups mix clusters of different materials
+#ifdef NONUNIFORM
+#extension GL_EXT_nonuniform_qualifier : require
+#endif
+
+// Set to the texture slot count the device allows when the pipeline is built, unused slots repeat slot 0
+layout(constant_id = 0) const uint TEXTURE_COUNT = 1;
+
+layout(binding = 1) uniform sampler2D texSamplers[TEXTURE_COUNT];
 
 layout(location = 0) in vec3 fragColor;
 layout(location = 1) in vec2 fragTexCoord;
+layout(location = 3) flat in uint fragTexture;
 
 layout(location = 0) out vec4 outColor;
 
 void main() {
-    outColor = texture(texSampler, fragTexCoord);
+#ifdef NONUNIFORM
+    outColor = texture(texSamplers[nonuniformEXT(fragTexture)], fragTexCoord);
+#else
+    outColor = texture(texSamplers[fragTexture], fragTexCoord);
+#endif
 }
@@ -0,0 +1,34 @@
+// Shared by vshader_pull.vert and meshlet.mesh, the vertex buffer is bound as a storage buffer and every layout is decoded here
+layout(std430, binding = 3) readonly buffer Vertices {
+    uint words[];
+};
+
+// Matches Vertex_Pull_Constants, stride and offsets are in 32 bit words, a missing attribute has offset ABSENT
+layout(push_constant) uniform VertexLayout {
+    uint stride;
+    uint positionOffset;
+    uint colorOffset;
+    uint texCoordOffset;
+    uint quantized;
+} vertexLayout;
+
+const uint ABSENT = 0xFFFFFFFFu;
+
+// Quantized position is R16G16B16A16_UNORM relative to the mesh AABB, ubo.model already holds the dequantize transform
+vec3 fetchPosition(uint word) {
+    if (vertexLayout.quantized != 0u)
+        return vec3(unpackUnorm2x16(words[word]), unpackUnorm2x16(words[word + 1u]).x);
+    return uintBitsToFloat(uvec3(words[word], words[word + 1u], words[word + 2u]));
+}
+
+vec3 fetchColor(uint word) {
+    if (vertexLayout.quantized != 0u)
+        return unpackUnorm4x8(words[word]).rgb;
+    return uintBitsToFloat(uvec3(words[word], words[word + 1u], words[word + 2u]));
+}
+
+vec2 fetchTexCoord(uint word) {
+    if (vertexLayout.quantized != 0u)
+        return unpackHalf2x16(words[word]);
+    return uintBitsToFloat(uvec2(words[word], words[word + 1u]));
+}
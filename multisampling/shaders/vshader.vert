@@ -12,9 +12,12 @@ layout(location = 2) in vec2 inTexCoord;
 
 layout(location = 0) out vec3 fragColor;
 layout(location = 1) out vec2 fragTexCoord;
+layout(location = 3) flat out uint fragTexture;
 
 void main() {
     gl_Position = ubo.proj * ubo.view * ubo.model * vec4(inPosition, 1.0);
     fragColor = inColor;
     fragTexCoord = inTexCoord;
+    // The texture slot rides above the instance index in firstInstance
+    fragTexture = uint(gl_InstanceIndex) >> 20;
 }
@@ -0,0 +1,23 @@
+#version 450
+
+layout(binding = 0) uniform UniformBufferObject {
+    mat4 model;
+    mat4 view;
+    mat4 proj;
+} ubo;
+
+// Position arrives as UNORM relative to the mesh AABB, ubo.model already holds the dequantize transform
+layout(location = 0) in vec3 inPosition;
+layout(location = 2) in vec2 inTexCoord;
+
+layout(location = 0) out vec3 fragColor;
+layout(location = 1) out vec2 fragTexCoord;
+layout(location = 3) flat out uint fragTexture;
+
+void main() {
+    gl_Position = ubo.proj * ubo.view * ubo.model * vec4(inPosition, 1.0);
+    fragColor = vec3(1.0);
+    fragTexCoord = inTexCoord;
+    // The texture slot rides above the instance index in firstInstance
+    fragTexture = uint(gl_InstanceIndex) >> 20;
+}
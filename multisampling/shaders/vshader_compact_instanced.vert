@@ -0,0 +1,35 @@
+#version 450
+
+// ubo.model holds the scene transform only, each instance carries its placement and the dequantize transform
+layout(binding = 0) uniform UniformBufferObject {
+    mat4 model;
+    mat4 view;
+    mat4 proj;
+} ubo;
+
+struct Instance {
+    mat4 model;
+    vec4 sphere;
+};
+
+layout(std430, binding = 2) readonly buffer Instances {
+    Instance instances[];
+};
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 2) in vec2 inTexCoord;
+
+layout(location = 0) out vec3 fragColor;
+layout(location = 1) out vec2 fragTexCoord;
+layout(location = 3) flat out uint fragTexture;
+
+// Matches Draw_Instance, firstInstance carries the texture slot above the instance index
+const uint INSTANCE_BITS = 20;
+
+void main() {
+    uint instanceIndex = uint(gl_InstanceIndex) & ((1u << INSTANCE_BITS) - 1u);
+    gl_Position = ubo.proj * ubo.view * ubo.model * instances[instanceIndex].model * vec4(inPosition, 1.0);
+    fragColor = vec3(1.0);
+    fragTexCoord = inTexCoord;
+    fragTexture = uint(gl_InstanceIndex) >> INSTANCE_BITS;
+}
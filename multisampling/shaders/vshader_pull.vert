@@ -0,0 +1,45 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+
+// Built twice: vshader_pull.spv for direct draws, vshader_pull_instanced.spv with -DINSTANCED for per instance transforms
+// There is no vertex input state, the vertex buffer is bound as a storage buffer and vertex_pull.glsl decodes every layout,
+// so one pipeline draws meshes of any Vertex_Layout. gl_VertexIndex already includes the draw's vertexOffset
+layout(binding = 0) uniform UniformBufferObject {
+    mat4 model;
+    mat4 view;
+    mat4 proj;
+} ubo;
+
+#ifdef INSTANCED
+struct Instance {
+    mat4 model;
+    vec4 sphere;
+};
+
+layout(std430, binding = 2) readonly buffer Instances {
+    Instance instances[];
+};
+#endif
+
+#include "vertex_pull.glsl"
+
+layout(location = 0) out vec3 fragColor;
+layout(location = 1) out vec2 fragTexCoord;
+layout(location = 3) flat out uint fragTexture;
+
+// Matches Draw_Instance, firstInstance carries the texture slot above the instance index
+const uint INSTANCE_BITS = 20;
+
+void main() {
+    uint base = uint(gl_VertexIndex) * vertexLayout.stride;
+
+    vec4 position = vec4(fetchPosition(base + vertexLayout.positionOffset), 1.0);
+#ifdef INSTANCED
+    position = instances[uint(gl_InstanceIndex) & ((1u << INSTANCE_BITS) - 1u)].model * position;
+#endif
+
+    gl_Position = ubo.proj * ubo.view * ubo.model * position;
+    fragColor = vertexLayout.colorOffset == ABSENT ? vec3(1.0) : fetchColor(base + vertexLayout.colorOffset);
+    fragTexCoord = vertexLayout.texCoordOffset == ABSENT ? vec2(0.0) : fetchTexCoord(base + vertexLayout.texCoordOffset);
+    fragTexture = uint(gl_InstanceIndex) >> INSTANCE_BITS;
+}